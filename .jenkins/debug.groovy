@@ -16,7 +16,7 @@ def runCI =
 
     def prj = new rocProject('rocBLAS', 'Debug')
     // customize for project
-    prj.paths.build_command = './install.sh -c -g'
+    prj.paths.build_command = './install.sh -c -g --api-ranges'
     prj.defaults.ccache = true
 
     // Define test architectures, optional rocm version argument is available
@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 #define ROCBLAS_BETA_FEATURES_API
+#include "client_memory_pool.hpp"
 #include "program_options.hpp"
 
 #include "rocblas.hpp"
@@ -32,14 +33,18 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <map>
 #include <stdexcept>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <vector>
 
 // aux
+#include "testing_convert_host.hpp"
 #include "testing_set_get_matrix.hpp"
 #include "testing_set_get_matrix_async.hpp"
 #include "testing_set_get_vector.hpp"
@@ -49,6 +54,7 @@
 #include "testing_asum_batched.hpp"
 #include "testing_asum_strided_batched.hpp"
 #include "testing_axpy.hpp"
+#include "testing_axpy_dot.hpp"
 #include "testing_axpy_batched.hpp"
 #include "testing_axpy_batched_ex.hpp"
 #include "testing_axpy_ex.hpp"
@@ -66,10 +72,13 @@
 #include "testing_iamax_iamin.hpp"
 #include "testing_iamax_iamin_batched.hpp"
 #include "testing_iamax_iamin_strided_batched.hpp"
+#include "testing_multi_axpy.hpp"
+#include "testing_multi_dot.hpp"
 #include "testing_nrm2.hpp"
 #include "testing_nrm2_batched.hpp"
 #include "testing_nrm2_batched_ex.hpp"
 #include "testing_nrm2_ex.hpp"
+#include "testing_nrm2_scal.hpp"
 #include "testing_nrm2_strided_batched.hpp"
 #include "testing_nrm2_strided_batched_ex.hpp"
 #include "testing_rot.hpp"
@@ -93,6 +102,7 @@
 #include "testing_scal_ex.hpp"
 #include "testing_scal_strided_batched.hpp"
 #include "testing_scal_strided_batched_ex.hpp"
+#include "testing_scalar_op.hpp"
 #include "testing_swap.hpp"
 #include "testing_swap_batched.hpp"
 #include "testing_swap_strided_batched.hpp"
@@ -105,6 +115,9 @@
 #include "testing_gemv_strided_batched.hpp"
 #include "testing_ger.hpp"
 #include "testing_ger_batched.hpp"
+#include "testing_ger_k.hpp"
+#include "testing_ger_k_batched.hpp"
+#include "testing_ger_k_strided_batched.hpp"
 #include "testing_ger_strided_batched.hpp"
 #include "testing_hbmv.hpp"
 #include "testing_hbmv_batched.hpp"
@@ -147,6 +160,9 @@
 #include "testing_syr2_batched.hpp"
 #include "testing_syr2_strided_batched.hpp"
 #include "testing_syr_batched.hpp"
+#include "testing_syr_k.hpp"
+#include "testing_syr_k_batched.hpp"
+#include "testing_syr_k_strided_batched.hpp"
 #include "testing_syr_strided_batched.hpp"
 #include "testing_tbmv.hpp"
 #include "testing_tbmv_batched.hpp"
@@ -172,8 +188,10 @@
 #include "testing_dgmm_strided_batched.hpp"
 #include "testing_geam.hpp"
 #include "testing_geam_batched.hpp"
+#include "testing_geam_batched_ex.hpp"
 #include "testing_geam_ex.hpp"
 #include "testing_geam_strided_batched.hpp"
+#include "testing_geam_strided_batched_ex.hpp"
 #include "testing_gemmt.hpp"
 #include "testing_gemmt_batched.hpp"
 #include "testing_gemmt_strided_batched.hpp"
@@ -205,6 +223,7 @@
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
 #include "testing_gemm_ex3.hpp"
+#include "testing_gemm_ex3_scaled.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "testing_trsm.hpp"
@@ -297,6 +316,7 @@ struct perf_gemm_ex3<
     {
         static const func_map map = {
             {"gemm_ex3", testing_gemm_ex3<TiA, TiB, To, Tc>},
+            {"gemm_ex3_scaled", testing_gemm_ex3_scaled<TiA, TiB, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -354,6 +374,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same_v<T, float> || std::is_same
                 {"axpy", testing_axpy<T>},
                 {"axpy_batched", testing_axpy_batched<T>},
                 {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
                 {"copy", testing_copy<T>},
                 {"copy_batched", testing_copy_batched<T>},
                 {"copy_strided_batched", testing_copy_strided_batched<T>},
@@ -366,15 +387,19 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same_v<T, float> || std::is_same
                 {"iamin", testing_iamin<T>},
                 {"iamin_batched", testing_iamin_batched<T>},
                 {"iamin_strided_batched", testing_iamin_strided_batched<T>},
+                {"multi_axpy", testing_multi_axpy<T>},
+                {"multi_dot", testing_multi_dot<T>},
                 {"nrm2", testing_nrm2<T>},
                 {"nrm2_batched", testing_nrm2_batched<T>},
                 {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+                {"nrm2_scal", testing_nrm2_scal<T>},
                 {"rotm", testing_rotm<T>},
                 {"rotm_batched", testing_rotm_batched<T>},
                 {"rotm_strided_batched", testing_rotm_strided_batched<T>},
                 {"rotmg", testing_rotmg<T>},
                 {"rotmg_batched", testing_rotmg_batched<T>},
                 {"rotmg_strided_batched", testing_rotmg_strided_batched<T>},
+                {"scalar_op", testing_scalar_op<T>},
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
@@ -386,10 +411,15 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same_v<T, float> || std::is_same
                 {"geam_batched", testing_geam_batched<T>},
                 {"geam_strided_batched", testing_geam_strided_batched<T>},
                 {"geam_ex", testing_geam_ex<T>},
+                {"geam_batched_ex", testing_geam_batched_ex<T>},
+                {"geam_strided_batched_ex", testing_geam_strided_batched_ex<T>},
                 {"gemv", testing_gemv<T>},
                 {"ger", testing_ger<T, false>},
                 {"ger_batched", testing_ger_batched<T, false>},
                 {"ger_strided_batched", testing_ger_strided_batched<T, false>},
+                {"ger_k", testing_ger_k<T, false>},
+                {"ger_k_batched", testing_ger_k_batched<T, false>},
+                {"ger_k_strided_batched", testing_ger_k_strided_batched<T, false>},
                 {"spr", testing_spr<T>},
                 {"spr_batched", testing_spr_batched<T>},
                 {"spr_strided_batched", testing_spr_strided_batched<T>},
@@ -399,6 +429,9 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same_v<T, float> || std::is_same
                 {"syr", testing_syr<T>},
                 {"syr_batched", testing_syr_batched<T>},
                 {"syr_strided_batched", testing_syr_strided_batched<T>},
+                {"syr_k", testing_syr_k<T, false>},
+                {"syr_k_batched", testing_syr_k_batched<T, false>},
+                {"syr_k_strided_batched", testing_syr_k_strided_batched<T, false>},
                 {"syr2", testing_syr2<T>},
                 {"syr2_batched", testing_syr2_batched<T>},
                 {"syr2_strided_batched", testing_syr2_strided_batched<T>},
@@ -497,6 +530,8 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same_v<T, rocblas_half>>> : rocb
                 {"dot_batched", testing_dot_batched<T>},
                 {"dot_strided_batched", testing_dot_strided_batched<T>},
                 {"geam_ex", testing_geam_ex<T>},
+                {"geam_batched_ex", testing_geam_batched_ex<T>},
+                {"geam_strided_batched_ex", testing_geam_strided_batched_ex<T>},
 #if BUILD_WITH_TENSILE
                 {"gemm", testing_gemm<T>},
                 {"gemm_batched", testing_gemm_batched<T>},
@@ -562,6 +597,7 @@ struct perf_blas<
                 {"axpy", testing_axpy<T>},
                 {"axpy_batched", testing_axpy_batched<T>},
                 {"axpy_strided_batched", testing_axpy_strided_batched<T>},
+                {"axpy_dot", testing_axpy_dot<T>},
                 {"copy", testing_copy<T>},
                 {"copy_batched", testing_copy_batched<T>},
                 {"copy_strided_batched", testing_copy_strided_batched<T>},
@@ -577,9 +613,13 @@ struct perf_blas<
                 {"iamin", testing_iamin<T>},
                 {"iamin_batched", testing_iamin_batched<T>},
                 {"iamin_strided_batched", testing_iamin_strided_batched<T>},
+                {"multi_axpy", testing_multi_axpy<T>},
+                {"multi_dot", testing_multi_dot<T>},
                 {"nrm2", testing_nrm2<T>},
                 {"nrm2_batched", testing_nrm2_batched<T>},
                 {"nrm2_strided_batched", testing_nrm2_strided_batched<T>},
+                {"nrm2_scal", testing_nrm2_scal<T>},
+                {"scalar_op", testing_scalar_op<T>},
                 {"swap", testing_swap<T>},
                 {"swap_batched", testing_swap_batched<T>},
                 {"swap_strided_batched", testing_swap_strided_batched<T>},
@@ -594,6 +634,12 @@ struct perf_blas<
                 {"gerc", testing_ger<T, true>},
                 {"gerc_batched", testing_ger_batched<T, true>},
                 {"gerc_strided_batched", testing_ger_strided_batched<T, true>},
+                {"geru_k", testing_ger_k<T, false>},
+                {"geru_k_batched", testing_ger_k_batched<T, false>},
+                {"geru_k_strided_batched", testing_ger_k_strided_batched<T, false>},
+                {"gerc_k", testing_ger_k<T, true>},
+                {"gerc_k_batched", testing_ger_k_batched<T, true>},
+                {"gerc_k_strided_batched", testing_ger_k_strided_batched<T, true>},
                 {"hbmv", testing_hbmv<T>},
                 {"hbmv_batched", testing_hbmv_batched<T>},
                 {"hbmv_strided_batched", testing_hbmv_strided_batched<T>},
@@ -603,6 +649,9 @@ struct perf_blas<
                 {"her", testing_her<T>},
                 {"her_batched", testing_her_batched<T>},
                 {"her_strided_batched", testing_her_strided_batched<T>},
+                {"her_k", testing_syr_k<T, true>},
+                {"her_k_batched", testing_syr_k_batched<T, true>},
+                {"her_k_strided_batched", testing_syr_k_strided_batched<T, true>},
                 {"her2", testing_her2<T>},
                 {"her2_batched", testing_her2_batched<T>},
                 {"her2_strided_batched", testing_her2_strided_batched<T>},
@@ -621,6 +670,9 @@ struct perf_blas<
                 {"syr", testing_syr<T>},
                 {"syr_batched", testing_syr_batched<T>},
                 {"syr_strided_batched", testing_syr_strided_batched<T>},
+                {"syr_k", testing_syr_k<T, false>},
+                {"syr_k_batched", testing_syr_k_batched<T, false>},
+                {"syr_k_strided_batched", testing_syr_k_strided_batched<T, false>},
                 {"syr2", testing_syr2<T>},
                 {"syr2_batched", testing_syr2_batched<T>},
                 {"syr2_strided_batched", testing_syr2_strided_batched<T>},
@@ -1039,6 +1091,29 @@ struct perf_blas_rotg<
     }
 };
 
+template <typename Ti, typename To = Ti, typename = void>
+struct perf_convert_host : rocblas_test_invalid
+{
+};
+
+template <typename Ti, typename To>
+struct perf_convert_host<
+    Ti,
+    To,
+    std::enable_if_t<!std::is_same_v<Ti, To>
+                     && !((std::is_same_v<Ti, rocblas_f8> || std::is_same_v<Ti, rocblas_bf8>)
+                          && (std::is_same_v<To, rocblas_f8> || std::is_same_v<To, rocblas_bf8>))>>
+    : rocblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"convert_host", testing_convert_host<Ti, To>},
+        };
+        run_function(map, arg);
+    }
+};
+
 int run_bench_test(bool               init,
                    Arguments&         arg,
                    const std::string& filter,
@@ -1187,7 +1262,7 @@ int run_bench_test(bool               init,
         }
         rocblas_gemm_dispatch<perf_gemm_ex>(arg);
     }
-    else if(!strcmp(function, "gemm_ex3"))
+    else if(!strcmp(function, "gemm_ex3") || !strcmp(function, "gemm_ex3_scaled"))
     {
         // adjust dimension for GEMM routines
         rocblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1215,10 +1290,10 @@ int run_bench_test(bool               init,
             rocblas_cout << "rocblas-bench INFO: ldd < min_ldd, set ldd = " << min_ldc << std::endl;
             arg.ldd = min_ldd;
         }
-        if(!strcmp(function, "gemm_ex3") && arg.batch_count > 1)
+        if(arg.batch_count > 1)
         {
-            rocblas_cout << "rocblas-bench INFO: batch_count can only be 1 for function gemm_ex3"
-                         << ", set batch_count = 1" << std::endl;
+            rocblas_cout << "rocblas-bench INFO: batch_count can only be 1 for function "
+                         << function << ", set batch_count = 1" << std::endl;
             arg.batch_count = 1;
         }
         rocblas_gemm_dispatch<perf_gemm_ex3>(arg);
@@ -1296,6 +1371,8 @@ int run_bench_test(bool               init,
         else if(!strcmp(function, "scal_ex") || !strcmp(function, "scal_batched_ex")
                 || !strcmp(function, "scal_strided_batched_ex"))
             rocblas_blas1_ex_dispatch<perf_blas_scal_ex>(arg);
+        else if(!strcmp(function, "convert_host"))
+            rocblas_convert_host_dispatch<perf_convert_host>(arg);
         else if(!strcmp(function, "gemv_batched") || !strcmp(function, "gemv_strided_batched"))
             rocblas_gemv_batched_and_strided_batched_dispatch<
                 perf_gemv_batched_and_strided_batched>(arg);
@@ -1307,11 +1384,18 @@ int run_bench_test(bool               init,
 
 int rocblas_bench_datafile(const std::string& filter,
                            const std::string& name_filter,
-                           bool               any_stride)
+                           bool               any_stride,
+                           int                samples)
 {
     int ret = 0;
-    for(Arguments arg : RocBLAS_TestData())
-        ret |= run_bench_test(true, arg, filter, name_filter, any_stride, true);
+    for(const Arguments& test : RocBLAS_TestData())
+    {
+        for(int i = 0; i < samples; i++)
+        {
+            Arguments arg(test);
+            ret |= run_bench_test(true, arg, filter, name_filter, any_stride, true);
+        }
+    }
     test_cleanup::cleanup();
     return ret;
 }
@@ -1374,6 +1458,74 @@ int run_bench_gpu_test(int                parallel_devices,
     return 0;
 }
 
+// Sizes of a sweep option: a value, a comma separated list of values, start:end:step, or
+// start:end:*factor for geometric steps
+std::vector<int64_t> rocblas_bench_sizes(const std::string& spec, const char* option)
+{
+    auto invalid = [&] {
+        return std::invalid_argument(std::string("Invalid value for ") + option + " " + spec);
+    };
+
+    auto to_int = [&](const std::string& str) {
+        size_t  end;
+        int64_t value = -1;
+        try
+        {
+            value = std::stoll(str, &end);
+        }
+        catch(const std::exception&)
+        {
+            throw invalid();
+        }
+        if(end != str.size() || value < 0)
+            throw invalid();
+        return value;
+    };
+
+    std::vector<int64_t> sizes;
+
+    size_t colon = spec.find(':');
+    if(colon == std::string::npos)
+    {
+        for(size_t pos = 0, comma; pos <= spec.size(); pos = comma + 1)
+        {
+            comma = spec.find(',', pos);
+            if(comma == std::string::npos)
+                comma = spec.size();
+            sizes.push_back(to_int(spec.substr(pos, comma - pos)));
+        }
+        return sizes;
+    }
+
+    size_t colon2 = spec.find(':', colon + 1);
+    if(colon2 == std::string::npos)
+        throw invalid();
+
+    int64_t     start = to_int(spec.substr(0, colon));
+    int64_t     end   = to_int(spec.substr(colon + 1, colon2 - colon - 1));
+    std::string step  = spec.substr(colon2 + 1);
+    if(start > end || step.empty())
+        throw invalid();
+
+    if(step[0] == '*')
+    {
+        int64_t factor = to_int(step.substr(1));
+        if(factor < 2 || start < 1)
+            throw invalid();
+        for(int64_t size = start; size <= end; size *= factor)
+            sizes.push_back(size);
+    }
+    else
+    {
+        int64_t increment = to_int(step);
+        if(increment < 1)
+            throw invalid();
+        for(int64_t size = start; size <= end; size += increment)
+            sizes.push_back(size);
+    }
+    return sizes;
+}
+
 // Replace --batch with --batch_count for backward compatibility
 void fix_batch(int argc, char* argv[])
 {
@@ -1411,10 +1563,22 @@ try
     int32_t     parallel_devices;
     int32_t     flags             = 0;
     int32_t     geam_ex_op        = 0;
+    int32_t     scale_a_mode      = 0;
+    int32_t     scale_b_mode      = 0;
+    int32_t     repro_mode        = 0;
     bool        datafile          = rocblas_parse_data(argc, argv);
     bool        atomics_allowed   = true;
     bool        log_function_name = false;
     bool        log_datatype      = false;
+    bool        roofline          = false;
+    std::string peak_file;
+    std::string roofline_file;
+    std::string output_file;
+    int32_t     samples = 1;
+    std::string size_m;
+    std::string size_n;
+    std::string size_k;
+    std::string batch_count;
     bool        any_stride        = false;
     uint32_t    math_mode         = 0;
     bool        fortran           = false;
@@ -1425,19 +1589,20 @@ try
     desc.add_options()
         // clang-format off
         ("sizem,m",
-         value<int64_t>(&arg.M)->default_value(128),
+         value<std::string>(&size_m)->default_value("128"),
          "Specific matrix size: sizem is only applicable to BLAS-2 & BLAS-3: the number of "
-         "rows or columns in matrix.")
+         "rows or columns in matrix. A list of sizes a,b,c, a range start:end:step, or a geometric "
+         "range start:end:*factor sweeps the sizes in process.")
 
         ("sizen,n",
-         value<int64_t>(&arg.N)->default_value(128),
+         value<std::string>(&size_n)->default_value("128"),
          "Specific matrix/vector size: BLAS-1: the length of the vector. BLAS-2 & "
-         "BLAS-3: the number of rows or columns in matrix")
+         "BLAS-3: the number of rows or columns in matrix. Sweeps as -m, or m to follow -m")
 
         ("sizek,k",
-         value<int64_t>(&arg.K)->default_value(128),
+         value<std::string>(&size_k)->default_value("128"),
          "Specific matrix size: BLAS-2: the number of sub or super-diagonals of A. BLAS-3: "
-         "the number of columns in A and rows in B.")
+         "the number of columns in A and rows in B. Sweeps as -m, or m or n to follow -m or -n")
 
         ("kl",
          value<int64_t>(&arg.KL)->default_value(32),
@@ -1582,8 +1747,8 @@ try
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm xtrsm_ex xtrsv xtrmm
 
         ("batch_count",
-         value<int64_t>(&arg.batch_count)->default_value(1),
-         "Number of matrices. Only applicable to batched and strided_batched routines")
+         value<std::string>(&batch_count)->default_value("1"),
+         "Number of matrices. Only applicable to batched and strided_batched routines. Sweeps as -m")
 
         ("HMM",
          value<bool>(&arg.HMM)->default_value(false),
@@ -1611,16 +1776,33 @@ try
 
         ("geam_ex_op",
          value<int32_t>(&geam_ex_op)->default_value(rocblas_geam_ex_operation_min_plus),
-         "geam_ex_operation, 0: min_plus operation, 1: plus_min operation")
+         "geam_ex_operation, 0: min_plus operation, 1: plus_min operation, 2: max_plus operation, "
+         "3: min_max operation, 4: max_min operation, 5: or_and operation")
+
+        ("scale_a_mode",
+         value<int32_t>(&scale_a_mode)->default_value(rocblas_gemm_scale_mode_none),
+         "gemm_ex3_scaled scaling of A, 0: none, 1: one factor for the matrix, 2: one factor per row of op(A)")
+
+        ("scale_b_mode",
+         value<int32_t>(&scale_b_mode)->default_value(rocblas_gemm_scale_mode_none),
+         "gemm_ex3_scaled scaling of B, 0: none, 1: one factor for the matrix, 2: one factor per column of op(B)")
 
         ("flags",
          value<int32_t>(&flags)->default_value(rocblas_gemm_flags_none),
          "gemm_ex flags, 1: Use packed-i8, 0: (default) uses unpacked-i8, available on matrix-inst-supported device")
 
+        ("stochastic_rounding",
+         bool_switch(&arg.stochastic_rounding)->default_value(false),
+         "Use stochastic rounding for f8 and bf8 results of host conversion")
+
         ("atomics_allowed",
          bool_switch(&atomics_allowed)->default_value(true),
          "Atomic operations with non-determinism in results are allowed")
 
+        ("reproducibility_mode",
+         value<int32_t>(&repro_mode)->default_value(rocblas_reproducibility_default),
+         "Handle reproducibility mode, 0: default, 1: bitwise reproducible, 2: bitwise reproducible with compensated summation")
+
         ("device",
          value<int32_t>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -1649,13 +1831,36 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("roofline",
+         bool_switch(&roofline)->default_value(false),
+         "Include percent of peak Gflops and GB/s, arithmetic intensity and compute or memory bound in output.")
+
+        ("peak_file",
+         value<std::string>(&peak_file),
+         "Peaks used by --roofline from a file of key = value lines: gflops_f64, gflops_f32, gflops_f16, "
+         "gflops_bf16, gflops_i8, gflops_f8, gflops, GBps. Peaks not given are detected from the device")
+
+        ("roofline_file",
+         value<std::string>(&roofline_file),
+         "Write the roofline of every timed call to a CSV file, or JSON file if it ends in .json, implies --roofline")
+
+        ("output",
+         value<std::string>(&output_file),
+         "Write the results of every timed call with the library version, device, clocks, solution index, "
+         "iterations and errors to a CSV file, or JSON Lines file if it ends in .json or .jsonl")
+
+        ("samples",
+         value<int32_t>(&samples)->default_value(1),
+         "Number of times each case is run, each run is a sample in --output")
+
         ("function_filter",
          value<std::string>(&filter),
          "Simple strstr filter on function name only without wildcards")
 
         ("math_mode",
          value<uint32_t>(&arg.math_mode)->default_value(rocblas_default_math),
-         "extended precision gemm math mode")
+         "math mode, 0: default, 1: xf32 xdl gemm, 2: compensated summation in dot, nrm2 and asum, "
+         "3: iterative refinement in double precision trsm and trsv")
 
         ("name_filter",
          value<std::string>(&name_filter),
@@ -1699,6 +1904,7 @@ try
     // transfer local variable state
 
     arg.atomics_mode = atomics_allowed ? rocblas_atomics_allowed : rocblas_atomics_not_allowed;
+    arg.reproducibility_mode = rocblas_reproducibility_mode(repro_mode);
     if(fortran)
         arg.api = FORTRAN;
 
@@ -1734,10 +1940,24 @@ try
 
     arg.geam_ex_op = rocblas_geam_ex_operation(geam_ex_op);
 
+    arg.scale_a_mode = rocblas_gemm_scale_mode(scale_a_mode);
+    arg.scale_b_mode = rocblas_gemm_scale_mode(scale_b_mode);
+
     ArgumentModel_set_log_function_name(log_function_name);
 
     ArgumentModel_set_log_datatype(log_datatype);
 
+    ArgumentModel_set_roofline(roofline);
+    if(!peak_file.empty())
+        ArgumentModel_set_peak_file(peak_file);
+    if(!roofline_file.empty())
+        ArgumentModel_set_roofline_file(roofline_file);
+    if(!output_file.empty())
+        ArgumentModel_set_output(output_file);
+
+    if(samples < 1)
+        throw std::invalid_argument("Invalid value for --samples " + std::to_string(samples));
+
     // Device Query
     rocblas_int device_count = query_device_property();
 
@@ -1748,7 +1968,11 @@ try
         set_device(device_id);
 
     if(datafile)
-        return rocblas_bench_datafile(filter, name_filter, any_stride);
+    {
+        int status = rocblas_bench_datafile(filter, name_filter, any_stride, samples);
+        client_pool_release();
+        return status;
+    }
 
     // single bench run
 
@@ -1792,24 +2016,104 @@ try
     if(arg.arithmetic_check == static_cast<rocblas_arithmetic_check>(0)) // zero not in enum
         throw std::invalid_argument("Invalid value for --arithmetic_check " + arithmetic_check);
 
-    if(arg.M < 0)
-        throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
-    if(arg.N < 0)
-        throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
-    if(arg.K < 0)
-        throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
+    // sizes of the sweep, a single point without ranges or lists
+    bool n_is_m = size_n == "m";
+    bool k_is_m = size_k == "m";
+    bool k_is_n = size_k == "n";
+
+    std::vector<int64_t> sweep_m = rocblas_bench_sizes(size_m, "-m");
+    std::vector<int64_t> sweep_n
+        = n_is_m ? std::vector<int64_t>{0} : rocblas_bench_sizes(size_n, "-n");
+    std::vector<int64_t> sweep_k
+        = k_is_m || k_is_n ? std::vector<int64_t>{0} : rocblas_bench_sizes(size_k, "-k");
+    std::vector<int64_t> sweep_batch = rocblas_bench_sizes(batch_count, "--batch_count");
+
+    size_t sweep_points = sweep_m.size() * sweep_n.size() * sweep_k.size() * sweep_batch.size();
+
+    // sets the sizes of a point, and in sweeps the leading dimensions and strides left at their
+    // defaults to fit the point
+    auto set_point = [&](Arguments& a, int64_t m, int64_t n, int64_t k, int64_t batch) {
+        a.M           = m;
+        a.N           = n_is_m ? m : n;
+        a.K           = k_is_m ? m : k_is_n ? a.N : k;
+        a.batch_count = batch;
+        if(sweep_points == 1)
+            return;
+
+        int64_t dim = std::max({a.M, a.N, a.K, int64_t(1)});
+        int64_t inc = std::max({std::abs(a.incx), std::abs(a.incy), int64_t(1)});
+        for(auto [name, ld, stride] : {std::tuple{"lda", &a.lda, &a.stride_a},
+                                       std::tuple{"ldb", &a.ldb, &a.stride_b},
+                                       std::tuple{"ldc", &a.ldc, &a.stride_c},
+                                       std::tuple{"ldd", &a.ldd, &a.stride_d}})
+        {
+            if(vm[name].defaulted())
+                *ld = dim;
+            if(vm[std::string("stride_") + name[2]].defaulted())
+                *stride = *ld * dim;
+        }
+        if(vm["stride_x"].defaulted())
+            a.stride_x = dim * inc;
+        if(vm["stride_y"].defaulted())
+            a.stride_y = dim * inc;
+    };
+
+    set_point(arg, sweep_m[0], sweep_n[0], sweep_k[0], sweep_batch[0]);
 
     int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
-    if(!parallel_devices)
+    int status;
+    if(sweep_points > 1)
+    {
+        if(parallel_devices)
+            throw std::invalid_argument("Size sweeps are not supported with --parallel_devices");
+
+        // Allocate the buffers of the largest sizes once, with an untimed run, and reuse them
+        // for every point from the client memory pool
+        client_pool_set_best_fit(true);
+
+        Arguments largest(arg);
+        set_point(largest,
+                  *std::max_element(sweep_m.begin(), sweep_m.end()),
+                  *std::max_element(sweep_n.begin(), sweep_n.end()),
+                  *std::max_element(sweep_k.begin(), sweep_k.end()),
+                  *std::max_element(sweep_batch.begin(), sweep_batch.end()));
+        largest.cold_iters = 0;
+        largest.iters      = 0;
+        largest.norm_check = 0;
+
+        std::string name_filter = "";
+        status                  = run_bench_test(true, largest, filter, name_filter, any_stride);
+
+        for(int64_t batch : sweep_batch)
+            for(int64_t k : sweep_k)
+                for(int64_t n : sweep_n)
+                    for(int64_t m : sweep_m)
+                        for(int i = 0; i < samples; i++)
+                        {
+                            Arguments point(arg);
+                            set_point(point, m, n, k, batch);
+                            status |= run_bench_test(true, point, filter, name_filter, any_stride);
+                        }
+    }
+    else if(!parallel_devices)
     {
         std::string name_filter = "";
-        return run_bench_test(true, arg, filter, name_filter, any_stride);
+        status                  = 0;
+        for(int i = 0; i < samples; i++)
+        {
+            Arguments sample_arg(arg);
+            status |= run_bench_test(true, sample_arg, filter, name_filter, any_stride);
+        }
     }
     else
-        return run_bench_gpu_test(parallel_devices, arg, filter, any_stride);
+        status = run_bench_gpu_test(parallel_devices, arg, filter, any_stride);
+
+    // Free the blocks cached by the client memory pool
+    client_pool_release();
+    return status;
 }
 catch(const std::invalid_argument& exp)
 {
@@ -0,0 +1,390 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// rocblas-overhead-bench measures the host time of rocBLAS calls which do little or no device
+// work: quick returns with n = 0 and tiny sizes, optionally with the Tensile launches skipped.
+// With a library built with BUILD_WITH_HOST_TIMERS the time is broken down by host phase.
+
+#include "host_timers.hpp"
+#include "program_options.hpp"
+#include "rocblas.h"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+
+namespace
+{
+    // Device buffers shared by all calls, sized for the largest n
+    struct overhead_buffers
+    {
+        void* A = nullptr;
+        void* B = nullptr;
+        void* C = nullptr;
+        void* x = nullptr;
+        void* y = nullptr;
+
+        explicit overhead_buffers(size_t max_n)
+        {
+            size_t matrix_bytes = std::max(max_n * max_n, size_t(1)) * sizeof(double);
+            size_t vector_bytes = std::max(max_n, size_t(1)) * sizeof(double);
+            for(void** ptr : {&A, &B, &C})
+            {
+                CHECK_HIP_ERROR(hipMalloc(ptr, matrix_bytes));
+                CHECK_HIP_ERROR(hipMemset(*ptr, 0, matrix_bytes));
+            }
+            for(void** ptr : {&x, &y})
+            {
+                CHECK_HIP_ERROR(hipMalloc(ptr, vector_bytes));
+                CHECK_HIP_ERROR(hipMemset(*ptr, 0, vector_bytes));
+            }
+        }
+
+        ~overhead_buffers()
+        {
+            for(void* ptr : {A, B, C, x, y})
+                (void)hipFree(ptr);
+        }
+
+        overhead_buffers(const overhead_buffers&) = delete;
+        overhead_buffers& operator=(const overhead_buffers&) = delete;
+    };
+
+    using overhead_call
+        = std::function<rocblas_status(rocblas_handle, rocblas_int, const overhead_buffers&)>;
+
+    struct overhead_function
+    {
+        const char*   name;
+        overhead_call call;
+    };
+
+    template <typename T>
+    T* ptr(void* p)
+    {
+        return static_cast<T*>(p);
+    }
+
+    // Functions timed by default. The scalars are on the host, so the calls returning a result
+    // (dot, nrm2) also include the synchronization of the result copy.
+    const std::vector<overhead_function>& overhead_functions()
+    {
+        static const float  s_one = 1, s_zero = 0;
+        static const double d_one = 1, d_zero = 0;
+        static float        s_result;
+
+        // clang-format off
+        static const std::vector<overhead_function> functions = {
+            {"sgemm", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                rocblas_int ld = std::max(n, 1);
+                return rocblas_sgemm(h, rocblas_operation_none, rocblas_operation_none, n, n, n,
+                                     &s_one, ptr<float>(b.A), ld, ptr<float>(b.B), ld, &s_zero,
+                                     ptr<float>(b.C), ld);
+            }},
+            {"dgemm", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                rocblas_int ld = std::max(n, 1);
+                return rocblas_dgemm(h, rocblas_operation_none, rocblas_operation_none, n, n, n,
+                                     &d_one, ptr<double>(b.A), ld, ptr<double>(b.B), ld, &d_zero,
+                                     ptr<double>(b.C), ld);
+            }},
+            {"sgemm_strided_batched",
+             [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                rocblas_int ld = std::max(n, 1);
+                return rocblas_sgemm_strided_batched(h, rocblas_operation_none,
+                                                     rocblas_operation_none, n, n, n, &s_one,
+                                                     ptr<float>(b.A), ld, 0, ptr<float>(b.B), ld,
+                                                     0, &s_zero, ptr<float>(b.C), ld, 0, 1);
+            }},
+            {"gemm_ex", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                rocblas_int ld = std::max(n, 1);
+                return rocblas_gemm_ex(h, rocblas_operation_none, rocblas_operation_none, n, n, n,
+                                       &s_one, b.A, rocblas_datatype_f32_r, ld, b.B,
+                                       rocblas_datatype_f32_r, ld, &s_zero, b.C,
+                                       rocblas_datatype_f32_r, ld, b.C, rocblas_datatype_f32_r,
+                                       ld, rocblas_datatype_f32_r, rocblas_gemm_algo_standard, 0,
+                                       0);
+            }},
+            {"strsm", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                rocblas_int ld = std::max(n, 1);
+                return rocblas_strsm(h, rocblas_side_left, rocblas_fill_lower,
+                                     rocblas_operation_none, rocblas_diagonal_unit, n, n, &s_one,
+                                     ptr<float>(b.A), ld, ptr<float>(b.B), ld);
+            }},
+            {"sgemv", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                return rocblas_sgemv(h, rocblas_operation_none, n, n, &s_one, ptr<float>(b.A),
+                                     std::max(n, 1), ptr<float>(b.x), 1, &s_zero,
+                                     ptr<float>(b.y), 1);
+            }},
+            {"saxpy", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                return rocblas_saxpy(h, n, &s_one, ptr<float>(b.x), 1, ptr<float>(b.y), 1);
+            }},
+            {"sscal", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                return rocblas_sscal(h, n, &s_one, ptr<float>(b.x), 1);
+            }},
+            {"scopy", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                return rocblas_scopy(h, n, ptr<float>(b.x), 1, ptr<float>(b.y), 1);
+            }},
+            {"sdot", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                return rocblas_sdot(h, n, ptr<float>(b.x), 1, ptr<float>(b.y), 1, &s_result);
+            }},
+            {"snrm2", [](rocblas_handle h, rocblas_int n, const overhead_buffers& b) {
+                return rocblas_snrm2(h, n, ptr<float>(b.x), 1, &s_result);
+            }},
+        };
+        // clang-format on
+
+        return functions;
+    }
+
+    // Splits a comma separated list
+    std::vector<std::string> split_list(const std::string& list)
+    {
+        std::vector<std::string> items;
+        size_t                   start = 0;
+        while(start <= list.size())
+        {
+            size_t end = list.find(',', start);
+            if(end == std::string::npos)
+                end = list.size();
+            if(end > start)
+                items.push_back(list.substr(start, end - start));
+            start = end + 1;
+        }
+        return items;
+    }
+
+    double median(std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+        size_t mid = samples.size() / 2;
+        return samples.size() % 2 ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+    }
+}
+
+int main(int argc, char* argv[])
+try
+{
+    rocblas_int device_id;
+    rocblas_int iters;
+    rocblas_int repeats;
+    rocblas_int warmup;
+    std::string sizes;
+    std::string function_list;
+    std::string output;
+    bool        skip_launch = false;
+
+    options_description desc("rocblas-overhead-bench command line options");
+    desc.add_options()
+        // clang-format off
+        ("sizes",
+         value<std::string>(&sizes)->default_value("0,1,8"),
+         "Comma separated list of sizes n. 0 measures the quick return path, and small sizes "
+         "the full host path with tiny kernels")
+
+        ("function,f",
+         value<std::string>(&function_list)->default_value(""),
+         "Comma separated list of functions to time, default all of sgemm, dgemm, "
+         "sgemm_strided_batched, gemm_ex, strsm, sgemv, saxpy, sscal, scopy, sdot and snrm2")
+
+        ("iters,i",
+         value<rocblas_int>(&iters)->default_value(1000),
+         "Calls per sample")
+
+        ("repeats",
+         value<rocblas_int>(&repeats)->default_value(10),
+         "Samples per function and size. The median and minimum are reported")
+
+        ("warmup",
+         value<rocblas_int>(&warmup)->default_value(10),
+         "Untimed calls before the samples, which include one-time initialization")
+
+        ("skip_launch",
+         bool_switch(&skip_launch)->default_value(false),
+         "Skip the Tensile kernel launches as with TENSILE_DB2=1, so that the GEMM path is "
+         "timed up to the launch")
+
+        ("output,o",
+         value<std::string>(&output)->default_value(""),
+         "CSV file receiving every sample, with the function, arguments, sample and us columns "
+         "read by compare-bench-results.py")
+
+        ("device",
+         value<rocblas_int>(&device_id)->default_value(0),
+         "Set default device to be used for subsequent program runs")
+
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        rocblas_cout << desc << std::endl;
+        return 0;
+    }
+
+    if(iters < 1 || repeats < 1 || warmup < 0)
+        throw std::invalid_argument("--iters and --repeats must be positive");
+
+    // TENSILE_DB2 is read once by the library, so it must be set before the first rocBLAS call
+    if(skip_launch)
+    {
+        const char* db2   = getenv("TENSILE_DB2");
+        long        flags = db2 ? strtol(db2, nullptr, 0) : 0;
+        setenv("TENSILE_DB2", std::to_string(flags | 1).c_str(), 1);
+    }
+
+    std::vector<rocblas_int> size_list;
+    for(const auto& size : split_list(sizes))
+        size_list.push_back(std::stoi(size));
+    if(size_list.empty())
+        throw std::invalid_argument("--sizes must list at least one size");
+
+    std::vector<overhead_function> selected;
+    auto                           requested = split_list(function_list);
+    for(const auto& function : overhead_functions())
+        if(requested.empty()
+           || std::find(requested.begin(), requested.end(), function.name) != requested.end())
+            selected.push_back(function);
+    if(selected.size() < std::max(requested.size(), size_t(1)))
+        throw std::invalid_argument("Unknown function in --function " + function_list);
+
+    rocblas_int device_count = query_device_property();
+    if(device_count <= device_id)
+        throw std::invalid_argument("Invalid Device ID");
+    set_device(device_id);
+
+    rocblas_local_handle handle;
+    hipStream_t          stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    overhead_buffers buffers(*std::max_element(size_list.begin(), size_list.end()));
+
+    rocblas_host_timers timers;
+    bool                phase_timers = rocblas_internal_get_host_timers(&timers);
+    if(!phase_timers)
+        rocblas_cout << "rocBLAS was built without BUILD_WITH_HOST_TIMERS, phases are not timed"
+                     << std::endl;
+
+    std::ofstream csv;
+    if(!output.empty())
+    {
+        csv.open(output);
+        if(!csv)
+            throw std::invalid_argument("Cannot open --output file " + output);
+        csv << "function,arguments,batch_count,sample,us";
+        for(int p = 0; phase_timers && p < rocblas_host_phase_count; ++p)
+            csv << "," << rocblas_host_phase_name(rocblas_host_phase(p)) << "_us";
+        csv << "\n";
+    }
+
+    rocblas_cout << std::left << std::setw(24) << "function" << std::right << std::setw(6) << "n"
+                 << std::setw(12) << "median_us" << std::setw(12) << "min_us";
+    for(int p = 0; phase_timers && p < rocblas_host_phase_count; ++p)
+        rocblas_cout << std::setw(20) << rocblas_host_phase_name(rocblas_host_phase(p));
+    rocblas_cout << "  status" << std::endl;
+
+    for(const auto& function : selected)
+    {
+        for(rocblas_int n : size_list)
+        {
+            rocblas_status status = rocblas_status_success;
+            for(rocblas_int i = 0; i < warmup; ++i)
+                status = function.call(handle, n, buffers);
+            CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+            // Host time per call of each sample, and time per call of each phase. Phases which
+            // the function never enters are not measured, rather than taking no time.
+            std::vector<double>              samples;
+            std::vector<std::vector<double>> phase_samples(rocblas_host_phase_count);
+            std::vector<bool>                phase_entered(rocblas_host_phase_count);
+
+            for(rocblas_int r = 0; r < repeats; ++r)
+            {
+                rocblas_internal_reset_host_timers();
+
+                auto start = std::chrono::steady_clock::now();
+                for(rocblas_int i = 0; i < iters; ++i)
+                    status = function.call(handle, n, buffers);
+                auto stop = std::chrono::steady_clock::now();
+
+                // Launched kernels are drained outside of the timed loop
+                CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+                double us = std::chrono::duration<double, std::micro>(stop - start).count();
+                samples.push_back(us / iters);
+
+                rocblas_internal_get_host_timers(&timers);
+                for(int p = 0; p < rocblas_host_phase_count; ++p)
+                {
+                    phase_samples[p].push_back(timers.us[p] / iters);
+                    if(timers.count[p])
+                        phase_entered[p] = true;
+                }
+
+                if(csv.is_open())
+                {
+                    csv << function.name << ",\"n=" << n << " skip_launch=" << skip_launch
+                        << "\",1," << r << "," << samples.back();
+                    for(int p = 0; phase_timers && p < rocblas_host_phase_count; ++p)
+                    {
+                        csv << ",";
+                        if(timers.count[p])
+                            csv << phase_samples[p].back();
+                    }
+                    csv << "\n";
+                }
+            }
+
+            rocblas_cout << std::left << std::setw(24) << function.name << std::right
+                         << std::setw(6) << n << std::fixed << std::setprecision(3)
+                         << std::setw(12) << median(samples) << std::setw(12)
+                         << *std::min_element(samples.begin(), samples.end());
+            for(int p = 0; phase_timers && p < rocblas_host_phase_count; ++p)
+            {
+                if(phase_entered[p])
+                    rocblas_cout << std::setw(20) << median(phase_samples[p]);
+                else
+                    rocblas_cout << std::setw(20) << "-";
+            }
+            rocblas_cout << "  " << rocblas_status_to_string(status) << std::endl;
+        }
+    }
+
+    return 0;
+}
+catch(const std::invalid_argument& exp)
+{
+    rocblas_cerr << exp.what() << std::endl;
+    return -1;
+}
@@ -22,6 +22,18 @@
 
 #include "argument_model.hpp"
 
+#include <hip/hip_runtime.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 
 static bool log_function_name = false;
@@ -47,3 +59,523 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static bool log_roofline = false;
+
+void ArgumentModel_set_roofline(bool r)
+{
+    log_roofline = r;
+}
+
+bool ArgumentModel_get_roofline()
+{
+    return log_roofline;
+}
+
+namespace
+{
+    // Peak flops per clock per CU of the matrix or vector units, used when no peak file is given.
+    // These are estimates from the published peaks, so the peak file should be used where exact
+    // percentages matter.
+    struct flops_per_clock
+    {
+        const char* arch;
+        double      f64, f32, f16, bf16, i8, f8;
+    };
+
+    // clang-format off
+    constexpr flops_per_clock c_flops_per_clock[] = {
+        // arch     f64  f32   f16  bf16    i8    f8
+        {"gfx908",   64, 256, 1024,  512, 1024, 1024},
+        {"gfx90a",  256, 256, 1024, 1024, 1024, 1024},
+        {"gfx940",  256, 256, 2048, 2048, 4096, 4096},
+        {"gfx941",  256, 256, 2048, 2048, 4096, 4096},
+        {"gfx942",  256, 256, 2048, 2048, 4096, 4096},
+        {"gfx11",     4, 256,  512,  512,  512,  512},
+        {"gfx10",     8, 128,  256,  256,  512,  256},
+        {"",         64, 128,  256,  256,  256,  256}, // any other arch
+    };
+    // clang-format on
+
+    // Peak key of a data type, complex types using the peak of their real type
+    std::string peak_key(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_f64_c:
+            return "f64";
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_f32_c:
+            return "f32";
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_f16_c:
+            return "f16";
+        case rocblas_datatype_bf16_r:
+        case rocblas_datatype_bf16_c:
+            return "bf16";
+        case rocblas_datatype_i8_r:
+        case rocblas_datatype_i8_c:
+        case rocblas_datatype_u8_r:
+        case rocblas_datatype_u8_c:
+            return "i8";
+        case rocblas_datatype_f8_r:
+        case rocblas_datatype_bf8_r:
+            return "f8";
+        default:
+            return "f32";
+        }
+    }
+
+    bool has_extension(const std::string& file, const char* ext)
+    {
+        size_t len = strlen(ext);
+        return file.size() >= len && file.compare(file.size() - len, len, ext) == 0;
+    }
+
+    struct roofline_state
+    {
+        std::mutex mutex;
+
+        // peaks of the peak file, by key: gflops_f64, ..., gflops and GBps
+        std::map<std::string, double> file_peaks;
+
+        // peaks detected by device and key
+        std::map<std::pair<int, std::string>, double> device_peaks;
+
+        std::ofstream dataset;
+        bool          dataset_json = false;
+        size_t        dataset_rows = 0;
+
+        ~roofline_state()
+        {
+            if(dataset.is_open() && dataset_json)
+                dataset << (dataset_rows ? "\n]\n" : "[]\n");
+        }
+    };
+
+    roofline_state& roofline()
+    {
+        static roofline_state state;
+        return state;
+    }
+
+    // Detects the peaks of the current device from its CU count, engine clock, memory clock and
+    // memory bus width. Called with the mutex held.
+    double detect_peak(roofline_state& state, const std::string& key)
+    {
+        int device = 0;
+        (void)hipGetDevice(&device);
+
+        auto it = state.device_peaks.find({device, key});
+        if(it != state.device_peaks.end())
+            return it->second;
+
+        hipDeviceProp_t props;
+        double          peak = 0;
+        if(hipGetDeviceProperties(&props, device) == hipSuccess)
+        {
+            if(key == "GBps")
+            {
+                // double data rate over the bus, kHz to GB/s
+                peak = 2.0 * props.memoryClockRate * 1e3 * (props.memoryBusWidth / 8) / 1e9;
+            }
+            else
+            {
+                const flops_per_clock* fpc = c_flops_per_clock;
+                while(*fpc->arch && strncmp(props.gcnArchName, fpc->arch, strlen(fpc->arch)))
+                    ++fpc;
+
+                double per_clock = key == "gflops_f64"    ? fpc->f64
+                                   : key == "gflops_f16"  ? fpc->f16
+                                   : key == "gflops_bf16" ? fpc->bf16
+                                   : key == "gflops_i8"   ? fpc->i8
+                                   : key == "gflops_f8"   ? fpc->f8
+                                                          : fpc->f32;
+
+                peak = per_clock * props.multiProcessorCount * props.clockRate * 1e3 / 1e9;
+            }
+        }
+
+        state.device_peaks[{device, key}] = peak;
+        return peak;
+    }
+
+    // Peak of the file, or of the device when the file has none. Called with the mutex held.
+    double get_peak(roofline_state& state, const std::string& key)
+    {
+        auto it = state.file_peaks.find(key);
+        if(it != state.file_peaks.end())
+            return it->second;
+
+        // gflops applies to every data type without its own entry
+        if(key != "GBps")
+        {
+            it = state.file_peaks.find("gflops");
+            if(it != state.file_peaks.end())
+                return it->second;
+        }
+
+        return detect_peak(state, key);
+    }
+}
+
+void ArgumentModel_set_peak_file(const std::string& file)
+{
+    std::ifstream in(file);
+    if(!in)
+        throw std::invalid_argument("Cannot open peak file " + file);
+
+    auto& state = roofline();
+
+    // key = value or key: value lines, with # comments
+    std::string line;
+    while(std::getline(in, line))
+    {
+        line     = line.substr(0, line.find('#'));
+        auto sep = line.find_first_of("=:");
+        if(sep == std::string::npos)
+            continue;
+
+        std::string key;
+        double      value;
+        std::istringstream(line.substr(0, sep)) >> key;
+        if(key.empty() || !(std::istringstream(line.substr(sep + 1)) >> value) || value <= 0)
+            throw std::invalid_argument("Invalid peak file line: " + line);
+
+        state.file_peaks[key] = value;
+    }
+}
+
+void ArgumentModel_set_roofline_file(const std::string& file)
+{
+    auto& state = roofline();
+    state.dataset.open(file);
+    if(!state.dataset)
+        throw std::invalid_argument("Cannot open roofline file " + file);
+
+    state.dataset_json = has_extension(file, ".json");
+    if(!state.dataset_json)
+        state.dataset << "function,a_type,compute_type,M,N,K,batch_count,us,rocblas-Gflops,"
+                         "rocblas-GB/s,AI,peak-Gflops,peak-GB/s,%peak-Gflops,%peak-GB/s,bound\n";
+    log_roofline = true;
+}
+
+void ArgumentModel_log_roofline(rocblas_internal_ostream& name_line,
+                                rocblas_internal_ostream& val_line,
+                                const Arguments&          arg,
+                                int64_t                   batch_count,
+                                double                    gpu_us,
+                                double                    gflops,
+                                double                    gbytes,
+                                double                    rocblas_gflops,
+                                double                    rocblas_GBps)
+{
+    auto&                       state = roofline();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    bool has_flops = gflops != ArgumentLogging::NA_value;
+    bool has_bytes = gbytes != ArgumentLogging::NA_value;
+
+    double peak_gflops = has_flops ? get_peak(state, "gflops_" + peak_key(arg.a_type)) : 0;
+    double peak_GBps   = has_bytes ? get_peak(state, "GBps") : 0;
+
+    double pct_gflops = peak_gflops > 0 ? 100 * rocblas_gflops / peak_gflops : 0;
+    double pct_GBps   = peak_GBps > 0 ? 100 * rocblas_GBps / peak_GBps : 0;
+
+    // arithmetic intensity in flops per byte, below the ridge point the call is memory bound
+    double      ai    = has_flops && has_bytes && gbytes > 0 ? gflops / gbytes : 0;
+    const char* bound = "";
+    if(ai > 0 && peak_gflops > 0 && peak_GBps > 0)
+        bound = ai < peak_gflops / peak_GBps ? "memory" : "compute";
+
+    if(has_flops)
+    {
+        name_line << ",%peak-Gflops";
+        val_line << ", " << pct_gflops;
+    }
+
+    if(has_bytes)
+    {
+        name_line << ",%peak-GB/s";
+        val_line << ", " << pct_GBps;
+    }
+
+    if(*bound)
+    {
+        name_line << ",AI,bound";
+        val_line << ", " << ai << ", " << bound;
+    }
+
+    if(!state.dataset.is_open())
+        return;
+
+    if(state.dataset_json)
+    {
+        state.dataset << (state.dataset_rows ? ",\n" : "[\n") << "{\"function\": \"" << arg.function
+                      << "\", \"a_type\": \"" << rocblas_datatype2string(arg.a_type)
+                      << "\", \"compute_type\": \"" << rocblas_datatype2string(arg.compute_type)
+                      << "\", \"M\": " << arg.M << ", \"N\": " << arg.N << ", \"K\": " << arg.K
+                      << ", \"batch_count\": " << batch_count << ", \"us\": " << gpu_us
+                      << ", \"gflops\": " << (has_flops ? rocblas_gflops : 0)
+                      << ", \"GBps\": " << (has_bytes ? rocblas_GBps : 0) << ", \"AI\": " << ai
+                      << ", \"peak_gflops\": " << peak_gflops
+                      << ", \"peak_GBps\": " << peak_GBps
+                      << ", \"pct_peak_gflops\": " << pct_gflops
+                      << ", \"pct_peak_GBps\": " << pct_GBps << ", \"bound\": \"" << bound
+                      << "\"}";
+    }
+    else
+    {
+        state.dataset << arg.function << "," << rocblas_datatype2string(arg.a_type) << ","
+                      << rocblas_datatype2string(arg.compute_type) << "," << arg.M << "," << arg.N
+                      << "," << arg.K << "," << batch_count << "," << gpu_us << ","
+                      << (has_flops ? rocblas_gflops : 0) << ","
+                      << (has_bytes ? rocblas_GBps : 0) << "," << ai << "," << peak_gflops << ","
+                      << peak_GBps << "," << pct_gflops << "," << pct_GBps << "," << bound << "\n";
+    }
+    state.dataset_rows++;
+    state.dataset.flush();
+}
+
+namespace
+{
+    // Metadata of a device, written with each of its results
+    struct output_device
+    {
+        std::string name;
+        std::string arch;
+        int         sclk_MHz = 0;
+        int         mclk_MHz = 0;
+        int         CUs      = 0;
+    };
+
+    struct output_state
+    {
+        std::mutex                    mutex;
+        std::ofstream                 file;
+        bool                          json = false;
+        std::string                   version;
+        std::map<int, output_device>  devices;
+        std::map<std::string, size_t> samples; // results so far of each case
+    };
+
+    output_state* output_sink = nullptr;
+
+    // Device metadata of the current device. Called with the mutex held.
+    const output_device& get_output_device(output_state& state, int device)
+    {
+        auto it = state.devices.find(device);
+        if(it != state.devices.end())
+            return it->second;
+
+        output_device&  dev = state.devices[device];
+        hipDeviceProp_t props;
+        if(hipGetDeviceProperties(&props, device) == hipSuccess)
+        {
+            dev.name     = props.name;
+            dev.arch     = props.gcnArchName;
+            dev.sclk_MHz = props.clockRate / 1000;
+            dev.mclk_MHz = props.memoryClockRate / 1000;
+            dev.CUs      = props.multiProcessorCount;
+        }
+        return dev;
+    }
+
+    std::string json_string(const std::string& str)
+    {
+        std::string quoted = "\"";
+        for(char c : str)
+        {
+            if(c == '"' || c == '\\')
+                quoted += '\\';
+            if(static_cast<unsigned char>(c) >= ' ')
+                quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    std::string csv_string(const std::string& str)
+    {
+        if(str.find_first_of(",\"\n") == std::string::npos)
+            return str;
+
+        std::string quoted = "\"";
+        for(char c : str)
+        {
+            if(c == '"')
+                quoted += '"';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
+
+    // Argument values which are plain numbers are written as JSON numbers, others as strings
+    std::string json_value(const std::string& value)
+    {
+        char* end = nullptr;
+        if(!value.empty() && (strtod(value.c_str(), &end), *end == '\0')
+           && value.find_first_of("xXnN") == std::string::npos)
+            return value;
+        return json_string(value);
+    }
+
+    // Not available results are null in JSON and empty in CSV
+    std::string number(double value, bool json)
+    {
+        if(value == ArgumentLogging::NA_value)
+            return json ? "null" : "";
+        std::ostringstream str;
+        str.precision(9);
+        str << value;
+        return str.str();
+    }
+
+    // clang-format off
+    constexpr const char* c_output_columns[] = {
+        "timestamp", "version", "device", "device_name", "arch", "sclk_MHz", "mclk_MHz", "CUs",
+        "function", "name", "a_type", "b_type", "c_type", "d_type", "compute_type",
+        "arguments", "batch_count", "requested_solution_index", "cold_iters", "iters", "sample",
+        "us", "gflops", "GBps", "cpu_us", "norm_error_1", "norm_error_2", "norm_error_3", "norm_error_4",
+    };
+    // clang-format on
+
+    constexpr size_t c_arguments_column = 15;
+}
+
+void ArgumentModel_set_output(const std::string& file)
+{
+    static output_state state;
+
+    state.file.open(file);
+    if(!state.file)
+        throw std::invalid_argument("Cannot open output file " + file);
+
+    state.json = has_extension(file, ".json") || has_extension(file, ".jsonl");
+    if(!state.json)
+    {
+        auto delim = "";
+        for(auto column : c_output_columns)
+        {
+            state.file << delim << column;
+            delim = ",";
+        }
+        state.file << std::endl;
+    }
+
+    size_t size;
+    rocblas_get_version_string_size(&size);
+    state.version.assign(size - 1, '\0');
+    rocblas_get_version_string(state.version.data(), size);
+
+    output_sink = &state;
+}
+
+bool ArgumentModel_get_output()
+{
+    return output_sink != nullptr;
+}
+
+void ArgumentModel_log_output(const Arguments&              arg,
+                              const ArgumentModel_arg_list& arg_list,
+                              int64_t                       batch_count,
+                              double                        gpu_us,
+                              double                        gflops,
+                              double                        gbytes,
+                              double                        rocblas_gflops,
+                              double                        rocblas_GBps,
+                              double                        cpu_us,
+                              double                        norm1,
+                              double                        norm2,
+                              double                        norm3,
+                              double                        norm4)
+{
+    int device = 0;
+    (void)hipGetDevice(&device);
+
+    char      timestamp[32];
+    struct tm tm_buf;
+    time_t    now = time(nullptr);
+#ifdef WIN32
+    gmtime_s(&tm_buf, &now);
+#else
+    gmtime_r(&now, &tm_buf);
+#endif
+    strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", &tm_buf);
+
+    auto&                       state = *output_sink;
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    const output_device& dev  = get_output_device(state, device);
+    bool                 json = state.json;
+
+    // arguments as "name=value name=value" identify the case along with function and types
+    std::string arguments;
+    for(auto& [name, value] : arg_list)
+        arguments += (arguments.empty() ? "" : " ") + name + "=" + value;
+
+    std::string case_key = std::string(arg.function) + " " + rocblas_datatype2string(arg.a_type)
+                           + " " + rocblas_datatype2string(arg.compute_type) + " " + arguments
+                           + " device=" + std::to_string(device);
+    size_t sample = state.samples[case_key]++;
+
+    std::vector<std::string> values = {
+        json ? json_string(timestamp) : timestamp,
+        json ? json_string(state.version) : csv_string(state.version),
+        std::to_string(device),
+        json ? json_string(dev.name) : csv_string(dev.name),
+        json ? json_string(dev.arch) : csv_string(dev.arch),
+        std::to_string(dev.sclk_MHz),
+        std::to_string(dev.mclk_MHz),
+        std::to_string(dev.CUs),
+        json ? json_string(arg.function) : csv_string(arg.function),
+        json ? json_string(arg.name) : csv_string(arg.name),
+        json ? json_string(rocblas_datatype2string(arg.a_type))
+             : rocblas_datatype2string(arg.a_type),
+        json ? json_string(rocblas_datatype2string(arg.b_type))
+             : rocblas_datatype2string(arg.b_type),
+        json ? json_string(rocblas_datatype2string(arg.c_type))
+             : rocblas_datatype2string(arg.c_type),
+        json ? json_string(rocblas_datatype2string(arg.d_type))
+             : rocblas_datatype2string(arg.d_type),
+        json ? json_string(rocblas_datatype2string(arg.compute_type))
+             : rocblas_datatype2string(arg.compute_type),
+        "", // arguments
+        std::to_string(batch_count),
+        std::to_string(arg.solution_index),
+        std::to_string(arg.cold_iters),
+        std::to_string(arg.iters),
+        std::to_string(sample),
+        number(gpu_us, json),
+        number(gflops == ArgumentLogging::NA_value ? gflops : rocblas_gflops, json),
+        number(gbytes == ArgumentLogging::NA_value ? gbytes : rocblas_GBps, json),
+        number(cpu_us, json),
+        number(norm1, json),
+        number(norm2, json),
+        number(norm3, json),
+        number(norm4, json),
+    };
+
+    if(json)
+    {
+        std::string args_object = "{";
+        for(auto& [name, value] : arg_list)
+            args_object += (args_object.size() > 1 ? ", " : "") + json_string(name) + ": "
+                           + json_value(value);
+        values[c_arguments_column] = args_object + "}";
+
+        state.file << "{";
+        for(size_t i = 0; i < values.size(); i++)
+            state.file << (i ? ", " : "") << json_string(c_output_columns[i]) << ": "
+                       << values[i];
+        state.file << "}\n";
+    }
+    else
+    {
+        values[c_arguments_column] = csv_string(arguments);
+        for(size_t i = 0; i < values.size(); i++)
+            state.file << (i ? "," : "") << values[i];
+        state.file << "\n";
+    }
+    state.file.flush();
+}
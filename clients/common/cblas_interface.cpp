@@ -1213,6 +1213,81 @@ void cblas_geam_plus_min(rocblas_operation transA,
     }
 }
 
+template <typename T>
+void cblas_geam_ex(rocblas_geam_ex_operation geam_ex_op,
+                   rocblas_operation         transA,
+                   rocblas_operation         transB,
+                   int64_t                   m,
+                   int64_t                   n,
+                   int64_t                   k,
+                   const T                   alpha,
+                   const T*                  A,
+                   int64_t                   lda,
+                   const T*                  B,
+                   int64_t                   ldb,
+                   const T                   beta,
+                   const T*                  C,
+                   int64_t                   ldc,
+                   T*                        D,
+                   int64_t                   ldd)
+{
+    if(geam_ex_op == rocblas_geam_ex_operation_min_plus)
+        return cblas_geam_min_plus(
+            transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, D, ldd);
+    if(geam_ex_op == rocblas_geam_ex_operation_plus_min)
+        return cblas_geam_plus_min(
+            transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, D, ldd);
+
+    // Dij = add(beta * Cij, add_k(mul(alpha * Aik, alpha * Bkj)))
+    auto add = [geam_ex_op](T x, T y) -> T {
+        if(geam_ex_op == rocblas_geam_ex_operation_min_max)
+            return std::min(x, y);
+        else if(geam_ex_op == rocblas_geam_ex_operation_or_and)
+            return (x != T(0) || y != T(0)) ? T(1) : T(0);
+        else
+            return std::max(x, y);
+    };
+
+    auto mul = [geam_ex_op](T x, T y) -> T {
+        if(geam_ex_op == rocblas_geam_ex_operation_max_plus)
+            return x + y;
+        else if(geam_ex_op == rocblas_geam_ex_operation_min_max)
+            return std::max(x, y);
+        else if(geam_ex_op == rocblas_geam_ex_operation_max_min)
+            return std::min(x, y);
+        else
+            return (x != T(0) && y != T(0)) ? T(1) : T(0);
+    };
+
+    bool TRANSA = transA != rocblas_operation_none;
+    bool TRANSB = transB != rocblas_operation_none;
+
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for(int64_t n1 = 0; n1 < n; n1++)
+    {
+        for(int64_t m1 = 0; m1 < m; m1++)
+        {
+            size_t idxC = size_t(ldc) * n1 + m1;
+            size_t idxD = size_t(ldd) * n1 + m1;
+            T      d    = beta * C[idxC];
+
+            // the boolean semiring maps beta * Cij to 0 or 1 even when k == 0
+            if(geam_ex_op == rocblas_geam_ex_operation_or_and)
+                d = add(d, T(0));
+
+            for(int64_t k1 = 0; k1 < k; k1++)
+            {
+                size_t idxA = TRANSA ? size_t(lda) * m1 + k1 : size_t(lda) * k1 + m1;
+                size_t idxB = TRANSB ? size_t(ldb) * k1 + n1 : size_t(ldb) * n1 + k1;
+                d           = add(d, mul(alpha * A[idxA], alpha * B[idxB]));
+            }
+            D[idxD] = d;
+        }
+    }
+}
+
 template <typename T, typename U>
 void cblas_herkx(rocblas_fill      uplo,
                  rocblas_operation transA,
@@ -1435,6 +1510,57 @@ template void cblas_geam_plus_min<rocblas_half>(rocblas_operation   transA,
                                                 rocblas_half*       D,
                                                 int64_t             ldd);
 
+template void cblas_geam_ex<float>(rocblas_geam_ex_operation geam_ex_op,
+                                   rocblas_operation         transA,
+                                   rocblas_operation         transB,
+                                   int64_t                   m,
+                                   int64_t                   n,
+                                   int64_t                   k,
+                                   const float               alpha,
+                                   const float*              A,
+                                   int64_t                   lda,
+                                   const float*              B,
+                                   int64_t                   ldb,
+                                   const float               beta,
+                                   const float*              C,
+                                   int64_t                   ldc,
+                                   float*                    D,
+                                   int64_t                   ldd);
+
+template void cblas_geam_ex<double>(rocblas_geam_ex_operation geam_ex_op,
+                                    rocblas_operation         transA,
+                                    rocblas_operation         transB,
+                                    int64_t                   m,
+                                    int64_t                   n,
+                                    int64_t                   k,
+                                    const double              alpha,
+                                    const double*             A,
+                                    int64_t                   lda,
+                                    const double*             B,
+                                    int64_t                   ldb,
+                                    const double              beta,
+                                    const double*             C,
+                                    int64_t                   ldc,
+                                    double*                   D,
+                                    int64_t                   ldd);
+
+template void cblas_geam_ex<rocblas_half>(rocblas_geam_ex_operation geam_ex_op,
+                                          rocblas_operation         transA,
+                                          rocblas_operation         transB,
+                                          int64_t                   m,
+                                          int64_t                   n,
+                                          int64_t                   k,
+                                          const rocblas_half        alpha,
+                                          const rocblas_half*       A,
+                                          int64_t                   lda,
+                                          const rocblas_half*       B,
+                                          int64_t                   ldb,
+                                          const rocblas_half        beta,
+                                          const rocblas_half*       C,
+                                          int64_t                   ldc,
+                                          rocblas_half*             D,
+                                          int64_t                   ldd);
+
 template void cblas_herkx<rocblas_float_complex, float>(rocblas_fill                 uplo,
                                                         rocblas_operation            transA,
                                                         int64_t                      n,
@@ -0,0 +1,257 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "client_memory_pool.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    constexpr size_t c_kinds = size_t(client_memory_kind::count);
+
+    // kind, device and size class of a block
+    using block_key = std::tuple<client_memory_kind, int, size_t>;
+
+    struct client_memory_pool
+    {
+        std::mutex                              mutex;
+        std::map<block_key, std::vector<void*>> free_blocks;
+        std::unordered_map<void*, block_key>    live_blocks;
+        size_t                                  cached_bytes[c_kinds]{};
+        client_memory_pool_stats                stats;
+        bool                                    enabled   = true;
+        bool                                    best_fit  = false;
+        size_t                                  cache_cap = size_t(1) << 30;
+
+        client_memory_pool()
+        {
+            // ROCBLAS_CLIENT_NO_POOL allocates and frees every buffer with hip as before
+            enabled = !getenv("ROCBLAS_CLIENT_NO_POOL");
+
+            auto* cap_str = getenv("ROCBLAS_CLIENT_POOL_MB");
+            if(cap_str)
+            {
+                size_t cap_mb;
+                if(sscanf(cap_str, "%zu", &cap_mb) == 1)
+                    cache_cap = cap_mb << 20;
+            }
+        }
+    };
+
+    client_memory_pool& pool()
+    {
+        // Never destroyed, as hip may be shut down before static destructors run.
+        // client_pool_release frees the cached blocks at the end of main.
+        static auto* p = new client_memory_pool;
+        return *p;
+    }
+
+    // Four size classes per power of two above 4 kB, so a reused block wastes at most 25%
+    size_t size_class(size_t bytes)
+    {
+        constexpr size_t min_class = 4096;
+        if(bytes <= min_class)
+            return min_class;
+
+        size_t top = min_class;
+        while(top < bytes / 2)
+            top *= 2;
+        size_t step = top / 4;
+        return (bytes + step - 1) / step * step;
+    }
+
+    void* hip_malloc(client_memory_kind kind, size_t bytes)
+    {
+        void*      ptr    = nullptr;
+        hipError_t status = hipErrorInvalidValue;
+        switch(kind)
+        {
+        case client_memory_kind::device:
+            status = (hipMalloc)(&ptr, bytes);
+            break;
+        case client_memory_kind::managed:
+            status = hipMallocManaged(&ptr, bytes);
+            break;
+        case client_memory_kind::pinned_host:
+            status = hipHostMalloc(&ptr, bytes, hipHostMallocDefault);
+            break;
+        case client_memory_kind::count:
+            break;
+        }
+        return status == hipSuccess ? ptr : nullptr;
+    }
+
+    hipError_t hip_free(client_memory_kind kind, void* ptr)
+    {
+        return kind == client_memory_kind::pinned_host ? hipHostFree(ptr) : (hipFree)(ptr);
+    }
+
+    // Frees the cached blocks of one kind, or of all kinds. Called with the mutex held.
+    void release_locked(client_memory_pool& p, client_memory_kind kind, bool all_kinds)
+    {
+        for(auto it = p.free_blocks.begin(); it != p.free_blocks.end();)
+        {
+            client_memory_kind block_kind = std::get<0>(it->first);
+            if(!all_kinds && block_kind != kind)
+            {
+                ++it;
+                continue;
+            }
+            for(void* ptr : it->second)
+                hip_free(block_kind, ptr);
+            p.cached_bytes[size_t(block_kind)] -= std::get<2>(it->first) * it->second.size();
+            it = p.free_blocks.erase(it);
+        }
+    }
+
+    size_t total_cached(const client_memory_pool& p)
+    {
+        size_t total = 0;
+        for(size_t bytes : p.cached_bytes)
+            total += bytes;
+        return total;
+    }
+}
+
+void* client_pool_malloc(client_memory_kind kind, size_t bytes)
+{
+    auto& p = pool();
+
+    int device = -1;
+    if(kind != client_memory_kind::pinned_host)
+        (void)hipGetDevice(&device);
+
+    std::lock_guard<std::mutex> lock(p.mutex);
+
+    // blocks too large to cache are allocated at their exact size
+    size_t    block_bytes = size_class(bytes);
+    bool      cacheable   = p.enabled && (p.best_fit || block_bytes <= p.cache_cap / 4);
+    block_key key{kind, device, cacheable ? block_bytes : bytes};
+
+    if(cacheable)
+    {
+        // with best fit the smallest cached block of at least the size class is used
+        auto it = p.best_fit ? p.free_blocks.lower_bound(key) : p.free_blocks.find(key);
+        while(p.best_fit && it != p.free_blocks.end() && it->second.empty()
+              && std::get<0>(it->first) == kind && std::get<1>(it->first) == device)
+            ++it;
+
+        if(it != p.free_blocks.end() && !it->second.empty() && std::get<0>(it->first) == kind
+           && std::get<1>(it->first) == device)
+        {
+            void* ptr = it->second.back();
+            it->second.pop_back();
+            p.cached_bytes[size_t(kind)] -= std::get<2>(it->first);
+            p.live_blocks[ptr] = it->first;
+            p.stats.hits++;
+            return ptr;
+        }
+    }
+
+    auto  start = std::chrono::steady_clock::now();
+    void* ptr   = hip_malloc(kind, std::get<2>(key));
+    if(!ptr && p.cached_bytes[size_t(kind)])
+    {
+        // the cached blocks may be what is filling the memory
+        release_locked(p, kind, false);
+        ptr = hip_malloc(kind, std::get<2>(key));
+    }
+    p.stats.miss_us += std::chrono::duration<double, std::micro>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+    p.stats.misses++;
+
+    if(ptr)
+        p.live_blocks[ptr] = key;
+    return ptr;
+}
+
+void client_pool_free(client_memory_kind kind, void* ptr)
+{
+    if(!ptr)
+        return;
+
+    auto&                       p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+
+    auto it = p.live_blocks.find(ptr);
+    if(it == p.live_blocks.end())
+    {
+        // not from client_pool_malloc
+        hip_free(kind, ptr);
+        return;
+    }
+
+    block_key key = it->second;
+    p.live_blocks.erase(it);
+
+    size_t block_bytes = std::get<2>(key);
+    if(p.enabled
+       && (p.best_fit
+           || (block_bytes <= p.cache_cap / 4
+               && p.cached_bytes[size_t(kind)] + block_bytes <= p.cache_cap)))
+    {
+        p.free_blocks[key].push_back(ptr);
+        p.cached_bytes[size_t(kind)] += block_bytes;
+    }
+    else
+    {
+        auto start = std::chrono::steady_clock::now();
+        hip_free(kind, ptr);
+        p.stats.miss_us += std::chrono::duration<double, std::micro>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    }
+}
+
+void client_pool_release()
+{
+    auto&                       p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    release_locked(p, client_memory_kind::count, true);
+}
+
+void client_pool_set_best_fit(bool best_fit)
+{
+    auto&                       p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    p.best_fit = best_fit;
+}
+
+client_memory_pool_stats client_pool_get_stats()
+{
+    auto&                       p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+
+    client_memory_pool_stats stats = p.stats;
+    stats.cached_bytes             = total_cached(p);
+    return stats;
+}
@@ -29,6 +29,7 @@
 #include <string.h>
 #endif
 
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <stdlib.h>
@@ -67,26 +68,18 @@ size_t host_bytes_allocated()
     return mem_used;
 }
 
+#ifndef WIN32
 //!
-//! @brief Memory free helper.  Returns kB or -1 if unknown.
+//! @brief Reads the free memory line of /proc/meminfo. Returns bytes or -1 if unknown.
 //!
-ptrdiff_t host_bytes_available()
+static ptrdiff_t read_meminfo_bytes()
 {
-#ifdef WIN32
-
-    MEMORYSTATUSEX status;
-    status.dwLength = sizeof(status);
-    GlobalMemoryStatusEx(&status);
-    return (ptrdiff_t)status.ullAvailPhys;
-
-#else
-
     const int BUF_MAX = 1024;
     char      buf[BUF_MAX];
 
     ptrdiff_t n_bytes = -1; // unknown
 
-    FILE* fp = popen("cat /proc/meminfo", "r");
+    FILE* fp = fopen("/proc/meminfo", "r");
     if(fp == NULL)
     {
         return n_bytes;
@@ -105,22 +98,60 @@ ptrdiff_t host_bytes_available()
         // set env ROCBLAS_CLIENT_ALLOC_AVAILABLE to use MemAvailable if too many SKIPS occur
         if(!strncmp(buf, mem_token, mem_token_len))
         {
-            sscanf(buf, "%*s %td", &n_bytes); // kB assumed as 3rd column and ignored
-            n_bytes *= 1024;
+            if(sscanf(buf, "%*s %td", &n_bytes) == 1) // kB assumed as 3rd column and ignored
+                n_bytes *= 1024;
+            else
+                n_bytes = -1;
             break;
         }
     }
 
-    int status = pclose(fp);
-    if(status == -1)
-    {
-        return -1;
-    }
-    else
+    fclose(fp);
+    return n_bytes;
+}
+#endif
+
+//!
+//! @brief Memory free helper.  Returns bytes or -1 if unknown.
+//!
+ptrdiff_t host_bytes_available()
+{
+#ifdef WIN32
+
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    GlobalMemoryStatusEx(&status);
+    return (ptrdiff_t)status.ullAvailPhys;
+
+#else
+
+    // /proc/meminfo is read directly and the result reused for a second, adjusted by the client's
+    // own allocations since, as large allocation checks can come in quick succession
+    static std::mutex                            meminfo_mutex;
+    static std::chrono::steady_clock::time_point meminfo_time;
+    static ptrdiff_t                             meminfo_bytes     = -1;
+    static size_t                                meminfo_allocated = 0;
+    static bool                                  meminfo_read      = false;
+
+    std::lock_guard<std::mutex> lock(meminfo_mutex);
+
+    auto   now       = std::chrono::steady_clock::now();
+    size_t allocated = host_bytes_allocated();
+
+    if(!meminfo_read || now - meminfo_time > std::chrono::seconds(1))
     {
-        return n_bytes;
+        meminfo_bytes     = read_meminfo_bytes();
+        meminfo_allocated = allocated;
+        meminfo_time      = now;
+        meminfo_read      = true;
     }
 
+    if(meminfo_bytes < 0)
+        return -1;
+
+    ptrdiff_t n_bytes = meminfo_bytes - (ptrdiff_t(allocated) - ptrdiff_t(meminfo_allocated));
+    return n_bytes > 0 ? n_bytes : 0;
+
 #endif
 }
 
@@ -214,7 +245,7 @@ void* host_calloc(size_t nmemb, size_t size)
     if(host_mem_safe(nmemb * size))
     {
         void* ptr = calloc(nmemb, size);
-        alloc_ptr_use(ptr, size);
+        alloc_ptr_use(ptr, nmemb * size);
         return ptr;
     }
     else
@@ -65,6 +65,9 @@ void Arguments::init()
     beta   = 0.0;
     betai  = 0.0;
 
+    init_scale_a = 1.0;
+    init_scale_x = 1.0;
+
     stride_a = 0;
     stride_b = 0;
     stride_c = 0;
@@ -105,6 +108,9 @@ void Arguments::init()
 
     geam_ex_op = rocblas_geam_ex_operation_min_plus;
 
+    scale_a_mode = rocblas_gemm_scale_mode_none;
+    scale_b_mode = rocblas_gemm_scale_mode_none;
+
     flags = rocblas_gemm_flags_none;
 
     a_type       = rocblas_datatype_f32_r;
@@ -119,6 +125,8 @@ void Arguments::init()
 
     atomics_mode = rocblas_atomics_allowed;
 
+    reproducibility_mode = rocblas_reproducibility_default;
+
     math_mode = rocblas_default_math;
 
     os_flags = rocblas_client_os::ALL;
@@ -268,6 +268,14 @@ def setdefaults(test):
         if test['function'] in ('trsv_strided_batched'):
             setkey_product(test, 'stride_a', ['lda', 'M', 'stride_scale'])
 
+    elif test['function'] in ('ger_k_strided_batched', 'geru_k_strided_batched',
+                              'gerc_k_strided_batched', 'syr_k_strided_batched',
+                              'her_k_strided_batched'):
+        # x and y are ldb x K and ldc x K matrices
+        setkey_product(test, 'stride_x', ['ldb', 'K', 'stride_scale'])
+        setkey_product(test, 'stride_y', ['ldc', 'K', 'stride_scale'])
+        setkey_product(test, 'stride_a', ['lda', 'N', 'stride_scale'])
+
     elif test['function'] in ('hemv_strided_batched', 'hbmv_strided_batched',
                               'sbmv_strided_batched'):
         if all([x in test for x in ('N', 'incx', 'incy', 'stride_scale')]):
@@ -26,32 +26,8 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
-#include <fcntl.h>
 #include <iostream>
 #include <string>
-#include <sys/types.h>
-
-// Parse YAML data
-static std::string rocblas_parse_yaml(const std::string& yaml)
-{
-    std::string tmp     = rocblas_tempname();
-    auto        exepath = rocblas_exepath();
-    auto cmd = exepath + "rocblas_gentest.py --template " + exepath + "rocblas_template.yaml -o "
-               + tmp + " " + yaml;
-    rocblas_cerr << cmd << std::endl;
-
-#ifdef WIN32
-    int status = std::system(cmd.c_str());
-    if(status == -1)
-        exit(EXIT_FAILURE);
-#else
-    int status = system(cmd.c_str());
-    if(status == -1 || !WIFEXITED(status) || WEXITSTATUS(status))
-        exit(EXIT_FAILURE);
-#endif
-
-    return tmp;
-}
 
 // Parse --data and --yaml command-line arguments
 bool rocblas_parse_data(int& argc, char** argv, const std::string& default_file)
@@ -106,12 +82,13 @@ bool rocblas_parse_data(int& argc, char** argv, const std::string& default_file)
     else if(filename == "")
         filename = default_file;
 
-    if(yaml)
-        filename = rocblas_parse_yaml(filename);
-
     if(filename != "")
     {
-        RocBLAS_TestData::set_filename(filename, yaml);
+        // YAML files are expanded in process, as the tests read them
+        if(yaml)
+            RocBLAS_TestData::set_yaml(filename, rocblas_exepath() + "rocblas_template.yaml");
+        else
+            RocBLAS_TestData::set_filename(filename);
         return true;
     }
 
@@ -0,0 +1,2336 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// This is a port of rocblas_gentest.py. The YAML reader covers the subset of YAML used by the
+// rocBLAS test files: block and flow collections, plain and quoted scalars, anchors, aliases and
+// merge keys, resolved to values as PyYAML does. The expansion follows the Python functions of
+// the same names, including their quirks, so that the records are identical.
+
+#include "rocblas_yaml_expand.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <unordered_set>
+#include <variant>
+
+namespace
+{
+    /**********************************************************************
+     * Values                                                             *
+     **********************************************************************/
+
+    struct yaml_value;
+    using yaml_list = std::vector<yaml_value>;
+    using yaml_dict = std::map<std::string, yaml_value>;
+
+    // A YAML node as the Python value PyYAML constructs for it
+    struct yaml_value
+    {
+        std::variant<std::monostate,
+                     bool,
+                     int64_t,
+                     double,
+                     std::string,
+                     std::shared_ptr<const yaml_list>,
+                     std::shared_ptr<const yaml_dict>>
+            v;
+
+        yaml_value() = default;
+
+        yaml_value(bool value)
+            : v(value)
+        {
+        }
+
+        yaml_value(int64_t value)
+            : v(value)
+        {
+        }
+
+        yaml_value(double value)
+            : v(value)
+        {
+        }
+
+        yaml_value(std::string value)
+            : v(std::move(value))
+        {
+        }
+
+        yaml_value(yaml_list list)
+            : v(std::make_shared<const yaml_list>(std::move(list)))
+        {
+        }
+
+        yaml_value(yaml_dict dict)
+            : v(std::make_shared<const yaml_dict>(std::move(dict)))
+        {
+        }
+
+        bool is_none() const
+        {
+            return v.index() == 0;
+        }
+
+        const bool* boolean() const
+        {
+            return std::get_if<bool>(&v);
+        }
+
+        const int64_t* integer() const
+        {
+            return std::get_if<int64_t>(&v);
+        }
+
+        const double* real() const
+        {
+            return std::get_if<double>(&v);
+        }
+
+        const std::string* str() const
+        {
+            return std::get_if<std::string>(&v);
+        }
+
+        const yaml_list* list() const
+        {
+            auto* p = std::get_if<std::shared_ptr<const yaml_list>>(&v);
+            return p ? p->get() : nullptr;
+        }
+
+        const yaml_dict* dict() const
+        {
+            auto* p = std::get_if<std::shared_ptr<const yaml_dict>>(&v);
+            return p ? p->get() : nullptr;
+        }
+
+        // bool and int, which Python treats as integers
+        bool is_int() const
+        {
+            return boolean() || integer();
+        }
+
+        bool is_number() const
+        {
+            return is_int() || real();
+        }
+
+        int64_t as_int() const
+        {
+            return boolean() ? *boolean() : *integer();
+        }
+
+        double as_real() const
+        {
+            return real() ? *real() : double(as_int());
+        }
+
+        // Python type name, for error messages
+        const char* type_name() const
+        {
+            static const char* names[]
+                = {"NoneType", "bool", "int", "float", "str", "list", "dict"};
+            return names[v.index()];
+        }
+    };
+
+    // Python repr of a value, for error messages
+    void py_repr(std::ostream& os, const yaml_value& value)
+    {
+        if(value.is_none())
+            os << "None";
+        else if(value.boolean())
+            os << (*value.boolean() ? "True" : "False");
+        else if(value.integer())
+            os << *value.integer();
+        else if(value.real())
+            os << *value.real();
+        else if(value.str())
+            os << '\'' << *value.str() << '\'';
+        else if(value.list())
+        {
+            os << '[';
+            const char* sep = "";
+            for(auto& item : *value.list())
+            {
+                os << sep;
+                py_repr(os, item);
+                sep = ", ";
+            }
+            os << ']';
+        }
+        else
+        {
+            os << '{';
+            const char* sep = "";
+            for(auto& item : *value.dict())
+            {
+                os << sep << '\'' << item.first << "': ";
+                py_repr(os, item.second);
+                sep = ", ";
+            }
+            os << '}';
+        }
+    }
+
+    // Python truth value
+    bool py_truth(const yaml_value& value)
+    {
+        if(value.is_none())
+            return false;
+        if(value.is_int())
+            return value.as_int() != 0;
+        if(value.real())
+            return *value.real() != 0;
+        if(value.str())
+            return !value.str()->empty();
+        if(value.list())
+            return !value.list()->empty();
+        return !value.dict()->empty();
+    }
+
+    // Python ==
+    bool py_equal(const yaml_value& a, const yaml_value& b)
+    {
+        if(a.is_number() && b.is_number())
+        {
+            if(a.is_int() && b.is_int())
+                return a.as_int() == b.as_int();
+            return a.as_real() == b.as_real();
+        }
+        if(a.v.index() != b.v.index())
+            return false;
+        if(a.is_none())
+            return true;
+        if(a.str())
+            return *a.str() == *b.str();
+        if(a.list())
+        {
+            auto &la = *a.list(), &lb = *b.list();
+            if(la.size() != lb.size())
+                return false;
+            for(size_t i = 0; i < la.size(); ++i)
+                if(!py_equal(la[i], lb[i]))
+                    return false;
+            return true;
+        }
+        auto &da = *a.dict(), &db = *b.dict();
+        if(da.size() != db.size())
+            return false;
+        for(auto ia = da.begin(), ib = db.begin(); ia != da.end(); ++ia, ++ib)
+            if(ia->first != ib->first || !py_equal(ia->second, ib->second))
+                return false;
+        return true;
+    }
+
+    // Exits with a message, as sys.exit does in rocblas_gentest.py
+    [[noreturn]] void fatal(const std::string& message)
+    {
+        rocblas_cerr << message << std::endl;
+        exit(EXIT_FAILURE);
+    }
+
+    /**********************************************************************
+     * Source                                                             *
+     **********************************************************************/
+
+    // One line of YAML with where it came from, as in read_yaml_file
+    struct source_line
+    {
+        std::string text;
+        std::string file;
+        size_t      line_no;
+    };
+
+    bool file_exists(const std::string& path)
+    {
+        std::ifstream ifs(path);
+        return ifs.good();
+    }
+
+    std::string dir_name(const std::string& path)
+    {
+        auto slash = path.find_last_of('/');
+        return slash == std::string::npos ? "" : path.substr(0, slash);
+    }
+
+    // Reads the YAML file, processing include: lines as an extension
+    void read_yaml_file(const std::string&              file,
+                        const std::vector<std::string>& includes,
+                        std::vector<source_line>&       source)
+    {
+        std::ifstream ifs(file);
+        if(!ifs)
+            fatal("Cannot open " + file);
+
+        std::string file_dir = dir_name(file);
+        if(file_dir.empty())
+            file_dir = ".";
+
+        // include\s*:\s*([-.\w/]+)
+        static const std::regex include_re(R"(include\s*:\s*([-.\w/]+))");
+
+        std::string line;
+        size_t      line_no = 0;
+        while(std::getline(ifs, line))
+        {
+            ++line_no;
+            if(!ifs.eof())
+                line += '\n';
+
+            std::smatch match;
+            if(line.compare(0, 7, "include")
+               || !std::regex_search(
+                   line, match, include_re, std::regex_constants::match_continuous))
+            {
+                source.push_back({line, file, line_no});
+                continue;
+            }
+
+            std::string include_file = match[1];
+            std::vector<std::string> include_dirs{file_dir};
+            include_dirs.insert(include_dirs.end(), includes.begin(), includes.end());
+
+            bool found = false;
+            for(auto& dir : include_dirs)
+            {
+                std::string path = include_file[0] == '/' ? include_file : dir + "/" + include_file;
+                if(file_exists(path))
+                {
+                    read_yaml_file(path, includes, source);
+                    found = true;
+                    break;
+                }
+            }
+            if(!found)
+            {
+                std::string msg = "In file " + file + ", line " + std::to_string(line_no)
+                                  + ", column " + std::to_string(match.position(1) + 1) + ":\n"
+                                  + line.substr(0, line.find_last_not_of(" \t\r\n") + 1) + "\n"
+                                  + std::string(match.position(1), ' ') + "^\nCannot open "
+                                  + include_file + "\n\nInclude paths:";
+                for(auto& dir : include_dirs)
+                    msg += "\n" + dir;
+                fatal(msg);
+            }
+        }
+    }
+
+    /**********************************************************************
+     * YAML reader                                                        *
+     **********************************************************************/
+
+    // Resolves a plain scalar to null, bool, int, float or str with the YAML 1.1 rules of PyYAML
+    yaml_value resolve_plain(const std::string& s)
+    {
+        if(s.empty() || s == "~" || s == "null" || s == "Null" || s == "NULL")
+            return {};
+
+        static const std::set<std::string> true_values{
+            "yes", "Yes", "YES", "true", "True", "TRUE", "on", "On", "ON"};
+        static const std::set<std::string> false_values{
+            "no", "No", "NO", "false", "False", "FALSE", "off", "Off", "OFF"};
+        if(true_values.count(s))
+            return true;
+        if(false_values.count(s))
+            return false;
+
+        static const std::regex int_re(
+            R"([-+]?0b[0-1_]+|[-+]?0[0-7_]+|[-+]?(?:0|[1-9][0-9_]*))"
+            R"(|[-+]?0x[0-9a-fA-F_]+|[-+]?[1-9][0-9_]*(?::[0-5]?[0-9])+)");
+        static const std::regex float_re(
+            R"([-+]?(?:[0-9][0-9_]*)\.[0-9_]*(?:[eE][-+][0-9]+)?|\.[0-9_]+(?:[eE][-+][0-9]+)?)"
+            R"(|[-+]?[0-9][0-9_]*(?::[0-5]?[0-9])+\.[0-9_]*)"
+            R"(|[-+]?\.(?:inf|Inf|INF)|\.(?:nan|NaN|NAN))");
+
+        bool is_int = std::regex_match(s, int_re);
+        if(!is_int && !std::regex_match(s, float_re))
+            return s;
+
+        std::string value;
+        for(char c : s)
+            if(c != '_')
+                value += is_int ? c : char(tolower(c));
+
+        int sign = 1;
+        if(value[0] == '-')
+            sign = -1;
+        if(value[0] == '-' || value[0] == '+')
+            value.erase(0, 1);
+
+        auto sexagesimal = [&](auto digit) {
+            decltype(digit(std::string())) result = 0;
+            std::stringstream              ss(value);
+            std::string                    part;
+            while(std::getline(ss, part, ':'))
+                result = result * 60 + digit(part);
+            return result;
+        };
+
+        if(is_int)
+        {
+            int64_t result;
+            if(value == "0")
+                result = 0;
+            else if(!value.compare(0, 2, "0b"))
+                result = strtoll(value.c_str() + 2, nullptr, 2);
+            else if(!value.compare(0, 2, "0x"))
+                result = strtoll(value.c_str() + 2, nullptr, 16);
+            else if(value[0] == '0')
+                result = strtoll(value.c_str(), nullptr, 8);
+            else if(value.find(':') != std::string::npos)
+                result = sexagesimal([](const std::string& d) { return int64_t(stoll(d)); });
+            else
+                result = strtoll(value.c_str(), nullptr, 10);
+            return sign * result;
+        }
+
+        if(value == ".inf")
+            return sign * std::numeric_limits<double>::infinity();
+        if(value == ".nan")
+        {
+            // PyYAML's nan_value is -inf/inf computed at run time, the hardware's default NaN
+            volatile double inf = std::numeric_limits<double>::infinity();
+            return -inf / inf;
+        }
+        if(value.find(':') != std::string::npos)
+            return sign
+                   * sexagesimal([](const std::string& d) { return strtod(d.c_str(), nullptr); });
+        return sign * strtod(value.c_str(), nullptr);
+    }
+
+    class yaml_reader
+    {
+        const std::vector<source_line>& m_source;
+        std::string                     m_src;
+        std::vector<size_t>             m_line_start;
+        size_t                          m_pos = 0;
+        std::map<std::string, yaml_value> m_anchors;
+
+        /******************** Errors ********************/
+
+        [[noreturn]] void error(const std::string& problem, size_t pos) const
+        {
+            size_t line = std::upper_bound(m_line_start.begin(), m_line_start.end(), pos)
+                          - m_line_start.begin() - 1;
+            size_t column = pos - m_line_start[line];
+            auto&  src    = m_source[line];
+            fatal("In file " + src.file + ", line " + std::to_string(src.line_no) + ", column "
+                  + std::to_string(column + 1) + ":\n"
+                  + src.text.substr(0, src.text.find_last_not_of(" \t\r\n") + 1) + "\n"
+                  + std::string(column, ' ') + "^\n" + problem);
+        }
+
+        [[noreturn]] void error(const std::string& problem) const
+        {
+            error(problem, m_pos);
+        }
+
+        /******************** Characters ********************/
+
+        char peek(size_t ahead = 0) const
+        {
+            return m_pos + ahead < m_src.size() ? m_src[m_pos + ahead] : '\0';
+        }
+
+        bool at_end() const
+        {
+            return m_pos >= m_src.size();
+        }
+
+        static bool is_space(char c)
+        {
+            return c == ' ' || c == '\t';
+        }
+
+        static bool is_break(char c)
+        {
+            return c == '\n' || c == '\r' || c == '\0';
+        }
+
+        static bool is_blank(char c)
+        {
+            return is_space(c) || is_break(c);
+        }
+
+        static bool is_flow_indicator(char c)
+        {
+            return c == ',' || c == '[' || c == ']' || c == '{' || c == '}';
+        }
+
+        int column() const
+        {
+            size_t line = std::upper_bound(m_line_start.begin(), m_line_start.end(), m_pos)
+                          - m_line_start.begin() - 1;
+            return int(m_pos - m_line_start[line]);
+        }
+
+        void skip_spaces()
+        {
+            while(is_space(peek()))
+                ++m_pos;
+        }
+
+        void skip_comment()
+        {
+            if(peek() == '#')
+                while(!is_break(peek()))
+                    ++m_pos;
+        }
+
+        // Skips spaces and a comment, returning whether the line has ended
+        bool at_line_end()
+        {
+            skip_spaces();
+            skip_comment();
+            return is_break(peek());
+        }
+
+        // Moves to the next character of content, skipping spaces, comments and line breaks
+        void skip_to_content()
+        {
+            for(;;)
+            {
+                skip_spaces();
+                skip_comment();
+                if(at_end() || !is_break(peek()))
+                    return;
+                ++m_pos;
+            }
+        }
+
+        bool at_document_marker() const
+        {
+            return column() == 0
+                   && (!m_src.compare(m_pos, 3, "---") || !m_src.compare(m_pos, 3, "..."))
+                   && is_blank(peek(3));
+        }
+
+        bool at_sequence_entry() const
+        {
+            return peek() == '-' && is_blank(peek(1));
+        }
+
+        /******************** Scalars ********************/
+
+        // Appends the line folding of a quoted or plain scalar: one line break becomes a space,
+        // and each further line break is kept
+        void fold_lines(std::string& text)
+        {
+            size_t breaks = 0;
+            while(is_blank(peek()) && !at_end())
+            {
+                if(peek() == '\n')
+                    ++breaks;
+                ++m_pos;
+            }
+            if(breaks == 1)
+                text += ' ';
+            else
+                text.append(breaks - 1, '\n');
+        }
+
+        std::string parse_single_quoted()
+        {
+            size_t      start = m_pos++;
+            std::string text;
+            for(;;)
+            {
+                char c = peek();
+                if(at_end())
+                    error("found unexpected end of stream while scanning a quoted scalar", start);
+                if(c == '\'')
+                {
+                    if(peek(1) != '\'')
+                    {
+                        ++m_pos;
+                        return text;
+                    }
+                    text += '\'';
+                    m_pos += 2;
+                }
+                else if(is_break(c))
+                {
+                    while(!text.empty() && is_space(text.back()))
+                        text.pop_back();
+                    fold_lines(text);
+                }
+                else
+                {
+                    text += c;
+                    ++m_pos;
+                }
+            }
+        }
+
+        std::string parse_double_quoted()
+        {
+            size_t      start = m_pos++;
+            std::string text;
+            for(;;)
+            {
+                char c = peek();
+                if(at_end())
+                    error("found unexpected end of stream while scanning a quoted scalar", start);
+                if(c == '"')
+                {
+                    ++m_pos;
+                    return text;
+                }
+                if(c == '\\')
+                {
+                    char e = peek(1);
+                    m_pos += 2;
+                    switch(e)
+                    {
+                    case '0': text += '\0'; break;
+                    case 'a': text += '\a'; break;
+                    case 'b': text += '\b'; break;
+                    case 't':
+                    case '\t': text += '\t'; break;
+                    case 'n': text += '\n'; break;
+                    case 'v': text += '\v'; break;
+                    case 'f': text += '\f'; break;
+                    case 'r': text += '\r'; break;
+                    case 'e': text += '\x1b'; break;
+                    case ' ': text += ' '; break;
+                    case '"': text += '"'; break;
+                    case '/': text += '/'; break;
+                    case '\\': text += '\\'; break;
+                    case '\n':
+                        // escaped line break joins the lines
+                        skip_spaces();
+                        break;
+                    case 'x':
+                    {
+                        text += char(strtol(m_src.substr(m_pos, 2).c_str(), nullptr, 16));
+                        m_pos += 2;
+                        break;
+                    }
+                    default: error("found unknown escape character while parsing a quoted scalar");
+                    }
+                }
+                else if(is_break(c))
+                {
+                    while(!text.empty() && is_space(text.back()))
+                        text.pop_back();
+                    fold_lines(text);
+                }
+                else
+                {
+                    text += c;
+                    ++m_pos;
+                }
+            }
+        }
+
+        // Plain scalar ending at a comment, ": " or, in flow context, a flow indicator. It may
+        // continue on following lines indented more than indent.
+        std::string parse_plain(int indent, bool flow)
+        {
+            std::string text;
+            for(;;)
+            {
+                size_t start = m_pos;
+                while(!is_break(peek()))
+                {
+                    char c = peek();
+                    if(c == ':' && (is_blank(peek(1)) || (flow && is_flow_indicator(peek(1)))))
+                        break;
+                    if(c == '#' && m_pos > start && is_space(m_src[m_pos - 1]))
+                        break;
+                    if(flow && is_flow_indicator(c))
+                        break;
+                    ++m_pos;
+                }
+
+                size_t end = m_pos;
+                while(end > start && is_space(m_src[end - 1]))
+                    --end;
+                text.append(m_src, start, end - start);
+
+                if(!is_break(peek()) || at_end())
+                    return text;
+
+                // A continuation line is more indented and not a comment, indicator or key
+                size_t      line_end = m_pos;
+                std::string folded;
+                fold_lines(folded);
+                skip_spaces();
+                char c = peek();
+                if(at_end() || c == '#' || at_document_marker() || column() <= indent
+                   || (flow && (is_flow_indicator(c) || c == ':'))
+                   || (!flow && (at_sequence_entry() || is_mapping_key())))
+                {
+                    m_pos = line_end;
+                    return text;
+                }
+                text += folded;
+            }
+        }
+
+        // Whether the content at the current position is a block mapping key
+        bool is_mapping_key() const
+        {
+            size_t p = m_pos;
+            char   q = peek();
+            if(q == '\'' || q == '"')
+            {
+                for(++p; p < m_src.size() && !is_break(m_src[p]); ++p)
+                {
+                    if(q == '\\' && m_src[p] == '\\')
+                        ++p;
+                    else if(m_src[p] == q)
+                    {
+                        if(q == '\'' && p + 1 < m_src.size() && m_src[p + 1] == '\'')
+                            ++p;
+                        else
+                            break;
+                    }
+                }
+                for(++p; p < m_src.size() && is_space(m_src[p]); ++p)
+                    ;
+                return p < m_src.size() && m_src[p] == ':'
+                       && (p + 1 == m_src.size() || is_blank(m_src[p + 1]));
+            }
+            if(q == '[' || q == '{' || q == '*' || q == '&' || q == '#')
+                return false;
+            for(; p < m_src.size() && !is_break(m_src[p]); ++p)
+            {
+                if(m_src[p] == ':' && (p + 1 == m_src.size() || is_blank(m_src[p + 1])))
+                    return true;
+                if(m_src[p] == '#' && p > m_pos && is_space(m_src[p - 1]))
+                    return false;
+            }
+            return false;
+        }
+
+        /******************** Nodes ********************/
+
+        std::string parse_anchor_name()
+        {
+            size_t start = ++m_pos;
+            while(!is_blank(peek()) && !is_flow_indicator(peek()))
+                ++m_pos;
+            if(m_pos == start)
+                error("expected alphabetic or numeric character while scanning an anchor");
+            return m_src.substr(start, m_pos - start);
+        }
+
+        yaml_value parse_alias()
+        {
+            size_t start = m_pos;
+            auto   name  = parse_anchor_name();
+            auto   it    = m_anchors.find(name);
+            if(it == m_anchors.end())
+                error("found undefined alias '" + name + "'", start);
+            return it->second;
+        }
+
+        // Adds a key to a mapping, collecting merge keys to apply once all keys are known
+        void add_key(yaml_dict&               dict,
+                     std::vector<yaml_value>& merges,
+                     const std::string&       key,
+                     bool                     plain,
+                     yaml_value               value,
+                     size_t                   pos)
+        {
+            if(plain && key == "<<")
+            {
+                if(value.dict())
+                    merges.push_back(std::move(value));
+                else if(value.list())
+                {
+                    // in a list of merged mappings, the earlier ones take precedence
+                    for(auto it = value.list()->rbegin(); it != value.list()->rend(); ++it)
+                    {
+                        if(!it->dict())
+                            error("expected a mapping for merging", pos);
+                        merges.push_back(*it);
+                    }
+                }
+                else
+                    error("expected a mapping or list of mappings for merging", pos);
+            }
+            else
+                dict[key] = std::move(value);
+        }
+
+        // Explicit keys take precedence over merged ones
+        static yaml_value merge(yaml_dict dict, const std::vector<yaml_value>& merges)
+        {
+            if(merges.empty())
+                return dict;
+            yaml_dict result;
+            for(auto& merged : merges)
+                for(auto& [key, value] : *merged.dict())
+                    result[key] = value;
+            for(auto& [key, value] : dict)
+                result[key] = value;
+            return result;
+        }
+
+        yaml_value parse_flow_node()
+        {
+            skip_to_content();
+            std::string anchor;
+            if(peek() == '&')
+            {
+                anchor = parse_anchor_name();
+                skip_to_content();
+            }
+
+            yaml_value value;
+            char       c = peek();
+            if(c == '*')
+                value = parse_alias();
+            else if(c == '{')
+                value = parse_flow_mapping();
+            else if(c == '[')
+                value = parse_flow_sequence();
+            else if(c == '\'')
+                value = parse_single_quoted();
+            else if(c == '"')
+                value = parse_double_quoted();
+            else if(c == ',' || c == ']' || c == '}')
+                value = {};
+            else if(at_end())
+                error("found unexpected end of stream");
+            else
+                value = resolve_plain(parse_plain(-1, true));
+
+            if(!anchor.empty())
+                m_anchors[anchor] = value;
+            return value;
+        }
+
+        yaml_value parse_flow_mapping()
+        {
+            size_t                  start = m_pos++;
+            yaml_dict               dict;
+            std::vector<yaml_value> merges;
+            for(;;)
+            {
+                skip_to_content();
+                if(peek() == '}')
+                {
+                    ++m_pos;
+                    return merge(std::move(dict), merges);
+                }
+                if(at_end())
+                    error("found unexpected end of stream while parsing a flow mapping", start);
+
+                size_t      key_pos = m_pos;
+                bool        plain   = peek() != '\'' && peek() != '"';
+                std::string key     = peek() == '\''  ? parse_single_quoted()
+                                      : peek() == '"' ? parse_double_quoted()
+                                                      : parse_plain(-1, true);
+                skip_to_content();
+
+                yaml_value value;
+                if(peek() == ':')
+                {
+                    ++m_pos;
+                    skip_to_content();
+                    if(peek() != ',' && peek() != '}')
+                        value = parse_flow_node();
+                }
+                add_key(dict, merges, key, plain, std::move(value), key_pos);
+
+                skip_to_content();
+                if(peek() == ',')
+                    ++m_pos;
+                else if(at_end())
+                    error("found unexpected end of stream while parsing a flow mapping", start);
+                else if(peek() != '}')
+                    error("expected ',' or '}', but got '" + std::string(1, peek()) + "'");
+            }
+        }
+
+        yaml_value parse_flow_sequence()
+        {
+            size_t    start = m_pos++;
+            yaml_list list;
+            for(;;)
+            {
+                skip_to_content();
+                if(peek() == ']')
+                {
+                    ++m_pos;
+                    return list;
+                }
+                if(at_end())
+                    error("found unexpected end of stream while parsing a flow sequence", start);
+
+                size_t     item_pos = m_pos;
+                bool       plain    = peek() != '\'' && peek() != '"';
+                yaml_value item     = parse_flow_node();
+                skip_to_content();
+
+                // a single pair mapping [ key: value ]
+                if(peek() == ':')
+                {
+                    ++m_pos;
+                    skip_to_content();
+                    yaml_value value;
+                    if(peek() != ',' && peek() != ']')
+                        value = parse_flow_node();
+                    if(!item.str() && !item.is_number())
+                        error("expected a scalar key", item_pos);
+                    std::ostringstream key;
+                    if(item.str())
+                        key << *item.str();
+                    else
+                        py_repr(key, item);
+                    yaml_dict               dict;
+                    std::vector<yaml_value> merges;
+                    add_key(dict, merges, key.str(), plain, std::move(value), item_pos);
+                    item = merge(std::move(dict), merges);
+                    skip_to_content();
+                }
+                list.push_back(std::move(item));
+
+                if(peek() == ',')
+                    ++m_pos;
+                else if(at_end())
+                    error("found unexpected end of stream while parsing a flow sequence", start);
+                else if(peek() != ']')
+                    error("expected ',' or ']', but got '" + std::string(1, peek()) + "'");
+            }
+        }
+
+        void expect_line_end()
+        {
+            if(!at_line_end())
+                error("expected <block end>, but found '" + std::string(1, peek()) + "'");
+        }
+
+        // Scalar, alias or flow collection on the line of its key or sequence entry
+        yaml_value parse_inline_node(int indent)
+        {
+            yaml_value value;
+            char       c = peek();
+            if(c == '*')
+                value = parse_alias();
+            else if(c == '{')
+                value = parse_flow_mapping();
+            else if(c == '[')
+                value = parse_flow_sequence();
+            else if(c == '\'')
+                value = parse_single_quoted();
+            else if(c == '"')
+                value = parse_double_quoted();
+            else if(c == '!' || c == '|' || c == '>' || c == '?' || c == '%' || c == '@'
+                    || c == '`')
+                error("unsupported YAML indicator '" + std::string(1, c) + "'");
+            else
+                value = resolve_plain(parse_plain(indent, false));
+            expect_line_end();
+            return value;
+        }
+
+        // Node in block context, starting at the current position or on a following line. Its
+        // content must be indented more than indent, except for a sequence which is the value of a
+        // mapping key at indent.
+        yaml_value parse_block_node(int indent, bool sequence_at_indent)
+        {
+            skip_to_content();
+            if(at_end() || at_document_marker())
+                return {};
+
+            int col = column();
+            if(col <= indent && !(sequence_at_indent && col == indent && at_sequence_entry()))
+                return {};
+
+            std::string anchor;
+            if(peek() == '&')
+            {
+                anchor = parse_anchor_name();
+                if(at_line_end())
+                {
+                    yaml_value value = parse_block_node(indent, sequence_at_indent);
+                    m_anchors[anchor] = value;
+                    return value;
+                }
+                col = column();
+            }
+
+            yaml_value value;
+            if(at_sequence_entry())
+                value = parse_block_sequence(col);
+            else if(is_mapping_key())
+                value = parse_block_mapping(col);
+            else
+                value = parse_inline_node(indent);
+
+            if(!anchor.empty())
+                m_anchors[anchor] = value;
+            return value;
+        }
+
+        yaml_value parse_block_sequence(int indent)
+        {
+            yaml_list list;
+            for(;;)
+            {
+                ++m_pos; // '-'
+                list.push_back(parse_block_node(indent, false));
+
+                skip_to_content();
+                if(at_end() || at_document_marker() || column() != indent || !at_sequence_entry())
+                    return list;
+            }
+        }
+
+        yaml_value parse_block_mapping(int indent)
+        {
+            yaml_dict               dict;
+            std::vector<yaml_value> merges;
+            for(;;)
+            {
+                size_t      key_pos = m_pos;
+                bool        plain   = peek() != '\'' && peek() != '"';
+                std::string key     = peek() == '\''  ? parse_single_quoted()
+                                      : peek() == '"' ? parse_double_quoted()
+                                                      : parse_plain(indent, false);
+                skip_spaces();
+                if(peek() != ':')
+                    error("could not find expected ':'");
+                ++m_pos;
+
+                yaml_value value;
+                if(at_line_end())
+                    value = parse_block_node(indent, true);
+                else
+                {
+                    std::string anchor;
+                    if(peek() == '&')
+                        anchor = parse_anchor_name();
+                    if(!anchor.empty() && at_line_end())
+                        value = parse_block_node(indent, true);
+                    else
+                    {
+                        skip_spaces();
+                        value = parse_inline_node(indent);
+                    }
+                    if(!anchor.empty())
+                        m_anchors[anchor] = value;
+                }
+                add_key(dict, merges, key, plain, std::move(value), key_pos);
+
+                skip_to_content();
+                if(at_end() || at_document_marker() || column() != indent || at_sequence_entry())
+                    return merge(std::move(dict), merges);
+                if(!is_mapping_key())
+                    error("could not find expected ':'");
+            }
+        }
+
+    public:
+        explicit yaml_reader(const std::vector<source_line>& source)
+            : m_source(source)
+        {
+            for(auto& line : source)
+            {
+                m_line_start.push_back(m_src.size());
+                m_src += line.text;
+            }
+            if(m_line_start.empty())
+                m_line_start.push_back(0);
+        }
+
+        // Reads all documents of the stream
+        std::vector<yaml_value> read_documents()
+        {
+            std::vector<yaml_value> docs;
+            for(;;)
+            {
+                skip_to_content();
+                if(at_end())
+                    return docs;
+
+                if(peek() == '%' && column() == 0)
+                {
+                    // directives are ignored
+                    while(!is_break(peek()))
+                        ++m_pos;
+                    continue;
+                }
+
+                if(at_document_marker())
+                {
+                    bool start = m_src[m_pos] == '-';
+                    m_pos += 3;
+                    if(!start)
+                        continue;
+                }
+
+                m_anchors.clear();
+                docs.push_back(parse_block_node(-1, false));
+
+                skip_to_content();
+                if(!at_end() && !at_document_marker())
+                    error("expected '<document start>', but found another node");
+            }
+        }
+    };
+
+    /**********************************************************************
+     * Binary layout                                                      *
+     **********************************************************************/
+
+    // A ctypes type
+    struct ctype_info
+    {
+        enum kind_t
+        {
+            signed_int,
+            unsigned_int,
+            floating,
+            character,
+            boolean,
+        } kind;
+        size_t size;
+        size_t count   = 0; // array length, or 0 for a scalar
+        bool   derived = false; // declared in Datatypes, so an enum argument
+
+        size_t bytes() const
+        {
+            return count ? size * count : size;
+        }
+    };
+
+    // An entry of the Datatypes namespace, either a type or an attribute value
+    struct datatype_entry
+    {
+        bool       is_type;
+        ctype_info type;
+        yaml_value value;
+    };
+
+    using datatype_map = std::map<std::string, datatype_entry>;
+
+    datatype_map ctypes_namespace()
+    {
+        using k = ctype_info::kind_t;
+        datatype_map dt;
+        auto         add = [&](const char* name, k kind, size_t size) {
+            dt[name] = {true, {kind, size}, {}};
+        };
+        add("c_bool", k::boolean, 1);
+        add("c_char", k::character, 1);
+        add("c_byte", k::signed_int, 1);
+        add("c_ubyte", k::unsigned_int, 1);
+        add("c_short", k::signed_int, sizeof(short));
+        add("c_ushort", k::unsigned_int, sizeof(short));
+        add("c_int", k::signed_int, sizeof(int));
+        add("c_uint", k::unsigned_int, sizeof(int));
+        add("c_long", k::signed_int, sizeof(long));
+        add("c_ulong", k::unsigned_int, sizeof(long));
+        add("c_longlong", k::signed_int, sizeof(long long));
+        add("c_ulonglong", k::unsigned_int, sizeof(long long));
+        add("c_int8", k::signed_int, 1);
+        add("c_uint8", k::unsigned_int, 1);
+        add("c_int16", k::signed_int, 2);
+        add("c_uint16", k::unsigned_int, 2);
+        add("c_int32", k::signed_int, 4);
+        add("c_uint32", k::unsigned_int, 4);
+        add("c_int64", k::signed_int, 8);
+        add("c_uint64", k::unsigned_int, 8);
+        add("c_size_t", k::unsigned_int, sizeof(size_t));
+        add("c_ssize_t", k::signed_int, sizeof(size_t));
+        add("c_float", k::floating, sizeof(float));
+        add("c_double", k::floating, sizeof(double));
+        return dt;
+    }
+
+    // TYPE_RE: [a-z_A-Z]\w*(:?\s*\*\s*\d+)?$, a type name with an optional array length
+    bool match_type(const std::string& s, std::string* name = nullptr, size_t* count = nullptr)
+    {
+        static const std::regex type_re(R"(([a-z_A-Z]\w*)(:?\s*\*\s*(\d+))?)");
+        std::smatch             m;
+        if(!std::regex_match(s, m, type_re))
+            return false;
+        if(name)
+            *name = m[1];
+        if(count)
+            *count = m[3].matched ? std::stoul(m[3]) : 0;
+        return true;
+    }
+
+    // eval of a type name in the Datatypes namespace
+    ctype_info eval_type(const std::string& decl, const datatype_map& dt)
+    {
+        std::string name;
+        size_t      count;
+        match_type(decl, &name, &count);
+        auto it = dt.find(name);
+        if(it == dt.end())
+            fatal("NameError: name '" + name + "' is not defined");
+        if(!it->second.is_type)
+            fatal("TypeError: " + decl + " is not a ctypes type");
+        ctype_info type = it->second.type;
+        if(count)
+        {
+            if(type.count)
+                fatal("TypeError: arrays of arrays are not supported: " + decl);
+            type.count = count;
+        }
+        return type;
+    }
+
+    struct argument_field
+    {
+        std::string name;
+        ctype_info  type;
+        size_t      offset;
+    };
+
+    /**********************************************************************
+     * Expansion                                                          *
+     **********************************************************************/
+
+    // Thrown for a missing key, which rocblas_gentest.py reports as "Undefined value"
+    struct undefined_value
+    {
+        std::string key;
+    };
+
+    const yaml_value& at(const yaml_dict& test, const std::string& key)
+    {
+        auto it = test.find(key);
+        if(it == test.end())
+            throw undefined_value{key};
+        return it->second;
+    }
+
+    bool has(const yaml_dict& test, const std::string& key)
+    {
+        return test.find(key) != test.end();
+    }
+
+    const std::string& str_of(const yaml_value& value, const char* what)
+    {
+        if(!value.str())
+            fatal(std::string("TypeError: ") + what + " requires a str, not "
+                  + value.type_name());
+        return *value.str();
+    }
+
+    std::string upper(const yaml_value& value)
+    {
+        std::string s = str_of(value, "upper()");
+        for(char& c : s)
+            c = toupper(c);
+        return s;
+    }
+
+    yaml_value py_mul(const yaml_value& a, const yaml_value& b)
+    {
+        if(!a.is_number() || !b.is_number())
+            fatal(std::string("TypeError: unsupported operand type(s) for *: '") + a.type_name()
+                  + "' and '" + b.type_name() + "'");
+        if(a.is_int() && b.is_int())
+            return a.as_int() * b.as_int();
+        return a.as_real() * b.as_real();
+    }
+
+    yaml_value py_abs(const yaml_value& a)
+    {
+        if(a.is_int())
+            return std::abs(a.as_int());
+        if(a.real())
+            return std::fabs(*a.real());
+        fatal(std::string("TypeError: bad operand type for abs(): '") + a.type_name() + "'");
+    }
+
+    int64_t py_int(const yaml_value& a)
+    {
+        if(a.is_int())
+            return a.as_int();
+        if(a.real())
+            return int64_t(*a.real());
+        if(a.str())
+        {
+            char*   end;
+            int64_t value = strtoll(a.str()->c_str(), &end, 10);
+            if(!a.str()->empty() && !*end)
+                return value;
+        }
+        fatal(std::string("ValueError: invalid literal for int(): ") + a.type_name());
+    }
+
+    bool py_gt_zero(const yaml_value& a)
+    {
+        if(!a.is_number())
+            fatal(std::string("TypeError: '>' not supported between instances of '")
+                  + a.type_name() + "' and 'int'");
+        return a.as_real() > 0;
+    }
+
+    bool is_zero(const yaml_value& a)
+    {
+        return py_equal(a, int64_t(0));
+    }
+
+    bool in_tuple(const std::string& s, std::initializer_list<const char*> tuple)
+    {
+        for(auto* t : tuple)
+            if(s == t)
+                return true;
+        return false;
+    }
+
+    // "x in ('name')" in rocblas_gentest.py is a substring test, as ('name') is not a tuple
+    bool in_string(const std::string& s, const char* str)
+    {
+        return strstr(str, s.c_str()) != nullptr;
+    }
+
+    // fnmatch.fnmatchcase
+    bool fnmatchcase(const char* name, const char* pat)
+    {
+        for(; *pat; ++pat)
+        {
+            if(*pat == '*')
+            {
+                for(const char* n = name;; ++n)
+                {
+                    if(fnmatchcase(n, pat + 1))
+                        return true;
+                    if(!*n)
+                        return false;
+                }
+            }
+            if(!*name)
+                return false;
+            if(*pat == '[')
+            {
+                const char* p      = pat + 1;
+                bool        negate = *p == '!';
+                if(negate)
+                    ++p;
+                const char* close = strchr(p + 1, ']');
+                if(!close)
+                {
+                    // an unmatched [ is literal
+                    if(*name != '[')
+                        return false;
+                }
+                else
+                {
+                    bool found = false;
+                    for(const char* q = p; q < close; ++q)
+                    {
+                        if(q + 2 < close && q[1] == '-')
+                        {
+                            found |= *name >= q[0] && *name <= q[2];
+                            q += 2;
+                        }
+                        else
+                            found |= *name == *q;
+                    }
+                    if(found == negate)
+                        return false;
+                    pat = close;
+                }
+            }
+            else if(*pat != '?' && *pat != *name)
+                return false;
+            ++name;
+        }
+        return !*name;
+    }
+
+    // INT_RANGE_RE: \s*(-?\d+)\s*\.\.\s*(-?\d+)\s*(?:\.\.\s*(-?\d+)\s*)?$
+    bool match_int_range(const std::string& s, int64_t& start, int64_t& stop, int64_t& step)
+    {
+        const char* p = s.c_str();
+
+        auto skip_spaces = [&] {
+            while(isspace(*p))
+                ++p;
+        };
+        auto number = [&](int64_t& value) {
+            const char* begin = p;
+            if(*p == '-')
+                ++p;
+            if(!isdigit(*p))
+                return false;
+            while(isdigit(*p))
+                ++p;
+            value = strtoll(begin, nullptr, 10);
+            return true;
+        };
+        auto dots = [&] {
+            if(p[0] != '.' || p[1] != '.')
+                return false;
+            p += 2;
+            return true;
+        };
+
+        step = 1;
+        skip_spaces();
+        if(!number(start))
+            return false;
+        skip_spaces();
+        if(!dots())
+            return false;
+        skip_spaces();
+        if(!number(stop))
+            return false;
+        skip_spaces();
+        if(dots())
+        {
+            skip_spaces();
+            if(!number(step))
+                return false;
+            skip_spaces();
+        }
+        // $ also matches before a trailing newline
+        return !*p || (p[0] == '\n' && !p[1]);
+    }
+
+    // Document being expanded, as the param and datatypes globals of rocblas_gentest.py
+    struct expansion_doc
+    {
+        datatype_map                datatypes;
+        std::vector<argument_field> fields;
+        size_t                      struct_size = 0;
+        yaml_list                   dict_lists_to_expand;
+        yaml_list                   lists_to_not_expand;
+        yaml_dict                   defaults;
+        yaml_list                   known_bugs;
+        yaml_dict                   functions;
+        yaml_list                   tests;
+        size_t                      next_test = 0;
+    };
+
+    const yaml_list& list_or_empty(const yaml_dict& doc, const char* key)
+    {
+        static const yaml_list empty;
+        auto                   it = doc.find(key);
+        if(it == doc.end() || !py_truth(it->second))
+            return empty;
+        if(!it->second.list())
+            fatal(std::string("TypeError: ") + key + " must be a list");
+        return *it->second.list();
+    }
+
+    const yaml_dict& dict_or_empty(const yaml_dict& doc, const char* key)
+    {
+        static const yaml_dict empty;
+        auto                   it = doc.find(key);
+        if(it == doc.end() || !py_truth(it->second))
+            return empty;
+        if(!it->second.dict())
+            fatal(std::string("TypeError: ") + key + " must be a dictionary");
+        return *it->second.dict();
+    }
+
+    // get_datatypes
+    datatype_map get_datatypes(const yaml_dict& doc)
+    {
+        datatype_map dt = ctypes_namespace();
+        for(auto& declaration : list_or_empty(doc, "Datatypes"))
+        {
+            if(!declaration.dict())
+                fatal("AttributeError: Datatypes entries must be dictionaries");
+            for(auto& [name, decl] : *declaration.dict())
+            {
+                if(decl.dict())
+                {
+                    // derived class of the first base, with the attributes in the namespace
+                    const yaml_dict& d         = *decl.dict();
+                    bool             have_base = false;
+                    ctype_info       type{};
+                    for(auto& base : list_or_empty(d, "bases"))
+                        if(base.str() && match_type(*base.str()) && !have_base)
+                        {
+                            type      = eval_type(*base.str(), dt);
+                            have_base = true;
+                        }
+                    type.derived = true;
+                    dt[name]     = {have_base, type, {}};
+                    for(auto& [subtype, value] : dict_or_empty(d, "attr"))
+                        if(match_type(subtype))
+                            dt[subtype] = {false, {}, value};
+                }
+                else if(decl.str() && match_type(*decl.str()))
+                {
+                    auto it = dt.find(*decl.str());
+                    if(it == dt.end())
+                        fatal("KeyError: '" + *decl.str() + "'");
+                    dt[name] = it->second;
+                }
+                else
+                {
+                    std::ostringstream msg;
+                    msg << "Unrecognized data type " << name << ": ";
+                    py_repr(msg, decl);
+                    fatal(msg.str());
+                }
+            }
+        }
+        return dt;
+    }
+
+    // get_arguments, laid out as a ctypes Structure
+    void get_arguments(const yaml_dict& doc, expansion_doc& d)
+    {
+        size_t offset = 0, max_align = 1;
+        for(auto& decl : list_or_empty(doc, "Arguments"))
+        {
+            if(!decl.dict() || decl.dict()->size() != 1)
+                continue;
+            auto& [var, type_decl] = *decl.dict()->begin();
+            if(!type_decl.str())
+                fatal("TypeError: the type of Arguments field " + var + " must be a str");
+            if(!match_type(*type_decl.str()))
+                continue;
+
+            ctype_info type  = eval_type(*type_decl.str(), d.datatypes);
+            size_t     align = type.size;
+            offset           = (offset + align - 1) / align * align;
+            d.fields.push_back({var, type, offset});
+            offset += type.bytes();
+            max_align = std::max(max_align, align);
+        }
+        d.struct_size = (offset + max_align - 1) / max_align * max_align;
+    }
+
+    // setkey_product
+    void setkey_product(yaml_dict& test, const char* key, std::initializer_list<const char*> vals)
+    {
+        for(auto* x : vals)
+            if(!has(test, x))
+                return;
+        yaml_value result = int64_t(1);
+        for(auto* x : vals)
+            result = py_mul(result,
+                            !strcmp(x, "incx") || !strcmp(x, "incy") ? py_abs(at(test, x))
+                                                                     : at(test, x));
+        test[key] = py_int(result);
+    }
+
+    void setdefault(yaml_dict& test, const char* key, yaml_value value)
+    {
+        test.emplace(key, std::move(value));
+    }
+
+    // setdefaults
+    void setdefaults(yaml_dict& test)
+    {
+        const std::string function = str_of(at(test, "function"), "in");
+
+        if(in_tuple(function,
+                    {"asum_strided_batched",    "nrm2_strided_batched",
+                     "scal_strided_batched",    "swap_strided_batched",
+                     "copy_strided_batched",    "dot_strided_batched",
+                     "dotc_strided_batched",    "dot_strided_batched_ex",
+                     "dotc_strided_batched_ex", "rot_strided_batched",
+                     "rot_strided_batched_ex",  "rotm_strided_batched",
+                     "iamax_strided_batched",   "iamin_strided_batched",
+                     "axpy_strided_batched",    "axpy_strided_batched_ex",
+                     "nrm2_strided_batched_ex", "scal_strided_batched_ex"}))
+        {
+            setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+            setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+            // all() over the characters of 'stride_scale', as in rocblas_gentest.py
+            bool all = true;
+            for(char c : std::string("stride_scale"))
+                all = all && has(test, std::string(1, c));
+            if(all)
+                setdefault(test, "stride_c", py_int(at(test, "stride_scale")) * 5);
+        }
+        else if(in_string(function, "tpmv_strided_batched"))
+        {
+            setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+            setkey_product(test, "stride_a", {"M", "M", "stride_scale"});
+        }
+        else if(in_string(function, "trmv_strided_batched"))
+        {
+            setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+            setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+        }
+        else if(in_tuple(function,
+                         {"gemv_strided_batched",
+                          "gbmv_strided_batched",
+                          "ger_strided_batched",
+                          "geru_strided_batched",
+                          "gerc_strided_batched",
+                          "trsv_strided_batched"}))
+        {
+            if(in_tuple(function,
+                        {"ger_strided_batched",
+                         "geru_strided_batched",
+                         "gerc_strided_batched",
+                         "trsv_strided_batched"})
+               || in_tuple(str_of(at(test, "transA"), "in"), {"T", "C"}))
+            {
+                setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+                setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+            }
+            else
+            {
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                setkey_product(test, "stride_y", {"M", "incy", "stride_scale"});
+            }
+            if(in_string(function, "gbmv_strided_batched"))
+                setkey_product(test, "stride_a", {"lda", "N", "stride_scale"});
+            if(in_string(function, "trsv_strided_batched"))
+                setkey_product(test, "stride_a", {"lda", "M", "stride_scale"});
+        }
+        else if(in_tuple(function,
+                         {"ger_k_strided_batched",
+                          "geru_k_strided_batched",
+                          "gerc_k_strided_batched",
+                          "syr_k_strided_batched",
+                          "her_k_strided_batched"}))
+        {
+            setkey_product(test, "stride_x", {"ldb", "K", "stride_scale"});
+            setkey_product(test, "stride_y", {"ldc", "K", "stride_scale"});
+            setkey_product(test, "stride_a", {"lda", "N", "stride_scale"});
+        }
+        else if(in_tuple(function,
+                         {"hemv_strided_batched", "hbmv_strided_batched", "sbmv_strided_batched"}))
+        {
+            if(has(test, "N") && has(test, "incx") && has(test, "incy")
+               && has(test, "stride_scale"))
+            {
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+            }
+        }
+        else if(in_string(function, "hpmv_strided_batched"))
+        {
+            if(has(test, "N") && has(test, "incx") && has(test, "incy")
+               && has(test, "stride_scale"))
+            {
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+                setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+                auto& N   = at(test, "N");
+                auto  NN1 = py_mul(N, N.is_int() ? yaml_value(N.as_int() + 1)
+                                                 : yaml_value(N.as_real() + 1));
+                auto  ldN = py_mul(NN1, at(test, "stride_scale")).as_real() / 2;
+                setdefault(test, "stride_a", int64_t(ldN));
+            }
+        }
+        else if(in_tuple(function,
+                         {"spr_strided_batched",
+                          "spr2_strided_batched",
+                          "hpr_strided_batched",
+                          "hpr2_strided_batched",
+                          "tpsv_strided_batched"}))
+        {
+            setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+            setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+            setkey_product(test, "stride_a", {"N", "N", "stride_scale"});
+        }
+        else if(in_tuple(function,
+                         {"her_strided_batched", "her2_strided_batched", "syr2_strided_batched"}))
+        {
+            setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+            setkey_product(test, "stride_y", {"N", "incy", "stride_scale"});
+            setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+        }
+        else if(in_string(function, "rotg_strided_batched"))
+        {
+            if(has(test, "stride_scale"))
+            {
+                int64_t scale = py_int(at(test, "stride_scale"));
+                for(auto* key : {"stride_a", "stride_b", "stride_c", "stride_d"})
+                    setdefault(test, key, scale);
+            }
+        }
+        else if(in_string(function, "rotmg_strided_batched"))
+        {
+            if(has(test, "stride_scale"))
+            {
+                int64_t scale = py_int(at(test, "stride_scale"));
+                setdefault(test, "stride_a", scale);
+                setdefault(test, "stride_b", scale);
+                setdefault(test, "stride_c", scale * 5);
+                setdefault(test, "stride_x", scale);
+                setdefault(test, "stride_y", scale);
+            }
+        }
+        else if(in_string(function, "dgmm_strided_batched"))
+        {
+            setkey_product(test, "stride_c", {"N", "ldc", "stride_scale"});
+            setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+            if(upper(at(test, "side")) == "L")
+                setkey_product(test, "stride_x", {"M", "incx", "stride_scale"});
+            else
+                setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+        }
+        else if(in_string(function, "geam_strided_batched"))
+        {
+            setkey_product(test, "stride_c", {"N", "ldc", "stride_scale"});
+
+            if(upper(at(test, "transA")) == "N")
+                setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+            else
+                setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+
+            if(upper(at(test, "transB")) == "N")
+                setkey_product(test, "stride_b", {"N", "ldb", "stride_scale"});
+            else
+                setkey_product(test, "stride_b", {"M", "ldb", "stride_scale"});
+        }
+        else if(in_string(function, "trmm_strided_batched"))
+        {
+            setkey_product(test, "stride_b", {"N", "ldb", "stride_scale"});
+            setkey_product(test, "stride_c", {"N", "ldc", "stride_scale"});
+
+            if(upper(at(test, "side")) == "L")
+                setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+            else
+                setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+        }
+        else if(in_tuple(function, {"trsm_strided_batched", "trsm_strided_batched_ex"}))
+        {
+            setkey_product(test, "stride_b", {"N", "ldb", "stride_scale"});
+
+            if(upper(at(test, "side")) == "L")
+                setkey_product(test, "stride_a", {"M", "lda", "stride_scale"});
+            else
+                setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+        }
+        else if(in_string(function, "tbmv_strided_batched"))
+        {
+            if(has(test, "M") && has(test, "lda") && has(test, "stride_scale"))
+                setdefault(test,
+                           "stride_a",
+                           py_int(py_mul(py_mul(at(test, "M"), at(test, "lda")),
+                                         at(test, "stride_scale"))));
+            if(has(test, "M") && has(test, "incx") && has(test, "stride_scale"))
+                setdefault(test,
+                           "stride_x",
+                           py_int(py_mul(py_mul(at(test, "M"), py_abs(at(test, "incx"))),
+                                         at(test, "stride_scale"))));
+        }
+        else if(in_string(function, "tbsv_strided_batched"))
+        {
+            setkey_product(test, "stride_a", {"N", "lda", "stride_scale"});
+            setkey_product(test, "stride_x", {"N", "incx", "stride_scale"});
+        }
+
+        setdefault(test, "stride_x", int64_t(0));
+        setdefault(test, "stride_y", int64_t(0));
+
+        const yaml_value star = std::string("*");
+        if(py_equal(at(test, "transA"), star) || py_equal(at(test, "transB"), star))
+        {
+            setdefault(test, "lda", int64_t(0));
+            setdefault(test, "ldb", int64_t(0));
+            setdefault(test, "ldc", int64_t(0));
+            setdefault(test, "ldd", int64_t(0));
+        }
+        else
+        {
+            // catered to gemm default behaviour
+            auto or_one = [&](const char* key) -> yaml_value {
+                auto& value = at(test, key);
+                return !is_zero(value) ? value : yaml_value(int64_t(1));
+            };
+            bool transA_N = upper(at(test, "transA")) == "N";
+            setdefault(test, "lda", transA_N ? or_one("M") : or_one("K"));
+            bool transB_N = upper(at(test, "transB")) == "N";
+            setdefault(test, "ldb", transB_N ? or_one("K") : or_one("N"));
+            setdefault(test, "ldc", or_one("M"));
+            setdefault(test, "ldd", or_one("M"));
+            if(py_gt_zero(at(test, "batch_count")))
+            {
+                setdefault(test,
+                           "stride_a",
+                           py_mul(at(test, "lda"),
+                                  upper(at(test, "transA")) == "N" ? at(test, "K")
+                                                                   : at(test, "M")));
+                setdefault(test,
+                           "stride_b",
+                           py_mul(at(test, "ldb"),
+                                  upper(at(test, "transB")) == "N" ? at(test, "N")
+                                                                   : at(test, "K")));
+                setdefault(test, "stride_c", py_mul(at(test, "ldc"), at(test, "N")));
+                setdefault(test, "stride_d", py_mul(at(test, "ldd"), at(test, "N")));
+                return;
+            }
+        }
+
+        setdefault(test, "stride_a", int64_t(0));
+        setdefault(test, "stride_b", int64_t(0));
+        setdefault(test, "stride_c", int64_t(0));
+        setdefault(test, "stride_d", int64_t(0));
+    }
+
+    // Stores an integer in the low bytes of a field, wrapping as ctypes does
+    void store_int(char* dst, size_t size, int64_t value)
+    {
+        uint64_t bits = uint64_t(value);
+        for(size_t i = 0; i < size; ++i)
+            dst[i] = char(bits >> (8 * i));
+    }
+
+    void store_scalar(char* dst, const ctype_info& type, const yaml_value& value, const char* name)
+    {
+        auto type_error = [&](const char* expected) {
+            fatal(std::string("TypeError: ") + expected + " for " + name
+                  + ", which has type <class '" + value.type_name() + "'>\n");
+        };
+
+        switch(type.kind)
+        {
+        case ctype_info::character:
+            if(!value.str() || value.str()->size() != 1)
+                type_error("one character bytes, bytearray or integer expected");
+            *dst = (*value.str())[0];
+            break;
+        case ctype_info::boolean:
+            *dst = py_truth(value);
+            break;
+        case ctype_info::signed_int:
+        case ctype_info::unsigned_int:
+            if(!value.is_int())
+                type_error("an integer is required");
+            store_int(dst, type.size, value.as_int());
+            break;
+        case ctype_info::floating:
+            if(!value.is_number())
+                type_error("must be real number");
+            if(type.size == sizeof(float))
+            {
+                float f = float(value.as_real());
+                memcpy(dst, &f, sizeof(f));
+            }
+            else
+            {
+                double d = value.as_real();
+                memcpy(dst, &d, sizeof(d));
+            }
+            break;
+        }
+    }
+}
+
+/**********************************************************************
+ * rocblas_yaml_expander                                              *
+ **********************************************************************/
+
+struct rocblas_yaml_expander::impl
+{
+    std::vector<source_line> source;
+    std::vector<yaml_value>  docs;
+    size_t                   doc_index = 0;
+    bool                     doc_ready = false;
+    expansion_doc            doc;
+
+    // Signature and records, and the offsets and sizes of the records seen so far
+    std::string data;
+    bool        signature_written = false;
+
+    struct record_hash
+    {
+        const std::string* data;
+        size_t             operator()(const std::pair<size_t, size_t>& rec) const
+        {
+            return std::hash<std::string_view>{}(
+                std::string_view(data->data() + rec.first, rec.second));
+        }
+    };
+
+    struct record_equal
+    {
+        const std::string* data;
+        bool               operator()(const std::pair<size_t, size_t>& a,
+                        const std::pair<size_t, size_t>& b) const
+        {
+            return a.second == b.second
+                   && !memcmp(data->data() + a.first, data->data() + b.first, a.second);
+        }
+    };
+
+    std::unordered_set<std::pair<size_t, size_t>, record_hash, record_equal> testcases{
+        0, record_hash{&data}, record_equal{&data}};
+
+    // Sets up the next document with Tests, returning false if there is none
+    bool next_doc()
+    {
+        for(; doc_index < docs.size(); ++doc_index)
+        {
+            auto& value = docs[doc_index];
+
+            // Ignore empty documents
+            if(!py_truth(value))
+                continue;
+            if(!value.dict())
+                fatal("AttributeError: a YAML document must be a dictionary");
+
+            const yaml_dict& d     = *value.dict();
+            auto             tests = d.find("Tests");
+            if(tests == d.end() || !py_truth(tests->second))
+                continue;
+            if(!tests->second.list())
+                fatal("TypeError: Tests must be a list");
+
+            doc           = {};
+            doc.datatypes = get_datatypes(d);
+            get_arguments(d, doc);
+            doc.dict_lists_to_expand = list_or_empty(d, "Dictionary lists to expand");
+            doc.lists_to_not_expand  = list_or_empty(d, "Lists to not expand");
+            doc.defaults             = dict_or_empty(d, "Defaults");
+            doc.known_bugs           = list_or_empty(d, "Known bugs");
+            doc.functions            = dict_or_empty(d, "Functions");
+            doc.tests                = *tests->second.list();
+            return true;
+        }
+        return false;
+    }
+
+    void write_signature()
+    {
+        data.append("rocBLAS", 8);
+        size_t   start = data.size();
+        unsigned sig   = 0;
+        data.append(doc.struct_size, '\0');
+        for(auto& field : doc.fields)
+        {
+            for(size_t i = 0; i < field.type.bytes(); ++i)
+                data[start + field.offset + i] = char(sig ^ i);
+            sig = (sig + 89) % 256;
+        }
+        data.append("ROCblas", 8);
+    }
+
+    // write_test
+    void write_test(const yaml_dict& test)
+    {
+        std::string record(doc.struct_size, '\0');
+        for(auto& field : doc.fields)
+        {
+            const yaml_value& value = at(test, field.name);
+            char*             dst   = &record[field.offset];
+            const ctype_info& type  = field.type;
+
+            if(type.count && type.kind == ctype_info::character)
+            {
+                const std::string& s = str_of(value, ("bytes() of " + field.name).c_str());
+                if(s.size() > type.count)
+                    fatal("ValueError: bytes too long for " + field.name + ": " + s);
+                memcpy(dst, s.data(), s.size());
+            }
+            else if(type.count)
+            {
+                if(!value.list() || value.list()->size() > type.count)
+                    fatal("TypeError: " + field.name + " must be a list of at most "
+                          + std::to_string(type.count) + " values");
+                ctype_info element = type;
+                element.count      = 0;
+                for(auto& item : *value.list())
+                {
+                    store_scalar(dst, element, item, field.name.c_str());
+                    dst += element.size;
+                }
+            }
+            else
+                store_scalar(dst, type, value, field.name.c_str());
+        }
+
+        if(!signature_written)
+        {
+            write_signature();
+            signature_written = true;
+        }
+
+        size_t offset = data.size();
+        data += record;
+        if(!testcases.insert({offset, record.size()}).second)
+            data.resize(offset);
+    }
+
+    // instantiate
+    void instantiate(yaml_dict test)
+    {
+        try
+        {
+            setdefaults(test);
+
+            // For enum arguments, replace name with value
+            for(auto& field : doc.fields)
+            {
+                if(!field.type.derived)
+                    continue;
+                const yaml_value& value = at(test, field.name);
+                if(!value.str())
+                    continue;
+                auto it = doc.datatypes.find(*value.str());
+                if(it == doc.datatypes.end())
+                    continue;
+                if(it->second.is_type)
+                    fatal("TypeError: " + field.name + " is set to the type " + *value.str());
+                test[field.name] = it->second.value;
+            }
+
+            std::set<std::string> known_bug_platforms;
+
+            // Match known bugs
+            const std::string& category = str_of(at(test, "category"), "in");
+            if(!in_string(category, "known_bug"))
+            {
+                for(auto& bug : doc.known_bugs)
+                {
+                    if(!bug.dict())
+                        fatal("AttributeError: Known bugs entries must be dictionaries");
+
+                    bool match = true;
+                    for(auto& [key, value] : *bug.dict())
+                    {
+                        if(key == "known_bug_platforms" || key == "category")
+                            continue;
+                        auto it = test.find(key);
+                        if(it == test.end())
+                        {
+                            match = false;
+                            break;
+                        }
+                        if(key == "function")
+                        {
+                            if(!fnmatchcase(str_of(it->second, "fnmatchcase").c_str(),
+                                            str_of(value, "fnmatchcase").c_str()))
+                            {
+                                match = false;
+                                break;
+                            }
+                            continue;
+                        }
+
+                        // For keys declared as enums, compare resulting values
+                        const yaml_value* expected = &value;
+                        for(auto& field : doc.fields)
+                            if(field.name == key && field.type.derived && value.str())
+                            {
+                                auto dt = doc.datatypes.find(*value.str());
+                                if(dt != doc.datatypes.end() && !dt->second.is_type)
+                                    expected = &dt->second.value;
+                            }
+                        if(!py_equal(it->second, *expected))
+                        {
+                            match = false;
+                            break;
+                        }
+                    }
+                    if(!match)
+                        continue;
+
+                    // All values specified in known bug match the test case
+                    auto        platforms_it = bug.dict()->find("known_bug_platforms");
+                    std::string platforms    = platforms_it == bug.dict()->end()
+                                                   ? ""
+                                                   : str_of(platforms_it->second, "strip()");
+                    static const char* seps  = " :,\f\n\r\t\v";
+                    if(platforms.find_first_not_of(seps) != std::string::npos)
+                    {
+                        // re.split keeps the empty strings around leading and trailing separators
+                        size_t pos = 0;
+                        for(;;)
+                        {
+                            size_t end = platforms.find_first_of(seps, pos);
+                            known_bug_platforms.insert(platforms.substr(pos, end - pos));
+                            if(end == std::string::npos)
+                                break;
+                            pos = platforms.find_first_not_of(seps, end);
+                            if(pos == std::string::npos)
+                            {
+                                known_bug_platforms.insert("");
+                                break;
+                            }
+                        }
+                    }
+                    else
+                        test["category"] = std::string("known_bug");
+                    break;
+                }
+            }
+
+            // Unless category is already set to known_bug or disabled, set known_bug_platforms
+            // to a space-separated list of platforms
+            std::string platforms;
+            if(!in_string(str_of(at(test, "category"), "in"), "known_bug"))
+                for(auto& platform : known_bug_platforms)
+                    platforms += (platforms.empty() ? "" : " ") + platform;
+            test["known_bug_platforms"] = platforms;
+
+            write_test(test);
+        }
+        catch(const undefined_value& err)
+        {
+            std::ostringstream msg;
+            msg << "Undefined value '" << err.key << "'\n";
+            py_repr(msg, yaml_value(test));
+            fatal(msg.str());
+        }
+    }
+
+    bool not_expanded(const std::string& key) const
+    {
+        for(auto& item : doc.lists_to_not_expand)
+            if(item.str() && *item.str() == key)
+                return true;
+        return false;
+    }
+
+    // generate
+    void generate(yaml_dict test)
+    {
+        // For specially named lists, they are expanded and merged into the test argument list.
+        // When the list name is a dictionary of length 1, its pairs indicate that the argument
+        // named by its key takes on values paired with the argument named by its value, which is
+        // another dictionary list. The value dictionaries' keys are processed in order.
+        for(auto& argname : doc.dict_lists_to_expand)
+        {
+            if(argname.dict())
+            {
+                if(argname.dict()->size() != 1)
+                    continue;
+                auto& [arg, target_value] = *argname.dict()->begin();
+                auto it                   = test.find(arg);
+                if(it == test.end() || !it->second.dict())
+                    continue;
+                if(!target_value.str())
+                    fatal("TypeError: the target of " + arg + " must be a str");
+                auto pairs = it->second.dict();
+                auto keep  = it->second;
+                for(auto& [key, value] : *pairs)
+                {
+                    test[arg]                  = key;
+                    test[*target_value.str()] = value;
+                    generate(test);
+                }
+                return;
+            }
+
+            if(!argname.str())
+                continue;
+            auto it = test.find(*argname.str());
+            if(it == test.end() || !(it->second.list() || it->second.dict()))
+                continue;
+
+            // Pop the list and iterate across it
+            yaml_value ilist = std::move(it->second);
+            test.erase(it);
+
+            // For a bare dictionary, apply it once
+            auto apply = [&](const yaml_value& item) {
+                if(!item.dict())
+                    fatal(std::string("TypeError: cannot update a dictionary with ")
+                          + item.type_name() + " for " + *argname.str()
+                          + ", which has type <class '" + item.type_name()
+                          + "'>\nA name listed in \"Dictionary lists to expand\" must be a "
+                            "defined as a dictionary.\n");
+                yaml_dict c = test;
+                for(auto& [key, value] : *item.dict())
+                    c[key] = value;
+                generate(std::move(c));
+            };
+            if(ilist.dict())
+                apply(ilist);
+            else
+                for(auto& item : *ilist.list())
+                    apply(item);
+            return;
+        }
+
+        for(auto& [key, value] : test)
+        {
+            // Integer arguments which are ranges (A..B[..C]) are expanded
+            if(value.str())
+            {
+                int64_t start, stop, step;
+                if(match_int_range(*value.str(), start, stop, step))
+                {
+                    if(!step)
+                        fatal("ValueError: range() arg 3 must not be zero");
+                    std::string k = key;
+                    for(int64_t i = start; step > 0 ? i < stop + 1 : i > stop + 1; i += step)
+                    {
+                        test[k] = i;
+                        generate(test);
+                    }
+                    return;
+                }
+            }
+            // For sequence arguments, they are expanded into scalars
+            else if(value.list() && !not_expanded(key))
+            {
+                std::string k    = key;
+                yaml_value  list = value;
+                for(auto& item : *list.list())
+                {
+                    test[k] = item;
+                    generate(test);
+                }
+                return;
+            }
+        }
+
+        // Replace typed function names with generic functions and types
+        auto it = test.find("rocblas_function");
+        if(it != test.end())
+        {
+            std::string func = str_of(it->second, "rocblas_function");
+            test.erase(it);
+            auto f = doc.functions.find(func);
+            if(f != doc.functions.end())
+            {
+                if(!f->second.dict())
+                    fatal("TypeError: Functions entry " + func + " must be a dictionary");
+                for(auto& [key, value] : *f->second.dict())
+                    test[key] = value;
+            }
+            else
+            {
+                auto pos       = func.rfind("rocblas_");
+                test["function"] = pos == std::string::npos ? func : func.substr(pos + 8);
+            }
+            generate(std::move(test));
+            return;
+        }
+
+        instantiate(std::move(test));
+    }
+};
+
+rocblas_yaml_expander::rocblas_yaml_expander(const std::string&              yaml,
+                                             const std::string&              template_file,
+                                             const std::vector<std::string>& include_dirs)
+    : m_impl(std::make_unique<impl>())
+{
+    if(!template_file.empty())
+        read_yaml_file(template_file, include_dirs, m_impl->source);
+    read_yaml_file(yaml, include_dirs, m_impl->source);
+    m_impl->docs = yaml_reader(m_impl->source).read_documents();
+}
+
+rocblas_yaml_expander::~rocblas_yaml_expander() = default;
+
+bool rocblas_yaml_expander::expand_next()
+{
+    auto& d = *m_impl;
+    for(;;)
+    {
+        if(!d.doc_ready)
+        {
+            if(!d.next_doc())
+                return false;
+            d.doc_ready = true;
+        }
+
+        if(d.doc.next_test < d.doc.tests.size())
+        {
+            const yaml_value& test = d.doc.tests[d.doc.next_test++];
+            if(!test.dict())
+                fatal(std::string("TypeError: Tests entries must be dictionaries, not ")
+                      + test.type_name());
+
+            // Instantiate the test, starting with defaults
+            yaml_dict c = d.doc.defaults;
+            for(auto& [key, value] : *test.dict())
+                c[key] = value;
+            d.generate(std::move(c));
+            return true;
+        }
+
+        ++d.doc_index;
+        d.doc_ready = false;
+    }
+}
+
+const std::string& rocblas_yaml_expander::data() const
+{
+    return m_impl->data;
+}
+
+/**********************************************************************
+ * rocblas_yaml_streambuf                                             *
+ **********************************************************************/
+
+void rocblas_yaml_streambuf::fill(size_t size)
+{
+    while(m_expander.data().size() < size && m_expander.expand_next())
+        ;
+}
+
+void rocblas_yaml_streambuf::set_position(size_t pos)
+{
+    auto& data = m_expander.data();
+    char* base = const_cast<char*>(data.data());
+    setg(base, base + pos, base + data.size());
+}
+
+rocblas_yaml_streambuf::int_type rocblas_yaml_streambuf::underflow()
+{
+    size_t pos = gptr() - eback();
+    fill(pos + 1);
+    if(pos >= m_expander.data().size())
+        return traits_type::eof();
+    set_position(pos);
+    return traits_type::to_int_type(*gptr());
+}
+
+rocblas_yaml_streambuf::pos_type rocblas_yaml_streambuf::seekoff(off_type                off,
+                                                                 std::ios_base::seekdir  dir,
+                                                                 std::ios_base::openmode which)
+{
+    if(dir == std::ios_base::cur)
+        off += gptr() - eback();
+    else if(dir == std::ios_base::end)
+    {
+        fill(std::numeric_limits<size_t>::max());
+        off += m_expander.data().size();
+    }
+    return seekpos(off, which);
+}
+
+rocblas_yaml_streambuf::pos_type rocblas_yaml_streambuf::seekpos(pos_type                pos,
+                                                                 std::ios_base::openmode which)
+{
+    off_type off = pos;
+    if(!(which & std::ios_base::in) || off < 0)
+        return pos_type(off_type(-1));
+    fill(off);
+    if(size_t(off) > m_expander.data().size())
+        return pos_type(off_type(-1));
+    set_position(off);
+    return pos;
+}
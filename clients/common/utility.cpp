@@ -287,6 +287,10 @@ rocblas_local_handle::rocblas_local_handle(const Arguments& arg)
     // Set the atomics mode
     auto status = rocblas_set_atomics_mode(m_handle, arg.atomics_mode);
 
+    // Set the reproducibility mode
+    if(status == rocblas_status_success)
+        status = rocblas_set_reproducibility_mode(m_handle, arg.reproducibility_mode);
+
     if(status == rocblas_status_success)
     {
         // If the test specifies user allocated workspace, allocate and use it
@@ -0,0 +1,305 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#define ROCBLAS_BETA_FEATURES_API
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_exported_functions.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+#include <cstring>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    // Exported functions which do not report an API range
+    const char* const api_range_unreported[] = {
+        "rocblas_clear_trsm_invA",
+        "rocblas_device_malloc_alloc",
+        "rocblas_device_malloc_free",
+        "rocblas_device_malloc_get",
+        "rocblas_device_malloc_ptr",
+        "rocblas_dgemm_kernel_name",
+        "rocblas_get_device_memory_pool_stats",
+        "rocblas_get_device_memory_size",
+        "rocblas_get_version_string",
+        "rocblas_get_version_string_size",
+        "rocblas_hgemm_kernel_name",
+        "rocblas_set_device_memory_pool_release_threshold",
+        "rocblas_set_device_memory_size",
+        "rocblas_set_optimal_device_memory_size_impl",
+        "rocblas_set_trsm_invA",
+        "rocblas_set_workspace",
+        "rocblas_sgemm_kernel_name",
+        "rocblas_start_device_memory_size_query",
+        "rocblas_stop_device_memory_size_query",
+    };
+
+    bool api_range_reported(const char* name)
+    {
+        if(strstr(name, "_get_solutions"))
+            return false;
+        for(const char* unreported : api_range_unreported)
+            if(!strcmp(name, unreported))
+                return false;
+        return true;
+    }
+
+    // Argument passed for a parameter of type T: pointers are null and sizes are zero, so every
+    // call returns from its argument checks without launching a kernel
+    template <typename T>
+    T api_range_arg()
+    {
+        if constexpr(std::is_pointer<T>{})
+            return nullptr;
+        else if constexpr(std::is_same<T, rocblas_operation>{})
+            return rocblas_operation_none;
+        else if constexpr(std::is_same<T, rocblas_fill>{})
+            return rocblas_fill_upper;
+        else if constexpr(std::is_same<T, rocblas_diagonal>{})
+            return rocblas_diagonal_non_unit;
+        else if constexpr(std::is_same<T, rocblas_side>{})
+            return rocblas_side_left;
+        else if constexpr(std::is_same<T, rocblas_datatype>{})
+            return rocblas_datatype_f32_r;
+        else if constexpr(std::is_same<T, rocblas_computetype>{})
+            return rocblas_compute_type_f32;
+        else
+            return T(0); // the other enums are valid as zero
+    }
+
+    template <typename... Ps>
+    rocblas_status api_range_invoke(rocblas_status (*fn)(rocblas_handle, Ps...),
+                                    rocblas_handle handle)
+    {
+        return fn(handle, api_range_arg<Ps>()...);
+    }
+
+    // gemm_xt takes an array of handles
+    template <typename... Ps>
+    rocblas_status api_range_invoke(rocblas_status (*fn)(const rocblas_handle*, rocblas_int, Ps...),
+                                    rocblas_handle handle)
+    {
+        return fn(&handle, 1, api_range_arg<Ps>()...);
+    }
+
+    template <auto fn>
+    rocblas_status api_range_call(rocblas_handle handle)
+    {
+        return api_range_invoke(fn, handle);
+    }
+
+    struct api_range_function
+    {
+        const char* name;
+        rocblas_status (*call)(rocblas_handle);
+    };
+
+    // clang-format off
+#define API_RANGE_CALL(fn_) {#fn_, api_range_call<fn_>}
+#define API_RANGE_CALLS(fn_) \
+    API_RANGE_CALL(fn_), API_RANGE_CALL(fn_##_batched), API_RANGE_CALL(fn_##_strided_batched)
+#define API_RANGE_CALLS_SD(fn_) API_RANGE_CALLS(rocblas_s##fn_), API_RANGE_CALLS(rocblas_d##fn_)
+#define API_RANGE_CALLS_CZ(fn_) API_RANGE_CALLS(rocblas_c##fn_), API_RANGE_CALLS(rocblas_z##fn_)
+#define API_RANGE_CALLS_SDCZ(fn_) API_RANGE_CALLS_SD(fn_), API_RANGE_CALLS_CZ(fn_)
+#define API_RANGE_CALL_SDCZ(fn_)                                    \
+    API_RANGE_CALL(rocblas_s##fn_), API_RANGE_CALL(rocblas_d##fn_), \
+    API_RANGE_CALL(rocblas_c##fn_), API_RANGE_CALL(rocblas_z##fn_)
+#define API_RANGE_CALLS_EX(fn_)                                                     \
+    API_RANGE_CALL(rocblas_##fn_##_ex), API_RANGE_CALL(rocblas_##fn_##_batched_ex), \
+    API_RANGE_CALL(rocblas_##fn_##_strided_batched_ex)
+
+    // Every exported function which reports an API range
+    const api_range_function api_range_functions[] = {
+        // BLAS 1
+        API_RANGE_CALLS_SD(asum), API_RANGE_CALLS(rocblas_scasum), API_RANGE_CALLS(rocblas_dzasum),
+        API_RANGE_CALLS_SDCZ(axpy), API_RANGE_CALLS(rocblas_haxpy),
+        API_RANGE_CALLS_SDCZ(copy),
+        API_RANGE_CALLS_SD(dot), API_RANGE_CALLS_CZ(dotu), API_RANGE_CALLS_CZ(dotc),
+        API_RANGE_CALLS(rocblas_hdot), API_RANGE_CALLS(rocblas_bfdot),
+        API_RANGE_CALLS(rocblas_isamax), API_RANGE_CALLS(rocblas_idamax),
+        API_RANGE_CALLS(rocblas_icamax), API_RANGE_CALLS(rocblas_izamax),
+        API_RANGE_CALLS(rocblas_isamin), API_RANGE_CALLS(rocblas_idamin),
+        API_RANGE_CALLS(rocblas_icamin), API_RANGE_CALLS(rocblas_izamin),
+        API_RANGE_CALLS_SD(nrm2), API_RANGE_CALLS(rocblas_scnrm2), API_RANGE_CALLS(rocblas_dznrm2),
+        API_RANGE_CALLS_SDCZ(rot), API_RANGE_CALLS(rocblas_csrot), API_RANGE_CALLS(rocblas_zdrot),
+        API_RANGE_CALLS_SDCZ(rotg), API_RANGE_CALLS_SD(rotm), API_RANGE_CALLS_SD(rotmg),
+        API_RANGE_CALLS_SDCZ(scal), API_RANGE_CALLS(rocblas_csscal),
+        API_RANGE_CALLS(rocblas_zdscal), API_RANGE_CALLS_SDCZ(swap),
+        // fused BLAS 1
+        API_RANGE_CALL_SDCZ(axpy_dot), API_RANGE_CALL_SDCZ(multi_axpy),
+        API_RANGE_CALL_SDCZ(multi_dot), API_RANGE_CALL_SDCZ(scalar_op),
+        API_RANGE_CALL(rocblas_snrm2_scal), API_RANGE_CALL(rocblas_dnrm2_scal),
+        API_RANGE_CALL(rocblas_scnrm2_scal), API_RANGE_CALL(rocblas_dznrm2_scal),
+        // BLAS 2
+        API_RANGE_CALLS_SDCZ(gbmv), API_RANGE_CALLS_SDCZ(gemv),
+        API_RANGE_CALL(rocblas_hshgemv_batched), API_RANGE_CALL(rocblas_hshgemv_strided_batched),
+        API_RANGE_CALL(rocblas_hssgemv_batched), API_RANGE_CALL(rocblas_hssgemv_strided_batched),
+        API_RANGE_CALL(rocblas_tstgemv_batched), API_RANGE_CALL(rocblas_tstgemv_strided_batched),
+        API_RANGE_CALL(rocblas_tssgemv_batched), API_RANGE_CALL(rocblas_tssgemv_strided_batched),
+        API_RANGE_CALLS_SD(ger), API_RANGE_CALLS_CZ(geru), API_RANGE_CALLS_CZ(gerc),
+        API_RANGE_CALLS_SD(ger_k), API_RANGE_CALLS_CZ(geru_k), API_RANGE_CALLS_CZ(gerc_k),
+        API_RANGE_CALLS_CZ(hbmv), API_RANGE_CALLS_CZ(hemv), API_RANGE_CALLS_CZ(her),
+        API_RANGE_CALLS_CZ(her2), API_RANGE_CALLS_CZ(her_k), API_RANGE_CALLS_CZ(hpmv),
+        API_RANGE_CALLS_CZ(hpr), API_RANGE_CALLS_CZ(hpr2),
+        API_RANGE_CALLS_SD(sbmv), API_RANGE_CALLS_SD(spmv), API_RANGE_CALLS_SDCZ(spr),
+        API_RANGE_CALLS_SD(spr2), API_RANGE_CALLS_SDCZ(symv), API_RANGE_CALLS_SDCZ(syr),
+        API_RANGE_CALLS_SDCZ(syr2), API_RANGE_CALLS_SDCZ(syr_k),
+        API_RANGE_CALLS_SDCZ(tbmv), API_RANGE_CALLS_SDCZ(tbsv), API_RANGE_CALLS_SDCZ(tpmv),
+        API_RANGE_CALLS_SDCZ(tpsv), API_RANGE_CALLS_SDCZ(trmv), API_RANGE_CALLS_SDCZ(trsv),
+        // BLAS 3
+        API_RANGE_CALLS_SDCZ(dgmm), API_RANGE_CALLS_SDCZ(geam),
+        API_RANGE_CALLS_SDCZ(gemm), API_RANGE_CALLS(rocblas_hgemm), API_RANGE_CALL_SDCZ(gemm_xt),
+        API_RANGE_CALLS_SDCZ(gemmt), API_RANGE_CALLS_CZ(hemm), API_RANGE_CALLS_CZ(her2k),
+        API_RANGE_CALLS_CZ(herk), API_RANGE_CALLS_CZ(herkx), API_RANGE_CALLS_SDCZ(symm),
+        API_RANGE_CALLS_SDCZ(syr2k), API_RANGE_CALLS_SDCZ(syrk), API_RANGE_CALLS_SDCZ(syrkx),
+        API_RANGE_CALLS_SDCZ(trmm), API_RANGE_CALLS_SDCZ(trsm), API_RANGE_CALLS_SDCZ(trtri),
+        // extensions
+        API_RANGE_CALLS_EX(axpy), API_RANGE_CALLS_EX(dot), API_RANGE_CALLS_EX(dotc),
+        API_RANGE_CALLS_EX(nrm2), API_RANGE_CALLS_EX(rot), API_RANGE_CALLS_EX(scal),
+        API_RANGE_CALLS_EX(geam), API_RANGE_CALLS_EX(gemm), API_RANGE_CALLS_EX(trsm),
+        API_RANGE_CALL(rocblas_gemm_ex3), API_RANGE_CALL(rocblas_gemm_ex3_scaled),
+    };
+    // clang-format on
+
+#undef API_RANGE_CALL
+#undef API_RANGE_CALLS
+#undef API_RANGE_CALLS_SD
+#undef API_RANGE_CALLS_CZ
+#undef API_RANGE_CALLS_SDCZ
+#undef API_RANGE_CALL_SDCZ
+#undef API_RANGE_CALLS_EX
+
+    using api_range_events = std::vector<std::pair<rocblas_api_range_event, std::string>>;
+
+    void api_range_record(void*                   user_data,
+                          rocblas_api_range_event event,
+                          const char*             name,
+                          const char*)
+    {
+        static_cast<api_range_events*>(user_data)->emplace_back(event, name);
+    }
+
+    template <typename...>
+    struct testing_api_range : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            rocblas_handle handle;
+            CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+            api_range_events events;
+            rocblas_status   status
+                = rocblas_set_api_range_callback(handle, api_range_record, &events);
+            if(status == rocblas_status_not_implemented)
+            {
+                // rocBLAS is built without API ranges
+                CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+                return;
+            }
+            CHECK_ROCBLAS_ERROR(status);
+
+            std::set<std::string> called;
+            for(const auto& function : api_range_functions)
+            {
+                EXPECT_TRUE(called.insert(function.name).second) << function.name;
+
+                events.clear();
+                status = function.call(handle);
+
+                // gemm_ex3 rejects architectures other than gfx94x before its range
+                if(!strncmp(function.name, "rocblas_gemm_ex3", 16)
+                   && status == rocblas_status_arch_mismatch && events.empty())
+                    continue;
+
+                // One top level range, closed in the order the ranges were opened
+                std::vector<std::string> open;
+                int                      top_level = 0;
+                for(const auto& [event, name] : events)
+                {
+                    if(event == rocblas_api_range_begin)
+                    {
+                        EXPECT_FALSE(name.empty() || name == "unknown") << function.name;
+                        if(open.empty())
+                            top_level++;
+                        open.push_back(name);
+                    }
+                    else if(open.empty())
+                    {
+                        ADD_FAILURE() << function.name << " ends a range it did not begin";
+                        break;
+                    }
+                    else
+                    {
+                        EXPECT_EQ(name, open.back()) << function.name;
+                        open.pop_back();
+                    }
+                }
+                EXPECT_TRUE(open.empty()) << function.name;
+                EXPECT_EQ(top_level, 1) << function.name;
+            }
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_api_range_callback(handle, nullptr, nullptr));
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+
+            // Every exported function which reports a range is called above
+            for(const char* name : rocblas_exported_functions)
+            {
+                if(api_range_reported(name))
+                    EXPECT_TRUE(called.count(name)) << name << " is not called";
+            }
+        }
+    };
+
+    struct api_range : RocBLAS_Test<api_range, testing_api_range>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "api_range");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<api_range>(arg.name);
+        }
+    };
+
+    TEST_P(api_range, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_api_range<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(api_range)
+
+} // namespace
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_ger_k.hpp"
+#include "testing_ger_k_batched.hpp"
+#include "testing_ger_k_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    // possible ger_k test cases
+    enum ger_k_test_type
+    {
+        GER_K,
+        GER_K_BATCHED,
+        GER_K_STRIDED_BATCHED,
+    };
+
+    // ger_k, geru_k and gerc_k share one suite; the function name without the batch
+    // and _bad_arg suffixes selects the conjugation
+    std::string ger_k_base_name(const char* function, ger_k_test_type GER_K_TYPE)
+    {
+        std::string fn = function;
+        if(fn.size() > 8 && fn.compare(fn.size() - 8, 8, "_bad_arg") == 0)
+            fn.resize(fn.size() - 8);
+
+        std::string suffix = GER_K_TYPE == GER_K_BATCHED           ? "_batched"
+                             : GER_K_TYPE == GER_K_STRIDED_BATCHED ? "_strided_batched"
+                                                                   : "";
+        if(fn.size() < suffix.size()
+           || fn.compare(fn.size() - suffix.size(), suffix.size(), suffix) != 0)
+            return "";
+        fn.resize(fn.size() - suffix.size());
+
+        return fn == "ger_k" || fn == "geru_k" || fn == "gerc_k" ? fn : "";
+    }
+
+    //ger_k test template
+    template <template <typename...> class FILTER, ger_k_test_type GER_K_TYPE>
+    struct ger_k_template : RocBLAS_Test<ger_k_template<FILTER, GER_K_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<ger_k_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !ger_k_base_name(arg.function, GER_K_TYPE).empty();
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<ger_k_template> name(arg.name);
+
+            name << ger_k_base_name(arg.function, GER_K_TYPE) << '_'
+                 << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << arg.M << '_' << arg.N << '_' << arg.K << '_' << arg.alpha << '_'
+                     << arg.ldb;
+
+                if(GER_K_TYPE == GER_K_STRIDED_BATCHED)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.ldc;
+
+                if(GER_K_TYPE == GER_K_STRIDED_BATCHED)
+                    name << '_' << arg.stride_y;
+
+                name << '_' << arg.lda;
+
+                if(GER_K_TYPE == GER_K_STRIDED_BATCHED)
+                    name << '_' << arg.stride_a;
+
+                if(GER_K_TYPE == GER_K_STRIDED_BATCHED || GER_K_TYPE == GER_K_BATCHED)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct ger_k_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct ger_k_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>
+                         || std::is_same_v<T, rocblas_float_complex>
+                         || std::is_same_v<T, rocblas_double_complex>>> : rocblas_test_valid
+    {
+        template <bool CONJ>
+        void run(const Arguments& arg)
+        {
+            bool        bad_arg = strstr(arg.function, "_bad_arg") != nullptr;
+            const char* batched = strstr(arg.function, "_batched");
+
+            if(!batched)
+                bad_arg ? testing_ger_k_bad_arg<T, CONJ>(arg) : testing_ger_k<T, CONJ>(arg);
+            else if(strstr(arg.function, "_strided_batched"))
+                bad_arg ? testing_ger_k_strided_batched_bad_arg<T, CONJ>(arg)
+                        : testing_ger_k_strided_batched<T, CONJ>(arg);
+            else
+                bad_arg ? testing_ger_k_batched_bad_arg<T, CONJ>(arg)
+                        : testing_ger_k_batched<T, CONJ>(arg);
+        }
+
+        void operator()(const Arguments& arg)
+        {
+            if constexpr(rocblas_is_complex<T>)
+            {
+                if(!strncmp(arg.function, "geru_k", 6))
+                    run<false>(arg);
+                else if(!strncmp(arg.function, "gerc_k", 6))
+                    run<true>(arg);
+                else
+                    FAIL() << "Internal error: Test called with unknown function: "
+                           << arg.function;
+            }
+            else
+            {
+                if(!strncmp(arg.function, "ger_k", 5))
+                    run<false>(arg);
+                else
+                    FAIL() << "Internal error: Test called with unknown function: "
+                           << arg.function;
+            }
+        }
+    };
+
+    using ger_k = ger_k_template<ger_k_testing, GER_K>;
+    TEST_P(ger_k, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<ger_k_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_k);
+
+    using ger_k_batched = ger_k_template<ger_k_testing, GER_K_BATCHED>;
+    TEST_P(ger_k_batched, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<ger_k_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_k_batched);
+
+    using ger_k_strided_batched = ger_k_template<ger_k_testing, GER_K_STRIDED_BATCHED>;
+    TEST_P(ger_k_strided_batched, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<ger_k_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_k_strided_batched);
+
+} // namespace
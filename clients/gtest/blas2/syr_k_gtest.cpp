@@ -0,0 +1,186 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_syr_k.hpp"
+#include "testing_syr_k_batched.hpp"
+#include "testing_syr_k_strided_batched.hpp"
+#include "type_dispatch.hpp"
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace
+{
+    // possible syr_k test cases
+    enum syr_k_test_type
+    {
+        SYR_K,
+        SYR_K_BATCHED,
+        SYR_K_STRIDED_BATCHED,
+    };
+
+    // syr_k and her_k share one suite; the function name without the batch and
+    // _bad_arg suffixes selects the hermitian update
+    std::string syr_k_base_name(const char* function, syr_k_test_type SYR_K_TYPE)
+    {
+        std::string fn = function;
+        if(fn.size() > 8 && fn.compare(fn.size() - 8, 8, "_bad_arg") == 0)
+            fn.resize(fn.size() - 8);
+
+        std::string suffix = SYR_K_TYPE == SYR_K_BATCHED           ? "_batched"
+                             : SYR_K_TYPE == SYR_K_STRIDED_BATCHED ? "_strided_batched"
+                                                                   : "";
+        if(fn.size() < suffix.size()
+           || fn.compare(fn.size() - suffix.size(), suffix.size(), suffix) != 0)
+            return "";
+        fn.resize(fn.size() - suffix.size());
+
+        return fn == "syr_k" || fn == "her_k" ? fn : "";
+    }
+
+    //syr_k test template
+    template <template <typename...> class FILTER, syr_k_test_type SYR_K_TYPE>
+    struct syr_k_template : RocBLAS_Test<syr_k_template<FILTER, SYR_K_TYPE>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_simple_dispatch<syr_k_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !syr_k_base_name(arg.function, SYR_K_TYPE).empty();
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<syr_k_template> name(arg.name);
+
+            name << syr_k_base_name(arg.function, SYR_K_TYPE) << '_'
+                 << rocblas_datatype2string(arg.a_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                name << '_' << (char)std::toupper(arg.uplo) << '_' << arg.N << '_' << arg.K << '_'
+                     << arg.alpha << '_' << arg.ldb;
+
+                if(SYR_K_TYPE == SYR_K_STRIDED_BATCHED)
+                    name << '_' << arg.stride_x;
+
+                name << '_' << arg.lda;
+
+                if(SYR_K_TYPE == SYR_K_STRIDED_BATCHED)
+                    name << '_' << arg.stride_a;
+
+                if(SYR_K_TYPE == SYR_K_STRIDED_BATCHED || SYR_K_TYPE == SYR_K_BATCHED)
+                    name << '_' << arg.batch_count;
+            }
+
+            return std::move(name);
+        }
+    };
+
+    // By default, this test does not apply to any types.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct syr_k_testing : rocblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct syr_k_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>
+                         || std::is_same_v<T, rocblas_float_complex>
+                         || std::is_same_v<T, rocblas_double_complex>>> : rocblas_test_valid
+    {
+        template <bool HERM>
+        void run(const Arguments& arg)
+        {
+            bool        bad_arg = strstr(arg.function, "_bad_arg") != nullptr;
+            const char* batched = strstr(arg.function, "_batched");
+
+            if(!batched)
+                bad_arg ? testing_syr_k_bad_arg<T, HERM>(arg) : testing_syr_k<T, HERM>(arg);
+            else if(strstr(arg.function, "_strided_batched"))
+                bad_arg ? testing_syr_k_strided_batched_bad_arg<T, HERM>(arg)
+                        : testing_syr_k_strided_batched<T, HERM>(arg);
+            else
+                bad_arg ? testing_syr_k_batched_bad_arg<T, HERM>(arg)
+                        : testing_syr_k_batched<T, HERM>(arg);
+        }
+
+        void operator()(const Arguments& arg)
+        {
+            if(!strncmp(arg.function, "syr_k", 5))
+                run<false>(arg);
+            else if constexpr(rocblas_is_complex<T>)
+            {
+                if(!strncmp(arg.function, "her_k", 5))
+                    run<true>(arg);
+                else
+                    FAIL() << "Internal error: Test called with unknown function: "
+                           << arg.function;
+            }
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using syr_k = syr_k_template<syr_k_testing, SYR_K>;
+    TEST_P(syr_k, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<syr_k_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr_k);
+
+    using syr_k_batched = syr_k_template<syr_k_testing, SYR_K_BATCHED>;
+    TEST_P(syr_k_batched, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<syr_k_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr_k_batched);
+
+    using syr_k_strided_batched = syr_k_template<syr_k_testing, SYR_K_STRIDED_BATCHED>;
+    TEST_P(syr_k_strided_batched, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<syr_k_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(syr_k_strided_batched);
+
+} // namespace
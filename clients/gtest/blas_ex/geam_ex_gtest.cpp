@@ -22,7 +22,9 @@
 #include "rocblas_data.hpp"
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
+#include "testing_geam_batched_ex.hpp"
 #include "testing_geam_ex.hpp"
+#include "testing_geam_strided_batched_ex.hpp"
 #include "type_dispatch.hpp"
 #include <cctype>
 #include <cstring>
@@ -55,12 +57,12 @@ namespace
             {
             case GEAM_EX:
                 return !strcmp(arg.function, "geam_ex") || !strcmp(arg.function, "geam_ex_bad_arg");
-                // case GEAM_BATCHED_EX:
-                //     return !strcmp(arg.function, "geam_batched_ex")
-                //            || !strcmp(arg.function, "geam_batched_bad_arg_ex");
-                // case GEAM_STRIDED_BATCHED_EX:
-                //     return !strcmp(arg.function, "geam_strided_batched_ex")
-                //            || !strcmp(arg.function, "geam_strided_batched_bad_arg_ex");
+            case GEAM_BATCHED_EX:
+                return !strcmp(arg.function, "geam_batched_ex")
+                       || !strcmp(arg.function, "geam_batched_ex_bad_arg");
+            case GEAM_STRIDED_BATCHED_EX:
+                return !strcmp(arg.function, "geam_strided_batched_ex")
+                       || !strcmp(arg.function, "geam_strided_batched_ex_bad_arg");
             }
             return false;
         }
@@ -70,10 +72,27 @@ namespace
         {
             RocBLAS_TestName<geam_ex_template> name(arg.name);
 
-            if(rocblas_geam_ex_operation(arg.geam_ex_op) == rocblas_geam_ex_operation_min_plus)
+            switch(rocblas_geam_ex_operation(arg.geam_ex_op))
+            {
+            case rocblas_geam_ex_operation_min_plus:
                 name << "min_plus";
-            else if(rocblas_geam_ex_operation(arg.geam_ex_op) == rocblas_geam_ex_operation_plus_min)
+                break;
+            case rocblas_geam_ex_operation_plus_min:
                 name << "plus_min";
+                break;
+            case rocblas_geam_ex_operation_max_plus:
+                name << "max_plus";
+                break;
+            case rocblas_geam_ex_operation_min_max:
+                name << "min_max";
+                break;
+            case rocblas_geam_ex_operation_max_min:
+                name << "max_min";
+                break;
+            case rocblas_geam_ex_operation_or_and:
+                name << "or_and";
+                break;
+            }
 
             // No support for mixed precision
             name << '_' << rocblas_datatype2string(arg.a_type);
@@ -147,6 +166,14 @@ namespace
                 testing_geam_ex<T>(arg);
             else if(!strcmp(arg.function, "geam_ex_bad_arg"))
                 testing_geam_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "geam_batched_ex"))
+                testing_geam_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "geam_batched_ex_bad_arg"))
+                testing_geam_batched_ex_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "geam_strided_batched_ex"))
+                testing_geam_strided_batched_ex<T>(arg);
+            else if(!strcmp(arg.function, "geam_strided_batched_ex_bad_arg"))
+                testing_geam_strided_batched_ex_bad_arg<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -160,4 +187,20 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(geam_ex);
 
+    using geam_batched_ex = geam_ex_template<geam_ex_testing, GEAM_BATCHED_EX>;
+    TEST_P(geam_batched_ex, blas_ex)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<geam_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geam_batched_ex);
+
+    using geam_strided_batched_ex = geam_ex_template<geam_ex_testing, GEAM_STRIDED_BATCHED_EX>;
+    TEST_P(geam_strided_batched_ex, blas_ex)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_simple_dispatch<geam_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geam_strided_batched_ex);
+
 } // namespace
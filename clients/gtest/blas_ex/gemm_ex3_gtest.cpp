@@ -25,6 +25,7 @@
 #include "rocblas_datatype2string.hpp"
 #include "rocblas_test.hpp"
 #include "testing_gemm_ex3.hpp"
+#include "testing_gemm_ex3_scaled.hpp"
 #include "type_dispatch.hpp"
 #include <cctype>
 #include <cstring>
@@ -72,7 +73,9 @@ namespace
 
             case GEMM_EX3:
                 return !strcmp(arg.function, "gemm_ex3")
-                       || !strcmp(arg.function, "gemm_ex3_bad_arg");
+                       || !strcmp(arg.function, "gemm_ex3_bad_arg")
+                       || !strcmp(arg.function, "gemm_ex3_scaled")
+                       || !strcmp(arg.function, "gemm_ex3_scaled_bad_arg");
 #endif
             }
 
@@ -96,6 +99,9 @@ namespace
 
             name << '_' << arg.ldd;
 
+            if(strstr(arg.function, "_scaled") != nullptr)
+                name << "_scale_" << arg.scale_a_mode << '_' << arg.scale_b_mode;
+
             return std::move(name);
         }
     };
@@ -143,6 +149,14 @@ namespace
             {
                 testing_gemm_ex3_bad_arg<TiA, TiB, To, Tc>(arg);
             }
+            else if(!strcmp(arg.function, "gemm_ex3_scaled"))
+            {
+                testing_gemm_ex3_scaled<TiA, TiB, To, Tc>(arg);
+            }
+            else if(!strcmp(arg.function, "gemm_ex3_scaled_bad_arg"))
+            {
+                testing_gemm_ex3_scaled_bad_arg<TiA, TiB, To, Tc>(arg);
+            }
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
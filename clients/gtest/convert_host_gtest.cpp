@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "testing_convert_host.hpp"
+#include "type_dispatch.hpp"
+#include <cstring>
+#include <type_traits>
+
+namespace
+{
+    // convert_host test template
+    template <template <typename...> class FILTER>
+    struct convert_host_template : RocBLAS_Test<convert_host_template<FILTER>, FILTER>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return rocblas_convert_host_dispatch<
+                convert_host_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "convert_host")
+                   || !strcmp(arg.function, "convert_host_bad_arg")
+                   || !strcmp(arg.function, "convert_host_exhaustive");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            RocBLAS_TestName<convert_host_template> name(arg.name);
+
+            name << rocblas_datatype2string(arg.a_type) << '_'
+                 << rocblas_datatype2string(arg.d_type);
+
+            if(strstr(arg.function, "_bad_arg") != nullptr)
+            {
+                name << "_bad_arg";
+            }
+            else
+            {
+                if(!strcmp(arg.function, "convert_host_exhaustive"))
+                    name << "_exhaustive";
+                else
+                    name << '_' << arg.N;
+
+                if(arg.stochastic_rounding)
+                    name << "_SR";
+            }
+
+            return std::move(name);
+        }
+    };
+
+    template <typename T>
+    constexpr bool convert_host_type
+        = std::is_same_v<T, float> || std::is_same_v<T, rocblas_half>
+          || std::is_same_v<T, rocblas_bfloat16> || std::is_same_v<T, rocblas_f8>
+          || std::is_same_v<T, rocblas_bf8>;
+
+    template <typename T>
+    constexpr bool convert_host_f8_type
+        = std::is_same_v<T, rocblas_f8> || std::is_same_v<T, rocblas_bf8>;
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed third parameter is used for enable_if_t below.
+    template <typename, typename = void, typename = void>
+    struct convert_host_testing : rocblas_test_invalid
+    {
+    };
+
+    // Every pair of supported types is valid except f8 <-> bf8 and identical types
+    template <typename Ti, typename To>
+    struct convert_host_testing<
+        Ti,
+        To,
+        std::enable_if_t<convert_host_type<Ti> && convert_host_type<To> && !std::is_same_v<Ti, To>
+                         && !(convert_host_f8_type<Ti> && convert_host_f8_type<To>)>>
+        : rocblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "convert_host"))
+                testing_convert_host<Ti, To>(arg);
+            else if(!strcmp(arg.function, "convert_host_bad_arg"))
+                testing_convert_host_bad_arg<Ti, To>(arg);
+            else if(!strcmp(arg.function, "convert_host_exhaustive"))
+                testing_convert_host_exhaustive<Ti, To>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using convert_host = convert_host_template<convert_host_testing>;
+    TEST_P(convert_host, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            rocblas_convert_host_dispatch<convert_host_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(convert_host);
+
+} // namespace
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas.hpp"
+#include "rocblas_data.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "utility.hpp"
+#include <string>
+
+#ifdef WIN32
+#define setenv(A, B, C) _putenv_s(A, B)
+#define unsetenv(A) _putenv_s(A, "")
+#endif
+
+namespace
+{
+    // Creates a handle with ROCBLAS_STREAM_ORDER_ALLOC set or unset, restoring the environment
+    rocblas_handle create_handle_with_stream_order_alloc(bool stream_order_alloc)
+    {
+        const char* env   = getenv("ROCBLAS_STREAM_ORDER_ALLOC");
+        std::string saved = env ? env : "";
+
+        if(stream_order_alloc)
+            setenv("ROCBLAS_STREAM_ORDER_ALLOC", "1", true);
+        else
+            unsetenv("ROCBLAS_STREAM_ORDER_ALLOC");
+
+        rocblas_handle handle;
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&handle));
+
+        if(env)
+            setenv("ROCBLAS_STREAM_ORDER_ALLOC", saved.c_str(), true);
+        else
+            unsetenv("ROCBLAS_STREAM_ORDER_ALLOC");
+
+        return handle;
+    }
+
+    template <typename...>
+    struct testing_device_memory_pool : rocblas_test_valid
+    {
+        void operator()(const Arguments&)
+        {
+            size_t used_current, used_high, reserved_current, reserved_high;
+
+            EXPECT_ROCBLAS_STATUS(rocblas_set_device_memory_pool_release_threshold(nullptr, 0),
+                                  rocblas_status_invalid_handle);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_device_memory_pool_stats(
+                    nullptr, &used_current, &used_high, &reserved_current, &reserved_high),
+                rocblas_status_invalid_handle);
+
+            // Without stream order allocation the handle has no pool
+            rocblas_handle handle = create_handle_with_stream_order_alloc(false);
+            EXPECT_ROCBLAS_STATUS(rocblas_set_device_memory_pool_release_threshold(handle, 0),
+                                  rocblas_status_not_implemented);
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_device_memory_pool_stats(
+                    handle, &used_current, &used_high, &reserved_current, &reserved_high),
+                rocblas_status_not_implemented);
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+
+            int device, pools_supported = 0;
+            CHECK_HIP_ERROR(hipGetDevice(&device));
+            CHECK_HIP_ERROR(hipDeviceGetAttribute(
+                &pools_supported, hipDeviceAttributeMemoryPoolsSupported, device));
+            if(!pools_supported)
+                return;
+
+            handle = create_handle_with_stream_order_alloc(true);
+
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_get_device_memory_pool_stats(
+                    handle, nullptr, &used_high, &reserved_current, &reserved_high),
+                rocblas_status_invalid_pointer);
+
+            // Nothing is reserved until a function needs workspace
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_pool_stats(
+                handle, &used_current, &used_high, &reserved_current, &reserved_high));
+            EXPECT_EQ(used_high, 0);
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_pool_release_threshold(handle, 0));
+
+            // nrm2 takes its reduction workspace from the pool
+            const rocblas_int N = 1 << 20;
+            device_vector<float> dx(N);
+            CHECK_DEVICE_ALLOCATION(dx.memcheck());
+            CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(float) * N));
+
+            float result;
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            CHECK_ROCBLAS_ERROR(rocblas_snrm2(handle, N, dx, 1, &result));
+
+            CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_pool_stats(
+                handle, &used_current, &used_high, &reserved_current, &reserved_high));
+            EXPECT_EQ(used_current, 0);
+            EXPECT_GT(used_high, 0);
+            EXPECT_GE(reserved_high, used_high);
+
+            CHECK_ROCBLAS_ERROR(rocblas_destroy_handle(handle));
+        }
+    };
+
+    struct device_memory_pool : RocBLAS_Test<device_memory_pool, testing_device_memory_pool>
+    {
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments&)
+        {
+            return true;
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            return !strcmp(arg.function, "device_memory_pool");
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            return RocBLAS_TestName<device_memory_pool>(arg.name);
+        }
+    };
+
+    TEST_P(device_memory_pool, auxiliary)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(testing_device_memory_pool<>{}(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(device_memory_pool)
+
+} // namespace
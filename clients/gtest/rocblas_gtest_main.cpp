@@ -22,9 +22,11 @@
 
 #include <string>
 
+#include "client_memory_pool.hpp"
 #include "rocblas_data.hpp"
 #include "rocblas_parse_data.hpp"
 #include "rocblas_test.hpp"
+#include "rocblas_test_parallel.hpp"
 #include "test_cleanup.hpp"
 #include "utility.hpp"
 
@@ -34,6 +36,7 @@ class ConfigurableEventListener : public TestEventListener
 {
     TestEventListener* const eventListener;
     std::atomic_size_t       skipped_tests{0}; // Number of skipped tests.
+    client_memory_pool_stats pool_stats; // Memory pool counters at the start of the test case.
 
 public:
     bool showTestCases      = true; // Show the names of each test case.
@@ -42,6 +45,7 @@ public:
     bool showInlineFailures = true; // Show each failure as it occurs.
     bool showEnvironment    = true; // Show the setup of the global environment.
     bool showInlineSkips    = true; // Show when we skip a test.
+    bool showMemoryPool     = true; // Show the memory pool reuse of each test case.
 
     explicit ConfigurableEventListener(TestEventListener* theEventListener)
         : eventListener(theEventListener)
@@ -79,6 +83,7 @@ public:
     {
         if(showTestCases)
             eventListener->OnTestCaseStart(test_case);
+        pool_stats = client_pool_get_stats();
     }
 
     void OnTestStart(const TestInfo& test_info) override
@@ -120,6 +125,23 @@ public:
     {
         if(showTestCases)
             eventListener->OnTestCaseEnd(test_case);
+
+        if(showMemoryPool)
+        {
+            client_memory_pool_stats stats = client_pool_get_stats();
+
+            client_memory_pool_stats suite;
+            suite.hits    = stats.hits - pool_stats.hits;
+            suite.misses  = stats.misses - pool_stats.misses;
+            suite.miss_us = stats.miss_us - pool_stats.miss_us;
+            if(suite.hits + suite.misses)
+            {
+                rocblas_cout << "[ MEMPOOL  ] " << test_case.name() << ": " << suite.hits << "/"
+                             << suite.hits + suite.misses << " allocations reused, ~"
+                             << suite.saved_us() / 1000 << " ms saved, "
+                             << (stats.cached_bytes >> 20) << " MB cached" << std::endl;
+            }
+        }
     }
 
     void OnEnvironmentsTearDownStart(const UnitTest& unit_test) override
@@ -233,7 +255,7 @@ static void rocblas_print_args(const std::string& args)
 // Device Query
 static void rocblas_set_test_device()
 {
-    int device_id    = 0;
+    int device_id    = rocblas_test_shard_device();
     int device_count = query_device_property();
     if(device_count <= device_id)
     {
@@ -263,6 +285,9 @@ int main(int argc, char** argv)
 
     rocblas_print_version();
 
+    // Number of worker processes to run the tests in, if --parallel is given
+    int parallel = rocblas_parse_parallel(argc, argv);
+
     // Set test device
     rocblas_set_test_device();
 
@@ -280,8 +305,11 @@ int main(int argc, char** argv)
     // Set Google Test listener
     rocblas_set_listener();
 
-    // Run the tests
-    int status = RUN_ALL_TESTS();
+    // Run the tests, in worker processes with --parallel
+    int status = parallel ? rocblas_run_parallel(parallel) : RUN_ALL_TESTS();
+
+    // Report the results of a --parallel worker to its parent
+    rocblas_test_shard_write_summary();
 
     // Failures printed at end for reporting so repeat version info
     rocblas_print_version();
@@ -289,6 +317,9 @@ int main(int argc, char** argv)
     // end test results with command line
     rocblas_print_args(args);
 
+    // Free the blocks cached by the client memory pool
+    client_pool_release();
+
     //rocblas_shutdown();
 
     return status;
@@ -0,0 +1,650 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_test_parallel.hpp"
+#include "flops.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_test.hpp"
+#include "utility.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern char** environ;
+#endif
+
+using namespace testing;
+
+namespace
+{
+    // Number of workers when this is a --parallel parent, otherwise 0
+    int g_workers = 0;
+
+    // Arguments passed on to the workers, without argv[0] and --parallel
+    std::vector<std::string>& worker_args()
+    {
+        static std::vector<std::string> args;
+        return args;
+    }
+
+    // Ordinal and estimated cost of each instantiated test, keyed by "suite/name"
+    auto& test_costs()
+    {
+        static std::unordered_map<std::string, std::pair<size_t, double>> costs;
+        return costs;
+    }
+
+    // Ordinals of the tests of each suite assigned to this worker, or nullptr if not a worker
+    const std::unordered_map<std::string, std::unordered_set<size_t>>* shard_tests()
+    {
+        static auto* tests = []() -> std::unordered_map<std::string, std::unordered_set<size_t>>* {
+            const char* file = getenv("ROCBLAS_TEST_SHARD_FILE");
+            if(!file)
+                return nullptr;
+
+            std::ifstream ifs(file);
+            if(!ifs)
+            {
+                rocblas_cerr << "Cannot open " << file << std::endl;
+                exit(EXIT_FAILURE);
+            }
+
+            auto*       tests = new std::unordered_map<std::string, std::unordered_set<size_t>>;
+            std::string suite;
+            size_t      ordinal;
+            while(ifs >> suite >> ordinal)
+                (*tests)[suite].insert(ordinal);
+            return tests;
+        }();
+        return tests;
+    }
+
+    /**********************************************************************
+     * Cost estimate of a test, in seconds of a single device test run.   *
+     * The host reference computation dominates for large sizes, and the  *
+     * initialization and checking of the data for small ones.            *
+     **********************************************************************/
+
+    // Dimension clamped to the range of the flop counts
+    rocblas_int dim(int64_t n)
+    {
+        return rocblas_int(std::clamp<int64_t>(n, 0, std::numeric_limits<rocblas_int>::max()));
+    }
+
+    bool has_prefix(const std::string& str, const char* prefix)
+    {
+        return !str.compare(0, strlen(prefix), prefix);
+    }
+
+    template <typename T>
+    double test_gflops(const std::string& function, const Arguments& arg)
+    {
+        rocblas_int M = dim(arg.M), N = dim(arg.N), K = dim(arg.K);
+
+        if(has_prefix(function, "gemm") || has_prefix(function, "geam_min_plus"))
+            return gemm_gflop_count<T>(M, N, K);
+        if(has_prefix(function, "trsm"))
+            return trsm_gflop_count<T>(M, N, arg.side == 'L' || arg.side == 'l' ? M : N);
+        if(has_prefix(function, "trmm"))
+            return trmm_gflop_count<T>(M, N, char2rocblas_side(arg.side));
+        if(has_prefix(function, "symm") || has_prefix(function, "hemm"))
+            return symm_gflop_count<T>(char2rocblas_side(arg.side), M, N);
+        if(has_prefix(function, "syr2k") || has_prefix(function, "her2k"))
+            return syr2k_gflop_count<T>(N, K);
+        if(has_prefix(function, "syrk") || has_prefix(function, "herk"))
+            return syrk_gflop_count<T>(N, K) * (function.find("kx") != std::string::npos ? 2 : 1);
+        if(has_prefix(function, "geam") || has_prefix(function, "dgmm"))
+            return geam_gflop_count<T>(M, N);
+        if(has_prefix(function, "trtri"))
+            return gemm_gflop_count<T>(N, N, N) / 6;
+
+        // Level 2 with an M x N matrix
+        for(auto* f : {"gemv", "gbmv", "ger"})
+            if(has_prefix(function, f))
+                return ger_gflop_count<T>(M, N);
+
+        // Level 2 with an N x N matrix, some of which use M for N
+        for(auto* f : {"sy", "he", "sp", "hp", "sb", "hb", "tr", "tp", "tb"})
+            if(has_prefix(function, f))
+                return symv_gflop_count<T>(std::max(M, N));
+
+        // Level 1
+        return axpy_gflop_count<T>(N);
+    }
+
+    // Elements of the matrices and vectors of a test, which are initialized and checked
+    double test_elements(const std::string& function, const Arguments& arg)
+    {
+        double M = std::max<int64_t>(arg.M, 1), N = std::max<int64_t>(arg.N, 1),
+               K = std::max<int64_t>(arg.K, 1);
+
+        double gflops = test_gflops<float>(function, arg);
+        double mn     = M * N;
+        if(gflops * 1e9 >= 2 * mn * K)
+            return M * K + K * N + 2 * mn; // level 3
+        if(gflops * 1e9 >= mn)
+            return mn + M + N; // level 2
+        return N * (std::abs(arg.incx) + std::abs(arg.incy) + 1); // level 1
+    }
+
+    double test_cost(const Arguments& arg)
+    {
+        constexpr double overhead_s      = 2e-3; // handle creation, allocation and launches
+        constexpr double host_gflops     = 20; // host reference BLAS throughput
+        constexpr double host_gelements  = 0.1; // host initialization and checking throughput
+        constexpr double complex_factor  = 4; // flops per complex multiply-add
+        constexpr double double_slowdown = 2; // host throughput of double precision
+
+        std::string function = arg.function;
+        bool        is_complex
+            = arg.a_type == rocblas_datatype_f32_c || arg.a_type == rocblas_datatype_f64_c;
+        bool is_double
+            = arg.a_type == rocblas_datatype_f64_r || arg.a_type == rocblas_datatype_f64_c;
+
+        double gflops   = test_gflops<float>(function, arg) * (is_complex ? complex_factor : 1);
+        double elements = test_elements(function, arg) * (is_complex ? 2 : 1);
+
+        double batch = function.find("batched") != std::string::npos
+                           ? std::max<int64_t>(arg.batch_count, 1)
+                           : 1;
+
+        double seconds = gflops / host_gflops + elements * 1e-9 / host_gelements;
+        return overhead_s + batch * seconds * (is_double ? double_slowdown : 1);
+    }
+
+    /**********************************************************************
+     * Google Test filter matching, as --gtest_filter does                *
+     **********************************************************************/
+
+    bool glob_match(const char* pattern, const char* pattern_end, const char* name)
+    {
+        for(; pattern != pattern_end; ++pattern, ++name)
+        {
+            if(*pattern == '*')
+            {
+                for(const char* n = name;; ++n)
+                {
+                    if(glob_match(pattern + 1, pattern_end, n))
+                        return true;
+                    if(!*n)
+                        return false;
+                }
+            }
+            if(!*name || (*pattern != '?' && *pattern != *name))
+                return false;
+        }
+        return !*name;
+    }
+
+    // Whether name matches any of the ':' separated patterns
+    bool matches_any(const std::string& name, const std::string& patterns)
+    {
+        for(size_t pos = 0; pos <= patterns.size();)
+        {
+            size_t end = std::min(patterns.find(':', pos), patterns.size());
+            if(glob_match(patterns.data() + pos, patterns.data() + end, name.c_str()))
+                return true;
+            pos = end + 1;
+        }
+        return false;
+    }
+
+    bool filter_match(const std::string& name, const std::string& filter)
+    {
+        size_t      dash     = filter.find('-');
+        std::string positive = filter.substr(0, dash);
+        std::string negative = dash == std::string::npos ? "" : filter.substr(dash + 1);
+        if(positive.empty())
+            positive = "*";
+        return matches_any(name, positive) && (negative.empty() || !matches_any(name, negative));
+    }
+
+    /**********************************************************************
+     * Workers                                                            *
+     **********************************************************************/
+
+    struct shard
+    {
+        std::vector<std::pair<std::string, size_t>> tests; // suite and ordinal
+        size_t                                       num_tests = 0;
+        double                                       cost      = 0;
+        int                                          device    = 0;
+        std::string                                  file, log, summary;
+#ifndef WIN32
+        pid_t pid = -1;
+#endif
+        std::chrono::steady_clock::time_point start;
+    };
+
+    // --gtest_output with a path distinct for each worker
+    std::string shard_output_arg(const std::string& arg, size_t index)
+    {
+        std::string value  = arg.substr(strlen("--gtest_output="));
+        std::string suffix = "_shard" + std::to_string(index);
+        size_t      colon  = value.find(':');
+        std::string format = value.substr(0, colon);
+        std::string path   = colon == std::string::npos ? "" : value.substr(colon + 1);
+
+        if(path.empty() || path.back() == '/')
+            path += "test_detail" + suffix + "." + format;
+        else
+        {
+            size_t dot = path.rfind('.'), slash = path.rfind('/');
+            if(dot != std::string::npos && (slash == std::string::npos || dot > slash))
+                path.insert(dot, suffix);
+            else
+                path += suffix;
+        }
+        return "--gtest_output=" + format + ":" + path;
+    }
+
+    // Results written by rocblas_test_shard_write_summary
+    struct shard_summary
+    {
+        bool                     valid   = false;
+        size_t                   tests   = 0;
+        size_t                   passed  = 0;
+        size_t                   skipped = 0;
+        std::vector<std::string> failures;
+    };
+
+    shard_summary read_summary(const std::string& file)
+    {
+        shard_summary summary;
+        std::ifstream ifs(file);
+        std::string   key;
+        while(ifs >> key)
+        {
+            if(key == "tests")
+                ifs >> summary.tests;
+            else if(key == "passed")
+                ifs >> summary.passed;
+            else if(key == "skipped")
+                ifs >> summary.skipped;
+            else if(key == "failure")
+            {
+                std::string name;
+                ifs >> name;
+                summary.failures.push_back(name);
+            }
+            else if(key == "end")
+                summary.valid = true;
+        }
+        return summary;
+    }
+
+    void print_file(const std::string& file)
+    {
+        std::ifstream ifs(file);
+        std::string   line;
+        while(std::getline(ifs, line))
+            rocblas_cout << line << '\n';
+        rocblas_cout.flush();
+    }
+
+#ifndef WIN32
+    bool spawn_worker(shard& s, size_t index, size_t num_workers)
+    {
+        std::vector<std::string> args{"rocblas-test"};
+        for(auto& arg : worker_args())
+            args.push_back(has_prefix(arg, "--gtest_output=") ? shard_output_arg(arg, index) : arg);
+
+        std::vector<std::string> env{"ROCBLAS_TEST_SHARD_FILE=" + s.file,
+                                     "ROCBLAS_TEST_SHARD_SUMMARY=" + s.summary,
+                                     "ROCBLAS_TEST_DEVICE=" + std::to_string(s.device)};
+
+        // Divide the host threads of the reference computations among the workers
+        if(!getenv("OMP_NUM_THREADS"))
+        {
+            size_t threads = std::max<size_t>(std::thread::hardware_concurrency() / num_workers, 1);
+            env.push_back("OMP_NUM_THREADS=" + std::to_string(threads));
+        }
+
+        for(char** e = environ; *e; ++e)
+            if(!has_prefix(*e, "ROCBLAS_TEST_SHARD_FILE=")
+               && !has_prefix(*e, "ROCBLAS_TEST_SHARD_SUMMARY=")
+               && !has_prefix(*e, "ROCBLAS_TEST_DEVICE="))
+                env.push_back(*e);
+
+        std::vector<char*> argv, envp;
+        for(auto& arg : args)
+            argv.push_back(arg.data());
+        argv.push_back(nullptr);
+        for(auto& e : env)
+            envp.push_back(e.data());
+        envp.push_back(nullptr);
+
+        // The worker's output goes to its log, which is printed when it finishes
+        posix_spawn_file_actions_t actions;
+        posix_spawn_file_actions_init(&actions);
+        posix_spawn_file_actions_addopen(
+            &actions, STDOUT_FILENO, s.log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        posix_spawn_file_actions_adddup2(&actions, STDOUT_FILENO, STDERR_FILENO);
+
+        s.start    = std::chrono::steady_clock::now();
+        int status = posix_spawn(
+            &s.pid, "/proc/self/exe", &actions, nullptr, argv.data(), envp.data());
+        posix_spawn_file_actions_destroy(&actions);
+
+        if(status)
+        {
+            rocblas_cerr << "Cannot start worker " << index << ": " << strerror(status)
+                         << std::endl;
+            return false;
+        }
+        return true;
+    }
+#endif
+}
+
+/*********************************************************************
+ * Instantiation hooks                                               *
+ *********************************************************************/
+
+bool rocblas_test_shard_select(const char* suite, size_t ordinal)
+{
+    auto* tests = shard_tests();
+    if(!tests)
+        return true;
+    auto it = tests->find(suite);
+    return it != tests->end() && it->second.count(ordinal);
+}
+
+void rocblas_test_shard_record(const char*        suite,
+                               const std::string& name,
+                               size_t             ordinal,
+                               const Arguments&   arg)
+{
+    if(g_workers)
+        test_costs()[std::string(suite) + "/" + name] = {ordinal, test_cost(arg)};
+}
+
+/*********************************************************************
+ * Parent                                                            *
+ *********************************************************************/
+
+int rocblas_parse_parallel(int& argc, char** argv)
+{
+    int workers = 0;
+
+    char** argv_p = argv + 1;
+    for(int i = 1; argv[i]; ++i)
+    {
+        if(!strcmp(argv[i], "--parallel"))
+        {
+            char* end;
+            if(argv[i + 1] && (workers = strtol(argv[i + 1], &end, 10)) > 0 && !*end)
+                ++i;
+            else
+            {
+                workers = 0;
+                (void)hipGetDeviceCount(&workers);
+            }
+            workers = std::max(workers, 1);
+        }
+        else
+        {
+            worker_args().push_back(argv[i]);
+            *argv_p++ = argv[i];
+        }
+    }
+
+    *argv_p = nullptr;
+    argc    = argv_p - argv;
+
+#ifdef WIN32
+    if(workers)
+    {
+        rocblas_cerr << "--parallel is not supported on Windows, running tests in one process"
+                     << std::endl;
+        workers = 0;
+    }
+#endif
+
+    g_workers = workers;
+    return workers;
+}
+
+int rocblas_run_parallel(int num_workers)
+{
+#ifdef WIN32
+    return EXIT_FAILURE;
+#else
+    auto*       unit_test = UnitTest::GetInstance();
+    std::string filter    = GTEST_FLAG(filter);
+    bool        disabled  = GTEST_FLAG(also_run_disabled_tests);
+
+    // Collect the tests which match the filter, grouped by the Arguments they were instantiated
+    // from, as the workers select Arguments rather than individual tests
+    std::map<std::pair<std::string, size_t>, std::pair<double, size_t>> groups;
+    for(int i = 0; i < unit_test->total_test_suite_count(); ++i)
+    {
+        const TestSuite* test_suite = unit_test->GetTestSuite(i);
+        for(int j = 0; j < test_suite->total_test_count(); ++j)
+        {
+            const TestInfo* info       = test_suite->GetTestInfo(j);
+            std::string     suite_name = info->test_suite_name();
+            std::string     test_name  = info->name();
+            std::string     suite      = suite_name.substr(suite_name.rfind('/') + 1);
+            std::string     param      = test_name.substr(test_name.find('/') + 1);
+
+            if(!disabled && (has_prefix(suite, "DISABLED_") || has_prefix(test_name, "DISABLED_")))
+                continue;
+            if(!filter_match(suite_name + "." + test_name, filter))
+                continue;
+
+            auto it = test_costs().find(suite + "/" + param);
+            if(it == test_costs().end())
+                continue;
+            auto& group = groups[{suite, it->second.first}];
+            group.first += it->second.second;
+            group.second++;
+        }
+    }
+
+    // Longest processing time first assignment to the least loaded worker
+    std::vector<std::pair<double, std::pair<std::string, size_t>>> sorted;
+    for(auto& group : groups)
+        sorted.push_back({group.second.first, group.first});
+    std::sort(sorted.begin(), sorted.end(), [](auto& a, auto& b) { return a.first > b.first; });
+
+    int device_count = 0;
+    (void)hipGetDeviceCount(&device_count);
+    device_count = std::max(device_count, 1);
+
+    std::string       base = rocblas_tempname();
+    std::vector<shard> shards(num_workers);
+    for(size_t i = 0; i < shards.size(); ++i)
+    {
+        shards[i].device  = int(i % device_count);
+        shards[i].file    = base + ".shard" + std::to_string(i);
+        shards[i].log     = base + ".log" + std::to_string(i);
+        shards[i].summary = base + ".summary" + std::to_string(i);
+    }
+
+    double total_cost = 0;
+    for(auto& [cost, key] : sorted)
+    {
+        auto& s = *std::min_element(shards.begin(), shards.end(), [](auto& a, auto& b) {
+            return a.cost < b.cost;
+        });
+        s.cost += cost;
+        s.num_tests += groups[key].second;
+        s.tests.push_back(key);
+        total_cost += cost;
+    }
+
+    // Start the workers
+    size_t running = 0;
+    for(size_t i = 0; i < shards.size(); ++i)
+    {
+        auto& s = shards[i];
+        {
+            std::ofstream ofs(s.file);
+            for(auto& [suite, ordinal] : s.tests)
+                ofs << suite << ' ' << ordinal << '\n';
+        }
+
+        rocblas_cout << "[ PARALLEL ] worker " << i << " on device " << s.device << ": "
+                     << s.num_tests << " tests, "
+                     << (total_cost ? 100 * s.cost / total_cost : 0) << "% of estimated cost"
+                     << std::endl;
+
+        if(spawn_worker(s, i, shards.size()))
+            ++running;
+    }
+
+    // Wait for the workers, printing the output of each as it finishes
+    int           status = running == shards.size() ? EXIT_SUCCESS : EXIT_FAILURE;
+    shard_summary total;
+    total.valid = true;
+    auto start  = std::chrono::steady_clock::now();
+
+    while(running)
+    {
+        int   wstatus;
+        pid_t pid = wait(&wstatus);
+        if(pid < 0)
+            break;
+
+        auto it = std::find_if(
+            shards.begin(), shards.end(), [=](const shard& s) { return s.pid == pid; });
+        if(it == shards.end())
+            continue;
+        --running;
+
+        size_t        index   = it - shards.begin();
+        shard_summary summary = read_summary(it->summary);
+        bool          exited  = WIFEXITED(wstatus) && !WEXITSTATUS(wstatus);
+        double        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now()
+                                                       - it->start)
+                             .count();
+
+        rocblas_cout << "[ PARALLEL ] worker " << index << " finished in " << seconds << " s"
+                     << std::endl;
+
+        // The output of workers is shown when they have failures
+        if(!exited || !summary.valid || !summary.failures.empty())
+        {
+            rocblas_cout << "[ PARALLEL ] output of worker " << index << ":" << std::endl;
+            print_file(it->log);
+            status = EXIT_FAILURE;
+        }
+
+        if(!summary.valid)
+        {
+            rocblas_cout << "[ PARALLEL ] worker " << index << " did not complete" << std::endl;
+            total.valid = false;
+        }
+
+        total.tests += summary.tests;
+        total.passed += summary.passed;
+        total.skipped += summary.skipped;
+        total.failures.insert(
+            total.failures.end(), summary.failures.begin(), summary.failures.end());
+    }
+
+    for(auto& s : shards)
+    {
+        remove(s.file.c_str());
+        remove(s.log.c_str());
+        remove(s.summary.c_str());
+    }
+    remove(base.c_str());
+
+    // Merged report, in the form of the Google Test summary
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                    .count();
+    std::sort(total.failures.begin(), total.failures.end());
+
+    rocblas_cout << "[==========] " << total.tests << " tests from " << shards.size()
+                 << " workers ran. (" << size_t(ms) << " ms total)\n"
+                 << "[  PASSED  ] " << total.passed << " tests.\n";
+    if(total.skipped)
+        rocblas_cout << "[  SKIPPED ] " << total.skipped << " tests.\n";
+    if(!total.failures.empty())
+    {
+        rocblas_cout << "[  FAILED  ] " << total.failures.size() << " tests, listed below:\n";
+        for(auto& name : total.failures)
+            rocblas_cout << "[  FAILED  ] " << name << '\n';
+    }
+    if(!total.valid)
+        rocblas_cout << "[  FAILED  ] not all workers completed, see their output above\n";
+    rocblas_cout.flush();
+
+    return status;
+#endif
+}
+
+/*********************************************************************
+ * Worker                                                            *
+ *********************************************************************/
+
+int rocblas_test_shard_device()
+{
+    const char* device = getenv("ROCBLAS_TEST_DEVICE");
+    return device ? atoi(device) : 0;
+}
+
+void rocblas_test_shard_write_summary()
+{
+    const char* file = getenv("ROCBLAS_TEST_SHARD_SUMMARY");
+    if(!file)
+        return;
+
+    auto*         unit_test = UnitTest::GetInstance();
+    std::ofstream ofs(file);
+    ofs << "tests " << unit_test->test_to_run_count() << '\n'
+        << "passed " << unit_test->successful_test_count() << '\n'
+        << "skipped " << unit_test->skipped_test_count() << '\n';
+
+    for(int i = 0; i < unit_test->total_test_suite_count(); ++i)
+    {
+        const TestSuite* test_suite = unit_test->GetTestSuite(i);
+        for(int j = 0; j < test_suite->total_test_count(); ++j)
+        {
+            const TestInfo* info = test_suite->GetTestInfo(j);
+            if(info->should_run() && info->result()->Failed())
+                ofs << "failure " << info->test_suite_name() << "." << info->name() << '\n';
+        }
+    }
+
+    // Marks a complete summary, as a worker which crashes may leave a partial one
+    ofs << "end" << std::endl;
+}
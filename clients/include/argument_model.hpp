@@ -24,6 +24,10 @@
 
 #include "rocblas_arguments.hpp"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace ArgumentLogging
 {
     const double NA_value = -1.0; // invalid for time, GFlop, GB
@@ -35,6 +39,49 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+// Roofline columns: percent of peak Gflops and GB/s, arithmetic intensity and bound
+void ArgumentModel_set_roofline(bool r);
+bool ArgumentModel_get_roofline();
+
+// Peaks from a file of key = value lines (gflops_f64, gflops_f32, gflops_f16, gflops_bf16,
+// gflops_i8, gflops_f8, gflops for all types, GBps) instead of those detected from the device
+void ArgumentModel_set_peak_file(const std::string& file);
+
+// Roofline dataset of every timed call, JSON when file ends in .json and CSV otherwise
+void ArgumentModel_set_roofline_file(const std::string& file);
+
+void ArgumentModel_log_roofline(rocblas_internal_ostream& name_line,
+                                rocblas_internal_ostream& val_line,
+                                const Arguments&          arg,
+                                int64_t                   batch_count,
+                                double                    gpu_us,
+                                double                    gflops,
+                                double                    gbytes,
+                                double                    rocblas_gflops,
+                                double                    rocblas_GBps);
+
+// (name, value) pairs of the arguments printed for a call
+using ArgumentModel_arg_list = std::vector<std::pair<std::string, std::string>>;
+
+// Structured results of every timed call with the run metadata, JSON Lines when file ends in
+// .json or .jsonl and CSV otherwise
+void ArgumentModel_set_output(const std::string& file);
+bool ArgumentModel_get_output();
+
+void ArgumentModel_log_output(const Arguments&              arg,
+                              const ArgumentModel_arg_list& arg_list,
+                              int64_t                       batch_count,
+                              double                        gpu_us,
+                              double                        gflops,
+                              double                        gbytes,
+                              double                        rocblas_gflops,
+                              double                        rocblas_GBps,
+                              double                        cpu_us,
+                              double                        norm1,
+                              double                        norm2,
+                              double                        norm3,
+                              double                        norm4);
+
 // ArgumentModel template has a variadic list of argument enums
 template <rocblas_argument... Args>
 class ArgumentModel
@@ -51,17 +98,18 @@ class ArgumentModel
     }
 
 public:
-    void log_perf(rocblas_internal_ostream& name_line,
-                  rocblas_internal_ostream& val_line,
-                  const Arguments&          arg,
-                  double                    gpu_us,
-                  double                    gflops,
-                  double                    gbytes,
-                  double                    cpu_us,
-                  double                    norm1,
-                  double                    norm2,
-                  double                    norm3,
-                  double                    norm4)
+    void log_perf(rocblas_internal_ostream&     name_line,
+                  rocblas_internal_ostream&     val_line,
+                  const Arguments&              arg,
+                  const ArgumentModel_arg_list& arg_list,
+                  double                        gpu_us,
+                  double                        gflops,
+                  double                        gbytes,
+                  double                        cpu_us,
+                  double                        norm1,
+                  double                        norm2,
+                  double                        norm3,
+                  double                        norm4)
     {
         constexpr bool has_batch_count = has(e_batch_count);
         rocblas_int    batch_count     = has_batch_count ? arg.batch_count : 1;
@@ -92,6 +140,17 @@ public:
         name_line << ",us";
         val_line << ", " << gpu_us;
 
+        if(ArgumentModel_get_roofline())
+            ArgumentModel_log_roofline(name_line,
+                                       val_line,
+                                       arg,
+                                       batch_count,
+                                       gpu_us,
+                                       gflops,
+                                       gbytes,
+                                       rocblas_gflops,
+                                       rocblas_GBps);
+
         if(arg.unit_check || arg.norm_check)
         {
             if(cpu_us != ArgumentLogging::NA_value)
@@ -130,6 +189,27 @@ public:
                 }
             }
         }
+
+        if(ArgumentModel_get_output())
+        {
+            // cpu time and errors are only measured with checking
+            const double NA = ArgumentLogging::NA_value;
+
+            bool checked = arg.unit_check || arg.norm_check;
+            ArgumentModel_log_output(arg,
+                                     arg_list,
+                                     batch_count,
+                                     gpu_us,
+                                     gflops,
+                                     gbytes,
+                                     rocblas_gflops,
+                                     rocblas_GBps,
+                                     checked ? cpu_us : NA,
+                                     arg.norm_check ? norm1 : NA,
+                                     arg.norm_check ? norm2 : NA,
+                                     arg.norm_check ? norm3 : NA,
+                                     arg.norm_check ? norm4 : NA);
+        }
     }
 
     template <typename T>
@@ -173,11 +253,21 @@ public:
             value_list << rocblas_datatype2string(arg.compute_type) << delim;
         }
 
+        // (name, value) pairs of the arguments for ArgumentModel_log_output
+        ArgumentModel_arg_list arg_list;
+        bool                   output = ArgumentModel_get_output();
+
         // Output (name, value) pairs to name_list and value_list
         auto print = [&, delim = ""](const char* name, auto&& value) mutable {
             name_list << delim << name;
             value_list << delim << value;
             delim = ",";
+            if(output)
+            {
+                rocblas_internal_ostream value_str;
+                value_str << value;
+                arg_list.emplace_back(name, value_str.str());
+            }
         };
 
         // Args is a parameter pack of type:   rocblas_argument...
@@ -217,6 +307,7 @@ public:
             log_perf(name_list,
                      value_list,
                      arg,
+                     arg_list,
                      gpu_us,
                      gflops,
                      gpu_bytes,
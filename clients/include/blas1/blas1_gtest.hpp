@@ -71,4 +71,9 @@ enum class blas1
     rotmg,
     rotmg_batched,
     rotmg_strided_batched,
+    axpy_dot,
+    multi_axpy,
+    multi_dot,
+    nrm2_scal,
+    scalar_op,
 };
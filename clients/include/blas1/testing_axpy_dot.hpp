@@ -0,0 +1,294 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_axpy_dot_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int N    = 100;
+        rocblas_int incx = 1;
+        rocblas_int incy = 1;
+        rocblas_int incz = 1;
+
+        device_vector<T> alpha_d(1), zero_d(1), result_d(1);
+
+        const T alpha_h(1), zero_h(0);
+        T       result_h;
+
+        const T* alpha  = &alpha_h;
+        const T* zero   = &zero_h;
+        T*       result = &result_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero   = zero_d;
+            result = result_d;
+        }
+
+        // Allocate device memory
+        device_vector<T> dx(N, incx);
+        device_vector<T> dy(N, incy);
+        device_vector<T> dz(N, incz);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+        CHECK_DEVICE_ALLOCATION(dz.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(nullptr, N, alpha, dx, incx, dy, incy, dz, incz, result),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, alpha, dx, incx, dy, incy, dz, incz, nullptr),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, nullptr, dx, incx, dy, incy, dz, incz, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, alpha, dx, incx, nullptr, incy, dz, incz, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(handle, N, alpha, dx, incx, dy, incy, nullptr, incz, result),
+            rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_axpy_dot<T>(handle, N, alpha, nullptr, incx, dy, incy, dz, incz, result),
+                rocblas_status_invalid_pointer);
+
+            // If alpha == 0, then X can be nullptr without error
+            EXPECT_ROCBLAS_STATUS(
+                rocblas_axpy_dot<T>(handle, N, zero, nullptr, incx, dy, incy, dz, incz, result),
+                rocblas_status_success);
+        }
+
+        // If N == 0, then alpha, X, Y and Z can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_axpy_dot<T>(
+                handle, 0, nullptr, nullptr, incx, nullptr, incy, nullptr, incz, result),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_axpy_dot(const Arguments& arg)
+{
+    rocblas_int          N       = arg.N;
+    rocblas_int          incx    = arg.incx;
+    rocblas_int          incy    = arg.incy;
+    T                    h_alpha = arg.get_alpha<T>();
+    bool                 HMM     = arg.HMM;
+    rocblas_local_handle handle{arg};
+
+    // arg.algo selects the aliased z == y form, otherwise z shares the stride of x
+    bool        z_is_y = arg.algo == 1;
+    rocblas_int incz   = z_is_y ? incy : incx;
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0)
+    {
+        T h_result = T(1);
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_axpy_dot<T>(
+            handle, N, nullptr, nullptr, incx, nullptr, incy, nullptr, incz, &h_result));
+        T zero = T(0);
+        unit_check_general<T>(1, 1, 1, &zero, &h_result);
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_vector<T> hx(N, incx);
+    host_vector<T> hy(N, incy);
+    host_vector<T> hz(N, incz);
+    host_vector<T> hy_gold(N, incy);
+    T              cpu_result, rocblas_result_1, rocblas_result_2;
+
+    // Allocate device memory
+    device_vector<T> dx(N, incx, HMM);
+    device_vector<T> dy(N, incy, HMM);
+    device_vector<T> dz(N, incz, HMM);
+    device_vector<T> d_alpha(1, 1, HMM);
+    device_vector<T> d_result(1, 1, HMM);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dz.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hz, arg, rocblas_client_alpha_sets_nan, false);
+
+    hy_gold = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dz.transfer_from(hz));
+
+    const T* dz_ptr = z_is_y ? (const T*)dy : (const T*)dz;
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        cblas_axpy<T>(N, h_alpha, hx, incx, hy_gold, incy);
+        const T* hz_ptr = z_is_y ? (const T*)hy_gold : (const T*)hz;
+        if constexpr(rocblas_is_complex<T>)
+            cblas_dotc<T>(N, hy_gold, incy, hz_ptr, incz, &cpu_result);
+        else
+            cblas_dot<T>(N, hy_gold, incy, hz_ptr, incz, &cpu_result);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.pointer_mode_host)
+        {
+            // ROCBLAS pointer mode host
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpy_dot<T>(
+                handle, N, &h_alpha, dx, incx, dy, incy, dz_ptr, incz, &rocblas_result_1));
+            handle.post_test(arg);
+
+            // copy output from device to CPU
+            host_vector<T> hy_1(N, incy);
+            CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, hy_gold, hy_1);
+                unit_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_1);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1 = norm_check_general<T>('F', 1, N, incy, hy_gold, hy_1);
+                rocblas_error_1
+                    += double(rocblas_abs((cpu_result - rocblas_result_1) / cpu_result));
+            }
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            // ROCBLAS pointer mode device
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+            CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_axpy_dot<T>(
+                handle, N, d_alpha, dx, incx, dy, incy, dz_ptr, incz, d_result));
+            handle.post_test(arg);
+
+            host_vector<T> hy_2(N, incy);
+            CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+            CHECK_HIP_ERROR(
+                hipMemcpy(&rocblas_result_2, d_result, sizeof(T), hipMemcpyDeviceToHost));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, hy_gold, hy_2);
+                unit_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_2);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_2 = norm_check_general<T>('F', 1, N, incy, hy_gold, hy_2);
+                rocblas_error_2
+                    += double(rocblas_abs((cpu_result - rocblas_result_2) / cpu_result));
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_axpy_dot<T>(handle, N, d_alpha, dx, incx, dy, incy, dz_ptr, incz, d_result);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_axpy_dot<T>(handle, N, d_alpha, dx, incx, dy, incy, dz_ptr, incz, d_result);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_alpha, e_incx, e_incy, e_algo>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            axpy_dot_gflop_count<T>(N),
+            axpy_dot_gbyte_count<T>(N, z_is_y),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
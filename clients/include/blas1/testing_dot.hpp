@@ -211,6 +211,11 @@ void testing_dot(const Arguments& arg)
         (CONJ ? cblas_dotc<T> : cblas_dot<T>)(N, hx, incx, hy_ptr, incy, &cpu_result);
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
+        // norm_check reports the error against a reference accumulated in double precision
+        T cpu_result_wide = cpu_result;
+        if(arg.norm_check)
+            cblas_dot_wide<CONJ, T>(N, hx, incx, hy_ptr, incy, &cpu_result_wide);
+
         if(arg.pointer_mode_host)
         {
             if(arg.unit_check)
@@ -231,7 +236,8 @@ void testing_dot(const Arguments& arg)
 
             if(arg.norm_check)
             {
-                rocblas_error_1 = double(rocblas_abs((cpu_result - rocblas_result_1) / cpu_result));
+                rocblas_error_1
+                    = double(rocblas_abs((cpu_result_wide - rocblas_result_1) / cpu_result_wide));
             }
         }
 
@@ -258,7 +264,8 @@ void testing_dot(const Arguments& arg)
 
             if(arg.norm_check)
             {
-                rocblas_error_2 = double(rocblas_abs((cpu_result - rocblas_result_2) / cpu_result));
+                rocblas_error_2
+                    = double(rocblas_abs((cpu_result_wide - rocblas_result_2) / cpu_result_wide));
             }
         }
     }
@@ -0,0 +1,252 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_multi_axpy_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int    N        = 100;
+        rocblas_int    K        = 3;
+        rocblas_int    incx     = 1;
+        rocblas_int    incy     = 1;
+        rocblas_stride stride_x = N;
+
+        device_vector<T> alpha_d(K);
+
+        const T  alpha_h[3] = {T(1), T(2), T(3)};
+        const T* alpha      = alpha_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(T) * K, hipMemcpyHostToDevice));
+            alpha = alpha_d;
+        }
+
+        // Allocate device memory
+        device_strided_batch_vector<T> dx(N, incx, stride_x, K);
+        device_vector<T>               dy(N, incy);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(nullptr, N, K, alpha, dx, incx, stride_x, dy, incy),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(handle, N, -1, alpha, dx, incx, stride_x, dy, incy),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(handle, N, K, nullptr, dx, incx, stride_x, dy, incy),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(handle, N, K, alpha, nullptr, incx, stride_x, dy, incy),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(handle, N, K, alpha, dx, incx, stride_x, nullptr, incy),
+            rocblas_status_invalid_pointer);
+
+        // If N == 0 or K == 0, then alpha, X and Y can be nullptr without error
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(handle, 0, K, nullptr, nullptr, incx, stride_x, nullptr, incy),
+            rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(handle, N, 0, nullptr, nullptr, incx, stride_x, nullptr, incy),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_multi_axpy(const Arguments& arg)
+{
+    rocblas_int          N    = arg.N;
+    rocblas_int          K    = arg.K;
+    rocblas_int          incx = arg.incx;
+    rocblas_int          incy = arg.incy;
+    bool                 HMM  = arg.HMM;
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    if(N <= 0 || K <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_axpy<T>(handle, N, K, nullptr, nullptr, incx, 0, nullptr, incy),
+            K < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    rocblas_stride stride_x = std::max(arg.stride_x, rocblas_stride(N) * std::abs(incx));
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_vector<T>               h_alpha(K);
+    host_strided_batch_vector<T> hx(N, incx, stride_x, K);
+    host_vector<T>               hy(N, incy);
+    host_vector<T>               hy_gold(N, incy);
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(N, incx, stride_x, K, HMM);
+    device_vector<T>               dy(N, incy, HMM);
+    device_vector<T>               d_alpha(K, 1, HMM);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory, alpha[0] comes from the arguments
+    rocblas_init_vector(h_alpha, arg, rocblas_client_alpha_sets_nan, false);
+    h_alpha[0] = arg.get_alpha<T>();
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+
+    hy_gold = hy;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int j = 0; j < K; j++)
+            cblas_axpy<T>(N, h_alpha[j], hx[j], incx, hy_gold, incy);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.pointer_mode_host)
+        {
+            // ROCBLAS pointer mode host
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_multi_axpy<T>(handle, N, K, h_alpha, dx, incx, stride_x, dy, incy));
+            handle.post_test(arg);
+
+            // copy output from device to CPU
+            host_vector<T> hy_1(N, incy);
+            CHECK_HIP_ERROR(hy_1.transfer_from(dy));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, hy_gold, hy_1);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1 = norm_check_general<T>('F', 1, N, incy, hy_gold, hy_1);
+            }
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            // ROCBLAS pointer mode device
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_multi_axpy<T>(handle, N, K, d_alpha, dx, incx, stride_x, dy, incy));
+            handle.post_test(arg);
+
+            host_vector<T> hy_2(N, incy);
+            CHECK_HIP_ERROR(hy_2.transfer_from(dy));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, N, incy, hy_gold, hy_2);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_2 = norm_check_general<T>('F', 1, N, incy, hy_gold, hy_2);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_multi_axpy<T>(handle, N, K, d_alpha, dx, incx, stride_x, dy, incy);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_multi_axpy<T>(handle, N, K, d_alpha, dx, incx, stride_x, dy, incy);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_K, e_incx, e_stride_x, e_incy>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            multi_axpy_gflop_count<T>(N, K),
+            multi_axpy_gbyte_count<T>(N, K),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
@@ -0,0 +1,257 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+template <typename T>
+void testing_multi_dot_bad_arg(const Arguments& arg)
+{
+    rocblas_int    N        = 100;
+    rocblas_int    K        = 3;
+    rocblas_int    incx     = 1;
+    rocblas_int    incy     = 1;
+    rocblas_stride stride_x = N;
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(N, incx, stride_x, K);
+    device_vector<T>               dy(N, incy);
+    device_vector<T>               d_results(K);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_results.memcheck());
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_multi_dot<T>(nullptr, N, K, dx, incx, stride_x, dy, incy, d_results),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_multi_dot<T>(handle, N, -1, dx, incx, stride_x, dy, incy, d_results),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_multi_dot<T>(handle, N, K, nullptr, incx, stride_x, dy, incy, d_results),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_multi_dot<T>(handle, N, K, dx, incx, stride_x, nullptr, incy, d_results),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_multi_dot<T>(handle, N, K, dx, incx, stride_x, dy, incy, nullptr),
+        rocblas_status_invalid_pointer);
+
+    // If K == 0, then X, Y and results can be nullptr without error
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_multi_dot<T>(handle, N, 0, nullptr, incx, stride_x, nullptr, incy, nullptr),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_multi_dot(const Arguments& arg)
+{
+    rocblas_int          N    = arg.N;
+    rocblas_int          K    = arg.K;
+    rocblas_int          incx = arg.incx;
+    rocblas_int          incy = arg.incy;
+    bool                 HMM  = arg.HMM;
+    rocblas_local_handle handle{arg};
+
+    // check to prevent undefined memory allocation error
+    if(K <= 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_multi_dot<T>(handle, N, K, nullptr, incx, 0, nullptr, incy, nullptr),
+            K < 0 ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    if(N <= 0)
+    {
+        host_vector<T>   h_results_0(K);
+        device_vector<T> d_results_0(K);
+        CHECK_DEVICE_ALLOCATION(d_results_0.memcheck());
+
+        rocblas_init_nan(h_results_0, 1, K, 1);
+        CHECK_HIP_ERROR(d_results_0.transfer_from(h_results_0));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_multi_dot<T>(handle, N, K, nullptr, incx, 0, nullptr, incy, d_results_0));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_multi_dot<T>(handle, N, K, nullptr, incx, 0, nullptr, incy, h_results_0));
+
+        host_vector<T> cpu_0(K);
+        host_vector<T> gpu_0(K);
+        for(rocblas_int j = 0; j < K; j++)
+            cpu_0[j] = T(0);
+        CHECK_HIP_ERROR(gpu_0.transfer_from(d_results_0));
+        unit_check_general<T>(1, K, 1, cpu_0, gpu_0);
+        unit_check_general<T>(1, K, 1, cpu_0, h_results_0);
+        return;
+    }
+
+    rocblas_stride stride_x = std::max(arg.stride_x, rocblas_stride(N) * std::abs(incx));
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    // Allocate host memory
+    host_strided_batch_vector<T> hx(N, incx, stride_x, K);
+    host_vector<T>               hy(N, incy);
+    host_vector<T>               cpu_results(K);
+    host_vector<T>               rocblas_results_1(K);
+    host_vector<T>               rocblas_results_2(K);
+
+    // Allocate device memory
+    device_strided_batch_vector<T> dx(N, incx, stride_x, K, HMM);
+    device_vector<T>               dy(N, incy, HMM);
+    device_vector<T>               d_results(K, 1, HMM);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_results.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // CPU BLAS
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int j = 0; j < K; j++)
+        {
+            if constexpr(rocblas_is_complex<T>)
+                cblas_dotc<T>(N, hx[j], incx, hy, incy, &cpu_results[j]);
+            else
+                cblas_dot<T>(N, hx[j], incx, hy, incy, &cpu_results[j]);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.pointer_mode_host)
+        {
+            // GPU BLAS, rocblas_pointer_mode_host
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(rocblas_multi_dot<T>(
+                handle, N, K, dx, incx, stride_x, dy, incy, rocblas_results_1));
+            handle.post_test(arg);
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, K, 1, cpu_results, rocblas_results_1);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1
+                    = norm_check_general<T>('F', 1, K, 1, cpu_results, rocblas_results_1);
+            }
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            // GPU BLAS, rocblas_pointer_mode_device
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                rocblas_multi_dot<T>(handle, N, K, dx, incx, stride_x, dy, incy, d_results));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(rocblas_results_2.transfer_from(d_results));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(1, K, 1, cpu_results, rocblas_results_2);
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_2
+                    = norm_check_general<T>('F', 1, K, 1, cpu_results, rocblas_results_2);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_multi_dot<T>(handle, N, K, dx, incx, stride_x, dy, incy, d_results);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_multi_dot<T>(handle, N, K, dx, incx, stride_x, dy, incy, d_results);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_N, e_K, e_incx, e_stride_x, e_incy>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            multi_dot_gflop_count<T>(N, K),
+            multi_dot_gbyte_count<T>(N, K),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
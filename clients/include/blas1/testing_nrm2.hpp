@@ -152,6 +152,11 @@ void testing_nrm2(const Arguments& arg)
         cblas_nrm2<T>(N, hx, incx, cpu_result);
         cpu_time_used = get_time_us_no_sync() - cpu_time_used;
 
+        // norm_check reports the error against a reference accumulated in double precision
+        real_t<T> cpu_result_wide = cpu_result[0];
+        if(arg.norm_check)
+            cblas_nrm2_wide<T>(N, hx, incx, &cpu_result_wide);
+
         real_t<T> abs_result = cpu_result[0] > 0 ? cpu_result[0] : -cpu_result[0];
         real_t<T> abs_error;
         if(abs_result > 0)
@@ -180,7 +185,7 @@ void testing_nrm2(const Arguments& arg)
             if(arg.norm_check)
             {
                 rocblas_error_1
-                    = rocblas_abs((cpu_result[0] - rocblas_result_1[0]) / cpu_result[0]);
+                    = rocblas_abs((cpu_result_wide - rocblas_result_1[0]) / cpu_result_wide);
             }
         }
 
@@ -200,7 +205,7 @@ void testing_nrm2(const Arguments& arg)
             if(arg.norm_check)
             {
                 rocblas_error_2
-                    = rocblas_abs((cpu_result[0] - rocblas_result_2[0]) / cpu_result[0]);
+                    = rocblas_abs((cpu_result_wide - rocblas_result_2[0]) / cpu_result_wide);
             }
         }
     }
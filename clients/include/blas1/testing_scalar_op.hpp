@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <complex>
+
+template <typename T>
+T scalar_op_reference(rocblas_scalar_operation op, T a, T b)
+{
+    auto ref_sqrt = [](T x) -> T {
+        if constexpr(rocblas_is_complex<T>)
+        {
+            using U             = real_t<T>;
+            std::complex<U> res = std::sqrt(std::complex<U>(std::real(x), std::imag(x)));
+            return T(res.real(), res.imag());
+        }
+        else
+        {
+            return std::sqrt(x);
+        }
+    };
+
+    switch(op)
+    {
+    case rocblas_scalar_operation_copy:
+        return a;
+    case rocblas_scalar_operation_negate:
+        return -a;
+    case rocblas_scalar_operation_reciprocal:
+        return T(1) / a;
+    case rocblas_scalar_operation_sqrt:
+        return ref_sqrt(a);
+    case rocblas_scalar_operation_rsqrt:
+        return T(1) / ref_sqrt(a);
+    case rocblas_scalar_operation_multiply:
+        return a * b;
+    case rocblas_scalar_operation_divide:
+        return a / b;
+    case rocblas_scalar_operation_negate_divide:
+        return -a / b;
+    }
+    return a;
+}
+
+constexpr rocblas_scalar_operation rocblas_scalar_operations[]
+    = {rocblas_scalar_operation_copy,
+       rocblas_scalar_operation_negate,
+       rocblas_scalar_operation_reciprocal,
+       rocblas_scalar_operation_sqrt,
+       rocblas_scalar_operation_rsqrt,
+       rocblas_scalar_operation_multiply,
+       rocblas_scalar_operation_divide,
+       rocblas_scalar_operation_negate_divide};
+
+template <typename T>
+void testing_scalar_op_bad_arg(const Arguments& arg)
+{
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        device_vector<T> a_d(1), b_d(1), result_d(1);
+        CHECK_DEVICE_ALLOCATION(a_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(b_d.memcheck());
+        CHECK_DEVICE_ALLOCATION(result_d.memcheck());
+
+        T a_h(2), b_h(4), result_h;
+
+        const T* a      = &a_h;
+        const T* b      = &b_h;
+        T*       result = &result_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(a_d, a, sizeof(T), hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(hipMemcpy(b_d, b, sizeof(T), hipMemcpyHostToDevice));
+            a      = a_d;
+            b      = b_d;
+            result = result_d;
+        }
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_scalar_op<T>(nullptr, rocblas_scalar_operation_divide, a, b, result),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_scalar_op<T>(handle, rocblas_scalar_operation(-1), a, b, result),
+            rocblas_status_invalid_value);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_scalar_op<T>(handle, rocblas_scalar_operation_divide, nullptr, b, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_scalar_op<T>(handle, rocblas_scalar_operation_divide, a, nullptr, result),
+            rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_scalar_op<T>(handle, rocblas_scalar_operation_divide, a, b, nullptr),
+            rocblas_status_invalid_pointer);
+
+        // b is not used by unary operations
+        EXPECT_ROCBLAS_STATUS(
+            rocblas_scalar_op<T>(handle, rocblas_scalar_operation_negate, a, nullptr, result),
+            rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_scalar_op(const Arguments& arg)
+{
+    T h_a = arg.get_alpha<T>();
+    T h_b = arg.get_beta<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // Allocate device memory
+    device_vector<T> d_a(1), d_b(1), d_result(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(d_a.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_b.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_result.memcheck());
+
+    CHECK_HIP_ERROR(hipMemcpy(d_a, &h_a, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_b, &h_b, sizeof(T), hipMemcpyHostToDevice));
+
+    double gpu_time_used, cpu_time_used = 0.0;
+    double rocblas_error_1 = 0.0;
+    double rocblas_error_2 = 0.0;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(auto op : rocblas_scalar_operations)
+        {
+            double cpu_start  = get_time_us_no_sync();
+            T      cpu_result = scalar_op_reference(op, h_a, h_b);
+            cpu_time_used += get_time_us_no_sync() - cpu_start;
+
+            // a few ulp for the sqrt and division sequences, which may differ from the host
+            double tol = std::numeric_limits<real_t<T>>::epsilon() * 8 * rocblas_abs(cpu_result);
+
+            if(arg.pointer_mode_host)
+            {
+                T rocblas_result_1;
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+                CHECK_ROCBLAS_ERROR(
+                    rocblas_scalar_op<T>(handle, op, &h_a, &h_b, &rocblas_result_1));
+
+                if(arg.unit_check)
+                    near_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_1, tol);
+
+                if(arg.norm_check)
+                    rocblas_error_1 = std::max(
+                        rocblas_error_1,
+                        double(rocblas_abs((cpu_result - rocblas_result_1) / cpu_result)));
+            }
+
+            if(arg.pointer_mode_device)
+            {
+                T rocblas_result_2;
+                CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+                handle.pre_test(arg);
+                CHECK_ROCBLAS_ERROR(rocblas_scalar_op<T>(handle, op, d_a, d_b, d_result));
+                handle.post_test(arg);
+
+                CHECK_HIP_ERROR(
+                    hipMemcpy(&rocblas_result_2, d_result, sizeof(T), hipMemcpyDeviceToHost));
+
+                if(arg.unit_check)
+                    near_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_2, tol);
+
+                if(arg.norm_check)
+                    rocblas_error_2 = std::max(
+                        rocblas_error_2,
+                        double(rocblas_abs((cpu_result - rocblas_result_2) / cpu_result)));
+
+                // result may alias an operand
+                device_vector<T> d_inplace(1);
+                CHECK_DEVICE_ALLOCATION(d_inplace.memcheck());
+                CHECK_HIP_ERROR(hipMemcpy(d_inplace, &h_a, sizeof(T), hipMemcpyHostToDevice));
+                CHECK_ROCBLAS_ERROR(rocblas_scalar_op<T>(handle, op, d_inplace, d_b, d_inplace));
+                CHECK_HIP_ERROR(
+                    hipMemcpy(&rocblas_result_2, d_inplace, sizeof(T), hipMemcpyDeviceToHost));
+
+                if(arg.unit_check)
+                    near_check_general<T>(1, 1, 1, &cpu_result, &rocblas_result_2, tol);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_scalar_op<T>(
+                handle, rocblas_scalar_operation_negate_divide, d_a, d_b, d_result);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_scalar_op<T>(
+                handle, rocblas_scalar_operation_negate_divide, d_a, d_b, d_result);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_alpha, e_beta>{}.log_args<T>(rocblas_cout,
+                                                     arg,
+                                                     gpu_time_used,
+                                                     ArgumentLogging::NA_value,
+                                                     ArgumentLogging::NA_value,
+                                                     cpu_time_used,
+                                                     rocblas_error_1,
+                                                     rocblas_error_2);
+    }
+}
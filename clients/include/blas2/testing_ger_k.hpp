@@ -0,0 +1,309 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "bytes.hpp"
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+template <typename T, bool CONJ>
+void testing_ger_k_bad_arg(const Arguments& arg)
+{
+    auto rocblas_ger_k_fn = rocblas_ger_k<T, CONJ>;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        rocblas_int M   = 100;
+        rocblas_int N   = 100;
+        rocblas_int K   = 4;
+        rocblas_int ldx = 100;
+        rocblas_int ldy = 100;
+        rocblas_int lda = 100;
+
+        device_vector<T> alpha_d(1), zero_d(1);
+
+        const T alpha_h(1), zero_h(0);
+
+        const T* alpha = &alpha_h;
+        const T* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        // Allocate device memory
+        device_matrix<T> dA(M, N, lda);
+        device_matrix<T> dx(M, K, ldx);
+        device_matrix<T> dy(N, K, ldy);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dx.memcheck());
+        CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(
+            (rocblas_ger_k_fn(nullptr, M, N, K, alpha, dx, ldx, dy, ldy, dA, lda)),
+            rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(
+            (rocblas_ger_k_fn(handle, M, N, K, nullptr, dx, ldx, dy, ldy, dA, lda)),
+            rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(
+                (rocblas_ger_k_fn(handle, M, N, K, alpha, nullptr, ldx, dy, ldy, dA, lda)),
+                rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(
+                (rocblas_ger_k_fn(handle, M, N, K, alpha, dx, ldx, nullptr, ldy, dA, lda)),
+                rocblas_status_invalid_pointer);
+
+            EXPECT_ROCBLAS_STATUS(
+                (rocblas_ger_k_fn(handle, M, N, K, alpha, dx, ldx, dy, ldy, nullptr, lda)),
+                rocblas_status_invalid_pointer);
+        }
+
+        // ldx and ldy must cover the rows of x and y
+        EXPECT_ROCBLAS_STATUS(
+            (rocblas_ger_k_fn(handle, M, N, K, alpha, dx, M - 1, dy, ldy, dA, lda)),
+            rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(
+            (rocblas_ger_k_fn(handle, M, N, K, alpha, dx, ldx, dy, N - 1, dA, lda)),
+            rocblas_status_invalid_size);
+
+        // K==0 all pointers may be null
+        EXPECT_ROCBLAS_STATUS(
+            (rocblas_ger_k_fn(handle, M, N, 0, nullptr, nullptr, ldx, nullptr, ldy, nullptr, lda)),
+            rocblas_status_success);
+
+        // alpha==0 all pointers may be null
+        EXPECT_ROCBLAS_STATUS(
+            (rocblas_ger_k_fn(handle, M, N, K, zero, nullptr, ldx, nullptr, ldy, nullptr, lda)),
+            rocblas_status_success);
+    }
+}
+
+template <typename T, bool CONJ>
+void testing_ger_k(const Arguments& arg)
+{
+    auto rocblas_ger_k_fn = rocblas_ger_k<T, CONJ>;
+
+    rocblas_int M       = arg.M;
+    rocblas_int N       = arg.N;
+    rocblas_int K       = arg.K;
+    rocblas_int ldx     = arg.ldb;
+    rocblas_int ldy     = arg.ldc;
+    rocblas_int lda     = arg.lda;
+    T           h_alpha = arg.get_alpha<T>();
+
+    rocblas_local_handle handle{arg};
+
+    // argument check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || ldx < M || ldx < 1 || ldy < N || ldy < 1
+                        || lda < M || lda < 1;
+    if(invalid_size || !M || !N || !K)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            (rocblas_ger_k_fn(handle, M, N, K, nullptr, nullptr, ldx, nullptr, ldy, nullptr, lda)),
+            invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+
+        return;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(M, N, lda);
+    host_matrix<T> hA_gold(M, N, lda);
+    host_matrix<T> hx(M, K, ldx);
+    host_matrix<T> hy(N, K, ldy);
+    host_vector<T> halpha(1);
+    halpha[0] = h_alpha;
+
+    // Allocate device memory
+    device_matrix<T> dA(M, N, lda);
+    device_matrix<T> dx(M, K, ldx);
+    device_matrix<T> dy(N, K, ldy);
+    device_vector<T> d_alpha(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(hA, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(hx, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hy, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix);
+
+    hA_gold = hA;
+
+    // Transfer data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    double gpu_time_used, cpu_time_used;
+    double rocblas_error_1;
+    double rocblas_error_2;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        if(arg.pointer_mode_host)
+        {
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                (rocblas_ger_k_fn(handle, M, N, K, &h_alpha, dx, ldx, dy, ldy, dA, lda)));
+            handle.post_test(arg);
+
+            // Transfer output from device to CPU
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+            // Transfer data from CPU to device (only need to restore if we did mode_host test)
+            if(arg.pointer_mode_device)
+                CHECK_HIP_ERROR(dA.transfer_from(hA_gold)); // gold still original hA
+        }
+
+        // CPU BLAS, one rank-1 update per column of x and y
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int j = 0; j < K; j++)
+            cblas_ger<T, CONJ>(M,
+                               N,
+                               h_alpha,
+                               (T*)hx + size_t(j) * ldx,
+                               1,
+                               (T*)hy + size_t(j) * ldy,
+                               1,
+                               hA_gold,
+                               lda);
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.pointer_mode_host)
+        {
+            if(arg.unit_check)
+            {
+                if(std::is_same_v<T, float> || std::is_same_v<T, double>)
+                {
+                    unit_check_general<T>(M, N, lda, hA_gold, hA);
+                }
+                else
+                {
+                    const double tol = K * sum_error_tolerance<T>;
+                    near_check_general<T>(M, N, lda, hA_gold, hA, tol);
+                }
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_1 = norm_check_general<T>('F', M, N, lda, hA_gold, hA);
+            }
+        }
+
+        if(arg.pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(d_alpha.transfer_from(halpha));
+
+            CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+            handle.pre_test(arg);
+            CHECK_ROCBLAS_ERROR(
+                (rocblas_ger_k_fn(handle, M, N, K, d_alpha, dx, ldx, dy, ldy, dA, lda)));
+            handle.post_test(arg);
+
+            CHECK_HIP_ERROR(hA.transfer_from(dA));
+
+            if(arg.unit_check)
+            {
+                if(std::is_same_v<T, float> || std::is_same_v<T, double>)
+                {
+                    unit_check_general<T>(M, N, lda, hA_gold, hA);
+                }
+                else
+                {
+                    const double tol = K * sum_error_tolerance<T>;
+                    near_check_general<T>(M, N, lda, hA_gold, hA, tol);
+                }
+            }
+
+            if(arg.norm_check)
+            {
+                rocblas_error_2 = norm_check_general<T>('F', M, N, lda, hA_gold, hA);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int iter = 0; iter < number_cold_calls; iter++)
+        {
+            rocblas_ger_k_fn(handle, M, N, K, &h_alpha, dx, ldx, dy, ldy, dA, lda);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+
+        for(int iter = 0; iter < number_hot_calls; iter++)
+        {
+            rocblas_ger_k_fn(handle, M, N, K, &h_alpha, dx, ldx, dy, ldy, dA, lda);
+        }
+
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_M, e_N, e_K, e_alpha, e_lda, e_ldb, e_ldc>{}.log_args<T>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ger_k_gflop_count<T>(M, N, K),
+            ger_k_gbyte_count<T>(M, N, K),
+            cpu_time_used,
+            rocblas_error_1,
+            rocblas_error_2);
+    }
+}
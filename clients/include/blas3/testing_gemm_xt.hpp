@@ -0,0 +1,435 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "blas3/rocblas_gemm_xt.hpp"
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <deque>
+
+/* ============================================================================================ */
+
+// Creates num_handles handles round-robin over the available devices
+inline void testing_gemm_xt_create_handles(const Arguments&                  arg,
+                                           int                               num_handles,
+                                           std::deque<rocblas_local_handle>& local_handles,
+                                           std::vector<rocblas_handle>&      handles)
+{
+    int device_count, saved_device;
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    CHECK_HIP_ERROR(hipGetDevice(&saved_device));
+
+    for(int i = 0; i < num_handles; i++)
+    {
+        CHECK_HIP_ERROR(hipSetDevice((saved_device + i) % device_count));
+        local_handles.emplace_back(arg);
+        handles.push_back(local_handles.back());
+    }
+
+    CHECK_HIP_ERROR(hipSetDevice(saved_device));
+}
+
+template <typename T>
+void testing_gemm_xt_bad_arg(const Arguments& arg)
+{
+    const rocblas_int M = 100;
+    const rocblas_int N = 101;
+    const rocblas_int K = 102;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 102;
+    const rocblas_int ldc = 100;
+
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const T alpha = 1, beta = 1;
+
+    std::deque<rocblas_local_handle> local_handles;
+    std::vector<rocblas_handle>      handles;
+    testing_gemm_xt_create_handles(arg, 2, local_handles, handles);
+
+    host_matrix<T> hA(M, K, lda);
+    host_matrix<T> hB(K, N, ldb);
+    host_matrix<T> hC(M, N, ldc);
+
+    // clang-format off
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(nullptr, 2, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc, 0),
+                          rocblas_status_invalid_handle);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(), 0, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc, 0),
+                          rocblas_status_invalid_handle);
+
+    const rocblas_handle duplicate[] = {handles.data()[0], handles.data()[0]};
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(duplicate, 2, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc, 0),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(), 2, (rocblas_operation)rocblas_fill_full, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc, 0),
+                          rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(), 2, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, hC, ldc, -1),
+                          rocblas_status_invalid_size);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(), 2, transA, transB, M, N, K, &alpha, nullptr, lda, hB, ldb, &beta, hC, ldc, 0),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(), 2, transA, transB, M, N, K, &alpha, hA, lda, nullptr, ldb, &beta, hC, ldc, 0),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(), 2, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, &beta, nullptr, ldc, 0),
+                          rocblas_status_invalid_pointer);
+
+    EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(), 2, transA, transB, M, N, K, &alpha, hA, lda, hB, ldb, nullptr, hC, ldc, 0),
+                          rocblas_status_invalid_pointer);
+    // clang-format on
+}
+
+template <typename T>
+void testing_gemm_xt(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    double rocblas_error = std::numeric_limits<double>::max();
+
+    // Several tiles with ragged edges in every dimension
+    rocblas_int block_dim = 1 + std::max({M, N, K}) / 3;
+
+    std::deque<rocblas_local_handle> local_handles;
+    std::vector<rocblas_handle>      handles;
+    testing_gemm_xt_create_handles(arg, std::max(1, int(arg.devices)), local_handles, handles);
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || ldc < M || lda < A_row || ldb < B_row;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_xt<T>(handles.data(),
+                                                 handles.size(),
+                                                 transA,
+                                                 transB,
+                                                 M,
+                                                 N,
+                                                 K,
+                                                 nullptr,
+                                                 nullptr,
+                                                 lda,
+                                                 nullptr,
+                                                 ldb,
+                                                 nullptr,
+                                                 nullptr,
+                                                 ldc,
+                                                 block_dim),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    // A, B and C stay in host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_gold(M, N, ldc);
+
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    hC_gold = hC;
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_xt<T>(handles.data(),
+                                               handles.size(),
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &h_alpha,
+                                               hA,
+                                               lda,
+                                               hB,
+                                               ldb,
+                                               &h_beta,
+                                               hC,
+                                               ldc,
+                                               block_dim));
+
+        cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+        if(arg.unit_check)
+        {
+            const double tol = K * sum_error_tolerance<T>;
+            near_check_general<T>(M, N, ldc, hC_gold, hC, tol);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error = norm_check_general<T>('F', M, N, ldc, hC_gold, hC);
+        }
+    }
+}
+
+/* ============================================================================================ */
+/*  Scheduling core of gemm_xt on a host implementation of the device layer                     */
+
+template <typename T>
+class gemm_xt_host_device
+{
+    int64_t        m_block_dim;
+    const T*       m_C;
+    int64_t        m_ldc;
+    std::vector<T> m_A[rocblas_gemm_xt_slots];
+    std::vector<T> m_B[rocblas_gemm_xt_slots];
+    std::vector<T> m_C_slot[rocblas_gemm_xt_slots];
+    bool           m_c_busy[rocblas_gemm_xt_slots] = {};
+
+    void pack(std::vector<T>& dst, const T* src, int64_t ld, int64_t rows, int64_t cols)
+    {
+        EXPECT_LE(rows, m_block_dim);
+        EXPECT_LE(cols, m_block_dim);
+        for(int64_t j = 0; j < cols; j++)
+            for(int64_t i = 0; i < rows; i++)
+                dst[i + j * rows] = src[i + j * ld];
+    }
+
+public:
+    // Tiles of C downloaded from this device
+    std::vector<rocblas_gemm_xt_tile> tiles;
+    int64_t                           c_uploads = 0;
+
+    gemm_xt_host_device(int64_t block_dim, const T* C, int64_t ldc)
+        : m_block_dim(block_dim)
+        , m_C(C)
+        , m_ldc(ldc)
+    {
+        for(int s = 0; s < rocblas_gemm_xt_slots; s++)
+        {
+            m_A[s].resize(block_dim * block_dim);
+            m_B[s].resize(block_dim * block_dim);
+            m_C_slot[s].resize(block_dim * block_dim);
+        }
+    }
+
+    rocblas_status set_c(int c_slot, const T* C, int64_t ldc, int64_t m, int64_t n)
+    {
+        EXPECT_FALSE(m_c_busy[c_slot]) << "C slot reused before download";
+        m_c_busy[c_slot] = true;
+        c_uploads++;
+        pack(m_C_slot[c_slot], C, ldc, m, n);
+        return rocblas_status_success;
+    }
+
+    rocblas_status set_ab(int      ab_slot,
+                          const T* A,
+                          int64_t  lda,
+                          int64_t  a_rows,
+                          int64_t  a_cols,
+                          const T* B,
+                          int64_t  ldb,
+                          int64_t  b_rows,
+                          int64_t  b_cols)
+    {
+        pack(m_A[ab_slot], A, lda, a_rows, a_cols);
+        pack(m_B[ab_slot], B, ldb, b_rows, b_cols);
+        return rocblas_status_success;
+    }
+
+    rocblas_status gemm(int               ab_slot,
+                        int               c_slot,
+                        rocblas_operation trans_a,
+                        rocblas_operation trans_b,
+                        int64_t           m,
+                        int64_t           n,
+                        int64_t           k,
+                        const T*          alpha,
+                        const T*          beta)
+    {
+        m_c_busy[c_slot] = true;
+
+        rocblas_int lda = std::max(int64_t(1), trans_a == rocblas_operation_none ? m : k);
+        rocblas_int ldb = std::max(int64_t(1), trans_b == rocblas_operation_none ? k : n);
+
+        cblas_gemm<T>(trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      *alpha,
+                      m_A[ab_slot].data(),
+                      lda,
+                      m_B[ab_slot].data(),
+                      ldb,
+                      *beta,
+                      m_C_slot[c_slot].data(),
+                      m);
+        return rocblas_status_success;
+    }
+
+    rocblas_status get_c(int c_slot, T* C, int64_t ldc, int64_t m, int64_t n)
+    {
+        EXPECT_TRUE(m_c_busy[c_slot]) << "C slot downloaded before it was computed";
+        m_c_busy[c_slot] = false;
+
+        int64_t offset = C - m_C;
+        tiles.push_back({offset % m_ldc, offset / m_ldc, m, n});
+
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = 0; i < m; i++)
+                C[i + j * ldc] = m_C_slot[c_slot][i + j * m];
+        return rocblas_status_success;
+    }
+
+    rocblas_status synchronize()
+    {
+        return rocblas_status_success;
+    }
+};
+
+template <typename T>
+void testing_gemm_xt_schedule(const Arguments& arg)
+{
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M   = arg.M;
+    rocblas_int N   = arg.N;
+    rocblas_int K   = arg.K;
+    rocblas_int lda = arg.lda;
+    rocblas_int ldb = arg.ldb;
+    rocblas_int ldc = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    int num_devices = std::max(1, int(arg.devices));
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : std::max(K, 1);
+    rocblas_int A_col = transA == rocblas_operation_none ? std::max(K, 1) : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? std::max(K, 1) : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : std::max(K, 1);
+
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC_init(M, N, ldc);
+
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix(hC_init, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    host_matrix<T> hC_gold(M, N, ldc);
+    hC_gold = hC_init;
+    cblas_gemm<T>(transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC_gold, ldc);
+
+    const rocblas_gemm_xt_grid grid = rocblas_gemm_xt_make_grid(num_devices);
+    EXPECT_EQ(grid.rows * grid.cols, num_devices);
+    EXPECT_LE(grid.rows, grid.cols);
+
+    // A single tile, a tile per element, and ragged tilings of every dimension
+    const int64_t ragged = 1 + std::max({M, N, K}) / 3;
+    for(int64_t requested : {int64_t(0), int64_t(1), int64_t(7), ragged})
+    {
+        const int64_t block_dim = rocblas_gemm_xt_block_dim(M, N, K, requested);
+
+        host_matrix<T> hC(M, N, ldc);
+        hC = hC_init;
+
+        std::vector<gemm_xt_host_device<T>> devices;
+        for(int d = 0; d < num_devices; d++)
+            devices.emplace_back(block_dim, (const T*)hC, ldc);
+
+        CHECK_ROCBLAS_ERROR(rocblas_gemm_xt_schedule<T>(devices,
+                                                        transA,
+                                                        transB,
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        &h_alpha,
+                                                        (const T*)hA,
+                                                        lda,
+                                                        (const T*)hB,
+                                                        ldb,
+                                                        &h_beta,
+                                                        (T*)hC,
+                                                        ldc,
+                                                        block_dim));
+
+        const double tol = K * sum_error_tolerance<T>;
+        near_check_general<T>(M, N, ldc, hC_gold, hC, tol);
+
+        // Every element of C is downloaded exactly once, from the device owning its tile
+        std::vector<int> owner(size_t(M) * N, -1);
+        for(int d = 0; d < num_devices; d++)
+        {
+            if(h_beta == T(0))
+                EXPECT_EQ(devices[d].c_uploads, 0);
+
+            for(const auto& tile : devices[d].tiles)
+            {
+                EXPECT_EQ(tile.row % block_dim, 0);
+                EXPECT_EQ(tile.col % block_dim, 0);
+                EXPECT_EQ(int((tile.row / block_dim) % grid.rows) * grid.cols
+                              + int((tile.col / block_dim) % grid.cols),
+                          d);
+
+                for(int64_t j = tile.col; j < tile.col + tile.n; j++)
+                    for(int64_t i = tile.row; i < tile.row + tile.m; i++)
+                    {
+                        EXPECT_EQ(owner[i + j * M], -1);
+                        owner[i + j * M] = d;
+                    }
+            }
+        }
+        EXPECT_EQ(std::count(owner.begin(), owner.end(), -1), 0);
+    }
+}
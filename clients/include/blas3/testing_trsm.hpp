@@ -265,6 +265,16 @@ void testing_trsm(const Arguments& arg)
     rocblas_init_matrix(
         hX, arg, rocblas_client_never_set_nan, rocblas_client_general_matrix, false, true);
 
+    // scaled data moves B or the diagonal of A out of float range for the refinement math mode
+    if(arg.init_scale_a != 1.0)
+        for(rocblas_int j = 0; j < K; j++)
+            for(rocblas_int i = 0; i < K; i++)
+                ((T*)hA)[i + j * size_t(lda)] *= arg.init_scale_a;
+    if(arg.init_scale_x != 1.0)
+        for(rocblas_int j = 0; j < N; j++)
+            for(rocblas_int i = 0; i < M; i++)
+                ((T*)hX)[i + j * size_t(ldb)] *= arg.init_scale_x;
+
     //  make hA unit diagonal if diag == rocblas_diagonal_unit
     if(diag == rocblas_diagonal_unit)
     {
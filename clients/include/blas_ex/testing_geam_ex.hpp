@@ -703,11 +703,8 @@ void testing_geam_ex(const Arguments& arg)
         // reference calculation for golden result
         cpu_time_used = get_time_us_no_sync();
 
-        auto cblas_geam_ex_fn = geam_ex_op == rocblas_geam_ex_operation_min_plus
-                                    ? cblas_geam_min_plus<T>
-                                    : cblas_geam_plus_min<T>;
-
-        cblas_geam_ex_fn(transA,
+        cblas_geam_ex<T>(geam_ex_op,
+                         transA,
                          transB,
                          M,
                          N,
@@ -777,7 +774,8 @@ void testing_geam_ex(const Arguments& arg)
                     hipMemcpy(hD_1, dD_in_place, sizeof(T) * size_D, hipMemcpyDeviceToHost));
 
                 // reference calculation
-                cblas_geam_ex_fn(transA,
+                cblas_geam_ex<T>(geam_ex_op,
+                                 transA,
                                  transB,
                                  M,
                                  N,
@@ -869,7 +867,8 @@ void testing_geam_ex(const Arguments& arg)
         }
         gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
-        ArgumentModel<e_transA,
+        ArgumentModel<e_geam_ex_op,
+                      e_transA,
                       e_transB,
                       e_M,
                       e_N,
@@ -0,0 +1,669 @@
+/* ************************************************************************
+ * Copyright (C) 2018-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "flops.hpp"
+#include "norm.hpp"
+#include "rocblas.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_matrix.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+/* ============================================================================================ */
+
+template <typename T>
+void testing_geam_strided_batched_ex_bad_arg(const Arguments& arg)
+{
+    auto rocblas_geam_strided_batched_ex_fn = rocblas_geam_strided_batched_ex;
+
+    for(auto pointer_mode : {rocblas_pointer_mode_host, rocblas_pointer_mode_device})
+    {
+        rocblas_local_handle handle{arg};
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, pointer_mode));
+
+        const rocblas_int M = 100;
+        const rocblas_int N = 99;
+        const rocblas_int K = 98;
+
+        const rocblas_int lda = 100;
+        const rocblas_int ldb = 100;
+        const rocblas_int ldc = 100;
+        const rocblas_int ldd = 100;
+
+        const rocblas_int batch_count = 2;
+
+        rocblas_datatype a_type       = arg.a_type;
+        rocblas_datatype b_type       = arg.b_type;
+        rocblas_datatype c_type       = arg.c_type;
+        rocblas_datatype d_type       = arg.d_type;
+        rocblas_datatype compute_type = arg.compute_type;
+
+        rocblas_geam_ex_operation geam_ex_op = arg.geam_ex_op;
+
+        device_vector<T> alpha_d(1), beta_d(1), zero_d(1);
+
+        const T alpha_h(1), beta_h(2), zero_h(0);
+
+        const T* alpha = &alpha_h;
+        const T* beta  = &beta_h;
+        const T* zero  = &zero_h;
+
+        if(pointer_mode == rocblas_pointer_mode_device)
+        {
+            CHECK_HIP_ERROR(hipMemcpy(alpha_d, alpha, sizeof(*alpha), hipMemcpyHostToDevice));
+            alpha = alpha_d;
+            CHECK_HIP_ERROR(hipMemcpy(beta_d, beta, sizeof(*beta), hipMemcpyHostToDevice));
+            beta = beta_d;
+            CHECK_HIP_ERROR(hipMemcpy(zero_d, zero, sizeof(*zero), hipMemcpyHostToDevice));
+            zero = zero_d;
+        }
+
+        const rocblas_operation transA = rocblas_operation_none;
+        const rocblas_operation transB = rocblas_operation_none;
+
+        const rocblas_stride stride_a = size_t(lda) * K;
+        const rocblas_stride stride_b = size_t(ldb) * N;
+        const rocblas_stride stride_c = size_t(ldc) * N;
+        const rocblas_stride stride_d = size_t(ldd) * N;
+
+        // Allocate device memory
+        device_strided_batch_matrix<T> dA(M, K, lda, stride_a, batch_count);
+        device_strided_batch_matrix<T> dB(K, N, ldb, stride_b, batch_count);
+        device_strided_batch_matrix<T> dC(M, N, ldc, stride_c, batch_count);
+        device_strided_batch_matrix<T> dD(M, N, ldd, stride_d, batch_count);
+
+        // Check device memory allocation
+        CHECK_DEVICE_ALLOCATION(dA.memcheck());
+        CHECK_DEVICE_ALLOCATION(dB.memcheck());
+        CHECK_DEVICE_ALLOCATION(dC.memcheck());
+        CHECK_DEVICE_ALLOCATION(dD.memcheck());
+
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(nullptr,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 alpha,
+                                                                 dA,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 dB,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 beta,
+                                                                 dC,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 dD,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 batch_count,
+                                                                 compute_type,
+                                                                 geam_ex_op),
+                              rocblas_status_invalid_handle);
+
+        // invalid semiring
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 alpha,
+                                                                 dA,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 dB,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 beta,
+                                                                 dC,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 dD,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 batch_count,
+                                                                 compute_type,
+                                                                 (rocblas_geam_ex_operation)-1),
+                              rocblas_status_invalid_value);
+
+        // negative batch_count
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 alpha,
+                                                                 dA,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 dB,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 beta,
+                                                                 dC,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 dD,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 -1,
+                                                                 compute_type,
+                                                                 geam_ex_op),
+                              rocblas_status_invalid_size);
+
+        // invalid pointers
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 alpha,
+                                                                 dA,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 dB,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 beta,
+                                                                 dC,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 nullptr,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 batch_count,
+                                                                 compute_type,
+                                                                 geam_ex_op),
+                              rocblas_status_invalid_pointer);
+
+        if(pointer_mode == rocblas_pointer_mode_host)
+        {
+            EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(handle,
+                                                                     transA,
+                                                                     transB,
+                                                                     M,
+                                                                     N,
+                                                                     K,
+                                                                     alpha,
+                                                                     nullptr,
+                                                                     a_type,
+                                                                     lda,
+                                                                     stride_a,
+                                                                     dB,
+                                                                     b_type,
+                                                                     ldb,
+                                                                     stride_b,
+                                                                     beta,
+                                                                     dC,
+                                                                     c_type,
+                                                                     ldc,
+                                                                     stride_c,
+                                                                     dD,
+                                                                     d_type,
+                                                                     ldd,
+                                                                     stride_d,
+                                                                     batch_count,
+                                                                     compute_type,
+                                                                     geam_ex_op),
+                                  rocblas_status_invalid_pointer);
+        }
+
+        // batch_count==0 then all may be nullptr
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 nullptr,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 nullptr,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 0,
+                                                                 compute_type,
+                                                                 geam_ex_op),
+                              rocblas_status_success);
+
+        // alpha==0 && beta==0 then A, B and C may be nullptr
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 zero,
+                                                                 nullptr,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 nullptr,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 zero,
+                                                                 nullptr,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 dD,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 batch_count,
+                                                                 compute_type,
+                                                                 geam_ex_op),
+                              rocblas_status_success);
+    }
+}
+
+template <typename T>
+void testing_geam_strided_batched_ex(const Arguments& arg)
+{
+    auto rocblas_geam_strided_batched_ex_fn = rocblas_geam_strided_batched_ex;
+
+    rocblas_operation transA = char2rocblas_operation(arg.transA);
+    rocblas_operation transB = char2rocblas_operation(arg.transB);
+
+    rocblas_int M = arg.M;
+    rocblas_int N = arg.N;
+    rocblas_int K = arg.K;
+
+    rocblas_int    lda         = arg.lda;
+    rocblas_int    ldb         = arg.ldb;
+    rocblas_int    ldc         = arg.ldc;
+    rocblas_int    ldd         = arg.ldd;
+    rocblas_stride stride_a    = arg.stride_a;
+    rocblas_stride stride_b    = arg.stride_b;
+    rocblas_stride stride_c    = arg.stride_c;
+    rocblas_stride stride_d    = arg.stride_d;
+    rocblas_int    batch_count = arg.batch_count;
+
+    rocblas_datatype a_type       = arg.a_type;
+    rocblas_datatype b_type       = arg.b_type;
+    rocblas_datatype c_type       = arg.c_type;
+    rocblas_datatype d_type       = arg.d_type;
+    rocblas_datatype compute_type = arg.compute_type;
+
+    rocblas_geam_ex_operation geam_ex_op = arg.geam_ex_op;
+
+    T alpha = arg.get_alpha<T>();
+    T beta  = arg.get_beta<T>();
+
+    rocblas_int A_row = transA == rocblas_operation_none ? M : K;
+    rocblas_int A_col = transA == rocblas_operation_none ? K : M;
+    rocblas_int B_row = transB == rocblas_operation_none ? K : N;
+    rocblas_int B_col = transB == rocblas_operation_none ? N : K;
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    double rocblas_error_1 = std::numeric_limits<double>::max();
+    double rocblas_error_2 = std::numeric_limits<double>::max();
+
+    rocblas_local_handle handle{arg};
+
+    // argument sanity check before allocating invalid memory
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M
+                        || ldd < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_geam_strided_batched_ex_fn(handle,
+                                                                 transA,
+                                                                 transB,
+                                                                 M,
+                                                                 N,
+                                                                 K,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 nullptr,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 c_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 nullptr,
+                                                                 d_type,
+                                                                 ldd,
+                                                                 stride_d,
+                                                                 batch_count,
+                                                                 compute_type,
+                                                                 geam_ex_op),
+                              invalid_size ? rocblas_status_invalid_size : rocblas_status_success);
+        return;
+    }
+
+    stride_a = std::max(stride_a, rocblas_stride(size_t(lda) * A_col));
+    stride_b = std::max(stride_b, rocblas_stride(size_t(ldb) * B_col));
+    stride_c = std::max(stride_c, rocblas_stride(size_t(ldc) * N));
+    stride_d = std::max(stride_d, rocblas_stride(size_t(ldd) * N));
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_strided_batch_matrix<T> hA(A_row, A_col, lda, stride_a, batch_count);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_b, batch_count);
+    host_strided_batch_matrix<T> hC(M, N, ldc, stride_c, batch_count);
+    host_strided_batch_matrix<T> hD_1(M, N, ldd, stride_d, batch_count);
+    host_strided_batch_matrix<T> hD_2(M, N, ldd, stride_d, batch_count);
+    host_strided_batch_matrix<T> hD_gold(M, N, ldd, stride_d, batch_count);
+    host_vector<T>               h_alpha(1);
+    host_vector<T>               h_beta(1);
+
+    h_alpha[0] = alpha;
+    h_beta[0]  = beta;
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hD_1.memcheck());
+    CHECK_HIP_ERROR(hD_2.memcheck());
+    CHECK_HIP_ERROR(hD_gold.memcheck());
+
+    // Allocate device memory
+    device_strided_batch_matrix<T> dA(A_row, A_col, lda, stride_a, batch_count);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride_b, batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, stride_c, batch_count);
+    device_strided_batch_matrix<T> dD(M, N, ldd, stride_d, batch_count);
+    device_vector<T>               d_alpha(1);
+    device_vector<T>               d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initialize data on host memory
+    rocblas_init_matrix(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix(hB, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    rocblas_init_matrix(hD_1, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+
+    hD_2.copy_from(hD_1);
+    hD_gold.copy_from(hD_1);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(d_alpha.transfer_from(h_alpha));
+    CHECK_HIP_ERROR(d_beta.transfer_from(h_beta));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(dD.transfer_from(hD_1));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // ROCBLAS
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_ROCBLAS_ERROR(rocblas_geam_strided_batched_ex_fn(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               &alpha,
+                                                               dA,
+                                                               a_type,
+                                                               lda,
+                                                               stride_a,
+                                                               dB,
+                                                               b_type,
+                                                               ldb,
+                                                               stride_b,
+                                                               &beta,
+                                                               dC,
+                                                               c_type,
+                                                               ldc,
+                                                               stride_c,
+                                                               dD,
+                                                               d_type,
+                                                               ldd,
+                                                               stride_d,
+                                                               batch_count,
+                                                               compute_type,
+                                                               geam_ex_op));
+
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+        CHECK_HIP_ERROR(dD.transfer_from(hD_2));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device));
+        CHECK_ROCBLAS_ERROR(rocblas_geam_strided_batched_ex_fn(handle,
+                                                               transA,
+                                                               transB,
+                                                               M,
+                                                               N,
+                                                               K,
+                                                               d_alpha,
+                                                               dA,
+                                                               a_type,
+                                                               lda,
+                                                               stride_a,
+                                                               dB,
+                                                               b_type,
+                                                               ldb,
+                                                               stride_b,
+                                                               d_beta,
+                                                               dC,
+                                                               c_type,
+                                                               ldc,
+                                                               stride_c,
+                                                               dD,
+                                                               d_type,
+                                                               ldd,
+                                                               stride_d,
+                                                               batch_count,
+                                                               compute_type,
+                                                               geam_ex_op));
+
+        CHECK_HIP_ERROR(hD_2.transfer_from(dD));
+
+        // reference calculation for golden result
+        cpu_time_used = get_time_us_no_sync();
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            cblas_geam_ex<T>(geam_ex_op,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             h_alpha[0],
+                             hA[b],
+                             lda,
+                             hB[b],
+                             ldb,
+                             h_beta[0],
+                             hC[b],
+                             ldc,
+                             hD_gold[b],
+                             ldd);
+        }
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldd, stride_d, hD_gold, hD_1, batch_count);
+            unit_check_general<T>(M, N, ldd, stride_d, hD_gold, hD_2, batch_count);
+        }
+
+        if(arg.norm_check)
+        {
+            rocblas_error_1
+                = norm_check_general<T>('F', M, N, ldd, stride_d, hD_gold, hD_1, batch_count);
+            rocblas_error_2
+                = norm_check_general<T>('F', M, N, ldd, stride_d, hD_gold, hD_2, batch_count);
+        }
+    } // end of if unit/norm check
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+        for(int i = 0; i < number_cold_calls; i++)
+        {
+            rocblas_geam_strided_batched_ex_fn(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &alpha,
+                                               dA,
+                                               a_type,
+                                               lda,
+                                               stride_a,
+                                               dB,
+                                               b_type,
+                                               ldb,
+                                               stride_b,
+                                               &beta,
+                                               dC,
+                                               c_type,
+                                               ldc,
+                                               stride_c,
+                                               dD,
+                                               d_type,
+                                               ldd,
+                                               stride_d,
+                                               batch_count,
+                                               compute_type,
+                                               geam_ex_op);
+        }
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+        {
+            rocblas_geam_strided_batched_ex_fn(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               &alpha,
+                                               dA,
+                                               a_type,
+                                               lda,
+                                               stride_a,
+                                               dB,
+                                               b_type,
+                                               ldb,
+                                               stride_b,
+                                               &beta,
+                                               dC,
+                                               c_type,
+                                               ldc,
+                                               stride_c,
+                                               dD,
+                                               d_type,
+                                               ldd,
+                                               stride_d,
+                                               batch_count,
+                                               compute_type,
+                                               geam_ex_op);
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_geam_ex_op,
+                      e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_stride_a,
+                      e_ldb,
+                      e_stride_b,
+                      e_beta,
+                      e_ldc,
+                      e_stride_c,
+                      e_ldd,
+                      e_stride_d,
+                      e_batch_count>{}
+            .log_args<T>(rocblas_cout,
+                         arg,
+                         gpu_time_used,
+                         geam_min_plus_gflop_count<T>(M, N, K),
+                         ArgumentLogging::NA_value,
+                         cpu_time_used,
+                         rocblas_error_1,
+                         rocblas_error_2);
+    }
+}
@@ -0,0 +1,514 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#pragma once
+
+#include "testing_gemm_ex3.hpp"
+
+/* ============================================================================================ */
+// Number of scaling factors rocblas_gemm_ex3_scaled reads for a scale mode
+inline size_t gemm_ex3_scale_count(rocblas_gemm_scale_mode mode, rocblas_int vector_length)
+{
+    return mode == rocblas_gemm_scale_mode_vector   ? size_t(std::max(vector_length, 1))
+           : mode == rocblas_gemm_scale_mode_tensor ? 1
+                                                    : 0;
+}
+
+// Random powers of two, which keep the quantized inputs and the scaled products exact so the
+// host reference matches the device bit for bit
+inline void gemm_ex3_init_scales(host_vector<float>& scale)
+{
+    for(auto& s : scale)
+        s = std::ldexp(1.0f, std::uniform_int_distribution<int>(-2, 2)(t_rocblas_rng));
+}
+
+inline float gemm_ex3_scale_at(const host_vector<float>& scale, rocblas_gemm_scale_mode mode, int i)
+{
+    return mode == rocblas_gemm_scale_mode_none     ? 1.0f
+           : mode == rocblas_gemm_scale_mode_tensor ? scale[0]
+                                                    : scale[i];
+}
+
+// Quantizes an input to the compute type of gemm_ex3 the way the scaled kernel does, inputs
+// wider than the compute type are divided by their scale first
+template <typename Tc, typename Ti>
+inline float gemm_ex3_quantize_scaled(Ti x, float scale)
+{
+    if constexpr(std::is_same<Ti, Tc>{})
+        return float(x);
+    else
+        return float(explicit_downcast<Tc, float, false>(float(x) / scale, 0));
+}
+
+/*
+ *  Host reference of gemm_ex3_scaled:
+ *      D = scale_d * (alpha * scale_a[i] * scale_b[j] * sum_k qA(i, k) * qB(k, j) + beta * C)
+ *  amax is max(|D|) before scale_d.
+ */
+template <typename TiA, typename TiB, typename To, typename TcA, typename TcB>
+void gemm_ex3_scaled_reference(rocblas_operation         transA,
+                               rocblas_operation         transB,
+                               rocblas_int               M,
+                               rocblas_int               N,
+                               rocblas_int               K,
+                               float                     alpha,
+                               const host_matrix<TiA>&   A,
+                               rocblas_int               lda,
+                               const host_matrix<TiB>&   B,
+                               rocblas_int               ldb,
+                               float                     beta,
+                               const host_matrix<To>&    C,
+                               rocblas_int               ldc,
+                               host_matrix<To>&          D,
+                               rocblas_int               ldd,
+                               const host_vector<float>& scale_a,
+                               rocblas_gemm_scale_mode   scale_a_mode,
+                               const host_vector<float>& scale_b,
+                               rocblas_gemm_scale_mode   scale_b_mode,
+                               float                     scale_d,
+                               float&                    amax)
+{
+    const TiA* hA = A[0];
+    const TiB* hB = B[0];
+    const To*  hC = C[0];
+    To*        hD = D[0];
+
+    amax = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(max : amax)
+#endif
+    for(rocblas_int j = 0; j < N; j++)
+    {
+        const float sb = gemm_ex3_scale_at(scale_b, scale_b_mode, j);
+        for(rocblas_int i = 0; i < M; i++)
+        {
+            const float sa  = gemm_ex3_scale_at(scale_a, scale_a_mode, i);
+            float       acc = 0;
+            for(rocblas_int k = 0; k < K; k++)
+            {
+                TiA a = transA == rocblas_operation_none ? hA[i + k * size_t(lda)]
+                                                         : hA[k + i * size_t(lda)];
+                TiB b = transB == rocblas_operation_none ? hB[k + j * size_t(ldb)]
+                                                         : hB[j + k * size_t(ldb)];
+                acc += gemm_ex3_quantize_scaled<TcA>(a, sa) * gemm_ex3_quantize_scaled<TcB>(b, sb);
+            }
+
+            float result = alpha * acc;
+            if(scale_a_mode != rocblas_gemm_scale_mode_none
+               || scale_b_mode != rocblas_gemm_scale_mode_none)
+                result *= sa * sb;
+            if(beta != 0)
+                result += beta * float(hC[i + j * size_t(ldc)]);
+
+            amax                     = std::max(amax, std::abs(result));
+            hD[i + j * size_t(ldd)] = explicit_downcast<To, float, false>(result * scale_d, 0);
+        }
+    }
+}
+
+/* ============================================================================================ */
+template <typename TiA, typename TiB, typename To, typename Tc>
+void testing_gemm_ex3_scaled_bad_arg(const Arguments& arg)
+{
+    const rocblas_operation transA = rocblas_operation_none;
+    const rocblas_operation transB = rocblas_operation_none;
+
+    const rocblas_int M = 100;
+    const rocblas_int N = 100;
+    const rocblas_int K = 100;
+
+    const rocblas_int lda = 100;
+    const rocblas_int ldb = 100;
+    const rocblas_int ldc = 100;
+    const rocblas_int ldd = 100;
+
+    const float alpha = 1, beta = 1;
+
+    const rocblas_gemm_algo algo           = rocblas_gemm_algo_standard;
+    int32_t                 solution_index = 0;
+    uint32_t                flags          = 0;
+
+    static const size_t safe_size = 100;
+
+    rocblas_local_handle handle{arg};
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // allocate memory on device
+    device_vector<float> dA(safe_size);
+    device_vector<float> dB(safe_size);
+    device_vector<float> dC(safe_size);
+    device_vector<float> dD(safe_size);
+    device_vector<float> d_scale(safe_size);
+    device_vector<float> d_amax(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_amax.memcheck());
+
+    auto gemm_ex3_scaled = [&](rocblas_handle          handle,
+                               rocblas_int             m,
+                               const float*            scale_a,
+                               rocblas_gemm_scale_mode scale_a_mode,
+                               const float*            scale_b,
+                               rocblas_gemm_scale_mode scale_b_mode) {
+        return rocblas_gemm_ex3_scaled(handle,
+                                       transA,
+                                       transB,
+                                       m,
+                                       N,
+                                       K,
+                                       &alpha,
+                                       dA,
+                                       arg.a_type,
+                                       lda,
+                                       dB,
+                                       arg.b_type,
+                                       ldb,
+                                       &beta,
+                                       dC,
+                                       arg.c_type,
+                                       ldc,
+                                       dD,
+                                       arg.d_type,
+                                       ldd,
+                                       arg.composite_compute_type,
+                                       algo,
+                                       solution_index,
+                                       flags,
+                                       scale_a,
+                                       scale_a_mode,
+                                       scale_b,
+                                       scale_b_mode,
+                                       d_scale,
+                                       d_amax);
+    };
+
+    if(rocblas_handle(handle)->getArch() < 940 || rocblas_handle(handle)->getArch() >= 1000)
+    {
+        // check for invalid arch
+        EXPECT_ROCBLAS_STATUS(gemm_ex3_scaled(handle,
+                                              M,
+                                              d_scale,
+                                              rocblas_gemm_scale_mode_tensor,
+                                              d_scale,
+                                              rocblas_gemm_scale_mode_tensor),
+                              rocblas_status_arch_mismatch);
+        return;
+    }
+
+    EXPECT_ROCBLAS_STATUS(gemm_ex3_scaled(nullptr,
+                                          M,
+                                          d_scale,
+                                          rocblas_gemm_scale_mode_tensor,
+                                          d_scale,
+                                          rocblas_gemm_scale_mode_tensor),
+                          rocblas_status_invalid_handle);
+
+    // check for invalid scale modes
+    EXPECT_ROCBLAS_STATUS(gemm_ex3_scaled(handle,
+                                          M,
+                                          d_scale,
+                                          rocblas_gemm_scale_mode(3),
+                                          d_scale,
+                                          rocblas_gemm_scale_mode_tensor),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(gemm_ex3_scaled(handle,
+                                          M,
+                                          d_scale,
+                                          rocblas_gemm_scale_mode_tensor,
+                                          d_scale,
+                                          rocblas_gemm_scale_mode(3)),
+                          rocblas_status_invalid_value);
+
+    // scaling factors are required unless their mode is none
+    EXPECT_ROCBLAS_STATUS(gemm_ex3_scaled(handle,
+                                          M,
+                                          nullptr,
+                                          rocblas_gemm_scale_mode_vector,
+                                          d_scale,
+                                          rocblas_gemm_scale_mode_tensor),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(gemm_ex3_scaled(handle,
+                                          M,
+                                          d_scale,
+                                          rocblas_gemm_scale_mode_tensor,
+                                          nullptr,
+                                          rocblas_gemm_scale_mode_vector),
+                          rocblas_status_invalid_pointer);
+
+    // quick return ignores the scaling factors
+    EXPECT_ROCBLAS_STATUS(gemm_ex3_scaled(handle,
+                                          0,
+                                          nullptr,
+                                          rocblas_gemm_scale_mode_vector,
+                                          nullptr,
+                                          rocblas_gemm_scale_mode_vector),
+                          rocblas_status_success);
+}
+
+template <typename TiA, typename TiB, typename To, typename Tc>
+void testing_gemm_ex3_scaled(const Arguments& arg)
+{
+    rocblas_gemm_algo algo = rocblas_gemm_algo(arg.algo);
+    int32_t           solution_index(arg.solution_index);
+    uint32_t          flags(arg.flags);
+
+    bool stochastic_rounding = flags & rocblas_gemm_flags_stochastic_rounding;
+
+    float h_alpha = arg.get_alpha<float>();
+    float h_beta  = arg.get_beta<float>();
+
+    double gpu_time_used, cpu_time_used;
+    gpu_time_used = cpu_time_used = 0.0;
+
+    rocblas_local_handle handle{arg};
+    auto                 transA = char2rocblas_operation(arg.transA);
+    auto                 transB = char2rocblas_operation(arg.transB);
+    auto                 M = arg.M, N = arg.N, K = arg.K;
+    auto                 lda = arg.lda, ldb = arg.ldb, ldc = arg.ldc, ldd = arg.ldd;
+    auto                 A_row = transA == rocblas_operation_none ? M : K;
+    auto                 A_col = transA == rocblas_operation_none ? K : M;
+    auto                 B_row = transB == rocblas_operation_none ? K : N;
+    auto                 B_col = transB == rocblas_operation_none ? N : K;
+
+    rocblas_gemm_scale_mode scale_a_mode = arg.scale_a_mode;
+    rocblas_gemm_scale_mode scale_b_mode = arg.scale_b_mode;
+
+    // check for invalid sizes
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M;
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocblas_gemm_ex3_scaled(handle,
+                                                      transA,
+                                                      transB,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      nullptr,
+                                                      nullptr,
+                                                      arg.a_type,
+                                                      lda,
+                                                      nullptr,
+                                                      arg.b_type,
+                                                      ldb,
+                                                      nullptr,
+                                                      nullptr,
+                                                      arg.c_type,
+                                                      ldc,
+                                                      nullptr,
+                                                      arg.d_type,
+                                                      ldd,
+                                                      arg.composite_compute_type,
+                                                      algo,
+                                                      solution_index,
+                                                      flags,
+                                                      nullptr,
+                                                      scale_a_mode,
+                                                      nullptr,
+                                                      scale_b_mode,
+                                                      nullptr,
+                                                      nullptr),
+                              rocblas_status_invalid_size);
+        return;
+    }
+
+    // compute types of A and B, as in testing_gemm_ex3
+    bool a_is_bf8 = arg.composite_compute_type == rocblas_compute_type_bf8_f8_f32
+                    || arg.composite_compute_type == rocblas_compute_type_bf8_bf8_f32
+                    || (arg.composite_compute_type == rocblas_compute_type_f32
+                        && arg.a_type == rocblas_datatype_bf8_r);
+    bool b_is_bf8 = arg.composite_compute_type == rocblas_compute_type_f8_bf8_f32
+                    || arg.composite_compute_type == rocblas_compute_type_bf8_bf8_f32
+                    || (arg.composite_compute_type == rocblas_compute_type_f32
+                        && arg.b_type == rocblas_datatype_bf8_r);
+
+    size_t size_scale_a = gemm_ex3_scale_count(scale_a_mode, M);
+    size_t size_scale_b = gemm_ex3_scale_count(scale_b_mode, N);
+
+    // allocate memory on device
+    device_matrix<TiA>   dA(A_row, A_col, lda);
+    device_matrix<TiB>   dB(B_row, B_col, ldb);
+    device_matrix<To>    dC(M, N, ldc);
+    device_matrix<To>    dD(M, N, ldd);
+    device_vector<float> d_scale_a(size_scale_a);
+    device_vector<float> d_scale_b(size_scale_b);
+    device_vector<float> d_scale_d(1);
+    device_vector<float> d_amax(1);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dD.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale_a.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale_b.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_scale_d.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_amax.memcheck());
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_matrix<TiA>   hA(A_row, A_col, lda);
+    host_matrix<TiB>   hB(B_row, B_col, ldb);
+    host_matrix<To>    hC(M, N, ldc);
+    host_vector<float> h_scale_a(size_scale_a);
+    host_vector<float> h_scale_b(size_scale_b);
+    host_vector<float> h_scale_d(1);
+
+    // Initial Data on CPU
+    rocblas_seedrand();
+
+    // Initialize data on host memory
+    rocblas_init_matrix<TiA>(
+        hA, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, true);
+    rocblas_init_matrix<TiB>(
+        hB, arg, rocblas_client_alpha_sets_nan, rocblas_client_general_matrix, false, true);
+    rocblas_init_matrix<To>(hC, arg, rocblas_client_beta_sets_nan, rocblas_client_general_matrix);
+    gemm_ex3_init_scales(h_scale_a);
+    gemm_ex3_init_scales(h_scale_b);
+    gemm_ex3_init_scales(h_scale_d);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(d_scale_a.transfer_from(h_scale_a));
+    CHECK_HIP_ERROR(d_scale_b.transfer_from(h_scale_b));
+    CHECK_HIP_ERROR(d_scale_d.transfer_from(h_scale_d));
+
+    auto gemm_ex3_scaled = [&]() {
+        return rocblas_gemm_ex3_scaled(handle,
+                                       transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       &h_alpha,
+                                       dA,
+                                       arg.a_type,
+                                       lda,
+                                       dB,
+                                       arg.b_type,
+                                       ldb,
+                                       &h_beta,
+                                       dC,
+                                       arg.c_type,
+                                       ldc,
+                                       dD,
+                                       arg.d_type,
+                                       ldd,
+                                       arg.composite_compute_type,
+                                       algo,
+                                       solution_index,
+                                       flags,
+                                       size_scale_a ? (const float*)d_scale_a : nullptr,
+                                       scale_a_mode,
+                                       size_scale_b ? (const float*)d_scale_b : nullptr,
+                                       scale_b_mode,
+                                       d_scale_d,
+                                       d_amax);
+    };
+
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    // the reference rounds to nearest, stochastic rounding is only timed
+    if((arg.unit_check || arg.norm_check) && !stochastic_rounding)
+    {
+        host_matrix<To> hD_gold(M, N, ldd);
+        host_matrix<To> hD_1(M, N, ldd);
+        float           h_amax_gold, h_amax_1;
+
+        rocblas_init_nan<To>(hD_1, M, N, ldd);
+        rocblas_init_nan<To>(hD_gold, M, N, ldd);
+
+        CHECK_ROCBLAS_ERROR(gemm_ex3_scaled());
+
+        CHECK_HIP_ERROR(hD_1.transfer_from(dD));
+        CHECK_HIP_ERROR(hipMemcpy(&h_amax_1, d_amax, sizeof(float), hipMemcpyDeviceToHost));
+
+        cpu_time_used = get_time_us_no_sync();
+
+#define SCALED_REFERENCE_PARM                                                                  \
+    transA, transB, M, N, K, h_alpha, hA, lda, hB, ldb, h_beta, hC, ldc, hD_gold, ldd,         \
+        h_scale_a, scale_a_mode, h_scale_b, scale_b_mode, h_scale_d[0], h_amax_gold
+
+        if(!a_is_bf8 && !b_is_bf8)
+            gemm_ex3_scaled_reference<TiA, TiB, To, rocblas_f8, rocblas_f8>(SCALED_REFERENCE_PARM);
+        else if(a_is_bf8 && b_is_bf8)
+            gemm_ex3_scaled_reference<TiA, TiB, To, rocblas_bf8, rocblas_bf8>(
+                SCALED_REFERENCE_PARM);
+        else if(!a_is_bf8)
+            gemm_ex3_scaled_reference<TiA, TiB, To, rocblas_f8, rocblas_bf8>(
+                SCALED_REFERENCE_PARM);
+        else
+            gemm_ex3_scaled_reference<TiA, TiB, To, rocblas_bf8, rocblas_f8>(
+                SCALED_REFERENCE_PARM);
+
+#undef SCALED_REFERENCE_PARM
+
+        cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+
+        if(arg.unit_check)
+        {
+            // power of two scales keep the products exact, only large K can reorder rounding
+            if(K > 16)
+            {
+                const double tol = K * sum_error_tolerance<float>;
+                near_check_general<To, To>(M, N, ldd, hD_gold, hD_1, tol);
+                near_check_general<float>(1, 1, 1, &h_amax_gold, &h_amax_1, tol);
+            }
+            else
+            {
+                unit_check_general<To, To>(M, N, ldd, hD_gold, hD_1);
+                unit_check_general<float>(1, 1, 1, &h_amax_gold, &h_amax_1);
+            }
+        }
+
+        if(arg.norm_check)
+        {
+            auto err1 = std::abs(norm_check_general<To>('O', M, N, ldd, (To*)hD_gold, (To*)hD_1));
+            double eps = a_is_bf8 || b_is_bf8 ? get_epsilon<rocblas_bf8>()
+                                              : get_epsilon<rocblas_f8>();
+            double tolerance = 50;
+#ifdef GOOGLE_TEST
+            ASSERT_LE(err1, tolerance * eps * std::min(M, N));
+            ASSERT_NEAR(h_amax_1, h_amax_gold, tolerance * eps * h_amax_gold);
+#endif
+        }
+    }
+
+    if(arg.timing)
+    {
+        int number_cold_calls = arg.cold_iters;
+        int number_hot_calls  = arg.iters;
+
+        for(int i = 0; i < number_cold_calls; i++)
+            CHECK_ROCBLAS_ERROR(gemm_ex3_scaled());
+
+        hipStream_t stream;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+        gpu_time_used = get_time_us_sync(stream); // in microseconds
+        for(int i = 0; i < number_hot_calls; i++)
+            gemm_ex3_scaled();
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        ArgumentModel<e_transA,
+                      e_transB,
+                      e_M,
+                      e_N,
+                      e_K,
+                      e_alpha,
+                      e_lda,
+                      e_beta,
+                      e_ldb,
+                      e_ldc,
+                      e_ldd,
+                      e_scale_a_mode,
+                      e_scale_b_mode>{}
+            .log_args<To>(rocblas_cout,
+                          arg,
+                          gpu_time_used,
+                          gemm_gflop_count<float>(M, N, K),
+                          ArgumentLogging::NA_value,
+                          cpu_time_used);
+    }
+}
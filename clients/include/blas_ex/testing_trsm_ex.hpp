@@ -243,6 +243,61 @@ void testing_trsm_ex_bad_arg(const Arguments& arg)
                                                  sizeInvA,
                                                  rocblas_datatype_bf16_r),
                               rocblas_status_not_implemented);
+
+        // invA registered in the handle
+        EXPECT_ROCBLAS_STATUS(rocblas_set_trsm_invA(nullptr,
+                                                    side,
+                                                    uplo,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    dA,
+                                                    lda,
+                                                    dinvA,
+                                                    sizeInvA,
+                                                    rocblas_datatype_f32_r),
+                              rocblas_status_invalid_handle);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_set_trsm_invA(handle,
+                                                    side,
+                                                    uplo,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    dA,
+                                                    lda,
+                                                    dinvA,
+                                                    sizeInvA - 1,
+                                                    rocblas_datatype_f32_r),
+                              rocblas_status_invalid_size);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_set_trsm_invA(handle,
+                                                    side,
+                                                    uplo,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    dA,
+                                                    lda,
+                                                    nullptr,
+                                                    sizeInvA,
+                                                    rocblas_datatype_f32_r),
+                              rocblas_status_invalid_pointer);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_set_trsm_invA(handle,
+                                                    side,
+                                                    uplo,
+                                                    diag,
+                                                    M,
+                                                    N,
+                                                    dA,
+                                                    lda,
+                                                    dinvA,
+                                                    sizeInvA,
+                                                    rocblas_datatype_bf16_r),
+                              rocblas_status_not_implemented);
+
+        EXPECT_ROCBLAS_STATUS(rocblas_clear_trsm_invA(nullptr), rocblas_status_invalid_handle);
     }
 }
 
@@ -305,6 +360,7 @@ void testing_trsm_ex(const Arguments& arg)
     host_matrix<T> hX(M, N, ldb);
     host_matrix<T> hXorB_1(M, N, ldb);
     host_matrix<T> hXorB_2(M, N, ldb);
+    host_matrix<T> hXorB_3(M, N, ldb);
     host_matrix<T> cpuXorB(M, N, ldb);
     host_matrix<T> invATemp1(TRSM_BLOCK, TRSM_BLOCK, K);
     host_matrix<T> invATemp2(TRSM_BLOCK, TRSM_BLOCK, K);
@@ -343,6 +399,7 @@ void testing_trsm_ex(const Arguments& arg)
 
     hXorB_1 = hB; // hXorB <- B
     hXorB_2 = hB; // hXorB <- B
+    hXorB_3 = hB; // hXorB <- B
     cpuXorB = hB; // cpuXorB <- B
 
     // copy data from CPU to device
@@ -356,6 +413,7 @@ void testing_trsm_ex(const Arguments& arg)
 
     double max_err_1 = 0.0;
     double max_err_2 = 0.0;
+    double max_err_3 = 0.0;
     double gpu_time_used, cpu_time_used;
     gpu_time_used = cpu_time_used  = 0.0;
     double error_eps_multiplier    = ERROR_EPS_MULTIPLIER;
@@ -413,6 +471,9 @@ void testing_trsm_ex(const Arguments& arg)
                                              TRSM_BLOCK * K,
                                              arg.compute_type));
 
+        CHECK_ALLOC_QUERY(rocblas_set_trsm_invA(
+            handle, side, uplo, diag, M, N, dA, lda, dinvA, TRSM_BLOCK * K, arg.compute_type));
+
         size_t size;
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
 
@@ -496,25 +557,42 @@ void testing_trsm_ex(const Arguments& arg)
 
         CHECK_HIP_ERROR(hXorB_2.transfer_from(dXorB));
 
+        // calculate dXorB <- A^(-1) B   plain trsm reusing the invA registered in the handle
+        CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+        CHECK_HIP_ERROR(dXorB.transfer_from(hXorB_3));
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_trsm_invA(
+            handle, side, uplo, diag, M, N, dA, lda, dinvA, TRSM_BLOCK * K, arg.compute_type));
+        CHECK_ROCBLAS_ERROR(
+            rocblas_trsm<T>(handle, side, uplo, transA, diag, M, N, &alpha_h, dA, lda, dXorB, ldb));
+        CHECK_ROCBLAS_ERROR(rocblas_clear_trsm_invA(handle));
+
+        CHECK_HIP_ERROR(hXorB_3.transfer_from(dXorB));
+
         //computed result is in hx_or_b, so forward error is E = hx - hx_or_b
         // calculate vector-induced-norm 1 of matrix E
         max_err_1 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hXorB_1));
         max_err_2 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hXorB_2));
+        max_err_3 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hX, hXorB_3));
 
         //unit test
         trsm_err_res_check<T>(max_err_1, M, error_eps_multiplier, eps);
         trsm_err_res_check<T>(max_err_2, M, error_eps_multiplier, eps);
+        trsm_err_res_check<T>(max_err_3, M, error_eps_multiplier, eps);
 
         // hx_or_b contains A * (calculated X), so res = A * (calculated x) - b = hx_or_b - hb
         cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB_1, ldb);
         cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB_2, ldb);
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, 1.0 / alpha_h, hA, lda, hXorB_3, ldb);
 
         max_err_1 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hXorB_1, hB));
         max_err_2 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hXorB_2, hB));
+        max_err_3 = rocblas_abs(matrix_norm_1<T>(M, N, ldb, hXorB_3, hB));
 
         //unit test
         trsm_err_res_check<T>(max_err_1, M, residual_eps_multiplier, eps);
         trsm_err_res_check<T>(max_err_2, M, residual_eps_multiplier, eps);
+        trsm_err_res_check<T>(max_err_3, M, residual_eps_multiplier, eps);
     }
 
     if(arg.timing)
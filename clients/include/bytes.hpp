@@ -108,6 +108,34 @@ constexpr double scal_gbyte_count(rocblas_int n)
     return (sizeof(T) * 2.0 * n) / 1e9;
 }
 
+/* \brief byte counts of AXPY_DOT, y is read once and z is not read when it is y */
+template <typename T>
+constexpr double axpy_dot_gbyte_count(rocblas_int n, bool z_is_y)
+{
+    return (sizeof(T) * (z_is_y ? 3.0 : 4.0) * n) / 1e9;
+}
+
+/* \brief byte counts of MULTI_AXPY */
+template <typename T>
+constexpr double multi_axpy_gbyte_count(rocblas_int n, rocblas_int k)
+{
+    return (sizeof(T) * (k + 2.0) * n) / 1e9;
+}
+
+/* \brief byte counts of MULTI_DOT */
+template <typename T>
+constexpr double multi_dot_gbyte_count(rocblas_int n, rocblas_int k)
+{
+    return (sizeof(T) * (k + 1.0) * n) / 1e9;
+}
+
+/* \brief byte counts of NRM2_SCAL, small vectors are read once */
+template <typename T>
+constexpr double nrm2_scal_gbyte_count(rocblas_int n)
+{
+    return (sizeof(T) * (n <= 8192 ? 2.0 : 3.0) * n) / 1e9;
+}
+
 /* \brief byte counts of SWAP */
 template <typename T>
 constexpr double swap_gbyte_count(rocblas_int n)
@@ -182,6 +210,13 @@ constexpr double ger_gbyte_count(rocblas_int m, rocblas_int n)
     return (sizeof(T) * (m * n + m + n)) / 1e9;
 }
 
+/* \brief byte counts of GER_K, A is read and written once for the k updates */
+template <typename T>
+constexpr double ger_k_gbyte_count(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return (sizeof(T) * (2.0 * m * n + double(m + n) * k)) / 1e9;
+}
+
 /* \brief byte counts of HEMV */
 template <typename T>
 constexpr double hemv_gbyte_count(rocblas_int n)
@@ -278,6 +313,13 @@ constexpr double syr_gbyte_count(rocblas_int n)
     return (sizeof(T) * (tri_count(n) * 2 + n)) / 1e9;
 }
 
+/* \brief byte counts of SYR_K and HER_K, the triangle of A is read and written once */
+template <typename T>
+constexpr double syr_k_gbyte_count(rocblas_int n, rocblas_int k)
+{
+    return (sizeof(T) * (tri_count(n) * 2.0 + double(n) * k)) / 1e9;
+}
+
 /* \brief byte counts of SYR2 */
 template <typename T>
 constexpr double syr2_gbyte_count(rocblas_int n)
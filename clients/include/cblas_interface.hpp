@@ -27,6 +27,7 @@
 #include "lapack_utilities.hpp"
 #include "rocblas.h"
 #include <type_traits>
+#include <vector>
 
 /*
  * ===========================================================================
@@ -252,6 +253,60 @@ inline void cblas_nrm2(int64_t n, const rocblas_double_complex* x, int64_t incx,
     *result = cblas_dznrm2(n, x, incx);
 }
 
+// dot and nrm2 with single precision data accumulated in double precision. Used as the reference
+// for the error reported by norm_check so that it measures the accuracy of the rocBLAS result,
+// for example with rocblas_compensated_sum_math, rather than that of the cblas accumulation.
+template <typename T>
+using cblas_wide_t = std::conditional_t<
+    std::is_same_v<T, float>,
+    double,
+    std::conditional_t<std::is_same_v<T, rocblas_float_complex>, rocblas_double_complex, T>>;
+
+template <typename T>
+std::vector<cblas_wide_t<T>> cblas_widen(int64_t n, const T* x, int64_t incx)
+{
+    std::vector<cblas_wide_t<T>> wide(n);
+    if(incx < 0)
+        x -= (n - 1) * incx;
+    for(int64_t i = 0; i < n; i++)
+        wide[i] = cblas_wide_t<T>(x[i * incx]);
+    return wide;
+}
+
+template <bool CONJ, typename T>
+void cblas_dot_wide(int64_t n, const T* x, int64_t incx, const T* y, int64_t incy, T* result)
+{
+    if constexpr(std::is_same_v<T, cblas_wide_t<T>>)
+    {
+        (CONJ ? cblas_dotc<T> : cblas_dot<T>)(n, x, incx, y, incy, result);
+    }
+    else
+    {
+        auto            wx = cblas_widen(n, x, incx);
+        auto            wy = cblas_widen(n, y, incy);
+        cblas_wide_t<T> wide_result;
+        (CONJ ? cblas_dotc<cblas_wide_t<T>> : cblas_dot<cblas_wide_t<T>>)(
+            n, wx.data(), 1, wy.data(), 1, &wide_result);
+        *result = T(wide_result);
+    }
+}
+
+template <typename T>
+void cblas_nrm2_wide(int64_t n, const T* x, int64_t incx, real_t<T>* result)
+{
+    if(std::is_same_v<T, cblas_wide_t<T>> || incx <= 0)
+    {
+        cblas_nrm2<T>(n, x, incx, result);
+    }
+    else
+    {
+        auto                    wx = cblas_widen(n, x, incx);
+        real_t<cblas_wide_t<T>> wide_result;
+        cblas_nrm2<cblas_wide_t<T>>(n, wx.data(), 1, &wide_result);
+        *result = real_t<T>(wide_result);
+    }
+}
+
 // scal ILP64
 template <typename T, typename U>
 void cblas_scal(int64_t n, T alpha, U x, int64_t incx);
@@ -2757,6 +2812,25 @@ void cblas_geam_plus_min(rocblas_operation transA,
                          T*                D,
                          int64_t           ldd);
 
+// reference for every geam_ex semiring, dispatches to the two functions above
+template <typename T>
+void cblas_geam_ex(rocblas_geam_ex_operation geam_ex_op,
+                   rocblas_operation         transA,
+                   rocblas_operation         transB,
+                   int64_t                   m,
+                   int64_t                   n,
+                   int64_t                   k,
+                   const T                   alpha,
+                   const T*                  A,
+                   int64_t                   lda,
+                   const T*                  B,
+                   int64_t                   ldb,
+                   const T                   beta,
+                   const T*                  C,
+                   int64_t                   ldc,
+                   T*                        D,
+                   int64_t                   ldd);
+
 // cblas_herkx doesn't exist. implementation in cpp
 template <typename T, typename U = real_t<T>>
 void cblas_herkx(rocblas_fill      uplo,
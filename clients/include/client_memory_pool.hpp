@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <cstddef>
+
+//!
+//! @brief Kinds of client memory cached by the pool. Device and managed blocks are cached per
+//!        device.
+//!
+enum class client_memory_kind
+{
+    device,
+    managed,
+    pinned_host,
+    count
+};
+
+//!
+//! @brief Allocation counters of the pool, summed over all kinds.
+//!
+struct client_memory_pool_stats
+{
+    size_t hits{0}; // allocations served from the cache
+    size_t misses{0}; // allocations passed to hip
+    double miss_us{0}; // time in hip allocations and frees of the misses
+    size_t cached_bytes{0}; // bytes currently held in the cache
+
+    //!
+    //! @brief Estimated time saved by the hits, at the average cost of a miss.
+    //!
+    double saved_us() const
+    {
+        return misses ? hits * miss_us / misses : 0;
+    }
+};
+
+//!
+//! @brief Allocates at least bytes of memory of the given kind, reusing a cached block of the
+//!        same size class when one is free. Blocks are not cleared. Returns nullptr on failure,
+//!        after retrying once with the cache released.
+//!
+void* client_pool_malloc(client_memory_kind kind, size_t bytes);
+
+//!
+//! @brief Returns a block from client_pool_malloc to the cache, or frees it when the cache is
+//!        full or the block is too large to cache.
+//!
+void client_pool_free(client_memory_kind kind, void* ptr);
+
+//!
+//! @brief Frees all cached blocks. Live blocks are unaffected.
+//!
+void client_pool_release();
+
+//!
+//! @brief With best_fit, allocations reuse the smallest cached block at least as large as their
+//!        size class, and freed blocks are cached whatever their size and the cache cap. Used by
+//!        sweeps, which allocate the blocks of their largest point first.
+//!
+void client_pool_set_best_fit(bool best_fit);
+
+//!
+//! @brief Current allocation counters.
+//!
+client_memory_pool_stats client_pool_get_stats();
@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "client_memory_pool.hpp"
 #include "rocblas.h"
 #include "rocblas_test.hpp"
 #include "singletons.hpp"
@@ -47,6 +48,11 @@ private:
 
     static bool m_init_guard;
 
+    client_memory_kind memory_kind() const
+    {
+        return use_HMM ? client_memory_kind::managed : client_memory_kind::device;
+    }
+
 public:
     inline size_t nmemb() const noexcept
     {
@@ -87,13 +93,13 @@ public:
 
     T* device_vector_setup()
     {
-        T* d = nullptr;
-        if(use_HMM ? hipMallocManaged(&d, m_bytes) : (hipMalloc)(&d, m_bytes) != hipSuccess)
+        // Blocks come from the client memory pool, so buffers of the same size class are reused
+        // across tests instead of being allocated and freed with hip each time
+        T* d = static_cast<T*>(client_pool_malloc(memory_kind(), m_bytes));
+        if(!d)
         {
             rocblas_cerr << "Warning: hip can't allocate " << m_bytes << " bytes ("
                          << (m_bytes >> 30) << " GB)" << std::endl;
-
-            d = nullptr;
         }
 #ifdef GOOGLE_TEST
         else
@@ -152,8 +158,8 @@ public:
             if(m_pad > 0)
                 d -= m_pad; // restore to start of alloc
 
-            // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            // Return device memory to the pool
+            client_pool_free(memory_kind(), d);
         }
     }
 };
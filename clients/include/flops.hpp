@@ -149,6 +149,34 @@ constexpr double scal_gflop_count<rocblas_double_complex, double>(rocblas_int n)
     return (2.0 * n) / 1e9;
 }
 
+// axpy_dot
+template <typename T>
+constexpr double axpy_dot_gflop_count(rocblas_int n)
+{
+    return axpy_gflop_count<T>(n) + dot_gflop_count<rocblas_is_complex<T>, T>(n);
+}
+
+// multi_axpy
+template <typename T>
+constexpr double multi_axpy_gflop_count(rocblas_int n, rocblas_int k)
+{
+    return k * axpy_gflop_count<T>(n);
+}
+
+// multi_dot
+template <typename T>
+constexpr double multi_dot_gflop_count(rocblas_int n, rocblas_int k)
+{
+    return k * dot_gflop_count<rocblas_is_complex<T>, T>(n);
+}
+
+// nrm2_scal
+template <typename Ti, typename To>
+constexpr double nrm2_scal_gflop_count(rocblas_int n)
+{
+    return nrm2_gflop_count<Ti>(n) + scal_gflop_count<Ti, To>(n);
+}
+
 // rot
 template <typename Tx, typename Ty, typename Tc, typename Ts>
 constexpr double rot_gflop_count(rocblas_int n)
@@ -510,6 +538,13 @@ constexpr double ger_gflop_count<double>(rocblas_int m, rocblas_int n)
     return ger_gflop_count<float>(m, n);
 }
 
+/* \brief floating point counts of GER_K, k rank-1 updates */
+template <typename T>
+constexpr double ger_k_gflop_count(rocblas_int m, rocblas_int n, rocblas_int k)
+{
+    return k * ger_gflop_count<T>(m, n);
+}
+
 /* \brief floating point counts of SYR */
 template <typename T>
 constexpr double syr_gflop_count(rocblas_int n)
@@ -517,6 +552,13 @@ constexpr double syr_gflop_count(rocblas_int n)
     return (n * (double(n) + 1.0) + n) / 1e9;
 }
 
+/* \brief floating point counts of SYR_K and HER_K, k rank-1 updates */
+template <typename T, bool HERM>
+constexpr double syr_k_gflop_count(rocblas_int n, rocblas_int k)
+{
+    return k * (HERM ? her_gflop_count<T>(n) : syr_gflop_count<T>(n));
+}
+
 /* \brief floating point counts of SYR2 */
 template <typename T>
 constexpr double syr2_gflop_count(rocblas_int n)
@@ -22,11 +22,12 @@
 
 #pragma once
 
+#include "client_memory_pool.hpp"
 #include <hip/hip_runtime.h>
 
 //!
-//! @brief  Allocator which requests pinned host memory via hipHostMalloc.
-//!         This class can be removed once hipHostRegister has been proven equivalent
+//! @brief  Allocator which requests pinned host memory via hipHostMalloc, cached by the client
+//!         memory pool. This class can be removed once hipHostRegister has been proven equivalent
 //!
 template <class T>
 struct pinned_memory_allocator
@@ -42,25 +43,19 @@ struct pinned_memory_allocator
 
     T* allocate(std::size_t n)
     {
-        T*         ptr;
-        hipError_t status = hipHostMalloc(&ptr, sizeof(T) * n, hipHostMallocDefault);
-        if(status != hipSuccess)
+        T* ptr
+            = static_cast<T*>(client_pool_malloc(client_memory_kind::pinned_host, sizeof(T) * n));
+        if(!ptr)
         {
-            ptr = nullptr;
-            rocblas_cerr << "rocBLAS pinned_memory_allocator failed to allocate memory: "
-                         << hipGetErrorString(status) << std::endl;
+            rocblas_cerr << "rocBLAS pinned_memory_allocator failed to allocate " << sizeof(T) * n
+                         << " bytes" << std::endl;
         }
         return ptr;
     }
 
     void deallocate(T* ptr, std::size_t n)
     {
-        hipError_t status = hipHostFree(ptr);
-        if(status != hipSuccess)
-        {
-            rocblas_cerr << "rocBLAS pinned_memory_allocator failed to free memory: "
-                         << hipGetErrorString(status) << std::endl;
-        }
+        client_pool_free(client_memory_kind::pinned_host, ptr);
     }
 };
 
@@ -770,6 +770,103 @@ static rocblas_status (*rocblas_rotmg_strided_batched)(rocblas_handle handle,
 MAP2CF(rocblas_rotmg_strided_batched, float, rocblas_srotmg_strided_batched);
 MAP2CF(rocblas_rotmg_strided_batched, double, rocblas_drotmg_strided_batched);
 
+// fused level 1 functions have no Fortran interface
+
+// axpy_dot
+template <typename T>
+static rocblas_status (*rocblas_axpy_dot)(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          const T*       alpha,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          T*             y,
+                                          rocblas_int    incy,
+                                          const T*       z,
+                                          rocblas_int    incz,
+                                          T*             result);
+
+template <>
+static auto rocblas_axpy_dot<float> = rocblas_saxpy_dot;
+template <>
+static auto rocblas_axpy_dot<double> = rocblas_daxpy_dot;
+template <>
+static auto rocblas_axpy_dot<rocblas_float_complex> = rocblas_caxpy_dot;
+template <>
+static auto rocblas_axpy_dot<rocblas_double_complex> = rocblas_zaxpy_dot;
+
+// multi_axpy
+template <typename T>
+static rocblas_status (*rocblas_multi_axpy)(rocblas_handle handle,
+                                            rocblas_int    n,
+                                            rocblas_int    k,
+                                            const T*       alpha,
+                                            const T*       x,
+                                            rocblas_int    incx,
+                                            rocblas_stride stridex,
+                                            T*             y,
+                                            rocblas_int    incy);
+
+template <>
+static auto rocblas_multi_axpy<float> = rocblas_smulti_axpy;
+template <>
+static auto rocblas_multi_axpy<double> = rocblas_dmulti_axpy;
+template <>
+static auto rocblas_multi_axpy<rocblas_float_complex> = rocblas_cmulti_axpy;
+template <>
+static auto rocblas_multi_axpy<rocblas_double_complex> = rocblas_zmulti_axpy;
+
+// multi_dot
+template <typename T>
+static rocblas_status (*rocblas_multi_dot)(rocblas_handle handle,
+                                           rocblas_int    n,
+                                           rocblas_int    k,
+                                           const T*       x,
+                                           rocblas_int    incx,
+                                           rocblas_stride stridex,
+                                           const T*       y,
+                                           rocblas_int    incy,
+                                           T*             results);
+
+template <>
+static auto rocblas_multi_dot<float> = rocblas_smulti_dot;
+template <>
+static auto rocblas_multi_dot<double> = rocblas_dmulti_dot;
+template <>
+static auto rocblas_multi_dot<rocblas_float_complex> = rocblas_cmulti_dot;
+template <>
+static auto rocblas_multi_dot<rocblas_double_complex> = rocblas_zmulti_dot;
+
+// nrm2_scal
+template <typename T>
+static rocblas_status (*rocblas_nrm2_scal)(
+    rocblas_handle handle, rocblas_int n, T* x, rocblas_int incx, real_t<T>* result);
+
+template <>
+static auto rocblas_nrm2_scal<float> = rocblas_snrm2_scal;
+template <>
+static auto rocblas_nrm2_scal<double> = rocblas_dnrm2_scal;
+template <>
+static auto rocblas_nrm2_scal<rocblas_float_complex> = rocblas_scnrm2_scal;
+template <>
+static auto rocblas_nrm2_scal<rocblas_double_complex> = rocblas_dznrm2_scal;
+
+// scalar_op
+template <typename T>
+static rocblas_status (*rocblas_scalar_op)(rocblas_handle           handle,
+                                           rocblas_scalar_operation op,
+                                           const T*                 a,
+                                           const T*                 b,
+                                           T*                       result);
+
+template <>
+static auto rocblas_scalar_op<float> = rocblas_sscalar_op;
+template <>
+static auto rocblas_scalar_op<double> = rocblas_dscalar_op;
+template <>
+static auto rocblas_scalar_op<rocblas_float_complex> = rocblas_cscalar_op;
+template <>
+static auto rocblas_scalar_op<rocblas_double_complex> = rocblas_zscalar_op;
+
 /*
  * ===========================================================================
  *    level 2 BLAS
@@ -839,6 +936,178 @@ MAP2CF(rocblas_ger_strided_batched, rocblas_double_complex, false, rocblas_zgeru
 MAP2CF(rocblas_ger_strided_batched, rocblas_float_complex, true, rocblas_cgerc_strided_batched);
 MAP2CF(rocblas_ger_strided_batched, rocblas_double_complex, true, rocblas_zgerc_strided_batched);
 
+// ger_k
+template <typename T, bool CONJ>
+static rocblas_status (*rocblas_ger_k)(rocblas_handle handle,
+                                       rocblas_int    m,
+                                       rocblas_int    n,
+                                       rocblas_int    k,
+                                       const T*       alpha,
+                                       const T*       x,
+                                       rocblas_int    ldx,
+                                       const T*       y,
+                                       rocblas_int    ldy,
+                                       T*             A,
+                                       rocblas_int    lda);
+
+template <>
+static auto rocblas_ger_k<float, false> = rocblas_sger_k;
+template <>
+static auto rocblas_ger_k<double, false> = rocblas_dger_k;
+template <>
+static auto rocblas_ger_k<rocblas_float_complex, false> = rocblas_cgeru_k;
+template <>
+static auto rocblas_ger_k<rocblas_double_complex, false> = rocblas_zgeru_k;
+template <>
+static auto rocblas_ger_k<rocblas_float_complex, true> = rocblas_cgerc_k;
+template <>
+static auto rocblas_ger_k<rocblas_double_complex, true> = rocblas_zgerc_k;
+
+template <typename T, bool CONJ>
+static rocblas_status (*rocblas_ger_k_batched)(rocblas_handle handle,
+                                               rocblas_int    m,
+                                               rocblas_int    n,
+                                               rocblas_int    k,
+                                               const T*       alpha,
+                                               const T* const x[],
+                                               rocblas_int    ldx,
+                                               const T* const y[],
+                                               rocblas_int    ldy,
+                                               T* const       A[],
+                                               rocblas_int    lda,
+                                               rocblas_int    batch_count);
+
+template <>
+static auto rocblas_ger_k_batched<float, false> = rocblas_sger_k_batched;
+template <>
+static auto rocblas_ger_k_batched<double, false> = rocblas_dger_k_batched;
+template <>
+static auto rocblas_ger_k_batched<rocblas_float_complex, false> = rocblas_cgeru_k_batched;
+template <>
+static auto rocblas_ger_k_batched<rocblas_double_complex, false> = rocblas_zgeru_k_batched;
+template <>
+static auto rocblas_ger_k_batched<rocblas_float_complex, true> = rocblas_cgerc_k_batched;
+template <>
+static auto rocblas_ger_k_batched<rocblas_double_complex, true> = rocblas_zgerc_k_batched;
+
+template <typename T, bool CONJ>
+static rocblas_status (*rocblas_ger_k_strided_batched)(rocblas_handle handle,
+                                                       rocblas_int    m,
+                                                       rocblas_int    n,
+                                                       rocblas_int    k,
+                                                       const T*       alpha,
+                                                       const T*       x,
+                                                       rocblas_int    ldx,
+                                                       rocblas_stride stride_x,
+                                                       const T*       y,
+                                                       rocblas_int    ldy,
+                                                       rocblas_stride stride_y,
+                                                       T*             A,
+                                                       rocblas_int    lda,
+                                                       rocblas_stride stride_a,
+                                                       rocblas_int    batch_count);
+
+template <>
+static auto rocblas_ger_k_strided_batched<float, false> = rocblas_sger_k_strided_batched;
+template <>
+static auto rocblas_ger_k_strided_batched<double, false> = rocblas_dger_k_strided_batched;
+template <>
+static auto rocblas_ger_k_strided_batched<rocblas_float_complex, false>
+    = rocblas_cgeru_k_strided_batched;
+template <>
+static auto rocblas_ger_k_strided_batched<rocblas_double_complex, false>
+    = rocblas_zgeru_k_strided_batched;
+template <>
+static auto rocblas_ger_k_strided_batched<rocblas_float_complex, true>
+    = rocblas_cgerc_k_strided_batched;
+template <>
+static auto rocblas_ger_k_strided_batched<rocblas_double_complex, true>
+    = rocblas_zgerc_k_strided_batched;
+
+// syr_k and her_k, HERM selects her_k with a real alpha
+template <typename T, bool HERM>
+using syr_k_alpha_t = std::conditional_t<HERM, real_t<T>, T>;
+
+template <typename T, bool HERM>
+static rocblas_status (*rocblas_syr_k)(rocblas_handle                handle,
+                                       rocblas_fill                  uplo,
+                                       rocblas_int                   n,
+                                       rocblas_int                   k,
+                                       const syr_k_alpha_t<T, HERM>* alpha,
+                                       const T*                      x,
+                                       rocblas_int                   ldx,
+                                       T*                            A,
+                                       rocblas_int                   lda);
+
+template <>
+static auto rocblas_syr_k<float, false> = rocblas_ssyr_k;
+template <>
+static auto rocblas_syr_k<double, false> = rocblas_dsyr_k;
+template <>
+static auto rocblas_syr_k<rocblas_float_complex, false> = rocblas_csyr_k;
+template <>
+static auto rocblas_syr_k<rocblas_double_complex, false> = rocblas_zsyr_k;
+template <>
+static auto rocblas_syr_k<rocblas_float_complex, true> = rocblas_cher_k;
+template <>
+static auto rocblas_syr_k<rocblas_double_complex, true> = rocblas_zher_k;
+
+template <typename T, bool HERM>
+static rocblas_status (*rocblas_syr_k_batched)(rocblas_handle                handle,
+                                               rocblas_fill                  uplo,
+                                               rocblas_int                   n,
+                                               rocblas_int                   k,
+                                               const syr_k_alpha_t<T, HERM>* alpha,
+                                               const T* const                x[],
+                                               rocblas_int                   ldx,
+                                               T* const                      A[],
+                                               rocblas_int                   lda,
+                                               rocblas_int                   batch_count);
+
+template <>
+static auto rocblas_syr_k_batched<float, false> = rocblas_ssyr_k_batched;
+template <>
+static auto rocblas_syr_k_batched<double, false> = rocblas_dsyr_k_batched;
+template <>
+static auto rocblas_syr_k_batched<rocblas_float_complex, false> = rocblas_csyr_k_batched;
+template <>
+static auto rocblas_syr_k_batched<rocblas_double_complex, false> = rocblas_zsyr_k_batched;
+template <>
+static auto rocblas_syr_k_batched<rocblas_float_complex, true> = rocblas_cher_k_batched;
+template <>
+static auto rocblas_syr_k_batched<rocblas_double_complex, true> = rocblas_zher_k_batched;
+
+template <typename T, bool HERM>
+static rocblas_status (*rocblas_syr_k_strided_batched)(rocblas_handle                handle,
+                                                       rocblas_fill                  uplo,
+                                                       rocblas_int                   n,
+                                                       rocblas_int                   k,
+                                                       const syr_k_alpha_t<T, HERM>* alpha,
+                                                       const T*                      x,
+                                                       rocblas_int                   ldx,
+                                                       rocblas_stride                stride_x,
+                                                       T*                            A,
+                                                       rocblas_int                   lda,
+                                                       rocblas_stride                stride_a,
+                                                       rocblas_int                   batch_count);
+
+template <>
+static auto rocblas_syr_k_strided_batched<float, false> = rocblas_ssyr_k_strided_batched;
+template <>
+static auto rocblas_syr_k_strided_batched<double, false> = rocblas_dsyr_k_strided_batched;
+template <>
+static auto rocblas_syr_k_strided_batched<rocblas_float_complex, false>
+    = rocblas_csyr_k_strided_batched;
+template <>
+static auto rocblas_syr_k_strided_batched<rocblas_double_complex, false>
+    = rocblas_zsyr_k_strided_batched;
+template <>
+static auto rocblas_syr_k_strided_batched<rocblas_float_complex, true>
+    = rocblas_cher_k_strided_batched;
+template <>
+static auto rocblas_syr_k_strided_batched<rocblas_double_complex, true>
+    = rocblas_zher_k_strided_batched;
+
 // spr
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_spr)(rocblas_handle handle,
@@ -2235,6 +2504,34 @@ MAP2CF(rocblas_gemm, rocblas_half, rocblas_hgemm);
 MAP2CF(rocblas_gemm, rocblas_float_complex, rocblas_cgemm);
 MAP2CF(rocblas_gemm, rocblas_double_complex, rocblas_zgemm);
 
+// gemm_xt has no Fortran interface
+template <typename T>
+static rocblas_status (*rocblas_gemm_xt)(const rocblas_handle* handles,
+                                         rocblas_int           num_handles,
+                                         rocblas_operation     transA,
+                                         rocblas_operation     transB,
+                                         rocblas_int           m,
+                                         rocblas_int           n,
+                                         rocblas_int           k,
+                                         const T*              alpha,
+                                         const T*              A,
+                                         rocblas_int           lda,
+                                         const T*              B,
+                                         rocblas_int           ldb,
+                                         const T*              beta,
+                                         T*                    C,
+                                         rocblas_int           ldc,
+                                         rocblas_int           block_dim);
+
+template <>
+static auto rocblas_gemm_xt<float> = rocblas_sgemm_xt;
+template <>
+static auto rocblas_gemm_xt<double> = rocblas_dgemm_xt;
+template <>
+static auto rocblas_gemm_xt<rocblas_float_complex> = rocblas_cgemm_xt;
+template <>
+static auto rocblas_gemm_xt<rocblas_double_complex> = rocblas_zgemm_xt;
+
 // gemm_batched
 template <typename T, bool FORTRAN = false>
 static rocblas_status (*rocblas_gemm_batched)(rocblas_handle    handle,
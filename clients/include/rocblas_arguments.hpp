@@ -81,6 +81,10 @@ struct Arguments
     double beta;
     double betai;
 
+    // test data of A and of the solution X are multiplied by these after initialization
+    double init_scale_a;
+    double init_scale_x;
+
     rocblas_stride stride_a; //  stride_a > transA == 'N' ? lda * K : lda * M
     rocblas_stride stride_b; //  stride_b > transB == 'N' ? ldb * N : ldb * K
     rocblas_stride stride_c; //  stride_c > ldc * N
@@ -119,6 +123,9 @@ struct Arguments
 
     rocblas_geam_ex_operation geam_ex_op;
 
+    rocblas_gemm_scale_mode scale_a_mode;
+    rocblas_gemm_scale_mode scale_b_mode;
+
     rocblas_gemm_flags flags;
 
     rocblas_datatype    a_type;
@@ -134,6 +141,8 @@ struct Arguments
 
     rocblas_atomics_mode atomics_mode;
 
+    rocblas_reproducibility_mode reproducibility_mode;
+
     rocblas_client_os os_flags;
 
     // the gpu arch string after "gfx" for which the test is valid
@@ -197,6 +206,8 @@ struct Arguments
     OPER(alphai) SEP                 \
     OPER(beta) SEP                   \
     OPER(betai) SEP                  \
+    OPER(init_scale_a) SEP           \
+    OPER(init_scale_x) SEP           \
     OPER(stride_a) SEP               \
     OPER(stride_b) SEP               \
     OPER(stride_c) SEP               \
@@ -222,6 +233,8 @@ struct Arguments
     OPER(algo) SEP                   \
     OPER(solution_index) SEP         \
     OPER(geam_ex_op) SEP             \
+    OPER(scale_a_mode) SEP           \
+    OPER(scale_b_mode) SEP           \
     OPER(flags) SEP                  \
     OPER(a_type) SEP                 \
     OPER(b_type) SEP                 \
@@ -232,6 +245,7 @@ struct Arguments
     OPER(initialization) SEP         \
     OPER(arithmetic_check) SEP       \
     OPER(atomics_mode) SEP           \
+    OPER(reproducibility_mode) SEP   \
     OPER(os_flags) SEP               \
     OPER(gpu_arch) SEP               \
     OPER(api) SEP                    \
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "rocblas_arguments.hpp"
+#include "rocblas_yaml_expand.hpp"
 #include "test_cleanup.hpp"
 #include <cerrno>
 #include <cstdio>
@@ -56,6 +57,19 @@ class RocBLAS_TestData
         return filename;
     }
 
+    // template file when filename is a YAML file expanded in process, otherwise empty
+    static auto& yaml_template()
+    {
+        static std::string yaml_template;
+        return yaml_template;
+    }
+
+    static auto& yaml()
+    {
+        static bool yaml = false;
+        return yaml;
+    }
+
     // filter iterator
     class iterator : public std::istream_iterator<Arguments>
     {
@@ -102,30 +116,39 @@ class RocBLAS_TestData
     };
 
 public:
-    // Initialize filename, optionally removing it at exit
-    static void set_filename(std::string name, bool remove_atexit = false)
+    // Initialize filename of a binary data file
+    static void set_filename(std::string name)
     {
         filename() = std::move(name);
-        if(remove_atexit)
-        {
-            auto cleanup = [] { fs::remove(filename().c_str()); };
-            atexit(cleanup);
-            at_quick_exit(cleanup);
-        }
+        yaml()     = false;
+    }
+
+    // Initialize filename of a YAML file, which is expanded as it is read
+    static void set_yaml(std::string name, std::string template_file)
+    {
+        filename()      = std::move(name);
+        yaml_template() = std::move(template_file);
+        yaml()          = true;
     }
 
     // begin() iterator which accepts an optional filter.
     static iterator begin(bool filter(const Arguments&) = nullptr)
     {
-        static std::ifstream* ifs = nullptr;
+        static std::istream* ifs = nullptr;
 
         // If this is the first time, or after test_cleanup::cleanup() has been called
         if(!ifs)
         {
             std::string fileToOpen = filename();
-            // Allocate a std::ifstream and register it to be deleted during cleanup
-            ifs = test_cleanup::allocate(
-                &ifs, fileToOpen, std::ifstream::in | std::ifstream::binary);
+            // Allocate a std::ifstream, or a stream of the records expanded from a YAML file,
+            // and register it to be deleted during cleanup. The records expanded so far are kept
+            // by the stream, so later begin() calls do not expand the YAML file again.
+            if(yaml())
+                ifs = test_cleanup::allocate_as<rocblas_yaml_istream>(
+                    &ifs, fileToOpen, yaml_template());
+            else
+                ifs = test_cleanup::allocate_as<std::ifstream>(
+                    &ifs, fileToOpen, std::ifstream::in | std::ifstream::binary);
             if(!ifs || ifs->fail())
             {
                 rocblas_cerr << "Cannot open " << fileToOpen << ": " << strerror(errno)
@@ -156,19 +156,32 @@ inline void rocblas_expect_status(rocblas_status status, rocblas_status expect)
 // Function which matches Arguments with a category, accounting for arg.known_bug_platforms
 bool match_test_category(const Arguments& arg, const char* category);
 
+// Function which selects the tests of a suite run by a rocblas-test --parallel worker process.
+// ordinal counts the Arguments accepted by the suite's filters. Always true outside of workers.
+bool rocblas_test_shard_select(const char* suite, size_t ordinal);
+
+// Function which records the estimated cost of each test in the rocblas-test --parallel parent
+void rocblas_test_shard_record(const char*        suite,
+                               const std::string& name,
+                               size_t             ordinal,
+                               const Arguments&   arg);
+
 // The tests are instantiated by filtering through the RocBLAS_Data stream
 // The filter is by category and by the type_filter() and function_filter()
-// functions in the testclass
+// functions in the testclass, and by the tests assigned to a --parallel worker
 #define INSTANTIATE_TEST_CATEGORY(testclass, category)                                            \
     INSTANTIATE_TEST_SUITE_P(category,                                                            \
                              testclass,                                                           \
                              testing::ValuesIn(RocBLAS_TestData::begin([](const Arguments& arg) { \
+                                                   static size_t ordinal = 0;                     \
                                                    return match_test_category(arg, #category)     \
                                                           && testclass::function_filter(arg)      \
-                                                          && testclass::type_filter(arg);         \
+                                                          && testclass::type_filter(arg)          \
+                                                          && rocblas_test_shard_select(           \
+                                                              #testclass, ordinal++);             \
                                                }),                                                \
                                                RocBLAS_TestData::end()),                          \
-                             testclass::PrintToStringParamName());
+                             testclass::PrintToStringParamName{#testclass});
 
 #if defined(GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST)
 #define ROCBLAS_ALLOW_UNINSTANTIATED_GTEST(testclass) \
@@ -373,11 +386,15 @@ public:
     // Wrapper functor class which calls name_suffix()
     struct PrintToStringParamName
     {
+        const char* suite = nullptr;
+
         std::string operator()(const testing::TestParamInfo<Arguments>& info) const
         {
             std::string name(info.param.category);
             name += "_";
             name += TEST::name_suffix(info.param);
+            if(suite)
+                rocblas_test_shard_record(suite, name, info.index, info.param);
             return name;
         }
     };
@@ -0,0 +1,43 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <string>
+
+/*! \brief Removes a --parallel [N] option from argv, returning the number of worker processes
+    requested, or 0 when tests run in this process. N defaults to the number of devices. Must be
+    called before the tests are instantiated, so their costs are recorded. */
+int rocblas_parse_parallel(int& argc, char** argv);
+
+/*! \brief Splits the instantiated tests which match the Google Test filter across num_workers
+    rocblas-test processes, balancing their estimated cost, and runs them on devices assigned
+    round robin. Prints the output of the workers and a merged summary, and returns the exit
+    status of the run. */
+int rocblas_run_parallel(int num_workers);
+
+/*! \brief The device a --parallel worker runs on, or 0 */
+int rocblas_test_shard_device();
+
+/*! \brief Writes the results of a --parallel worker for its parent. Does nothing outside of
+    workers. */
+void rocblas_test_shard_write_summary();
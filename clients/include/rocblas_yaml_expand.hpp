@@ -0,0 +1,97 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+/*! \brief In-process equivalent of rocblas_gentest.py. Reads a rocBLAS YAML test file with its
+    include: lines, Definitions, Datatypes, Arguments, Defaults, Functions and Known bugs, and
+    expands its Tests into the binary Arguments records rocblas_gentest.py would write, in the
+    same order and with the same signature. Records are produced one Tests entry at a time, so
+    the first ones are available before the rest of the file is expanded.
+
+    Errors in the YAML file are reported with their file, line and column, and exit the
+    program as rocblas_gentest.py does. */
+class rocblas_yaml_expander
+{
+public:
+    // template_file, if not empty, is prepended to yaml as with rocblas_gentest.py --template.
+    // include_dirs are searched after the including file's directory, as with -I.
+    explicit rocblas_yaml_expander(const std::string&              yaml,
+                                   const std::string&              template_file = "",
+                                   const std::vector<std::string>& include_dirs  = {});
+    ~rocblas_yaml_expander();
+
+    // Expands the next Tests entry, appending its records to data(), preceded by the signature
+    // when they are the first records. Returns false when all Tests entries have been expanded.
+    bool expand_next();
+
+    // Signature and records expanded so far
+    const std::string& data() const;
+
+private:
+    struct impl;
+    std::unique_ptr<impl> m_impl;
+};
+
+/*! \brief Stream buffer of the records of rocblas_yaml_expander, expanded as they are read.
+    Records already produced are kept, so the stream can be rewound and read again. */
+class rocblas_yaml_streambuf : public std::streambuf
+{
+    rocblas_yaml_expander m_expander;
+
+    // Expands Tests entries until at least size bytes are available or all are expanded
+    void fill(size_t size);
+
+    // Points the get area at the expander's data, which may have been reallocated
+    void set_position(size_t pos);
+
+protected:
+    int_type underflow() override;
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode) override;
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override;
+
+public:
+    explicit rocblas_yaml_streambuf(const std::string& yaml, const std::string& template_file = "")
+        : m_expander(yaml, template_file)
+    {
+    }
+};
+
+/*! \brief istream over rocblas_yaml_streambuf, used by RocBLAS_TestData for --yaml files */
+class rocblas_yaml_istream : public std::istream
+{
+    rocblas_yaml_streambuf m_buf;
+
+public:
+    explicit rocblas_yaml_istream(const std::string& yaml, const std::string& template_file = "")
+        : std::istream(nullptr)
+        , m_buf(yaml, template_file)
+    {
+        rdbuf(&m_buf);
+    }
+};
@@ -60,4 +60,16 @@ public:
         });
         return new T(std::forward<Args>(args)...);
     }
+
+    // Create an object of type T and register a cleanup handler for a pointer to its base B
+    template <typename T, typename B, typename... Args>
+    static T* allocate_as(B** ptr, Args&&... args)
+    {
+        *ptr = nullptr;
+        stack().push([=] {
+            delete *ptr;
+            *ptr = nullptr;
+        });
+        return new T(std::forward<Args>(args)...);
+    }
 };
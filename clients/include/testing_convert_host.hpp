@@ -0,0 +1,218 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocblas_convert_host.hpp"
+#include "rocblas_datatype2string.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "type_dispatch.hpp"
+#include "utility.hpp"
+
+template <typename Ti, typename To>
+void testing_convert_host_bad_arg(const Arguments& arg)
+{
+    const size_t           N      = 100;
+    const rocblas_datatype x_type = rocblas_type2datatype<Ti>();
+    const rocblas_datatype y_type = rocblas_type2datatype<To>();
+
+    host_vector<Ti> hx(N);
+    host_vector<To> hy(N);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_convert_host(
+            N, hx, x_type, hy, y_type, rocblas_rounding_mode(-1), 0),
+        rocblas_status_invalid_value);
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_convert_host(
+            N, nullptr, x_type, hy, y_type, rocblas_rounding_mode_nearest_even, 0),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_convert_host(
+            N, hx, x_type, nullptr, y_type, rocblas_rounding_mode_nearest_even, 0),
+        rocblas_status_invalid_pointer);
+
+    // Unsupported types
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_convert_host(
+            N, hx, rocblas_datatype_f64_r, hy, y_type, rocblas_rounding_mode_nearest_even, 0),
+        rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_convert_host(
+            N, hx, x_type, hy, rocblas_datatype_i32_r, rocblas_rounding_mode_nearest_even, 0),
+        rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(rocblas_convert_host(N,
+                                               hx,
+                                               rocblas_datatype_f8_r,
+                                               hy,
+                                               rocblas_datatype_bf8_r,
+                                               rocblas_rounding_mode_nearest_even,
+                                               0),
+                          rocblas_status_not_implemented);
+
+    // Quick return with zero elements, even with null pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_convert_host(
+            0, nullptr, x_type, nullptr, y_type, rocblas_rounding_mode_stochastic, 0),
+        rocblas_status_success);
+}
+
+// Converts hx and returns the number of elements which differ from the scalar conversion
+template <typename Ti, typename To, bool stochastic_rounding>
+size_t testing_convert_host_check(const host_vector<Ti>& hx, host_vector<To>& hy, uint32_t seed)
+{
+    size_t N = hx.size();
+
+    CHECK_ROCBLAS_ERROR(rocblas_convert_host(N,
+                                             hx,
+                                             rocblas_type2datatype<Ti>(),
+                                             hy,
+                                             rocblas_type2datatype<To>(),
+                                             stochastic_rounding
+                                                 ? rocblas_rounding_mode_stochastic
+                                                 : rocblas_rounding_mode_nearest_even,
+                                             seed));
+
+    size_t mismatches = 0;
+    for(size_t i = 0; i < N; i++)
+    {
+        To gold = rocblas_convert_host_element<To, Ti, stochastic_rounding>(hx[i], i, seed);
+        if(memcmp(&gold, &hy[i], sizeof(To)) && mismatches++ < 10)
+        {
+            uint32_t x_bits = 0, y_bits = 0, gold_bits = 0;
+            memcpy(&x_bits, &hx[i], sizeof(Ti));
+            memcpy(&y_bits, &hy[i], sizeof(To));
+            memcpy(&gold_bits, &gold, sizeof(To));
+            rocblas_cerr << "element " << i << " with bits 0x" << std::hex << x_bits
+                         << " converted to 0x" << y_bits << ", expected 0x" << gold_bits
+                         << std::dec << std::endl;
+        }
+    }
+    return mismatches;
+}
+
+template <typename Ti, typename To>
+void testing_convert_host(const Arguments& arg)
+{
+    const size_t   N    = arg.N < 0 ? 0 : size_t(arg.N);
+    const uint32_t seed = 0x1337;
+
+    // Random bit patterns cover every exponent, including subnormals, Inf and NaN
+    host_vector<Ti> hx(N);
+    host_vector<To> hy(N);
+    for(size_t i = 0; i < N; i++)
+    {
+        uint32_t bits = std::uniform_int_distribution<uint32_t>{}(t_rocblas_rng);
+        memcpy(&hx[i], &bits, sizeof(Ti));
+    }
+
+    double gpu_time_used = 0.0, cpu_time_used = ArgumentLogging::NA_value;
+
+    if(arg.unit_check)
+    {
+        size_t mismatches = arg.stochastic_rounding
+                                ? testing_convert_host_check<Ti, To, true>(hx, hy, seed)
+                                : testing_convert_host_check<Ti, To, false>(hx, hy, seed);
+#ifdef GOOGLE_TEST
+        EXPECT_EQ(mismatches, 0);
+#endif
+    }
+
+    if(arg.timing)
+    {
+        rocblas_rounding_mode rounding = arg.stochastic_rounding
+                                             ? rocblas_rounding_mode_stochastic
+                                             : rocblas_rounding_mode_nearest_even;
+
+        auto convert = [&] {
+            return rocblas_convert_host(N,
+                                        hx,
+                                        rocblas_type2datatype<Ti>(),
+                                        hy,
+                                        rocblas_type2datatype<To>(),
+                                        rounding,
+                                        seed);
+        };
+
+        for(int i = 0; i < arg.cold_iters; i++)
+            CHECK_ROCBLAS_ERROR(convert());
+
+        gpu_time_used = get_time_us_no_sync();
+        for(int i = 0; i < arg.iters; i++)
+            CHECK_ROCBLAS_ERROR(convert());
+        gpu_time_used = get_time_us_no_sync() - gpu_time_used;
+
+        // The scalar conversion is reported as the CPU time to show the speedup
+        if(arg.norm_check)
+        {
+            cpu_time_used = get_time_us_no_sync();
+            for(size_t i = 0; i < N; i++)
+            {
+                if(arg.stochastic_rounding)
+                    hy[i] = rocblas_convert_host_element<To, Ti, true>(hx[i], i, seed);
+                else
+                    hy[i] = rocblas_convert_host_element<To, Ti, false>(hx[i], i, seed);
+            }
+            cpu_time_used = get_time_us_no_sync() - cpu_time_used;
+        }
+
+        ArgumentModel<e_N, e_stochastic_rounding>{}.log_args<Ti>(
+            rocblas_cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            N * double(sizeof(Ti) + sizeof(To)) / 1e9,
+            cpu_time_used);
+    }
+}
+
+// Every bit pattern of Ti, in chunks for 32 bit sources
+template <typename Ti, typename To>
+void testing_convert_host_exhaustive(const Arguments& arg)
+{
+    const uint32_t seed  = 0x1337;
+    const uint64_t count = uint64_t(1) << (8 * sizeof(Ti));
+    const size_t   chunk = std::min(count, uint64_t(1) << 24);
+
+    host_vector<Ti> hx(chunk);
+    host_vector<To> hy(chunk);
+
+    for(uint64_t begin = 0; begin < count; begin += chunk)
+    {
+        for(size_t i = 0; i < chunk; i++)
+        {
+            uint32_t bits = uint32_t(begin + i);
+            memcpy(&hx[i], &bits, sizeof(Ti));
+        }
+
+        size_t mismatches = arg.stochastic_rounding
+                                ? testing_convert_host_check<Ti, To, true>(hx, hy, seed)
+                                : testing_convert_host_check<Ti, To, false>(hx, hy, seed);
+#ifdef GOOGLE_TEST
+        ASSERT_EQ(mismatches, 0);
+#endif
+    }
+}
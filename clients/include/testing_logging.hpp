@@ -87,6 +87,29 @@ std::string replaceX(std::string input_string)
     return input_string;
 }
 
+// Names of the API ranges reported to the callback, and the number of ranges still open
+struct logging_api_ranges
+{
+    std::vector<std::string> names;
+    int                      open     = 0;
+    bool                     balanced = true;
+};
+
+inline void logging_api_range_callback(void*                   user_data,
+                                       rocblas_api_range_event event,
+                                       const char*             name,
+                                       const char*             args)
+{
+    auto& ranges = *static_cast<logging_api_ranges*>(user_data);
+    if(event == rocblas_api_range_begin)
+    {
+        ranges.names.push_back(name);
+        ranges.open++;
+    }
+    else if(ranges.open-- == 0)
+        ranges.balanced = false;
+}
+
 template <typename T>
 void testing_logging(const Arguments& arg)
 {
@@ -189,6 +212,9 @@ void testing_logging(const Arguments& arg)
     CHECK_DEVICE_ALLOCATION(dc.memcheck());
     CHECK_DEVICE_ALLOCATION(dd.memcheck());
 
+    logging_api_ranges api_ranges;
+    bool               api_ranges_built = false;
+
     // enclose in {} so rocblas_local_handle destructor called as it goes out of scope
     {
         int                  i_result;
@@ -201,6 +227,11 @@ void testing_logging(const Arguments& arg)
         rocblas_set_pointer_mode(handle, test_pointer_mode);
         rocblas_get_pointer_mode(handle, &mode);
 
+        // when rocBLAS is built with API ranges, each function below also reports a range
+        api_ranges_built
+            = rocblas_set_api_range_callback(handle, logging_api_range_callback, &api_ranges)
+              == rocblas_status_success;
+
         // *************************************************** BLAS1 ***************************************************
         rocblas_iamax<T>(handle, n, dx, incx, &i_result);
 
@@ -1174,6 +1205,28 @@ void testing_logging(const Arguments& arg)
     ASSERT_EQ(trace_cmp, 0);
 #endif
 
+    if(api_ranges_built)
+    {
+        // every function in the trace log, other than the auxiliary functions, reported a range
+        std::vector<std::string> traced;
+        std::ifstream            trace_ifs(trace_path1);
+        std::string              line;
+        while(std::getline(trace_ifs, line))
+        {
+            std::string name = line.substr(0, line.find(','));
+            if(name != "rocblas_create_handle" && name != "rocblas_destroy_handle"
+               && name != "rocblas_set_pointer_mode" && name != "rocblas_get_pointer_mode")
+                traced.push_back(name);
+        }
+        trace_ifs.close();
+
+#ifdef GOOGLE_TEST
+        ASSERT_EQ(api_ranges.names, traced);
+        ASSERT_EQ(api_ranges.open, 0);
+        ASSERT_TRUE(api_ranges.balanced);
+#endif
+    }
+
     if(!trace_cmp)
     {
         fs::remove(trace_fspath1);
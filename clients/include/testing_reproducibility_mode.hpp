@@ -0,0 +1,285 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "cblas_interface.hpp"
+#include "near.hpp"
+#include "rocblas.hpp"
+#include "rocblas_init.hpp"
+#include "rocblas_math.hpp"
+#include "rocblas_random.hpp"
+#include "rocblas_test.hpp"
+#include "rocblas_vector.hpp"
+#include "unit.hpp"
+#include "utility.hpp"
+
+#include <cstring>
+
+// Bitwise comparison, unit_check_general tolerates a few ulps for floating point types
+template <typename U>
+inline void reproducibility_check(int64_t n, const U* expected, const U* actual)
+{
+    for(int64_t i = 0; i < n; i++)
+        if(memcmp(&expected[i], &actual[i], sizeof(U)))
+        {
+            ADD_FAILURE() << "results differ bitwise at index " << i << ": " << expected[i]
+                          << " vs " << actual[i];
+            return;
+        }
+}
+
+template <typename T>
+void testing_reproducibility_mode_bad_arg(const Arguments& arg)
+{
+    rocblas_local_handle handle;
+
+    // Make sure the default is rocblas_reproducibility_default
+    rocblas_reproducibility_mode mode = rocblas_reproducibility_bitwise;
+    CHECK_ROCBLAS_ERROR(rocblas_get_reproducibility_mode(handle, &mode));
+    EXPECT_EQ(rocblas_reproducibility_default, mode);
+
+    for(auto set_mode : {rocblas_reproducibility_bitwise,
+                         rocblas_reproducibility_bitwise_compensated,
+                         rocblas_reproducibility_default})
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_set_reproducibility_mode(handle, set_mode));
+        CHECK_ROCBLAS_ERROR(rocblas_get_reproducibility_mode(handle, &mode));
+        EXPECT_EQ(set_mode, mode);
+    }
+
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_reproducibility_mode(nullptr, rocblas_reproducibility_bitwise),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_reproducibility_mode(nullptr, &mode),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocblas_get_reproducibility_mode(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocblas_set_reproducibility_mode(handle, rocblas_reproducibility_mode(3)),
+        rocblas_status_invalid_value);
+
+    // an invalid mode must leave the handle unchanged
+    CHECK_ROCBLAS_ERROR(rocblas_get_reproducibility_mode(handle, &mode));
+    EXPECT_EQ(rocblas_reproducibility_default, mode);
+}
+
+// Check that the reductions covered by rocblas_reproducibility_mode return bitwise identical
+// results when:
+// - the same call is repeated
+// - the call is repeated on a second handle
+// - the pointer mode changes
+// - the batched call is split into batch_count non-batched calls
+// - for dot, x and y are accessed with a stride instead of contiguously
+// gemv is run with the transpose operation which is the reduction-based path.
+template <typename T>
+void testing_reproducibility_mode(const Arguments& arg)
+{
+    using Tr = real_t<T>;
+
+    rocblas_int N           = arg.N;
+    rocblas_int M           = arg.M;
+    rocblas_int lda         = arg.lda;
+    rocblas_int incx        = arg.incx;
+    rocblas_int batch_count = arg.batch_count;
+
+    ASSERT_NE(arg.reproducibility_mode, rocblas_reproducibility_default);
+
+    if(N <= 0 || M <= 0 || lda < M || incx <= 0 || batch_count <= 0)
+        return;
+
+    rocblas_local_handle handle{arg};
+    rocblas_local_handle handle_2{arg};
+
+    rocblas_stride stride_x = size_t(N) * incx;
+    rocblas_stride stride_a = size_t(lda) * N;
+    rocblas_stride stride_y = N;
+
+    // dot, nrm2 and asum use x and xc, the contiguous copy of x
+    host_strided_batch_vector<T> hx(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hy(N, incx, stride_x, batch_count);
+    host_strided_batch_vector<T> hxc(N, 1, N, batch_count);
+    host_strided_batch_vector<T> hyc(N, 1, N, batch_count);
+    CHECK_HIP_ERROR(hx.memcheck());
+    CHECK_HIP_ERROR(hy.memcheck());
+    CHECK_HIP_ERROR(hxc.memcheck());
+    CHECK_HIP_ERROR(hyc.memcheck());
+
+    rocblas_init_vector(hx, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hy, arg, rocblas_client_alpha_sets_nan, false, true);
+    for(rocblas_int b = 0; b < batch_count; b++)
+        for(rocblas_int i = 0; i < N; i++)
+        {
+            hxc[b][i] = hx[b][i * int64_t(incx)];
+            hyc[b][i] = hy[b][i * int64_t(incx)];
+        }
+
+    // gemv: y = alpha * A^T * v + beta * y with A M x N and v of length M
+    host_strided_batch_vector<T> hA(size_t(lda) * N, 1, stride_a, batch_count);
+    host_strided_batch_vector<T> hv(M, 1, M, batch_count);
+    host_strided_batch_vector<T> hgy(N, 1, stride_y, batch_count);
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hv.memcheck());
+    CHECK_HIP_ERROR(hgy.memcheck());
+    rocblas_init_vector(hA, arg, rocblas_client_alpha_sets_nan, true);
+    rocblas_init_vector(hv, arg, rocblas_client_alpha_sets_nan, false, true);
+    rocblas_init_vector(hgy, arg, rocblas_client_beta_sets_nan);
+
+    device_strided_batch_vector<T> dx(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<T> dy(N, incx, stride_x, batch_count);
+    device_strided_batch_vector<T> dxc(N, 1, N, batch_count);
+    device_strided_batch_vector<T> dyc(N, 1, N, batch_count);
+    device_strided_batch_vector<T> dA(size_t(lda) * N, 1, stride_a, batch_count);
+    device_strided_batch_vector<T> dv(M, 1, M, batch_count);
+    device_strided_batch_vector<T> dgy(N, 1, stride_y, batch_count);
+    device_vector<T>               d_dot(batch_count);
+    device_vector<Tr>              d_real(batch_count);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+    CHECK_DEVICE_ALLOCATION(dxc.memcheck());
+    CHECK_DEVICE_ALLOCATION(dyc.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dgy.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_dot.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_real.memcheck());
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIP_ERROR(dxc.transfer_from(hxc));
+    CHECK_HIP_ERROR(dyc.transfer_from(hyc));
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dv.transfer_from(hv));
+
+    host_vector<T>  h_dot_1(batch_count), h_dot_2(batch_count);
+    host_vector<Tr> h_real_1(batch_count), h_real_2(batch_count);
+
+    //
+    // dot
+    //
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+    CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+        handle, N, dx, incx, stride_x, dy, incx, stride_x, batch_count, h_dot_1));
+
+    // repeated, on a second handle and in device pointer mode
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle_2, rocblas_pointer_mode_device));
+    CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+        handle_2, N, dx, incx, stride_x, dy, incx, stride_x, batch_count, d_dot));
+    CHECK_HIP_ERROR(h_dot_2.transfer_from(d_dot));
+    reproducibility_check(batch_count, h_dot_1.data(), h_dot_2.data());
+
+    // contiguous copy
+    CHECK_ROCBLAS_ERROR(rocblas_dot_strided_batched<T>(
+        handle, N, dxc, 1, N, dyc, 1, N, batch_count, h_dot_2));
+    reproducibility_check(batch_count, h_dot_1.data(), h_dot_2.data());
+
+    // one batch at a time
+    for(rocblas_int b = 0; b < batch_count; b++)
+        CHECK_ROCBLAS_ERROR(rocblas_dot<T>(handle, N, dx[b], incx, dy[b], incx, &h_dot_2[b]));
+    reproducibility_check(batch_count, h_dot_1.data(), h_dot_2.data());
+
+    for(rocblas_int b = 0; b < batch_count; b++)
+    {
+        T      cpu_result;
+        double tol = N * double(std::numeric_limits<Tr>::epsilon());
+        cblas_dot<T>(N, hx[b], incx, hy[b], incx, &cpu_result);
+        near_check_general<T>(1, 1, 1, &cpu_result, &h_dot_1[b], tol * rocblas_abs(cpu_result));
+    }
+
+    //
+    // nrm2 and asum
+    //
+    for(bool is_nrm2 : {true, false})
+    {
+        auto rocblas_fn    = is_nrm2 ? rocblas_nrm2<T> : rocblas_asum<T>;
+        auto rocblas_sb_fn = is_nrm2 ? rocblas_nrm2_strided_batched<T>
+                                     : rocblas_asum_strided_batched<T>;
+
+        CHECK_ROCBLAS_ERROR(rocblas_sb_fn(handle, N, dx, incx, stride_x, batch_count, h_real_1));
+
+        CHECK_ROCBLAS_ERROR(rocblas_sb_fn(handle_2, N, dx, incx, stride_x, batch_count, d_real));
+        CHECK_HIP_ERROR(h_real_2.transfer_from(d_real));
+        reproducibility_check(batch_count, h_real_1.data(), h_real_2.data());
+
+        CHECK_ROCBLAS_ERROR(rocblas_sb_fn(handle, N, dxc, 1, N, batch_count, h_real_2));
+        reproducibility_check(batch_count, h_real_1.data(), h_real_2.data());
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+            CHECK_ROCBLAS_ERROR(rocblas_fn(handle, N, dx[b], incx, &h_real_2[b]));
+        reproducibility_check(batch_count, h_real_1.data(), h_real_2.data());
+
+        for(rocblas_int b = 0; b < batch_count; b++)
+        {
+            Tr     cpu_result;
+            double tol = N * double(std::numeric_limits<Tr>::epsilon());
+            (is_nrm2 ? cblas_nrm2<T> : cblas_asum<T>)(N, hx[b], incx, &cpu_result);
+            near_check_general<Tr>(1, 1, 1, &cpu_result, &h_real_1[b], tol * cpu_result);
+        }
+    }
+
+    //
+    // gemv
+    //
+    T                            h_alpha = arg.get_alpha<T>();
+    T                            h_beta  = arg.get_beta<T>();
+    host_strided_batch_vector<T> hgy_1(N, 1, stride_y, batch_count);
+    host_strided_batch_vector<T> hgy_2(N, 1, stride_y, batch_count);
+    CHECK_HIP_ERROR(hgy_1.memcheck());
+    CHECK_HIP_ERROR(hgy_2.memcheck());
+
+    CHECK_HIP_ERROR(dgy.transfer_from(hgy));
+    CHECK_ROCBLAS_ERROR(rocblas_gemv_strided_batched<T>(handle,
+                                                        rocblas_operation_transpose,
+                                                        M,
+                                                        N,
+                                                        &h_alpha,
+                                                        dA,
+                                                        lda,
+                                                        stride_a,
+                                                        dv,
+                                                        1,
+                                                        M,
+                                                        &h_beta,
+                                                        dgy,
+                                                        1,
+                                                        stride_y,
+                                                        batch_count));
+    CHECK_HIP_ERROR(hgy_1.transfer_from(dgy));
+
+    CHECK_HIP_ERROR(dgy.transfer_from(hgy));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle_2, rocblas_pointer_mode_host));
+    for(rocblas_int b = 0; b < batch_count; b++)
+        CHECK_ROCBLAS_ERROR(rocblas_gemv<T>(handle_2,
+                                            rocblas_operation_transpose,
+                                            M,
+                                            N,
+                                            &h_alpha,
+                                            dA[b],
+                                            lda,
+                                            dv[b],
+                                            1,
+                                            &h_beta,
+                                            dgy[b],
+                                            1));
+    CHECK_HIP_ERROR(hgy_2.transfer_from(dgy));
+    reproducibility_check(int64_t(stride_y) * batch_count, hgy_1.data(), hgy_2.data());
+}
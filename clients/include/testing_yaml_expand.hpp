@@ -0,0 +1,58 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas_test.hpp"
+#include "rocblas_yaml_expand.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Expands rocblas_smoke.yaml in process and compares the records with rocblas_smoke.data,
+// which rocblas_gentest.py generated from it at build time
+inline void testing_yaml_expand(const Arguments& arg)
+{
+    auto exepath = rocblas_exepath();
+
+    std::ifstream ifs(exepath + "rocblas_smoke.data", std::ifstream::in | std::ifstream::binary);
+    ASSERT_TRUE(ifs.good()) << "Cannot open " << exepath << "rocblas_smoke.data";
+    std::string expected{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+
+    rocblas_yaml_istream yaml(exepath + "rocblas_smoke.yaml", exepath + "rocblas_template.yaml");
+    std::string actual{std::istreambuf_iterator<char>(yaml), std::istreambuf_iterator<char>()};
+
+    ASSERT_EQ(actual.size(), expected.size());
+
+    // Report the first record which differs
+    size_t mismatch = std::mismatch(actual.begin(), actual.end(), expected.begin()).first
+                      - actual.begin();
+    EXPECT_EQ(mismatch, actual.size()) << "Records differ at byte " << mismatch;
+
+    // The stream can be rewound and read again, as RocBLAS_TestData does
+    yaml.clear();
+    yaml.seekg(0);
+    std::string reread{std::istreambuf_iterator<char>(yaml), std::istreambuf_iterator<char>()};
+    EXPECT_TRUE(reread == actual);
+}
@@ -534,3 +534,44 @@ auto rocblas_gemm_dispatch(const Arguments& arg)
     }
     return TEST<void>{}(arg);
 }
+
+// Host conversion functions, a_type is the source and d_type is the destination
+template <template <typename...> class TEST, typename Ti>
+auto rocblas_convert_host_dispatch_to(const Arguments& arg)
+{
+    switch(arg.d_type)
+    {
+    case rocblas_datatype_f32_r:
+        return TEST<Ti, float>{}(arg);
+    case rocblas_datatype_f16_r:
+        return TEST<Ti, rocblas_half>{}(arg);
+    case rocblas_datatype_bf16_r:
+        return TEST<Ti, rocblas_bfloat16>{}(arg);
+    case rocblas_datatype_f8_r:
+        return TEST<Ti, rocblas_f8>{}(arg);
+    case rocblas_datatype_bf8_r:
+        return TEST<Ti, rocblas_bf8>{}(arg);
+    default:
+        return TEST<void>{}(arg);
+    }
+}
+
+template <template <typename...> class TEST>
+auto rocblas_convert_host_dispatch(const Arguments& arg)
+{
+    switch(arg.a_type)
+    {
+    case rocblas_datatype_f32_r:
+        return rocblas_convert_host_dispatch_to<TEST, float>(arg);
+    case rocblas_datatype_f16_r:
+        return rocblas_convert_host_dispatch_to<TEST, rocblas_half>(arg);
+    case rocblas_datatype_bf16_r:
+        return rocblas_convert_host_dispatch_to<TEST, rocblas_bfloat16>(arg);
+    case rocblas_datatype_f8_r:
+        return rocblas_convert_host_dispatch_to<TEST, rocblas_f8>(arg);
+    case rocblas_datatype_bf8_r:
+        return rocblas_convert_host_dispatch_to<TEST, rocblas_bf8>(arg);
+    default:
+        return TEST<void>{}(arg);
+    }
+}
@@ -52,6 +52,12 @@ option(BUILD_CODE_COVERAGE "Build rocBLAS with code coverage enabled" OFF)
 # FOR OPTIONAL ADDRESS SANITIZER
 option(BUILD_ADDRESS_SANITIZER "Build with address sanitizer enabled" OFF)
 
+# FOR OPTIONAL HOST PHASE TIMERS READ BY rocblas-overhead-bench
+option(BUILD_WITH_HOST_TIMERS "Build rocBLAS with host phase timers enabled" OFF)
+
+# FOR OPTIONAL API RANGES AROUND EACH rocBLAS FUNCTION
+option(BUILD_WITH_API_RANGES "Build rocBLAS with API range instrumentation enabled" OFF)
+
 # FOR OPTIONAL HEADER TESTING
 option(RUN_HEADER_TESTING "Post build header compatibility testing" OFF)
 
@@ -90,6 +90,31 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_atomics_mode(rocblas_handle       hand
 ROCBLAS_EXPORT rocblas_status rocblas_get_atomics_mode(rocblas_handle        handle,
                                                        rocblas_atomics_mode* atomics_mode);
 
+/*! \brief Set rocblas_reproducibility_mode
+ *  \details
+ *  By default the reductions in dot, nrm2, asum and gemv are free to pick kernels and
+ *  summation orders based on the device, batch_count and atomics mode, so the last bits of
+ *  the result may differ between such configurations.
+ *
+ *  With `rocblas_reproducibility_bitwise` these functions use a fixed order reduction tree,
+ *  and the result for one vector or matrix depends only on its data and size. Results are
+ *  identical between runs, streams, batch counts, pointer modes, the batched and non-batched
+ *  forms, and devices with different wavefront sizes. With
+ *  `rocblas_reproducibility_bitwise_compensated` the per thread partial sums of dot, nrm2
+ *  and asum are also accumulated with compensated summation.
+ *
+ *  Setting a reproducibility mode other than the default also disables atomics in these
+ *  functions, regardless of rocblas_atomics_mode. Returns rocblas_status_invalid_value for an
+ *  unknown mode.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_reproducibility_mode(
+    rocblas_handle handle, rocblas_reproducibility_mode reproducibility_mode);
+
+/*! \brief Get rocblas_reproducibility_mode
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_reproducibility_mode(
+    rocblas_handle handle, rocblas_reproducibility_mode* reproducibility_mode);
+
 /*! \brief Set rocblas_math_mode
  */
 ROCBLAS_EXPORT rocblas_status rocblas_set_math_mode(rocblas_handle    handle,
@@ -100,6 +125,31 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_math_mode(rocblas_handle    handle,
 ROCBLAS_EXPORT rocblas_status rocblas_get_math_mode(rocblas_handle     handle,
                                                     rocblas_math_mode* math_mode);
 
+/*! \brief Set the parameters of rocblas_iterative_refinement_math
+ *  \details
+ *  With `rocblas_iterative_refinement_math` the double precision and double complex trsm and
+ *  trsv solve in single precision, then correct the solution X with residuals
+ *  R = alpha * B - op(A) * X computed in double precision until
+ *  max|R| <= tolerance * k * max|A| * max|X|, where k is the order of A. The solve is repeated
+ *  in double precision if this does not hold after max_iterations corrections.
+ *
+ *  Every correction copies the residual norms to the host, which synchronizes the stream.
+ *  While the stream is capturing a graph the solve runs directly in double precision instead.
+ *
+ *  A tolerance of 0 selects sqrt(k) times the double precision epsilon, the default.
+ *  max_iterations defaults to 30. Returns rocblas_status_invalid_value for a negative
+ *  tolerance or max_iterations.
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_set_iterative_refinement(rocblas_handle handle,
+                                                               double         tolerance,
+                                                               rocblas_int    max_iterations);
+
+/*! \brief Get the parameters of rocblas_iterative_refinement_math
+ */
+ROCBLAS_EXPORT rocblas_status rocblas_get_iterative_refinement(rocblas_handle handle,
+                                                               double*        tolerance,
+                                                               rocblas_int*   max_iterations);
+
 /*! \brief  Indicates whether the pointer is on the host or device.
  */
 ROCBLAS_EXPORT rocblas_pointer_mode rocblas_pointer_to_mode(void* ptr);
@@ -344,6 +394,49 @@ ROCBLAS_EXPORT rocblas_status rocblas_get_matrix_async(rocblas_int rows,
                                                        rocblas_int ldb,
                                                        hipStream_t stream);
 
+/*! \brief Convert an array between floating point types on the host
+     \details
+    rocblas_convert_host converts n contiguous elements of x on the host to the type of y, also
+    on the host. Conversions produce the same bits as converting each element with the rocBLAS
+    types, and explicit_downcast for rocblas_f8 and rocblas_bf8, but use SIMD and several host
+    threads for large arrays. This is intended for quantizing and dequantizing data before upload
+    or after download.
+
+    Supported types are rocblas_datatype_f32_r, rocblas_datatype_f16_r, rocblas_datatype_bf16_r,
+    rocblas_datatype_f8_r and rocblas_datatype_bf8_r. Conversions between rocblas_f8 and
+    rocblas_bf8 are not supported.
+
+    With rocblas_rounding_mode_stochastic the random bits used to round element i are those of
+    the gemm_ex3 quantization kernels for element index i, seed and the bits of x[i], so results
+    are reproducible for a given seed.
+    @param[in]
+    n           [size_t]
+                number of elements in x and y
+    @param[in]
+    x           pointer to the source array on the host
+    @param[in]
+    x_type      [rocblas_datatype]
+                specifies the datatype of x
+    @param[out]
+    y           pointer to the destination array on the host. x and y must not overlap.
+    @param[in]
+    y_type      [rocblas_datatype]
+                specifies the datatype of y
+    @param[in]
+    rounding    [rocblas_rounding_mode]
+                rounding used when y_type is narrower than x_type
+    @param[in]
+    seed        [uint32_t]
+                seed of the random bits used by rocblas_rounding_mode_stochastic
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_convert_host(size_t                n,
+                                                   const void*           x,
+                                                   rocblas_datatype      x_type,
+                                                   void*                 y,
+                                                   rocblas_datatype      y_type,
+                                                   rocblas_rounding_mode rounding,
+                                                   uint32_t              seed);
+
 /*******************************************************************************
  * Function to set start/stop event handlers (for internal use only)
  ******************************************************************************/
@@ -390,6 +483,30 @@ ROCBLAS_EXPORT rocblas_status rocblas_set_performance_metric(rocblas_handle
 ROCBLAS_EXPORT rocblas_status rocblas_get_performance_metric(rocblas_handle              handle,
                                                              rocblas_performance_metric* metric);
 
+/*! \brief registers a callback receiving the API ranges of a handle
+     \details
+    When rocBLAS is built with BUILD_WITH_API_RANGES, every rocBLAS function called with handle
+    reports a range to callback: rocblas_api_range_begin with the function name and its sizes,
+    modes and types formatted as a comma separated list when it is entered, and
+    rocblas_api_range_end with the same name when it returns. Ranges nest when a function calls
+    another one. Device memory size queries do not report ranges. A null callback removes the
+    callback.
+    @param[in]
+    handle      [rocblas_handle]
+                the handle of device
+    @param[in]
+    callback    [rocblas_api_range_callback]
+                the callback, called on the thread calling the rocBLAS function
+    @param[in]
+    user_data   [void*]
+                passed unchanged to callback
+
+    @return rocblas_status_not_implemented if rocBLAS is built without API ranges
+     ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_set_api_range_callback(rocblas_handle             handle,
+                                                             rocblas_api_range_callback callback,
+                                                             void*                      user_data);
+
 #ifdef __cplusplus
 }
 #endif
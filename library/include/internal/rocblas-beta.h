@@ -697,6 +697,163 @@ ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex3(rocblas_handle      handle,
                                                int32_t             solution_index,
                                                uint32_t            flags);
 //! @}
+
+ROCBLAS_DEPRECATED_MSG(
+    "rocblas_gemm_ex3_scaled is a beta feature and is subject to change in future releases."
+    "Trying to run this API on unsupported hardware will return rocblas_status_arch_mismatch ")
+/*! @{
+    \brief <b> BLAS BETA API </b>
+
+    \details
+    gemm_ex3_scaled performs the scaled matrix-matrix operation
+
+        D = scale_d * ( alpha*( diag( scale_a )*op( A ) )*( op( B )*diag( scale_b ) ) + beta*C ),
+
+    with the same operands, types and compute types as gemm_ex3. scale_a and scale_b are the
+    dequantization factors of A and B, either one factor for the whole matrix
+    (rocblas_gemm_scale_mode_tensor) or one factor per row of op( A ) and per column of op( B )
+    (rocblas_gemm_scale_mode_vector). scale_d quantizes the result into d_type, and amax_d
+    returns the largest magnitude of D before scale_d is applied, for the scale of the next
+    iteration.
+
+    Inputs which are wider than the compute type are divided by their scaling factor as they are
+    converted to f8 or bf8, so op( A ) and op( B ) are given unscaled. Scaling factors and amax_d
+    are shared by every matrix of a batch.
+
+    The scaling is fused into the conversion and the epilogue of the HIP gemm_ex3 kernel, which
+    is slower than the Tensile kernels used by gemm_ex3 without scaling.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    a         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    b         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    c         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[out]
+    d         [void *]
+              device pointer storing matrix D.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of matrix D.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of D.
+    @param[in]
+    compute_type
+              [rocblas_computetype]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [rocblas_gemm_algo]
+              enumerant specifying the algorithm type.
+    @param[in]
+    solution_index
+              [int32_t]
+              reserved for future use.
+    @param[in]
+    flags     [uint32_t]
+              optional gemm flags.
+    @param[in]
+    scale_a   [const float *]
+              device pointer storing the scaling factors of A, 1 or m values depending on
+              scale_a_mode. Unused if scale_a_mode is rocblas_gemm_scale_mode_none.
+    @param[in]
+    scale_a_mode
+              [rocblas_gemm_scale_mode]
+              specifies the layout of scale_a.
+    @param[in]
+    scale_b   [const float *]
+              device pointer storing the scaling factors of B, 1 or n values depending on
+              scale_b_mode. Unused if scale_b_mode is rocblas_gemm_scale_mode_none.
+    @param[in]
+    scale_b_mode
+              [rocblas_gemm_scale_mode]
+              specifies the layout of scale_b.
+    @param[in]
+    scale_d   [const float *]
+              device pointer storing the scaling factor of D, or nullptr for no scaling.
+    @param[out]
+    amax_d    [float *]
+              device pointer receiving max( |D| ) before scale_d is applied, or nullptr. It is NaN
+              when D contains NaN.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_gemm_ex3_scaled(rocblas_handle          handle,
+                                                      rocblas_operation       transA,
+                                                      rocblas_operation       transB,
+                                                      rocblas_int             m,
+                                                      rocblas_int             n,
+                                                      rocblas_int             k,
+                                                      const void*             alpha,
+                                                      const void*             a,
+                                                      rocblas_datatype        a_type,
+                                                      rocblas_int             lda,
+                                                      const void*             b,
+                                                      rocblas_datatype        b_type,
+                                                      rocblas_int             ldb,
+                                                      const void*             beta,
+                                                      const void*             c,
+                                                      rocblas_datatype        c_type,
+                                                      rocblas_int             ldc,
+                                                      void*                   d,
+                                                      rocblas_datatype        d_type,
+                                                      rocblas_int             ldd,
+                                                      rocblas_computetype     compute_type,
+                                                      rocblas_gemm_algo       algo,
+                                                      int32_t                 solution_index,
+                                                      uint32_t                flags,
+                                                      const float*            scale_a,
+                                                      rocblas_gemm_scale_mode scale_a_mode,
+                                                      const float*            scale_b,
+                                                      rocblas_gemm_scale_mode scale_b_mode,
+                                                      const float*            scale_d,
+                                                      float*                  amax_d);
+//! @}
 #ifdef __cplusplus
 }
 #endif
@@ -2774,6 +2774,366 @@ ROCBLAS_EXPORT rocblas_status rocblas_drotmg_strided_batched(rocblas_handle hand
                                                              rocblas_int    batch_count);
 //! @}
 
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    axpy_dot   computes constant alpha multiplied by vector x, plus vector y, and then the dot
+    product of the updated vector y with vector z in a single pass over y:
+
+        y := alpha * x + y
+        result = y * z;
+
+    For complex types the dot product uses the conjugate of y, result = conjugate (y) * z.
+    z may be the same vector as y with incz equal to incy, in which case result is the squared
+    2-norm of the updated y. Otherwise z must not overlap y.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x, y and z.
+    @param[in]
+    alpha     device pointer or host pointer to specify the scalar alpha.
+    @param[in]
+    x         device pointer storing vector x. x is not accessed if alpha is zero.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[in]
+    z         device pointer storing vector z.
+    @param[in]
+    incz      [rocblas_int]
+              specifies the increment for the elements of z.
+    @param[inout]
+    result
+              device pointer or host pointer to store the dot product.
+              return is 0.0 if n <= 0.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_saxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const float*   alpha,
+                                                const float*   x,
+                                                rocblas_int    incx,
+                                                float*         y,
+                                                rocblas_int    incy,
+                                                const float*   z,
+                                                rocblas_int    incz,
+                                                float*         result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_daxpy_dot(rocblas_handle handle,
+                                                rocblas_int    n,
+                                                const double*  alpha,
+                                                const double*  x,
+                                                rocblas_int    incx,
+                                                double*        y,
+                                                rocblas_int    incy,
+                                                const double*  z,
+                                                rocblas_int    incz,
+                                                double*        result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_caxpy_dot(rocblas_handle               handle,
+                                                rocblas_int                  n,
+                                                const rocblas_float_complex* alpha,
+                                                const rocblas_float_complex* x,
+                                                rocblas_int                  incx,
+                                                rocblas_float_complex*       y,
+                                                rocblas_int                  incy,
+                                                const rocblas_float_complex* z,
+                                                rocblas_int                  incz,
+                                                rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zaxpy_dot(rocblas_handle                handle,
+                                                rocblas_int                   n,
+                                                const rocblas_double_complex* alpha,
+                                                const rocblas_double_complex* x,
+                                                rocblas_int                   incx,
+                                                rocblas_double_complex*       y,
+                                                rocblas_int                   incy,
+                                                const rocblas_double_complex* z,
+                                                rocblas_int                   incz,
+                                                rocblas_double_complex*       result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    multi_axpy   adds k scaled vectors x_j to vector y, reading and writing y once:
+
+        y := y + alpha[0] * x_0 + alpha[1] * x_1 + ... + alpha[k-1] * x_(k-1)
+
+    where x_j starts at x + j * stridex.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each x_j and y.
+    @param[in]
+    k         [rocblas_int]
+              the number of vectors x_j. k >= 0.
+    @param[in]
+    alpha     device pointer or host pointer to an array of k scalars.
+    @param[in]
+    x         device pointer storing the first vector x_0.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_j.
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_j) to the next one (x_(j+1)).
+    @param[inout]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_smulti_axpy(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  rocblas_int    k,
+                                                  const float*   alpha,
+                                                  const float*   x,
+                                                  rocblas_int    incx,
+                                                  rocblas_stride stridex,
+                                                  float*         y,
+                                                  rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dmulti_axpy(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  rocblas_int    k,
+                                                  const double*  alpha,
+                                                  const double*  x,
+                                                  rocblas_int    incx,
+                                                  rocblas_stride stridex,
+                                                  double*        y,
+                                                  rocblas_int    incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cmulti_axpy(rocblas_handle               handle,
+                                                  rocblas_int                  n,
+                                                  rocblas_int                  k,
+                                                  const rocblas_float_complex* alpha,
+                                                  const rocblas_float_complex* x,
+                                                  rocblas_int                  incx,
+                                                  rocblas_stride               stridex,
+                                                  rocblas_float_complex*       y,
+                                                  rocblas_int                  incy);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zmulti_axpy(rocblas_handle                handle,
+                                                  rocblas_int                   n,
+                                                  rocblas_int                   k,
+                                                  const rocblas_double_complex* alpha,
+                                                  const rocblas_double_complex* x,
+                                                  rocblas_int                   incx,
+                                                  rocblas_stride                stridex,
+                                                  rocblas_double_complex*       y,
+                                                  rocblas_int                   incy);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    multi_dot   computes the dot products of k vectors x_j with one vector y, reading y once
+    for each group of up to 8 vectors:
+
+        results[j] = x_j * y;    j = 0, 1, ..., k-1
+
+    where x_j starts at x + j * stridex. For complex types the conjugate of x_j is used,
+    results[j] = conjugate (x_j) * y.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in each x_j and y.
+    @param[in]
+    k         [rocblas_int]
+              the number of vectors x_j. k >= 0.
+    @param[in]
+    x         device pointer storing the first vector x_0.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_j.
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one vector (x_j) to the next one (x_(j+1)).
+    @param[in]
+    y         device pointer storing vector y.
+    @param[in]
+    incy      [rocblas_int]
+              specifies the increment for the elements of y.
+    @param[inout]
+    results
+              device array or host array of k elements to store the dot products.
+              return is 0.0 for each element if n <= 0.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_smulti_dot(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const float*   x,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 const float*   y,
+                                                 rocblas_int    incy,
+                                                 float*         results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dmulti_dot(rocblas_handle handle,
+                                                 rocblas_int    n,
+                                                 rocblas_int    k,
+                                                 const double*  x,
+                                                 rocblas_int    incx,
+                                                 rocblas_stride stridex,
+                                                 const double*  y,
+                                                 rocblas_int    incy,
+                                                 double*        results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cmulti_dot(rocblas_handle               handle,
+                                                 rocblas_int                  n,
+                                                 rocblas_int                  k,
+                                                 const rocblas_float_complex* x,
+                                                 rocblas_int                  incx,
+                                                 rocblas_stride               stridex,
+                                                 const rocblas_float_complex* y,
+                                                 rocblas_int                  incy,
+                                                 rocblas_float_complex*       results);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zmulti_dot(rocblas_handle                handle,
+                                                 rocblas_int                   n,
+                                                 rocblas_int                   k,
+                                                 const rocblas_double_complex* x,
+                                                 rocblas_int                   incx,
+                                                 rocblas_stride                stridex,
+                                                 const rocblas_double_complex* y,
+                                                 rocblas_int                   incy,
+                                                 rocblas_double_complex*       results);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    nrm2_scal   computes the euclidean norm of a real or complex vector x and scales x by its
+    reciprocal:
+
+        result := sqrt( x'*x ) for real vectors
+        result := sqrt( x**H*x ) for complex vectors
+        x      := x / result
+
+    x is left unchanged when result is zero. Vectors of up to 8192 elements are read and
+    written once.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    n         [rocblas_int]
+              the number of elements in x.
+    @param[inout]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[inout]
+    result
+              device pointer or host pointer to store the nrm2 product.
+              return is 0.0 if n, incx<=0.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_snrm2_scal(
+    rocblas_handle handle, rocblas_int n, float* x, rocblas_int incx, float* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dnrm2_scal(
+    rocblas_handle handle, rocblas_int n, double* x, rocblas_int incx, double* result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_scnrm2_scal(rocblas_handle         handle,
+                                                  rocblas_int            n,
+                                                  rocblas_float_complex* x,
+                                                  rocblas_int            incx,
+                                                  float*                 result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dznrm2_scal(rocblas_handle          handle,
+                                                  rocblas_int             n,
+                                                  rocblas_double_complex* x,
+                                                  rocblas_int             incx,
+                                                  double*                 result);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 1 API </b>
+
+    \details
+    scalar_op applies an elementary operation to scalars produced or consumed by other rocBLAS
+    calls:
+
+        result := op( a )       for op = copy, negate, reciprocal, sqrt or rsqrt
+        result := a op b        for op = multiply, divide or negate_divide
+
+    Scalars a, b, and result may be stored in either host or device memory, location is specified
+    by calling rocblas_set_pointer_mode. With rocblas_pointer_mode_device the operation runs on the
+    handle's stream without synchronizing with the host, so the result of a reduction such as dot
+    or nrm2 can be turned into the alpha or beta of a following axpy, scal or gemv call, also
+    inside hipGraph stream capture. For example, one step of the conjugate gradient method
+    computes -alpha = -rho / (p * Ap) with
+
+        rocblas_sdot(handle, n, p, 1, Ap, 1, d_pAp);
+        rocblas_sscalar_op(
+            handle, rocblas_scalar_operation_negate_divide, d_rho, d_pAp, d_neg_alpha);
+        rocblas_saxpy(handle, n, d_neg_alpha, Ap, 1, r, 1);
+
+    For complex types sqrt and rsqrt use the principal square root.
+
+    @param[in]
+    handle  [rocblas_handle]
+            handle to the rocblas library context queue.
+    @param[in]
+    op      [rocblas_scalar_operation]
+            the operation to apply.
+    @param[in]
+    a       pointer to the first operand a.
+    @param[in]
+    b       pointer to the second operand b. Only used for rocblas_scalar_operation_multiply,
+            rocblas_scalar_operation_divide and rocblas_scalar_operation_negate_divide, may be
+            nullptr otherwise.
+    @param[out]
+    result  pointer to the result. result may point to the same scalar as a or b.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sscalar_op(rocblas_handle           handle,
+                                                 rocblas_scalar_operation op,
+                                                 const float*             a,
+                                                 const float*             b,
+                                                 float*                   result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dscalar_op(rocblas_handle           handle,
+                                                 rocblas_scalar_operation op,
+                                                 const double*            a,
+                                                 const double*            b,
+                                                 double*                  result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cscalar_op(rocblas_handle               handle,
+                                                 rocblas_scalar_operation     op,
+                                                 const rocblas_float_complex* a,
+                                                 const rocblas_float_complex* b,
+                                                 rocblas_float_complex*       result);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zscalar_op(rocblas_handle                handle,
+                                                 rocblas_scalar_operation      op,
+                                                 const rocblas_double_complex* a,
+                                                 const rocblas_double_complex* b,
+                                                 rocblas_double_complex*       result);
+//! @}
+
 /*
  * ===========================================================================
  *    level 2 BLAS
@@ -8688,141 +9048,1021 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgerc_strided_batched(rocblas_handle
     \brief <b> BLAS Level 2 API </b>
 
     \details
-    spr performs the matrix-vector operations:
+    ger_k,geru_k,gerc_k apply k rank-1 updates to A in a single pass:
 
-        A := A + alpha*x*x**T
-        where alpha is a scalar, x is a vector, and A is an
-        n by n symmetric matrix, supplied in packed form.
+        A := A + alpha*x*y**T , OR
+        A := A + alpha*x*y**H for gerc_k
+        where alpha is a scalar, x is an m by k matrix, y is an n by k matrix and A is an
+        m by n matrix. The result equals k calls to ger, geru or gerc with the columns of
+        x and y, but A is read and written once instead of once per column.
+
+    These functions target small k, for example online covariance updates. For large k
+    gemm with beta = 1 is usually faster.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    uplo      [rocblas_fill]
-            specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-            - rocblas_fill_upper: The upper triangular part of A is supplied in AP.
-            - rocblas_fill_lower: The lower triangular part of A is supplied in AP.
+    m         [rocblas_int]
+              the number of rows of the matrix A and of the matrix x.
     @param[in]
     n         [rocblas_int]
-            the number of rows and columns of matrix A. Must be at least 0.
+              the number of columns of the matrix A and rows of the matrix y.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of x and y.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device pointer storing vector x.
+    x         device pointer storing matrix x, with column j holding the j-th vector.
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of x.
+    ldx       [rocblas_int]
+              specifies the leading dimension of x. ldx >= max(1, m).
+    @param[in]
+    y         device pointer storing matrix y, with column j holding the j-th vector.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of y. ldy >= max(1, n).
     @param[in, out]
-    AP        device pointer storing the packed version of the specified triangular portion of
-              the symmetric matrix A. Of at least size ((n * (n + 1)) / 2).
-
-                    if uplo == rocblas_fill_upper:
-                        The upper triangular portion of the symmetric matrix A is supplied.
-                        The matrix is compacted so that AP contains the triangular portion
-                        column-by-column
-                        so that:
-                        AP(0) = A(0,0)
-                        AP(1) = A(0,1)
-                        AP(2) = A(1,1), etc.
-                            Ex: (rocblas_fill_upper; n = 4)
-                                1 2 4 7
-                                2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                                4 5 6 9
-                                7 8 9 0
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. lda >= max(1, m).
 
-                    if uplo == rocblas_fill_lower:
-                        The lower triangular portion of the symmetric matrix A is supplied.
-                        The matrix is compacted so that AP contains the triangular portion
-                        column-by-column
-                        so that:
-                        AP(0) = A(0,0)
-                        AP(1) = A(1,0)
-                        AP(2) = A(2,1), etc.
-                            Ex: (rocblas_fill_lower; n = 4)
-                                1 2 3 4
-                                2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                                3 6 8 9
-                                4 7 9 0
     ********************************************************************/
-ROCBLAS_EXPORT rocblas_status rocblas_sspr(rocblas_handle handle,
-                                           rocblas_fill   uplo,
-                                           rocblas_int    n,
-                                           const float*   alpha,
-                                           const float*   x,
-                                           rocblas_int    incx,
-                                           float*         AP);
-
-ROCBLAS_EXPORT rocblas_status rocblas_dspr(rocblas_handle handle,
-                                           rocblas_fill   uplo,
-                                           rocblas_int    n,
-                                           const double*  alpha,
-                                           const double*  x,
-                                           rocblas_int    incx,
-                                           double*        AP);
-
-ROCBLAS_EXPORT rocblas_status rocblas_cspr(rocblas_handle               handle,
-                                           rocblas_fill                 uplo,
-                                           rocblas_int                  n,
-                                           const rocblas_float_complex* alpha,
-                                           const rocblas_float_complex* x,
-                                           rocblas_int                  incx,
-                                           rocblas_float_complex*       AP);
-
-ROCBLAS_EXPORT rocblas_status rocblas_zspr(rocblas_handle                handle,
-                                           rocblas_fill                  uplo,
-                                           rocblas_int                   n,
-                                           const rocblas_double_complex* alpha,
-                                           const rocblas_double_complex* x,
-                                           rocblas_int                   incx,
-                                           rocblas_double_complex*       AP);
+ROCBLAS_EXPORT rocblas_status rocblas_sger_k(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             rocblas_int    k,
+                                             const float*   alpha,
+                                             const float*   x,
+                                             rocblas_int    ldx,
+                                             const float*   y,
+                                             rocblas_int    ldy,
+                                             float*         A,
+                                             rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_k(rocblas_handle handle,
+                                             rocblas_int    m,
+                                             rocblas_int    n,
+                                             rocblas_int    k,
+                                             const double*  alpha,
+                                             const double*  x,
+                                             rocblas_int    ldx,
+                                             const double*  y,
+                                             rocblas_int    ldy,
+                                             double*        A,
+                                             rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgeru_k(rocblas_handle               handle,
+                                              rocblas_int                  m,
+                                              rocblas_int                  n,
+                                              rocblas_int                  k,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  ldx,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  ldy,
+                                              rocblas_float_complex*       A,
+                                              rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgeru_k(rocblas_handle                handle,
+                                              rocblas_int                   m,
+                                              rocblas_int                   n,
+                                              rocblas_int                   k,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   ldx,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   ldy,
+                                              rocblas_double_complex*       A,
+                                              rocblas_int                   lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgerc_k(rocblas_handle               handle,
+                                              rocblas_int                  m,
+                                              rocblas_int                  n,
+                                              rocblas_int                  k,
+                                              const rocblas_float_complex* alpha,
+                                              const rocblas_float_complex* x,
+                                              rocblas_int                  ldx,
+                                              const rocblas_float_complex* y,
+                                              rocblas_int                  ldy,
+                                              rocblas_float_complex*       A,
+                                              rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgerc_k(rocblas_handle                handle,
+                                              rocblas_int                   m,
+                                              rocblas_int                   n,
+                                              rocblas_int                   k,
+                                              const rocblas_double_complex* alpha,
+                                              const rocblas_double_complex* x,
+                                              rocblas_int                   ldx,
+                                              const rocblas_double_complex* y,
+                                              rocblas_int                   ldy,
+                                              rocblas_double_complex*       A,
+                                              rocblas_int                   lda);
 //! @}
 
 /*! @{
     \brief <b> BLAS Level 2 API </b>
 
     \details
-    spr_batched performs the matrix-vector operations:
+    ger_k_batched,geru_k_batched,gerc_k_batched apply k rank-1 updates to each A_i in a single pass:
 
-        A_i := A_i + alpha*x_i*x_i**T
-        where alpha is a scalar, x_i is a vector, and A_i is an
-        n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+        A_i := A_i + alpha*x_i*y_i**T, OR
+        A_i := A_i + alpha*x_i*y_i**H  for gerc_k_batched
+        where (A_i, x_i, y_i) is the i-th instance of the batch.
+        alpha is a scalar, x_i is an m by k matrix, y_i is an n by k matrix and A_i is an
+        m by n matrix, for i = 1, ..., batch_count.
 
     @param[in]
     handle    [rocblas_handle]
               handle to the rocblas library context queue.
     @param[in]
-    uplo      [rocblas_fill]
-            specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
-            - rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
-            - rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+    m         [rocblas_int]
+              the number of rows of each matrix A_i and x_i.
     @param[in]
     n         [rocblas_int]
-            the number of rows and columns of each matrix A_i. Must be at least 0.
+              the number of columns of each matrix A_i and rows of each y_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of each x_i and y_i.
     @param[in]
     alpha
               device pointer or host pointer to scalar alpha.
     @param[in]
-    x         device array of device pointers storing each vector x_i.
+    x         device array of device pointers storing each matrix x_i.
     @param[in]
-    incx      [rocblas_int]
-              specifies the increment for the elements of each x_i.
+    ldx       [rocblas_int]
+              specifies the leading dimension of each x_i. ldx >= max(1, m).
+    @param[in]
+    y         device array of device pointers storing each matrix y_i.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of each y_i. ldy >= max(1, n).
     @param[in, out]
-    AP        device array of device pointers storing the packed version of the specified triangular portion of
-              each symmetric matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batch_count.
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. lda >= max(1, m).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
 
-                    if uplo == rocblas_fill_upper:
-                        The upper triangular portion of each symmetric matrix A_i is supplied.
-                        The matrix is compacted so that AP contains the triangular portion
-                        column-by-column
-                        so that:
-                        AP(0) = A(0,0)
-                        AP(1) = A(0,1)
-                        AP(2) = A(1,1), etc.
-                            Ex: (rocblas_fill_upper; n = 4)
-                                1 2 4 7
-                                2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
-                                4 5 6 9
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sger_k_batched(rocblas_handle     handle,
+                                                     rocblas_int        m,
+                                                     rocblas_int        n,
+                                                     rocblas_int        k,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     rocblas_int        ldx,
+                                                     const float* const y[],
+                                                     rocblas_int        ldy,
+                                                     float* const       A[],
+                                                     rocblas_int        lda,
+                                                     rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_k_batched(rocblas_handle      handle,
+                                                     rocblas_int         m,
+                                                     rocblas_int         n,
+                                                     rocblas_int         k,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     rocblas_int         ldx,
+                                                     const double* const y[],
+                                                     rocblas_int         ldy,
+                                                     double* const       A[],
+                                                     rocblas_int         lda,
+                                                     rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgeru_k_batched(rocblas_handle                     handle,
+                                                      rocblas_int                        m,
+                                                      rocblas_int                        n,
+                                                      rocblas_int                        k,
+                                                      const rocblas_float_complex*       alpha,
+                                                      const rocblas_float_complex* const x[],
+                                                      rocblas_int                        ldx,
+                                                      const rocblas_float_complex* const y[],
+                                                      rocblas_int                        ldy,
+                                                      rocblas_float_complex* const       A[],
+                                                      rocblas_int                        lda,
+                                                      rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgeru_k_batched(rocblas_handle                      handle,
+                                                      rocblas_int                         m,
+                                                      rocblas_int                         n,
+                                                      rocblas_int                         k,
+                                                      const rocblas_double_complex*       alpha,
+                                                      const rocblas_double_complex* const x[],
+                                                      rocblas_int                         ldx,
+                                                      const rocblas_double_complex* const y[],
+                                                      rocblas_int                         ldy,
+                                                      rocblas_double_complex* const       A[],
+                                                      rocblas_int                         lda,
+                                                      rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgerc_k_batched(rocblas_handle                     handle,
+                                                      rocblas_int                        m,
+                                                      rocblas_int                        n,
+                                                      rocblas_int                        k,
+                                                      const rocblas_float_complex*       alpha,
+                                                      const rocblas_float_complex* const x[],
+                                                      rocblas_int                        ldx,
+                                                      const rocblas_float_complex* const y[],
+                                                      rocblas_int                        ldy,
+                                                      rocblas_float_complex* const       A[],
+                                                      rocblas_int                        lda,
+                                                      rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgerc_k_batched(rocblas_handle                      handle,
+                                                      rocblas_int                         m,
+                                                      rocblas_int                         n,
+                                                      rocblas_int                         k,
+                                                      const rocblas_double_complex*       alpha,
+                                                      const rocblas_double_complex* const x[],
+                                                      rocblas_int                         ldx,
+                                                      const rocblas_double_complex* const y[],
+                                                      rocblas_int                         ldy,
+                                                      rocblas_double_complex* const       A[],
+                                                      rocblas_int                         lda,
+                                                      rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    ger_k_strided_batched,geru_k_strided_batched,gerc_k_strided_batched apply k rank-1 updates
+    to each A_i in a single pass:
+
+        A_i := A_i + alpha*x_i*y_i**T, OR
+        A_i := A_i + alpha*x_i*y_i**H  for gerc_k_strided_batched
+        where (A_i, x_i, y_i) is the i-th instance of the batch.
+        alpha is a scalar, x_i is an m by k matrix, y_i is an n by k matrix and A_i is an
+        m by n matrix, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    m         [rocblas_int]
+              the number of rows of each matrix A_i and x_i.
+    @param[in]
+    n         [rocblas_int]
+              the number of columns of each matrix A_i and rows of each y_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of each x_i and y_i.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer to the first matrix (x_1) in the batch.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of each x_i. ldx >= max(1, m).
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one matrix (x_i) and the next one (x_i+1).
+    @param[in]
+    y         device pointer to the first matrix (y_1) in the batch.
+    @param[in]
+    ldy       [rocblas_int]
+              specifies the leading dimension of each y_i. ldy >= max(1, n).
+    @param[in]
+    stridey   [rocblas_stride]
+              stride from the start of one matrix (y_i) and the next one (y_i+1).
+    @param[in, out]
+    A         device pointer to the first matrix (A_1) in the batch.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. lda >= max(1, m).
+    @param[in]
+    strideA     [rocblas_stride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sger_k_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    m,
+                                                             rocblas_int    n,
+                                                             rocblas_int    k,
+                                                             const float*   alpha,
+                                                             const float*   x,
+                                                             rocblas_int    ldx,
+                                                             rocblas_stride stridex,
+                                                             const float*   y,
+                                                             rocblas_int    ldy,
+                                                             rocblas_stride stridey,
+                                                             float*         A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride strideA,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dger_k_strided_batched(rocblas_handle handle,
+                                                             rocblas_int    m,
+                                                             rocblas_int    n,
+                                                             rocblas_int    k,
+                                                             const double*  alpha,
+                                                             const double*  x,
+                                                             rocblas_int    ldx,
+                                                             rocblas_stride stridex,
+                                                             const double*  y,
+                                                             rocblas_int    ldy,
+                                                             rocblas_stride stridey,
+                                                             double*        A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride strideA,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgeru_k_strided_batched(rocblas_handle               handle,
+                                                              rocblas_int                  m,
+                                                              rocblas_int                  n,
+                                                              rocblas_int                  k,
+                                                              const rocblas_float_complex* alpha,
+                                                              const rocblas_float_complex* x,
+                                                              rocblas_int                  ldx,
+                                                              rocblas_stride               stridex,
+                                                              const rocblas_float_complex* y,
+                                                              rocblas_int                  ldy,
+                                                              rocblas_stride               stridey,
+                                                              rocblas_float_complex*       A,
+                                                              rocblas_int                  lda,
+                                                              rocblas_stride               strideA,
+                                                              rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgeru_k_strided_batched(rocblas_handle                handle,
+                                                              rocblas_int                   m,
+                                                              rocblas_int                   n,
+                                                              rocblas_int                   k,
+                                                              const rocblas_double_complex* alpha,
+                                                              const rocblas_double_complex* x,
+                                                              rocblas_int                   ldx,
+                                                              rocblas_stride                stridex,
+                                                              const rocblas_double_complex* y,
+                                                              rocblas_int                   ldy,
+                                                              rocblas_stride                stridey,
+                                                              rocblas_double_complex*       A,
+                                                              rocblas_int                   lda,
+                                                              rocblas_stride                strideA,
+                                                              rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgerc_k_strided_batched(rocblas_handle               handle,
+                                                              rocblas_int                  m,
+                                                              rocblas_int                  n,
+                                                              rocblas_int                  k,
+                                                              const rocblas_float_complex* alpha,
+                                                              const rocblas_float_complex* x,
+                                                              rocblas_int                  ldx,
+                                                              rocblas_stride               stridex,
+                                                              const rocblas_float_complex* y,
+                                                              rocblas_int                  ldy,
+                                                              rocblas_stride               stridey,
+                                                              rocblas_float_complex*       A,
+                                                              rocblas_int                  lda,
+                                                              rocblas_stride               strideA,
+                                                              rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgerc_k_strided_batched(rocblas_handle                handle,
+                                                              rocblas_int                   m,
+                                                              rocblas_int                   n,
+                                                              rocblas_int                   k,
+                                                              const rocblas_double_complex* alpha,
+                                                              const rocblas_double_complex* x,
+                                                              rocblas_int                   ldx,
+                                                              rocblas_stride                stridex,
+                                                              const rocblas_double_complex* y,
+                                                              rocblas_int                   ldy,
+                                                              rocblas_stride                stridey,
+                                                              rocblas_double_complex*       A,
+                                                              rocblas_int                   lda,
+                                                              rocblas_stride                strideA,
+                                                              rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    syr_k applies k rank-1 updates to A in a single pass:
+
+        A := A + alpha*x*x**T
+        where alpha is a scalar, x is an n by k matrix and A is an n by n symmetric matrix.
+        The result equals k calls to syr with the columns of x, but the referenced
+        triangle of A is read and written once instead of once per column.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              - rocblas_fill_upper: The upper triangular part of A is supplied in A.
+              - rocblas_fill_lower: The lower triangular part of A is supplied in A.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of x.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing matrix x, with column j holding the j-th vector.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of x. ldx >= max(1, n).
+    @param[in, out]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. lda >= max(1, n).
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_k(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             rocblas_int    k,
+                                             const float*   alpha,
+                                             const float*   x,
+                                             rocblas_int    ldx,
+                                             float*         A,
+                                             rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_k(rocblas_handle handle,
+                                             rocblas_fill   uplo,
+                                             rocblas_int    n,
+                                             rocblas_int    k,
+                                             const double*  alpha,
+                                             const double*  x,
+                                             rocblas_int    ldx,
+                                             double*        A,
+                                             rocblas_int    lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr_k(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             rocblas_int                  k,
+                                             const rocblas_float_complex* alpha,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  ldx,
+                                             rocblas_float_complex*       A,
+                                             rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr_k(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             rocblas_int                   k,
+                                             const rocblas_double_complex* alpha,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   ldx,
+                                             rocblas_double_complex*       A,
+                                             rocblas_int                   lda);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    syr_k_batched applies k rank-1 updates to each A_i in a single pass:
+
+        A_i := A_i + alpha*x_i*x_i**T
+        where (A_i, x_i) is the i-th instance of the batch.
+        alpha is a scalar, x_i is an n by k matrix and A_i is an n by n symmetric
+        matrix, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              - rocblas_fill_upper: The upper triangular part of A is supplied in A.
+              - rocblas_fill_lower: The lower triangular part of A is supplied in A.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of each x_i.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each matrix x_i.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of each x_i. ldx >= max(1, n).
+    @param[in, out]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. lda >= max(1, n).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_k_batched(rocblas_handle     handle,
+                                                     rocblas_fill       uplo,
+                                                     rocblas_int        n,
+                                                     rocblas_int        k,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     rocblas_int        ldx,
+                                                     float* const       A[],
+                                                     rocblas_int        lda,
+                                                     rocblas_int        batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_k_batched(rocblas_handle      handle,
+                                                     rocblas_fill        uplo,
+                                                     rocblas_int         n,
+                                                     rocblas_int         k,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     rocblas_int         ldx,
+                                                     double* const       A[],
+                                                     rocblas_int         lda,
+                                                     rocblas_int         batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr_k_batched(rocblas_handle                     handle,
+                                                     rocblas_fill                       uplo,
+                                                     rocblas_int                        n,
+                                                     rocblas_int                        k,
+                                                     const rocblas_float_complex*       alpha,
+                                                     const rocblas_float_complex* const x[],
+                                                     rocblas_int                        ldx,
+                                                     rocblas_float_complex* const       A[],
+                                                     rocblas_int                        lda,
+                                                     rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr_k_batched(rocblas_handle                      handle,
+                                                     rocblas_fill                        uplo,
+                                                     rocblas_int                         n,
+                                                     rocblas_int                         k,
+                                                     const rocblas_double_complex*       alpha,
+                                                     const rocblas_double_complex* const x[],
+                                                     rocblas_int                         ldx,
+                                                     rocblas_double_complex* const       A[],
+                                                     rocblas_int                         lda,
+                                                     rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    syr_k_strided_batched applies k rank-1 updates to each A_i in a single pass:
+
+        A_i := A_i + alpha*x_i*x_i**T
+        where (A_i, x_i) is the i-th instance of the batch.
+        alpha is a scalar, x_i is an n by k matrix and A_i is an n by n symmetric
+        matrix, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              - rocblas_fill_upper: The upper triangular part of A is supplied in A.
+              - rocblas_fill_lower: The lower triangular part of A is supplied in A.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of each x_i.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer to the first matrix (x_1) in the batch.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of each x_i. ldx >= max(1, n).
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one matrix (x_i) and the next one (x_i+1).
+    @param[in, out]
+    A         device pointer to the first matrix (A_1) in the batch.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. lda >= max(1, n).
+    @param[in]
+    strideA     [rocblas_stride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_ssyr_k_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             rocblas_int    k,
+                                                             const float*   alpha,
+                                                             const float*   x,
+                                                             rocblas_int    ldx,
+                                                             rocblas_stride stridex,
+                                                             float*         A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride strideA,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dsyr_k_strided_batched(rocblas_handle handle,
+                                                             rocblas_fill   uplo,
+                                                             rocblas_int    n,
+                                                             rocblas_int    k,
+                                                             const double*  alpha,
+                                                             const double*  x,
+                                                             rocblas_int    ldx,
+                                                             rocblas_stride stridex,
+                                                             double*        A,
+                                                             rocblas_int    lda,
+                                                             rocblas_stride strideA,
+                                                             rocblas_int    batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_csyr_k_strided_batched(rocblas_handle               handle,
+                                                             rocblas_fill                 uplo,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             const rocblas_float_complex* alpha,
+                                                             const rocblas_float_complex* x,
+                                                             rocblas_int                  ldx,
+                                                             rocblas_stride               stridex,
+                                                             rocblas_float_complex*       A,
+                                                             rocblas_int                  lda,
+                                                             rocblas_stride               strideA,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zsyr_k_strided_batched(rocblas_handle                handle,
+                                                             rocblas_fill                  uplo,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             const rocblas_double_complex* alpha,
+                                                             const rocblas_double_complex* x,
+                                                             rocblas_int                   ldx,
+                                                             rocblas_stride                stridex,
+                                                             rocblas_double_complex*       A,
+                                                             rocblas_int                   lda,
+                                                             rocblas_stride                strideA,
+                                                             rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    her_k applies k rank-1 updates to A in a single pass:
+
+        A := A + alpha*x*x**H
+        where alpha is a real scalar, x is an n by k matrix and A is an n by n Hermitian matrix.
+        The result equals k calls to her with the columns of x, but the referenced
+        triangle of A is read and written once instead of once per column.
+
+    The imaginary parts of the diagonal elements of A are set to zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              - rocblas_fill_upper: The upper triangular part of A is supplied in A.
+              - rocblas_fill_lower: The lower triangular part of A is supplied in A.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of matrix A.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of x.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing matrix x, with column j holding the j-th vector.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of x. ldx >= max(1, n).
+    @param[in, out]
+    A         device pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A. lda >= max(1, n).
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_cher_k(rocblas_handle               handle,
+                                             rocblas_fill                 uplo,
+                                             rocblas_int                  n,
+                                             rocblas_int                  k,
+                                             const float*                 alpha,
+                                             const rocblas_float_complex* x,
+                                             rocblas_int                  ldx,
+                                             rocblas_float_complex*       A,
+                                             rocblas_int                  lda);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher_k(rocblas_handle                handle,
+                                             rocblas_fill                  uplo,
+                                             rocblas_int                   n,
+                                             rocblas_int                   k,
+                                             const double*                 alpha,
+                                             const rocblas_double_complex* x,
+                                             rocblas_int                   ldx,
+                                             rocblas_double_complex*       A,
+                                             rocblas_int                   lda);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    her_k_batched applies k rank-1 updates to each A_i in a single pass:
+
+        A_i := A_i + alpha*x_i*x_i**H
+        where (A_i, x_i) is the i-th instance of the batch.
+        alpha is a real scalar, x_i is an n by k matrix and A_i is an n by n Hermitian
+        matrix, for i = 1, ..., batch_count.
+
+    The imaginary parts of the diagonal elements of each A_i are set to zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              - rocblas_fill_upper: The upper triangular part of A is supplied in A.
+              - rocblas_fill_lower: The lower triangular part of A is supplied in A.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of each x_i.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each matrix x_i.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of each x_i. ldx >= max(1, n).
+    @param[in, out]
+    A         device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. lda >= max(1, n).
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_cher_k_batched(rocblas_handle                     handle,
+                                                     rocblas_fill                       uplo,
+                                                     rocblas_int                        n,
+                                                     rocblas_int                        k,
+                                                     const float*                       alpha,
+                                                     const rocblas_float_complex* const x[],
+                                                     rocblas_int                        ldx,
+                                                     rocblas_float_complex* const       A[],
+                                                     rocblas_int                        lda,
+                                                     rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher_k_batched(rocblas_handle                      handle,
+                                                     rocblas_fill                        uplo,
+                                                     rocblas_int                         n,
+                                                     rocblas_int                         k,
+                                                     const double*                       alpha,
+                                                     const rocblas_double_complex* const x[],
+                                                     rocblas_int                         ldx,
+                                                     rocblas_double_complex* const       A[],
+                                                     rocblas_int                         lda,
+                                                     rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    her_k_strided_batched applies k rank-1 updates to each A_i in a single pass:
+
+        A_i := A_i + alpha*x_i*x_i**H
+        where (A_i, x_i) is the i-th instance of the batch.
+        alpha is a real scalar, x_i is an n by k matrix and A_i is an n by n Hermitian
+        matrix, for i = 1, ..., batch_count.
+
+    The imaginary parts of the diagonal elements of each A_i are set to zero.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+              specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+              - rocblas_fill_upper: The upper triangular part of A is supplied in A.
+              - rocblas_fill_lower: The lower triangular part of A is supplied in A.
+    @param[in]
+    n         [rocblas_int]
+              the number of rows and columns of each matrix A_i.
+    @param[in]
+    k         [rocblas_int]
+              the number of rank-1 updates, the number of columns of each x_i.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer to the first matrix (x_1) in the batch.
+    @param[in]
+    ldx       [rocblas_int]
+              specifies the leading dimension of each x_i. ldx >= max(1, n).
+    @param[in]
+    stridex   [rocblas_stride]
+              stride from the start of one matrix (x_i) and the next one (x_i+1).
+    @param[in, out]
+    A         device pointer to the first matrix (A_1) in the batch.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i. lda >= max(1, n).
+    @param[in]
+    strideA     [rocblas_stride]
+                stride from the start of one matrix (A_i) and the next one (A_i+1)
+    @param[in]
+    batch_count [rocblas_int]
+                number of instances in the batch.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_cher_k_strided_batched(rocblas_handle               handle,
+                                                             rocblas_fill                 uplo,
+                                                             rocblas_int                  n,
+                                                             rocblas_int                  k,
+                                                             const float*                 alpha,
+                                                             const rocblas_float_complex* x,
+                                                             rocblas_int                  ldx,
+                                                             rocblas_stride               stridex,
+                                                             rocblas_float_complex*       A,
+                                                             rocblas_int                  lda,
+                                                             rocblas_stride               strideA,
+                                                             rocblas_int batch_count);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zher_k_strided_batched(rocblas_handle                handle,
+                                                             rocblas_fill                  uplo,
+                                                             rocblas_int                   n,
+                                                             rocblas_int                   k,
+                                                             const double*                 alpha,
+                                                             const rocblas_double_complex* x,
+                                                             rocblas_int                   ldx,
+                                                             rocblas_stride                stridex,
+                                                             rocblas_double_complex*       A,
+                                                             rocblas_int                   lda,
+                                                             rocblas_stride                strideA,
+                                                             rocblas_int batch_count);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    spr performs the matrix-vector operations:
+
+        A := A + alpha*x*x**T
+        where alpha is a scalar, x is a vector, and A is an
+        n by n symmetric matrix, supplied in packed form.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+            specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+            - rocblas_fill_upper: The upper triangular part of A is supplied in AP.
+            - rocblas_fill_lower: The lower triangular part of A is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+            the number of rows and columns of matrix A. Must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device pointer storing vector x.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of x.
+    @param[in, out]
+    AP        device pointer storing the packed version of the specified triangular portion of
+              the symmetric matrix A. Of at least size ((n * (n + 1)) / 2).
+
+                    if uplo == rocblas_fill_upper:
+                        The upper triangular portion of the symmetric matrix A is supplied.
+                        The matrix is compacted so that AP contains the triangular portion
+                        column-by-column
+                        so that:
+                        AP(0) = A(0,0)
+                        AP(1) = A(0,1)
+                        AP(2) = A(1,1), etc.
+                            Ex: (rocblas_fill_upper; n = 4)
+                                1 2 4 7
+                                2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                                4 5 6 9
+                                7 8 9 0
+
+                    if uplo == rocblas_fill_lower:
+                        The lower triangular portion of the symmetric matrix A is supplied.
+                        The matrix is compacted so that AP contains the triangular portion
+                        column-by-column
+                        so that:
+                        AP(0) = A(0,0)
+                        AP(1) = A(1,0)
+                        AP(2) = A(2,1), etc.
+                            Ex: (rocblas_fill_lower; n = 4)
+                                1 2 3 4
+                                2 5 6 7    -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                                3 6 8 9
+                                4 7 9 0
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sspr(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const float*   alpha,
+                                           const float*   x,
+                                           rocblas_int    incx,
+                                           float*         AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dspr(rocblas_handle handle,
+                                           rocblas_fill   uplo,
+                                           rocblas_int    n,
+                                           const double*  alpha,
+                                           const double*  x,
+                                           rocblas_int    incx,
+                                           double*        AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cspr(rocblas_handle               handle,
+                                           rocblas_fill                 uplo,
+                                           rocblas_int                  n,
+                                           const rocblas_float_complex* alpha,
+                                           const rocblas_float_complex* x,
+                                           rocblas_int                  incx,
+                                           rocblas_float_complex*       AP);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zspr(rocblas_handle                handle,
+                                           rocblas_fill                  uplo,
+                                           rocblas_int                   n,
+                                           const rocblas_double_complex* alpha,
+                                           const rocblas_double_complex* x,
+                                           rocblas_int                   incx,
+                                           rocblas_double_complex*       AP);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 2 API </b>
+
+    \details
+    spr_batched performs the matrix-vector operations:
+
+        A_i := A_i + alpha*x_i*x_i**T
+        where alpha is a scalar, x_i is a vector, and A_i is an
+        n by n symmetric matrix, supplied in packed form, for i = 1, ..., batch_count.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    uplo      [rocblas_fill]
+            specifies whether the upper 'rocblas_fill_upper' or lower 'rocblas_fill_lower'
+            - rocblas_fill_upper: The upper triangular part of each A_i is supplied in AP.
+            - rocblas_fill_lower: The lower triangular part of each A_i is supplied in AP.
+    @param[in]
+    n         [rocblas_int]
+            the number of rows and columns of each matrix A_i. Must be at least 0.
+    @param[in]
+    alpha
+              device pointer or host pointer to scalar alpha.
+    @param[in]
+    x         device array of device pointers storing each vector x_i.
+    @param[in]
+    incx      [rocblas_int]
+              specifies the increment for the elements of each x_i.
+    @param[in, out]
+    AP        device array of device pointers storing the packed version of the specified triangular portion of
+              each symmetric matrix A_i of at least size ((n * (n + 1)) / 2). Array is of at least size batch_count.
+
+                    if uplo == rocblas_fill_upper:
+                        The upper triangular portion of each symmetric matrix A_i is supplied.
+                        The matrix is compacted so that AP contains the triangular portion
+                        column-by-column
+                        so that:
+                        AP(0) = A(0,0)
+                        AP(1) = A(0,1)
+                        AP(2) = A(1,1), etc.
+                            Ex: (rocblas_fill_upper; n = 4)
+                                1 2 4 7
+                                2 3 5 8   -----> [1, 2, 3, 4, 5, 6, 7, 8, 9, 0]
+                                4 5 6 9
                                 7 8 9 0
 
                     if uplo == rocblas_fill_lower:
@@ -14321,20 +15561,155 @@ ROCBLAS_EXPORT rocblas_status rocblas_cgemm(rocblas_handle               handle,
                                             rocblas_float_complex*       C,
                                             rocblas_int                  ldc);
 
-ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle                handle,
-                                            rocblas_operation             transA,
-                                            rocblas_operation             transB,
-                                            rocblas_int                   m,
-                                            rocblas_int                   n,
-                                            rocblas_int                   k,
-                                            const rocblas_double_complex* alpha,
-                                            const rocblas_double_complex* A,
-                                            rocblas_int                   lda,
-                                            const rocblas_double_complex* B,
-                                            rocblas_int                   ldb,
-                                            const rocblas_double_complex* beta,
-                                            rocblas_double_complex*       C,
-                                            rocblas_int                   ldc);
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm(rocblas_handle                handle,
+                                            rocblas_operation             transA,
+                                            rocblas_operation             transB,
+                                            rocblas_int                   m,
+                                            rocblas_int                   n,
+                                            rocblas_int                   k,
+                                            const rocblas_double_complex* alpha,
+                                            const rocblas_double_complex* A,
+                                            rocblas_int                   lda,
+                                            const rocblas_double_complex* B,
+                                            rocblas_int                   ldb,
+                                            const rocblas_double_complex* beta,
+                                            rocblas_double_complex*       C,
+                                            rocblas_int                   ldc);
+//! @}
+
+/*! @{
+    \brief <b> BLAS Level 3 API </b>
+
+    \details
+    gemm_xt performs the matrix-matrix operation
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    as gemm, with A, B and C in host memory, distributing the work over several handles.
+
+    C is split into block_dim by block_dim tiles, which are assigned to the handles
+    2D block-cyclically over the most square grid of num_handles handles. Each handle
+    receives the panels of op( A ) and op( B ) needed by its tiles, double buffered so that
+    host to device transfers overlap the gemm on the handle's stream. The function returns
+    once C has been copied back to the host. Transfers only overlap with computation when
+    A, B and C are in pinned host memory, for example allocated with hipHostMalloc().
+
+    Handles are typically created on different devices, but several handles may share a
+    device. Each handle uses 6 * block_dim * block_dim elements of device memory.
+
+    @param[in]
+    handles   [const rocblas_handle*]
+              host array of num_handles distinct handles.
+    @param[in]
+    num_handles [rocblas_int]
+              number of handles in handles.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              number or rows of matrices op( A ) and C.
+    @param[in]
+    n         [rocblas_int]
+              number of columns of matrices op( B ) and C.
+    @param[in]
+    k         [rocblas_int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B ).
+    @param[in]
+    alpha     host pointer specifying the scalar alpha.
+    @param[in]
+    A         host pointer storing matrix A.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         host pointer storing matrix B.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      host pointer specifying the scalar beta.
+    @param[in, out]
+    C         host pointer storing matrix C.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of C.
+    @param[in]
+    block_dim [rocblas_int]
+              size of the square tiles of C and of the panels of op( A ) and op( B ).
+              If 0, a default of 2048 is used.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_sgemm_xt(const rocblas_handle* handles,
+                                               rocblas_int           num_handles,
+                                               rocblas_operation     transA,
+                                               rocblas_operation     transB,
+                                               rocblas_int           m,
+                                               rocblas_int           n,
+                                               rocblas_int           k,
+                                               const float*          alpha,
+                                               const float*          A,
+                                               rocblas_int           lda,
+                                               const float*          B,
+                                               rocblas_int           ldb,
+                                               const float*          beta,
+                                               float*                C,
+                                               rocblas_int           ldc,
+                                               rocblas_int           block_dim);
+
+ROCBLAS_EXPORT rocblas_status rocblas_dgemm_xt(const rocblas_handle* handles,
+                                               rocblas_int           num_handles,
+                                               rocblas_operation     transA,
+                                               rocblas_operation     transB,
+                                               rocblas_int           m,
+                                               rocblas_int           n,
+                                               rocblas_int           k,
+                                               const double*         alpha,
+                                               const double*         A,
+                                               rocblas_int           lda,
+                                               const double*         B,
+                                               rocblas_int           ldb,
+                                               const double*         beta,
+                                               double*               C,
+                                               rocblas_int           ldc,
+                                               rocblas_int           block_dim);
+
+ROCBLAS_EXPORT rocblas_status rocblas_cgemm_xt(const rocblas_handle*        handles,
+                                               rocblas_int                  num_handles,
+                                               rocblas_operation            transA,
+                                               rocblas_operation            transB,
+                                               rocblas_int                  m,
+                                               rocblas_int                  n,
+                                               rocblas_int                  k,
+                                               const rocblas_float_complex* alpha,
+                                               const rocblas_float_complex* A,
+                                               rocblas_int                  lda,
+                                               const rocblas_float_complex* B,
+                                               rocblas_int                  ldb,
+                                               const rocblas_float_complex* beta,
+                                               rocblas_float_complex*       C,
+                                               rocblas_int                  ldc,
+                                               rocblas_int                  block_dim);
+
+ROCBLAS_EXPORT rocblas_status rocblas_zgemm_xt(const rocblas_handle*         handles,
+                                               rocblas_int                   num_handles,
+                                               rocblas_operation             transA,
+                                               rocblas_operation             transB,
+                                               rocblas_int                   m,
+                                               rocblas_int                   n,
+                                               rocblas_int                   k,
+                                               const rocblas_double_complex* alpha,
+                                               const rocblas_double_complex* A,
+                                               rocblas_int                   lda,
+                                               const rocblas_double_complex* B,
+                                               rocblas_int                   ldb,
+                                               const rocblas_double_complex* beta,
+                                               rocblas_double_complex*       C,
+                                               rocblas_int                   ldc,
+                                               rocblas_int                   block_dim);
 //! @}
 
 /*! @{
@@ -16387,6 +17762,15 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemmt_strided_batched(rocblas_handle
 
         Dij = min(alpha * (Aik + Bkj), beta * Cij)
         Dij = min(alpha * Aik, alpha * Bkj) + beta * Cij
+        Dij = max(alpha * (Aik + Bkj), beta * Cij)
+        Dij = min(max(alpha * Aik, alpha * Bkj), beta * Cij)
+        Dij = max(min(alpha * Aik, alpha * Bkj), beta * Cij)
+        Dij = (alpha * Aik && alpha * Bkj) || beta * Cij
+
+    where the outer min, max, + or || is also the reduction over k. These are matrix
+    products over the semirings (min, +), (+, min), (max, +), (min, max), (max, min)
+    and (||, &&), selected by geam_ex_op. For the boolean (||, &&) semiring any non-zero
+    value is true and D is set to 1 or 0.
 
     alpha and beta are scalars, and A, B, C, and D are matrices, with
     op( A ) an m by k matrix, op( B ) a k by n matrix and C and D are m by n matrices.
@@ -16475,7 +17859,10 @@ ROCBLAS_EXPORT rocblas_status rocblas_zgemmt_strided_batched(rocblas_handle
               specifies the datatype of computation.
     @param[in]
     geam_ex_op [rocblas_geam_ex_operation]
-              enumerant specifying the operation type, support for rocblas_geam_ex_operation_min_plus and rocblas_geam_ex_operation_plus_min.
+              enumerant specifying the operation type, support for
+              rocblas_geam_ex_operation_min_plus, rocblas_geam_ex_operation_plus_min,
+              rocblas_geam_ex_operation_max_plus, rocblas_geam_ex_operation_min_max,
+              rocblas_geam_ex_operation_max_min and rocblas_geam_ex_operation_or_and.
 
     ********************************************************************/
 ROCBLAS_EXPORT rocblas_status rocblas_geam_ex(rocblas_handle            handle,
@@ -16502,6 +17889,244 @@ ROCBLAS_EXPORT rocblas_status rocblas_geam_ex(rocblas_handle            handle,
                                               rocblas_geam_ex_operation geam_ex_op);
 //! @}
 
+/*! @{
+    \brief <b> BLAS EX API </b>
+
+    \details
+    geam_batched_ex performs one of the batched matrix-matrix operations of geam_ex:
+
+        Di,j = min(alpha * (Ai,k + Bk,j), beta * Ci,j)
+        Di,j = min(alpha * Ai,k, alpha * Bk,j) + beta * Ci,j
+        Di,j = max(alpha * (Ai,k + Bk,j), beta * Ci,j)
+        Di,j = min(max(alpha * Ai,k, alpha * Bk,j), beta * Ci,j)
+        Di,j = max(min(alpha * Ai,k, alpha * Bk,j), beta * Ci,j)
+        Di,j = (alpha * Ai,k && alpha * Bk,j) || beta * Ci,j
+
+    for each of the batch_count instances of op( A ), op( B ), C and D.
+    Supported types are the same as for geam_ex.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    A         [void *]
+              device array of device pointers storing each matrix A_i.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    B         [void *]
+              device array of device pointers storing each matrix B_i.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    C         [void *]
+              device array of device pointers storing each matrix C_i.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of each C_i, must have ldc >= max(1, m).
+    @param[out]
+    D         [void *]
+              device array of device pointers storing each matrix D_i.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of each D_i, must have ldd >= max(1, m).
+    @param[in]
+    batch_count
+              [rocblas_int]
+              number of gemm-like operations in the batch.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    geam_ex_op [rocblas_geam_ex_operation]
+              enumerant specifying the operation type.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_geam_batched_ex(rocblas_handle            handle,
+                                                      rocblas_operation         transA,
+                                                      rocblas_operation         transB,
+                                                      rocblas_int               m,
+                                                      rocblas_int               n,
+                                                      rocblas_int               k,
+                                                      const void*               alpha,
+                                                      const void*               A,
+                                                      rocblas_datatype          a_type,
+                                                      rocblas_int               lda,
+                                                      const void*               B,
+                                                      rocblas_datatype          b_type,
+                                                      rocblas_int               ldb,
+                                                      const void*               beta,
+                                                      const void*               C,
+                                                      rocblas_datatype          c_type,
+                                                      rocblas_int               ldc,
+                                                      void*                     D,
+                                                      rocblas_datatype          d_type,
+                                                      rocblas_int               ldd,
+                                                      rocblas_int               batch_count,
+                                                      rocblas_datatype          compute_type,
+                                                      rocblas_geam_ex_operation geam_ex_op);
+//! @}
+
+/*! @{
+    \brief <b> BLAS EX API </b>
+
+    \details
+    geam_strided_batched_ex performs one of the strided batched matrix-matrix operations of
+    geam_ex, see geam_batched_ex, on batch_count instances of op( A ), op( B ), C and D
+    separated by stride_a, stride_b, stride_c and stride_d elements.
+    Supported types are the same as for geam_ex.
+
+    @param[in]
+    handle    [rocblas_handle]
+              handle to the rocblas library context queue.
+    @param[in]
+    transA    [rocblas_operation]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [rocblas_operation]
+              specifies the form of op( B ).
+    @param[in]
+    m         [rocblas_int]
+              matrix dimension m.
+    @param[in]
+    n         [rocblas_int]
+              matrix dimension n.
+    @param[in]
+    k         [rocblas_int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as compute_type.
+    @param[in]
+    A         [void *]
+              device pointer pointing to the first matrix A_1.
+    @param[in]
+    a_type    [rocblas_datatype]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [rocblas_int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    stride_a  [rocblas_stride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    B         [void *]
+              device pointer pointing to the first matrix B_1.
+    @param[in]
+    b_type    [rocblas_datatype]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [rocblas_int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    stride_b  [rocblas_stride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as compute_type.
+    @param[in]
+    C         [void *]
+              device pointer pointing to the first matrix C_1.
+    @param[in]
+    c_type    [rocblas_datatype]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [rocblas_int]
+              specifies the leading dimension of each C_i, must have ldc >= max(1, m).
+    @param[in]
+    stride_c  [rocblas_stride]
+              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    @param[out]
+    D         [void *]
+              device pointer pointing to the first matrix D_1.
+    @param[in]
+    d_type    [rocblas_datatype]
+              specifies the datatype of each matrix D_i.
+    @param[in]
+    ldd       [rocblas_int]
+              specifies the leading dimension of each D_i, must have ldd >= max(1, m).
+    @param[in]
+    stride_d  [rocblas_stride]
+              specifies stride from start of one D_i matrix to the next D_(i + 1).
+    @param[in]
+    batch_count
+              [rocblas_int]
+              number of gemm-like operations in the batch.
+    @param[in]
+    compute_type
+              [rocblas_datatype]
+              specifies the datatype of computation.
+    @param[in]
+    geam_ex_op [rocblas_geam_ex_operation]
+              enumerant specifying the operation type.
+
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_geam_strided_batched_ex(rocblas_handle            handle,
+                                    rocblas_operation         transA,
+                                    rocblas_operation         transB,
+                                    rocblas_int               m,
+                                    rocblas_int               n,
+                                    rocblas_int               k,
+                                    const void*               alpha,
+                                    const void*               A,
+                                    rocblas_datatype          a_type,
+                                    rocblas_int               lda,
+                                    rocblas_stride            stride_a,
+                                    const void*               B,
+                                    rocblas_datatype          b_type,
+                                    rocblas_int               ldb,
+                                    rocblas_stride            stride_b,
+                                    const void*               beta,
+                                    const void*               C,
+                                    rocblas_datatype          c_type,
+                                    rocblas_int               ldc,
+                                    rocblas_stride            stride_c,
+                                    void*                     D,
+                                    rocblas_datatype          d_type,
+                                    rocblas_int               ldd,
+                                    rocblas_stride            stride_d,
+                                    rocblas_int               batch_count,
+                                    rocblas_datatype          compute_type,
+                                    rocblas_geam_ex_operation geam_ex_op);
+//! @}
+
 /*! @{
     \brief <b> BLAS EX API </b>
 
@@ -16682,6 +18307,96 @@ ROCBLAS_EXPORT rocblas_status rocblas_trsm_ex(rocblas_handle    handle,
                         compute_type)
 // clang-format on
 
+/*! @{
+    \brief <b> BLAS EX API </b>
+
+    \details
+    set_trsm_invA computes the inverses of the diagonal blocks of the triangular matrix A into
+    the user-owned buffer invA, in the layout described for rocblas_trsm_ex, and records a
+    fingerprint of A (its device pointer, k, lda, uplo, diag and compute_type) in the handle.
+
+    Subsequent rocblas_Xtrsm and rocblas_trsm_ex calls on the same handle that do not supply
+    their own invA, and whose A matches the fingerprint, reuse invA and skip the inversion of
+    the diagonal blocks of A. This is intended for solvers where A is fixed while B changes.
+
+    Only the pointer and shape of A are recorded. If the contents of A change, call
+    rocblas_set_trsm_invA again. invA must remain allocated until it is replaced by another call
+    to rocblas_set_trsm_invA, or released with rocblas_clear_trsm_invA.
+
+    @param[in]
+    handle  [rocblas_handle]
+            handle to the rocblas library context queue.
+
+    @param[in]
+    side    [rocblas_side]
+            side of the trsm calls that will reuse invA. It selects k = m when rocblas_side_left
+            and k = n when rocblas_side_right.
+
+    @param[in]
+    uplo    [rocblas_fill]
+            - rocblas_fill_upper:  A is an upper triangular matrix.
+            - rocblas_fill_lower:  A is a lower triangular matrix.
+
+    @param[in]
+    diag    [rocblas_diagonal]
+            - rocblas_diagonal_unit:     A is assumed to be unit triangular.
+            - rocblas_diagonal_non_unit:  A is not assumed to be unit triangular.
+
+    @param[in]
+    m       [rocblas_int]
+            m specifies the number of rows of B. m >= 0.
+
+    @param[in]
+    n       [rocblas_int]
+            n specifies the number of columns of B. n >= 0.
+
+    @param[in]
+    A       [void *]
+            device pointer storing matrix A of dimension ( lda, k ).
+
+    @param[in]
+    lda     [rocblas_int]
+            lda specifies the first dimension of A. lda >= k.
+
+    @param[out]
+    invA    [void *]
+            device pointer to the user-owned buffer receiving the inverse diagonal blocks of A.
+
+    @param[in]
+    invA_size [rocblas_int]
+            number of elements of device memory in invA. invA_size >= 128 * k.
+
+    @param[in]
+    compute_type [rocblas_datatype]
+            specifies the datatype of A and invA.
+
+    ********************************************************************/
+
+ROCBLAS_EXPORT rocblas_status rocblas_set_trsm_invA(rocblas_handle   handle,
+                                                    rocblas_side     side,
+                                                    rocblas_fill     uplo,
+                                                    rocblas_diagonal diag,
+                                                    rocblas_int      m,
+                                                    rocblas_int      n,
+                                                    const void*      A,
+                                                    rocblas_int      lda,
+                                                    void*            invA,
+                                                    rocblas_int      invA_size,
+                                                    rocblas_datatype compute_type);
+
+/*! \brief <b> BLAS EX API </b>
+
+    \details
+    clear_trsm_invA releases the invA registered in the handle with rocblas_set_trsm_invA.
+    trsm calls recompute the inverses of the diagonal blocks of A afterwards.
+
+    @param[in]
+    handle  [rocblas_handle]
+            handle to the rocblas library context queue.
+    ********************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_clear_trsm_invA(rocblas_handle handle);
+//! @}
+
 /*! @{
     \brief <b> BLAS EX API </b>
 
@@ -18301,6 +20016,46 @@ ROCBLAS_DEPRECATED_MSG("rocblas_is_user_managing_device_memory will be removed i
                        "and supported modes will be 'rocblas_managed' & 'user_owned'")
 ROCBLAS_EXPORT bool rocblas_is_user_managing_device_memory(rocblas_handle handle);
 
+/*! \brief
+    \details
+    Sets the release threshold of the device memory pool owned by the handle when stream order
+    allocation is enabled with ROCBLAS_STREAM_ORDER_ALLOC. Device memory freed back to the pool
+    is kept for reuse by later rocBLAS calls up to threshold bytes. Memory beyond the threshold is
+    released to the device when the handle's stream synchronizes.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_not_implemented if
+    the handle does not use stream order allocation; rocblas_status_success otherwise
+    @param[in]
+    handle          rocblas handle
+    @param[in]
+    threshold       release threshold in bytes
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status
+    rocblas_set_device_memory_pool_release_threshold(rocblas_handle handle, size_t threshold);
+
+/*! \brief
+    \details
+    Gets the statistics of the device memory pool owned by the handle when stream order allocation
+    is enabled with ROCBLAS_STREAM_ORDER_ALLOC.
+    Returns rocblas_status_invalid_handle if handle is nullptr; rocblas_status_invalid_pointer if
+    any output pointer is nullptr; rocblas_status_not_implemented if the handle does not use stream
+    order allocation; rocblas_status_success otherwise
+    @param[in]
+    handle           rocblas handle
+    @param[out]
+    used_current     bytes currently allocated from the pool by rocBLAS
+    @param[out]
+    used_high        high watermark of used_current
+    @param[out]
+    reserved_current bytes currently reserved by the pool from the device
+    @param[out]
+    reserved_high    high watermark of reserved_current
+ ******************************************************************************/
+ROCBLAS_EXPORT rocblas_status rocblas_get_device_memory_pool_stats(rocblas_handle handle,
+                                                                   size_t*        used_current,
+                                                                   size_t*        used_high,
+                                                                   size_t*        reserved_current,
+                                                                   size_t*        reserved_high);
+
 /*! \brief
     \details
     Abort function which safely flushes all IO
@@ -245,6 +245,20 @@ typedef enum rocblas_atomics_mode_
     rocblas_atomics_allowed = 1,
 } rocblas_atomics_mode;
 
+/*! \brief Indicates if reductions must give bitwise reproducible results. When enabled, the
+*    reductions in dot, nrm2, asum and gemv use a fixed summation order which depends only
+*    on the problem size, not on batch_count, stream, pointer mode, atomics mode or the
+*    device wavefront size. Defaults to rocblas_reproducibility_default.  */
+typedef enum rocblas_reproducibility_mode_
+{
+    /*! \brief Algorithms may select the summation order for performance */
+    rocblas_reproducibility_default = 0,
+    /*! \brief Reductions use a fixed order tree and never use atomics */
+    rocblas_reproducibility_bitwise = 1,
+    /*! \brief As rocblas_reproducibility_bitwise, with compensated per thread sums */
+    rocblas_reproducibility_bitwise_compensated = 2,
+} rocblas_reproducibility_mode;
+
 /*! \brief Indicates which performance metric Tensile uses when selecting the optimal
 *    solution for gemm problems.  */
 typedef enum rocblas_performance_metric_
@@ -283,8 +297,46 @@ typedef enum rocblas_geam_ex_operation_
 {
     rocblas_geam_ex_operation_min_plus = 0x0, // Cij = min(Aik + Bkj, Cij)
     rocblas_geam_ex_operation_plus_min = 0x1, // Cij = min(Aik, Bkj) + Cij
+    rocblas_geam_ex_operation_max_plus = 0x2, // Cij = max(Aik + Bkj, Cij)
+    rocblas_geam_ex_operation_min_max  = 0x3, // Cij = min(max(Aik, Bkj), Cij)
+    rocblas_geam_ex_operation_max_min  = 0x4, // Cij = max(min(Aik, Bkj), Cij)
+    rocblas_geam_ex_operation_or_and   = 0x5, // Cij = (Aik && Bkj) || Cij
 } rocblas_geam_ex_operation;
 
+/*! \brief Rounding used by rocblas_convert_host when narrowing to a smaller floating point type */
+typedef enum rocblas_rounding_mode_
+{
+    /*! \brief Round to nearest, ties to even. */
+    rocblas_rounding_mode_nearest_even = 0x0,
+    /*! \brief Stochastic rounding. Only applies to rocblas_f8 and rocblas_bf8 destinations, other
+     * destinations are rounded to nearest even. */
+    rocblas_rounding_mode_stochastic = 0x1,
+} rocblas_rounding_mode;
+
+/*! \brief How the scaling factors of an input of rocblas_gemm_ex3_scaled are laid out */
+typedef enum rocblas_gemm_scale_mode_
+{
+    /*! \brief The input is not scaled. */
+    rocblas_gemm_scale_mode_none = 0x0,
+    /*! \brief A single scaling factor for the whole matrix. */
+    rocblas_gemm_scale_mode_tensor = 0x1,
+    /*! \brief One scaling factor per row of op( A ), or per column of op( B ). */
+    rocblas_gemm_scale_mode_vector = 0x2,
+} rocblas_gemm_scale_mode;
+
+/*! \brief Operation applied by rocblas_Xscalar_op to scalars held in device or host memory */
+typedef enum rocblas_scalar_operation_
+{
+    rocblas_scalar_operation_copy          = 0x0, // result = a
+    rocblas_scalar_operation_negate        = 0x1, // result = -a
+    rocblas_scalar_operation_reciprocal    = 0x2, // result = 1 / a
+    rocblas_scalar_operation_sqrt          = 0x3, // result = sqrt(a)
+    rocblas_scalar_operation_rsqrt         = 0x4, // result = 1 / sqrt(a)
+    rocblas_scalar_operation_multiply      = 0x5, // result = a * b
+    rocblas_scalar_operation_divide        = 0x6, // result = a / b
+    rocblas_scalar_operation_negate_divide = 0x7, // result = -a / b
+} rocblas_scalar_operation;
+
 /*! \brief Control flags passed into gemm algorithms invoked by Tensile Host */
 typedef enum rocblas_gemm_flags_
 {
@@ -343,6 +395,30 @@ typedef enum rocblas_math_mode_
     //Enable acceleration of single precision routines using XF32 xDL.
     rocblas_xf32_xdl_math_op = 0x1,
 
+    //Use compensated summation in the reductions of dot, nrm2 and asum and their _ex forms.
+    rocblas_compensated_sum_math = 0x2,
+
+    //Solve double and double complex trsm and trsv in single precision and refine the solution
+    //with residuals computed in double precision. Synchronizes the stream unless it is capturing a
+    //graph, see rocblas_set_iterative_refinement.
+    rocblas_iterative_refinement_math = 0x3,
+
 } rocblas_math_mode;
 
+/*! \brief Event passed to a rocblas_api_range_callback */
+typedef enum rocblas_api_range_event_
+{
+    /*! \brief A rocBLAS function was entered */
+    rocblas_api_range_begin = 0,
+    /*! \brief The rocBLAS function entered last is returning */
+    rocblas_api_range_end = 1,
+} rocblas_api_range_event;
+
+/*! \brief Callback receiving the API ranges of a handle, see rocblas_set_api_range_callback.
+    name and args are only valid during the call. */
+typedef void (*rocblas_api_range_callback)(void*                   user_data,
+                                           rocblas_api_range_event event,
+                                           const char*             name,
+                                           const char*             args);
+
 #endif /* ROCBLAS_TYPES_H */
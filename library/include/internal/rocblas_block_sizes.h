@@ -31,10 +31,14 @@
 // L1 NB
 #define ROCBLAS_ASUM_NB 512
 #define ROCBLAS_AXPY_NB 256
+#define ROCBLAS_AXPY_DOT_NB 512
 #define ROCBLAS_COPY_NB 256
 #define ROCBLAS_DOT_NB 512
 #define ROCBLAS_IAMAX_NB 1024
+#define ROCBLAS_MULTI_AXPY_NB 256
+#define ROCBLAS_MULTI_DOT_NB 512
 #define ROCBLAS_NRM2_NB 512
+#define ROCBLAS_NRM2_SCAL_NB 512
 #define ROCBLAS_ROT_NB 512
 #define ROCBLAS_ROTM_NB 512
 #define ROCBLAS_SCAL_NB 256
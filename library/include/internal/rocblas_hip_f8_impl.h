@@ -152,8 +152,11 @@ namespace rocblas_hip_f8_impl
             mantissa += (1 << mfmt); //Add the implicit 1 into mantissa
         }
 
-        bool midpoint = (mantissa & ((1 << (mfmt - wm + exponent_diff)) - 1))
-                        == (1 << (mfmt - wm + exponent_diff - 1));
+        // Inputs far below the f8 denormal range shift out every mantissa bit, keep the shift
+        // counts below 32 so the result stays defined
+        const int drop_bits = mfmt - wm + exponent_diff;
+        bool      midpoint  = drop_bits < 32
+                        && (mantissa & ((1u << drop_bits) - 1)) == (1u << (drop_bits - 1));
         /* This part is a bit tricky. The judgment of whether it is a tie needs to be done before we shift right
      as shift right could rip off some residual part and make something not midpoint look like midpoint.
      For example, the fp16 number 0x1002 (0 00100 0000000010), it is larger than midpoint,
@@ -161,7 +164,7 @@ namespace rocblas_hip_f8_impl
   */
 
         if(exponent_diff > 0)
-            mantissa >>= exponent_diff;
+            mantissa = exponent_diff < 32 ? mantissa >> exponent_diff : 0;
         else if(exponent_diff == -1)
             mantissa <<= -exponent_diff;
         bool implicit_one = mantissa & (1 << mfmt);
@@ -107,6 +107,16 @@ module rocblas_enums
     enum, bind(c)
         enumerator :: rocblas_geam_ex_operation_min_plus = 0
         enumerator :: rocblas_geam_ex_operation_plus_min = 1
+        enumerator :: rocblas_geam_ex_operation_max_plus = 2
+        enumerator :: rocblas_geam_ex_operation_min_max = 3
+        enumerator :: rocblas_geam_ex_operation_max_min = 4
+        enumerator :: rocblas_geam_ex_operation_or_and = 5
+    end enum
+
+    enum, bind(c)
+        enumerator :: rocblas_gemm_scale_mode_none = 0
+        enumerator :: rocblas_gemm_scale_mode_tensor = 1
+        enumerator :: rocblas_gemm_scale_mode_vector = 2
     end enum
 
 end module rocblas_enums
@@ -13051,6 +13061,52 @@ module rocblas
         end function rocblas_gemm_ex3
     end interface
 
+    interface
+        function rocblas_gemm_ex3_scaled(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+                                         b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
+                                         compute_type, algo, solution_index, flags, &
+                                         scale_a, scale_a_mode, scale_b, scale_b_mode, &
+                                         scale_d, amax_d) &
+            bind(c, name='rocblas_gemm_ex3_scaled')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_gemm_ex3_scaled
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: a
+            integer(kind(rocblas_datatype_f16_r)), value :: a_type
+            integer(c_int), value :: lda
+            type(c_ptr), value :: b
+            integer(kind(rocblas_datatype_f16_r)), value :: b_type
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: c
+            integer(kind(rocblas_datatype_f16_r)), value :: c_type
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: d
+            integer(kind(rocblas_datatype_f16_r)), value :: d_type
+            integer(c_int), value :: ldd
+            integer(kind(rocblas_compute_type_f32)), value :: compute_type
+            integer(kind(rocblas_gemm_algo_standard)), value :: algo
+            integer(c_int32_t), value :: solution_index
+            ! No unsigned types in fortran. If larger values are needed
+            ! we will need a workaround.
+            integer(c_int32_t), value :: flags
+            type(c_ptr), value :: scale_a
+            integer(kind(rocblas_gemm_scale_mode_none)), value :: scale_a_mode
+            type(c_ptr), value :: scale_b
+            integer(kind(rocblas_gemm_scale_mode_none)), value :: scale_b_mode
+            type(c_ptr), value :: scale_d
+            type(c_ptr), value :: amax_d
+        end function rocblas_gemm_ex3_scaled
+    end interface
+
     interface
         function rocblas_gemm_batched_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
                                          b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
@@ -13168,6 +13224,81 @@ module rocblas
         end function rocblas_geam_ex
     end interface
 
+    interface
+        function rocblas_geam_batched_ex(handle, transA, transB, m, n, k, alpha, a, a_type, lda, &
+                                         b, b_type, ldb, beta, c, c_type, ldc, d, d_type, ldd, &
+                                         batch_count, compute_type, geam_ex_op) &
+            bind(c, name='rocblas_geam_batched_ex')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_geam_batched_ex
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: a
+            integer(kind(rocblas_datatype_f16_r)), value :: a_type
+            integer(c_int), value :: lda
+            type(c_ptr), value :: b
+            integer(kind(rocblas_datatype_f16_r)), value :: b_type
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: c
+            integer(kind(rocblas_datatype_f16_r)), value :: c_type
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: d
+            integer(kind(rocblas_datatype_f16_r)), value :: d_type
+            integer(c_int), value :: ldd
+            integer(c_int), value :: batch_count
+            integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+            integer(kind(rocblas_geam_ex_operation_plus_min)), value :: geam_ex_op
+        end function rocblas_geam_batched_ex
+    end interface
+
+    interface
+        function rocblas_geam_strided_batched_ex(handle, transA, transB, m, n, k, alpha, &
+                                                 a, a_type, lda, stride_a, b, b_type, ldb, stride_b, &
+                                                 beta, c, c_type, ldc, stride_c, d, d_type, ldd, stride_d, &
+                                                 batch_count, compute_type, geam_ex_op) &
+            bind(c, name='rocblas_geam_strided_batched_ex')
+            use iso_c_binding
+            use rocblas_enums
+            implicit none
+            integer(kind(rocblas_status_success)) :: rocblas_geam_strided_batched_ex
+            type(c_ptr), value :: handle
+            integer(kind(rocblas_operation_none)), value :: transA
+            integer(kind(rocblas_operation_none)), value :: transB
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            integer(c_int), value :: k
+            type(c_ptr), value :: alpha
+            type(c_ptr), value :: a
+            integer(kind(rocblas_datatype_f16_r)), value :: a_type
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: stride_a
+            type(c_ptr), value :: b
+            integer(kind(rocblas_datatype_f16_r)), value :: b_type
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: stride_b
+            type(c_ptr), value :: beta
+            type(c_ptr), value :: c
+            integer(kind(rocblas_datatype_f16_r)), value :: c_type
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: stride_c
+            type(c_ptr), value :: d
+            integer(kind(rocblas_datatype_f16_r)), value :: d_type
+            integer(c_int), value :: ldd
+            integer(c_int64_t), value :: stride_d
+            integer(c_int), value :: batch_count
+            integer(kind(rocblas_datatype_f16_r)), value :: compute_type
+            integer(kind(rocblas_geam_ex_operation_plus_min)), value :: geam_ex_op
+        end function rocblas_geam_strided_batched_ex
+    end interface
+
     ! trsm_ex
     interface
         function rocblas_trsm_ex(handle, side, uplo, transA, diag, m, n, alpha, A, lda, &
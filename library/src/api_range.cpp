@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "api_range.hpp"
+#include "handle.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <utility>
+
+#ifdef ROCBLAS_API_RANGES_ROCTX
+#include <roctracer/roctx.h>
+#endif
+
+/*******************************************************************************
+ * exported. Registers the API range callback of a handle                      *
+ *******************************************************************************/
+extern "C" rocblas_status rocblas_set_api_range_callback(rocblas_handle             handle,
+                                                         rocblas_api_range_callback callback,
+                                                         void*                      user_data)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+#ifdef ROCBLAS_API_RANGES
+    handle->api_range_callback  = callback;
+    handle->api_range_user_data = callback ? user_data : nullptr;
+    return rocblas_status_success;
+#else
+    return rocblas_status_not_implemented;
+#endif
+}
+
+#ifdef ROCBLAS_API_RANGES
+
+namespace
+{
+    // Ranges recorded by the per thread buffer sink, and the number of open ranges
+    thread_local std::vector<rocblas_api_range_record> t_api_ranges;
+    thread_local int                                   t_api_range_depth = 0;
+
+    double now_us()
+    {
+        return std::chrono::duration<double, std::micro>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+}
+
+uint32_t rocblas_api_range::env_sinks()
+{
+    static const uint32_t sinks = [] {
+        const char* env   = std::getenv("ROCBLAS_API_RANGES");
+        uint32_t    sinks = env ? uint32_t(strtoul(env, nullptr, 0)) : 0;
+        return sinks & (rocblas_api_range_sink_roctx | rocblas_api_range_sink_buffer);
+    }();
+    return sinks;
+}
+
+void rocblas_api_range::begin(const std::string& args)
+{
+#ifdef ROCBLAS_API_RANGES_ROCTX
+    if(m_sinks & rocblas_api_range_sink_roctx)
+        roctxRangePushA((std::string(m_name) + "(" + args + ")").c_str());
+#endif
+
+    if(m_sinks & rocblas_api_range_sink_buffer)
+        t_api_ranges.push_back({m_name, args, now_us(), 0, t_api_range_depth});
+    t_api_range_depth++;
+
+    if(m_sinks & rocblas_api_range_sink_callback)
+        m_callback(m_user_data, rocblas_api_range_begin, m_name, args.c_str());
+}
+
+void rocblas_api_range::end()
+{
+    if(m_sinks & rocblas_api_range_sink_callback)
+        m_callback(m_user_data, rocblas_api_range_end, m_name, "");
+
+    t_api_range_depth--;
+    if(m_sinks & rocblas_api_range_sink_buffer)
+    {
+        // the innermost open range of this thread is the last one recorded at this depth
+        for(auto it = t_api_ranges.rbegin(); it != t_api_ranges.rend(); ++it)
+            if(it->depth == t_api_range_depth && it->end_us == 0)
+            {
+                it->end_us = now_us();
+                break;
+            }
+    }
+
+#ifdef ROCBLAS_API_RANGES_ROCTX
+    if(m_sinks & rocblas_api_range_sink_roctx)
+        roctxRangePop();
+#endif
+}
+
+#endif
+
+/*******************************************************************************
+ * exported. Ranges recorded by the calling thread, when built with            *
+ * BUILD_WITH_API_RANGES                                                       *
+ *******************************************************************************/
+std::vector<rocblas_api_range_record> rocblas_internal_take_api_ranges()
+{
+    std::vector<rocblas_api_range_record> ranges;
+#ifdef ROCBLAS_API_RANGES
+    std::swap(ranges, t_api_ranges);
+#endif
+    return ranges;
+}
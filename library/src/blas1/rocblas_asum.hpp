@@ -70,6 +70,8 @@ rocblas_status rocblas_asum_template(rocblas_handle handle,
                                      const char*    name,
                                      const char*    name_bench)
 {
+    ROCBLAS_API_RANGE(handle, name, n, incx, stridex, batch_count);
+
     size_t         dev_bytes     = 0;
     rocblas_status checks_status = rocblas_reduction_setup<NB, ISBATCHED, Tw>(
         handle, n, x, incx, stridex, batch_count, results, name, name_bench, dev_bytes);
@@ -55,8 +55,11 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle, name, n, incx, incy);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+        ROCBLAS_HOST_TIMER_BEGIN(logging);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, name, n, LOG_TRACE_SCALAR_VALUE(handle, alpha), x, incx, y, incy);
 
@@ -77,11 +80,13 @@ namespace
 
         if(layer_mode & rocblas_layer_mode_log_profile)
             log_profile(handle, name, "N", n, "incx", incx, "incy", incy);
+        ROCBLAS_HOST_TIMER_END(logging);
 
         static constexpr rocblas_int    batch_count_1 = 1;
         static constexpr rocblas_stride stride_0      = 0;
         static constexpr rocblas_stride offset_0      = 0;
 
+        ROCBLAS_HOST_TIMER_BEGIN(arg_check);
         rocblas_status arg_status = rocblas_axpy_arg_check(handle,
                                                            n,
                                                            alpha,
@@ -94,6 +99,7 @@ namespace
                                                            incy,
                                                            stride_0,
                                                            batch_count_1);
+        ROCBLAS_HOST_TIMER_END(arg_check);
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_fused_blas1.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int NB = ROCBLAS_AXPY_DOT_NB;
+
+    template <typename>
+    constexpr char rocblas_axpy_dot_name[] = "unknown";
+    template <>
+    constexpr char rocblas_axpy_dot_name<float>[] = "rocblas_saxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<double>[] = "rocblas_daxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<rocblas_float_complex>[] = "rocblas_caxpy_dot";
+    template <>
+    constexpr char rocblas_axpy_dot_name<rocblas_double_complex>[] = "rocblas_zaxpy_dot";
+
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_check_numerics(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   const T*       x,
+                                                   rocblas_int    incx,
+                                                   const T*       y,
+                                                   rocblas_int    incy,
+                                                   const T*       z,
+                                                   rocblas_int    incz,
+                                                   const int      check_numerics,
+                                                   bool           is_input)
+    {
+        const T*    vectors[] = {x, y, z};
+        rocblas_int incs[]    = {incx, incy, incz};
+        for(int i = 0; i < 3; i++)
+        {
+            // x is not read when alpha is zero and may be null
+            if(!vectors[i])
+                continue;
+
+            rocblas_status check_numerics_status
+                = rocblas_internal_check_numerics_vector_template(rocblas_axpy_dot_name<T>,
+                                                                  handle,
+                                                                  n,
+                                                                  vectors[i],
+                                                                  0,
+                                                                  incs[i],
+                                                                  0,
+                                                                  1,
+                                                                  check_numerics,
+                                                                  is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return rocblas_status_success;
+    }
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_axpy_dot_impl(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         const T*       alpha,
+                                         const T*       x,
+                                         rocblas_int    incx,
+                                         T*             y,
+                                         rocblas_int    incy,
+                                         const T*       z,
+                                         rocblas_int    incz,
+                                         T*             result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_axpy_dot_workspace_size<NB, T>(n);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        ROCBLAS_API_RANGE(handle, rocblas_axpy_dot_name<T>, n, incx, incy, incz);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_axpy_dot_name<T>,
+                      n,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      incx,
+                      y,
+                      incy,
+                      z,
+                      incz);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f axpy_dot -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--incx",
+                      incx,
+                      "--incy",
+                      incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_axpy_dot_name<T>,
+                        "N",
+                        n,
+                        "incx",
+                        incx,
+                        "incy",
+                        incy,
+                        "incz",
+                        incz);
+
+        if(!result)
+            return rocblas_status_invalid_pointer;
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(result, 0, sizeof(*result), handle->get_stream()));
+            else
+                *result = T(0);
+            return rocblas_status_success;
+        }
+
+        if(!alpha || !y || !z)
+            return rocblas_status_invalid_pointer;
+
+        // x is only read when alpha is nonzero
+        if(!x
+           && (handle->pointer_mode == rocblas_pointer_mode_device || *alpha != T(0)))
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status check_numerics_status = rocblas_axpy_dot_check_numerics(
+                handle, n, x, incx, y, incy, z, incz, check_numerics, is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_axpy_dot_template<NB>(
+            handle, n, alpha, x, incx, y, incy, z, incz, result, (T*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status check_numerics_status = rocblas_axpy_dot_check_numerics(
+                handle, n, x, incx, y, incy, z, incz, check_numerics, is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                    \
+    rocblas_status name_(rocblas_handle handle,                                            \
+                         rocblas_int    n,                                                 \
+                         const T_*      alpha,                                             \
+                         const T_*      x,                                                 \
+                         rocblas_int    incx,                                              \
+                         T_*            y,                                                 \
+                         rocblas_int    incy,                                              \
+                         const T_*      z,                                                 \
+                         rocblas_int    incz,                                              \
+                         T_*            result)                                            \
+    try                                                                                    \
+    {                                                                                      \
+        return rocblas_axpy_dot_impl(handle, n, alpha, x, incx, y, incy, z, incz, result); \
+    }                                                                                      \
+    catch(...)                                                                             \
+    {                                                                                      \
+        return exception_to_rocblas_status();                                              \
+    }
+
+IMPL(rocblas_saxpy_dot, float);
+IMPL(rocblas_daxpy_dot, double);
+IMPL(rocblas_caxpy_dot, rocblas_float_complex);
+IMPL(rocblas_zaxpy_dot, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -62,6 +62,8 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle, name, n, incx, stridex, incy, stridey, batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
@@ -50,8 +50,11 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle, rocblas_copy_name<T>, n, incx, incy);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+        ROCBLAS_HOST_TIMER_BEGIN(logging);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_copy_name<T>, n, x, incx, y, incy);
 
@@ -68,11 +71,14 @@ namespace
 
         if(layer_mode & rocblas_layer_mode_log_profile)
             log_profile(handle, rocblas_copy_name<T>, "N", n, "incx", incx, "incy", incy);
+        ROCBLAS_HOST_TIMER_END(logging);
 
+        ROCBLAS_HOST_TIMER_BEGIN(arg_check);
         if(n <= 0)
             return rocblas_status_success;
         if(!x || !y)
             return rocblas_status_invalid_pointer;
+        ROCBLAS_HOST_TIMER_END(arg_check);
 
         if(check_numerics)
         {
@@ -75,8 +75,11 @@ namespace
                 return handle->set_optimal_device_memory_size(dev_bytes);
         }
 
+        ROCBLAS_API_RANGE(handle, rocblas_dot_name<CONJ, T>, n, incx, incy);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+        ROCBLAS_HOST_TIMER_BEGIN(logging);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_dot_name<CONJ, T>, n, x, incx, y, incy);
 
@@ -93,7 +96,9 @@ namespace
 
         if(layer_mode & rocblas_layer_mode_log_profile)
             log_profile(handle, rocblas_dot_name<CONJ, T>, "N", n, "incx", incx, "incy", incy);
+        ROCBLAS_HOST_TIMER_END(logging);
 
+        ROCBLAS_HOST_TIMER_BEGIN(arg_check);
         // Quick return if possible.
         if(n <= 0)
         {
@@ -109,6 +114,7 @@ namespace
 
         if(!x || !y || !result)
             return rocblas_status_invalid_pointer;
+        ROCBLAS_HOST_TIMER_END(arg_check);
 
         auto w_mem = handle->device_malloc(dev_bytes);
         if(!w_mem)
@@ -81,6 +81,8 @@ namespace
                 return handle->set_optimal_device_memory_size(dev_bytes);
         }
 
+        ROCBLAS_API_RANGE(handle, rocblas_dot_batched_name<CONJ, T>, n, incx, incy, batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
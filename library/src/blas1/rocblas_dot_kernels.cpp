@@ -274,6 +274,149 @@ rocblas_dot_kernel_reduce(rocblas_int n_sums, V* __restrict__ in, T* __restrict_
         out[blockIdx.y] = T(sum);
 }
 
+// Windowed kernels used for rocblas_reproducibility_mode and rocblas_compensated_sum_math. Each
+// block sums NB * WIN consecutive elements, so the partial sums depend only on n and not on incx,
+// batch_count or pointer mode. FIXED_ORDER also makes the block reductions independent of the
+// wavefront size, COMPENSATED accumulates the per thread sums with rocblas_two_sum_add.
+template <rocblas_int NB,
+          rocblas_int WIN,
+          bool        CONJ,
+          bool        FIXED_ORDER,
+          bool        COMPENSATED,
+          typename T,
+          typename U,
+          typename V>
+ROCBLAS_KERNEL(NB)
+rocblas_dot_kernel_window(rocblas_int n,
+                          const U __restrict__ xa,
+                          rocblas_stride shiftx,
+                          rocblas_int    incx,
+                          rocblas_stride stridex,
+                          const U __restrict__ ya,
+                          rocblas_stride shifty,
+                          rocblas_int    incy,
+                          rocblas_stride stridey,
+                          V* __restrict__ workspace,
+                          T* __restrict__ out)
+{
+    const T* x = load_ptr_batch(xa, blockIdx.y, shiftx, stridex);
+    const T* y = load_ptr_batch(ya, blockIdx.y, shifty, stridey);
+
+    int64_t i = int64_t(blockIdx.x) * NB * WIN + threadIdx.x;
+
+    V sum = 0;
+    V err = 0;
+
+    // sum WIN elements per thread
+    for(int j = 0; j < WIN && i < n; j++, i += NB)
+    {
+        V prod = V(y[i * incy]) * V(CONJ ? conj(x[i * incx]) : x[i * incx]);
+        if constexpr(COMPENSATED)
+            rocblas_two_sum_add(sum, err, prod);
+        else
+            sum += prod;
+    }
+    if constexpr(COMPENSATED)
+        sum += err;
+
+    sum = rocblas_block_reduce_sum<NB, FIXED_ORDER>(sum);
+
+    rocblas_dot_save_sum<false>(sum, workspace, out);
+}
+
+template <rocblas_int NB, bool FIXED_ORDER, bool COMPENSATED, typename V, typename T>
+ROCBLAS_KERNEL(NB)
+rocblas_dot_kernel_reduce_window(rocblas_int n_sums, V* __restrict__ in, T* __restrict__ out)
+{
+    V sum = 0;
+    V err = 0;
+
+    in += size_t(blockIdx.y) * n_sums;
+
+    for(int i = threadIdx.x; i < n_sums; i += NB)
+    {
+        if constexpr(COMPENSATED)
+            rocblas_two_sum_add(sum, err, in[i]);
+        else
+            sum += in[i];
+    }
+    if constexpr(COMPENSATED)
+        sum += err;
+
+    sum = rocblas_block_reduce_sum<NB, FIXED_ORDER>(sum);
+    if(threadIdx.x == 0)
+        out[blockIdx.y] = T(sum);
+}
+
+template <rocblas_int NB,
+          bool        CONJ,
+          bool        FIXED_ORDER,
+          bool        COMPENSATED,
+          typename T,
+          typename U,
+          typename V>
+rocblas_status rocblas_dot_window_template(rocblas_handle __restrict__ handle,
+                                           rocblas_int n,
+                                           const U __restrict__ x,
+                                           rocblas_stride shiftx,
+                                           rocblas_int    incx,
+                                           rocblas_stride stridex,
+                                           const U __restrict__ y,
+                                           rocblas_stride shifty,
+                                           rocblas_int    incy,
+                                           rocblas_stride stridey,
+                                           rocblas_int    batch_count,
+                                           T* __restrict__ results,
+                                           V* __restrict__ workspace)
+{
+    // same block count as the multi block path so the caller's workspace is large enough
+    static constexpr int WIN    = rocblas_dot_WIN<T>();
+    rocblas_int          blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+    dim3                 grid(blocks, batch_count);
+    dim3                 threads(NB);
+    size_t               offset = size_t(batch_count) * blocks;
+    T*                   output = results;
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        output = (T*)(workspace + offset);
+    }
+
+    hipLaunchKernelGGL((rocblas_dot_kernel_window<NB, WIN, CONJ, FIXED_ORDER, COMPENSATED, T>),
+                       grid,
+                       threads,
+                       0,
+                       handle->get_stream(),
+                       n,
+                       x,
+                       shiftx,
+                       incx,
+                       stridex,
+                       y,
+                       shifty,
+                       incy,
+                       stridey,
+                       workspace,
+                       output);
+
+    if(blocks > 1) // if single block first kernel did all work
+        hipLaunchKernelGGL((rocblas_dot_kernel_reduce_window<NB, FIXED_ORDER, COMPENSATED>),
+                           dim3(1, batch_count),
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           blocks,
+                           workspace,
+                           output);
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(
+            hipMemcpy(&results[0], output, sizeof(T) * batch_count, hipMemcpyDeviceToHost));
+    }
+
+    return rocblas_status_success;
+}
+
 // assume workspace has already been allocated, recommended for repeated calling of dot_strided_batched product
 // routine
 template <rocblas_int NB, bool CONJ, typename T, typename U, typename V>
@@ -323,6 +466,49 @@ rocblas_status rocblas_internal_dot_template(rocblas_handle __restrict__ handle,
     int64_t shiftx = incx < 0 ? offsetx - int64_t(incx) * (n - 1) : offsetx;
     int64_t shifty = incy < 0 ? offsety - int64_t(incy) * (n - 1) : offsety;
 
+    if(handle->reproducibility_mode == rocblas_reproducibility_bitwise)
+        return rocblas_dot_window_template<NB, CONJ, true, false>(handle,
+                                                                  n,
+                                                                  x,
+                                                                  shiftx,
+                                                                  incx,
+                                                                  stridex,
+                                                                  y,
+                                                                  shifty,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  results,
+                                                                  workspace);
+    else if(handle->reproducibility_mode == rocblas_reproducibility_bitwise_compensated)
+        return rocblas_dot_window_template<NB, CONJ, true, true>(handle,
+                                                                 n,
+                                                                 x,
+                                                                 shiftx,
+                                                                 incx,
+                                                                 stridex,
+                                                                 y,
+                                                                 shifty,
+                                                                 incy,
+                                                                 stridey,
+                                                                 batch_count,
+                                                                 results,
+                                                                 workspace);
+    else if(handle->math_mode == rocblas_compensated_sum_math)
+        return rocblas_dot_window_template<NB, CONJ, false, true>(handle,
+                                                                  n,
+                                                                  x,
+                                                                  shiftx,
+                                                                  incx,
+                                                                  stridex,
+                                                                  y,
+                                                                  shifty,
+                                                                  incy,
+                                                                  stridey,
+                                                                  batch_count,
+                                                                  results,
+                                                                  workspace);
+
     int single_block_threshold = 32768;
     if(std::is_same_v<T, float>)
         single_block_threshold = 31000;
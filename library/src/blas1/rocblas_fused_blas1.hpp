@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas.h"
+#include "rocblas_dot.hpp"
+#include "rocblas_reduction.hpp"
+
+// Fused level 1 operations for Krylov style solvers. Each fused call reads the shared vectors
+// once where the separate axpy, dot, nrm2 and scal calls would read them again.
+
+// number of vectors x_j a multi_dot thread block accumulates against one read of y
+constexpr rocblas_int rocblas_multi_dot_KB = 8;
+
+// largest grid y dimension of a launch, multi_dot launches larger k in chunks
+constexpr rocblas_int c_YZ_grid_launch_limit = 65535;
+
+template <rocblas_int NB, typename T>
+size_t rocblas_axpy_dot_workspace_size(rocblas_int n)
+{
+    return rocblas_reduction_kernel_workspace_size<NB * rocblas_dot_WIN<T>(), T>(n);
+}
+
+template <rocblas_int NB, typename T>
+size_t rocblas_multi_dot_workspace_size(rocblas_int n, rocblas_int k)
+{
+    return rocblas_reduction_kernel_workspace_size<NB * rocblas_dot_WIN<T>(), T>(n, k);
+}
+
+// host pointer mode alpha values are staged in device memory
+template <typename T>
+size_t rocblas_multi_axpy_workspace_size(rocblas_handle handle, rocblas_int k)
+{
+    return handle->pointer_mode == rocblas_pointer_mode_host && k > 0 ? sizeof(T) * k : 0;
+}
+
+template <rocblas_int NB, typename Ti, typename To>
+size_t rocblas_nrm2_scal_workspace_size(rocblas_int n)
+{
+    return rocblas_reduction_kernel_workspace_size<NB * rocblas_dot_WIN<Ti>(), To>(n);
+}
+
+/**
+ * @brief y := alpha * x + y followed by result := y^H * z on the updated y in one pass.
+ *        z may alias y with incz == incy. workspace holds rocblas_axpy_dot_workspace_size
+ *        elements.
+ */
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_internal_axpy_dot_template(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const T*       alpha,
+                                                  const T*       x,
+                                                  rocblas_int    incx,
+                                                  T*             y,
+                                                  rocblas_int    incy,
+                                                  const T*       z,
+                                                  rocblas_int    incz,
+                                                  T*             result,
+                                                  T*             workspace);
+
+/**
+ * @brief y := y + sum_j alpha[j] * x_j for the k vectors x_j = x + j * stridex.
+ *        alpha holds k values in host or device memory as set by the pointer mode.
+ */
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_internal_multi_axpy_template(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    rocblas_int    k,
+                                                    const T*       alpha,
+                                                    const T*       x,
+                                                    rocblas_int    incx,
+                                                    rocblas_stride stridex,
+                                                    T*             y,
+                                                    rocblas_int    incy,
+                                                    T*             workspace);
+
+/**
+ * @brief results[j] := x_j^H * y for the k vectors x_j = x + j * stridex, reading y once for
+ *        each group of rocblas_multi_dot_KB vectors.
+ */
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_internal_multi_dot_template(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   rocblas_int    k,
+                                                   const T*       x,
+                                                   rocblas_int    incx,
+                                                   rocblas_stride stridex,
+                                                   const T*       y,
+                                                   rocblas_int    incy,
+                                                   T*             results,
+                                                   T*             workspace);
+
+/**
+ * @brief result := ||x||_2 followed by x := x / result. x is left unchanged when the norm is
+ *        zero.
+ */
+template <rocblas_int NB, typename Ti, typename To>
+rocblas_status rocblas_internal_nrm2_scal_template(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   Ti*            x,
+                                                   rocblas_int    incx,
+                                                   To*            result,
+                                                   To*            workspace);
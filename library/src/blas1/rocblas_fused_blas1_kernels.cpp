@@ -0,0 +1,584 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "reduction.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_fused_blas1.hpp"
+#include "rocblas_nrm2.hpp"
+
+// Stores a block's partial sum of result j. A single block grid has the full sum and writes it
+// to out directly so the second pass is skipped.
+template <typename T>
+__forceinline__ __device__ void
+    rocblas_fused_save_sum(T sum, rocblas_int j, T* __restrict__ workspace, T* __restrict__ out)
+{
+    if(threadIdx.x == 0)
+    {
+        if(gridDim.x == 1)
+            out[j] = sum;
+        else
+            workspace[blockIdx.x + size_t(j) * gridDim.x] = sum;
+    }
+}
+
+// Second pass, block y sums the nblocks partial results of result y.
+template <rocblas_int NB, typename FINALIZE, typename To, typename Tr>
+ROCBLAS_KERNEL(NB)
+rocblas_fused_reduce_kernel(rocblas_int nblocks,
+                            const To* __restrict__ workspace,
+                            Tr* __restrict__ out)
+{
+    const To* work = workspace + size_t(blockIdx.y) * nblocks;
+
+    To sum = 0;
+    for(rocblas_int i = threadIdx.x; i < nblocks; i += NB)
+        sum += work[i];
+
+    sum = rocblas_dot_block_reduce<NB>(sum);
+
+    if(threadIdx.x == 0)
+        out[blockIdx.y] = Tr(FINALIZE{}(sum));
+}
+
+// y is not restrict qualified as z may alias it, in which case the updated y_i is used directly
+template <rocblas_int NB, rocblas_int WIN, typename T, typename Ta>
+ROCBLAS_KERNEL(NB)
+rocblas_axpy_dot_kernel(rocblas_int n,
+                        Ta          alpha_device_host,
+                        const T* __restrict__ x,
+                        rocblas_int incx,
+                        T*          y,
+                        rocblas_int incy,
+                        const T*    z,
+                        rocblas_int incz,
+                        bool        z_is_y,
+                        T* __restrict__ workspace,
+                        T* __restrict__ out)
+{
+    auto alpha = load_scalar(alpha_device_host);
+
+    int64_t i   = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+    int64_t inc = int64_t(blockDim.x) * gridDim.x;
+
+    T sum = 0;
+
+    // sum WIN elements per thread
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+    {
+        T yi = y[i * incy];
+        if(alpha)
+        {
+            yi += alpha * x[i * incx];
+            y[i * incy] = yi;
+        }
+        T zi = z_is_y ? yi : z[i * incz];
+        sum += conj(yi) * zi;
+    }
+
+    sum = rocblas_dot_block_reduce<NB>(sum);
+
+    rocblas_fused_save_sum(sum, 0, workspace, out);
+}
+
+template <rocblas_int NB, typename T>
+ROCBLAS_KERNEL(NB)
+rocblas_multi_axpy_kernel(rocblas_int n,
+                          rocblas_int k,
+                          const T* __restrict__ alpha,
+                          const T* __restrict__ x,
+                          rocblas_int    incx,
+                          rocblas_stride stridex,
+                          T* __restrict__ y,
+                          rocblas_int incy)
+{
+    int64_t i = blockIdx.x * int64_t(NB) + threadIdx.x;
+    if(i >= n)
+        return;
+
+    // y_i is read and written once for all k vectors
+    const T* xi  = x + i * incx;
+    T        sum = 0;
+    for(rocblas_int j = 0; j < k; j++)
+        sum += alpha[j] * xi[j * stridex];
+
+    y[i * incy] += sum;
+}
+
+template <rocblas_int NB, rocblas_int WIN, rocblas_int KB, typename T>
+ROCBLAS_KERNEL(NB)
+rocblas_multi_dot_kernel(rocblas_int n,
+                         rocblas_int k,
+                         const T* __restrict__ x,
+                         rocblas_int    incx,
+                         rocblas_stride stridex,
+                         const T* __restrict__ y,
+                         rocblas_int incy,
+                         T* __restrict__ workspace,
+                         T* __restrict__ out)
+{
+    // block y accumulates vectors j0 to j0 + kb - 1, kb is uniform over the block so the
+    // block reductions below are reached by every thread
+    rocblas_int j0 = blockIdx.y * KB;
+    rocblas_int kb = k - j0 < KB ? k - j0 : KB;
+
+    int64_t i   = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+    int64_t inc = int64_t(blockDim.x) * gridDim.x;
+
+    T sum[KB];
+#pragma unroll
+    for(int jj = 0; jj < KB; jj++)
+        sum[jj] = 0;
+
+    const T* xj0 = x + j0 * stridex;
+    for(int w = 0; w < WIN && i < n; w++, i += inc)
+    {
+        T        yi = y[i * incy];
+        const T* xi = xj0 + i * incx;
+#pragma unroll
+        for(int jj = 0; jj < KB; jj++)
+            if(jj < kb)
+                sum[jj] += conj(xi[jj * stridex]) * yi;
+    }
+
+#pragma unroll
+    for(int jj = 0; jj < KB; jj++)
+    {
+        if(jj < kb)
+        {
+            T s = rocblas_dot_block_reduce<NB>(sum[jj]);
+            rocblas_fused_save_sum(s, j0 + jj, workspace, out);
+        }
+    }
+}
+
+template <rocblas_int NB, rocblas_int WIN, typename To, typename Ti>
+ROCBLAS_KERNEL(NB)
+rocblas_nrm2_scal_kernel_part1(rocblas_int n,
+                               const Ti* __restrict__ x,
+                               rocblas_int incx,
+                               To* __restrict__ workspace)
+{
+    int64_t i   = blockIdx.x * int64_t(blockDim.x) + threadIdx.x;
+    int64_t inc = int64_t(blockDim.x) * gridDim.x;
+
+    To sum = 0;
+    for(int j = 0; j < WIN && i < n; j++, i += inc)
+        sum += rocblas_fetch_nrm2<To>{}(x[i * incx]);
+
+    sum = rocblas_dot_block_reduce<NB>(sum);
+
+    if(threadIdx.x == 0)
+        workspace[blockIdx.x] = sum;
+}
+
+template <rocblas_int NB, typename Ti, typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_nrm2_scal_kernel(rocblas_int n, Ti* __restrict__ x, rocblas_int incx, const To* norm)
+{
+    int64_t i   = blockIdx.x * int64_t(NB) + threadIdx.x;
+    To      nrm = *norm;
+    if(i >= n || nrm == 0)
+        return;
+
+    x[i * incx] *= To(1) / nrm;
+}
+
+// Small n, one block keeps x in registers between the reduction and the scaling so x is read
+// and written once.
+template <rocblas_int NB, rocblas_int WIN, typename Ti, typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_nrm2_scal_kernel_one_block(rocblas_int n,
+                                   Ti* __restrict__ x,
+                                   rocblas_int incx,
+                                   To* __restrict__ out)
+{
+    __shared__ To nrm_shared;
+
+    Ti xr[WIN];
+    To sum = 0;
+#pragma unroll
+    for(int j = 0; j < WIN; j++)
+    {
+        int64_t i = threadIdx.x + int64_t(j) * NB;
+        if(i < n)
+        {
+            xr[j] = x[i * incx];
+            sum += rocblas_fetch_nrm2<To>{}(xr[j]);
+        }
+    }
+
+    sum = rocblas_dot_block_reduce<NB>(sum);
+    if(threadIdx.x == 0)
+    {
+        nrm_shared = rocblas_finalize_nrm2{}(sum);
+        *out       = nrm_shared;
+    }
+    __syncthreads();
+
+    To nrm = nrm_shared;
+    if(nrm == 0)
+        return;
+
+    To inv = To(1) / nrm;
+#pragma unroll
+    for(int j = 0; j < WIN; j++)
+    {
+        int64_t i = threadIdx.x + int64_t(j) * NB;
+        if(i < n)
+            x[i * incx] = xr[j] * inv;
+    }
+}
+
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_internal_axpy_dot_template(rocblas_handle handle,
+                                                  rocblas_int    n,
+                                                  const T*       alpha,
+                                                  const T*       x,
+                                                  rocblas_int    incx,
+                                                  T*             y,
+                                                  rocblas_int    incy,
+                                                  const T*       z,
+                                                  rocblas_int    incz,
+                                                  T*             result,
+                                                  T*             workspace)
+{
+    static constexpr int WIN = rocblas_dot_WIN<T>();
+
+    // in case of negative inc shift pointer to end of data for negative indexing tid*inc
+    int64_t shiftx = incx < 0 ? -int64_t(incx) * (n - 1) : 0;
+    int64_t shifty = incy < 0 ? -int64_t(incy) * (n - 1) : 0;
+    int64_t shiftz = incz < 0 ? -int64_t(incz) * (n - 1) : 0;
+    bool    z_is_y = z == y && incz == incy;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+    dim3        grid(blocks);
+    dim3        threads(NB);
+    T* output = handle->pointer_mode == rocblas_pointer_mode_device ? result : workspace + blocks;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, WIN>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           alpha,
+                           x + shiftx,
+                           incx,
+                           y + shifty,
+                           incy,
+                           z + shiftz,
+                           incz,
+                           z_is_y,
+                           workspace,
+                           output);
+    else
+        hipLaunchKernelGGL((rocblas_axpy_dot_kernel<NB, WIN>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           *alpha,
+                           x + shiftx,
+                           incx,
+                           y + shifty,
+                           incy,
+                           z + shiftz,
+                           incz,
+                           z_is_y,
+                           workspace,
+                           output);
+
+    if(blocks > 1) // if single block first kernel did all work
+        hipLaunchKernelGGL((rocblas_fused_reduce_kernel<NB, rocblas_finalize_identity>),
+                           dim3(1, 1),
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           blocks,
+                           workspace,
+                           output);
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        // synchronous to match dot in host pointer mode
+        RETURN_IF_HIP_ERROR(hipMemcpy(result, output, sizeof(T), hipMemcpyDeviceToHost));
+    }
+
+    return rocblas_status_success;
+}
+
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_internal_multi_axpy_template(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    rocblas_int    k,
+                                                    const T*       alpha,
+                                                    const T*       x,
+                                                    rocblas_int    incx,
+                                                    rocblas_stride stridex,
+                                                    T*             y,
+                                                    rocblas_int    incy,
+                                                    T*             workspace)
+{
+    const T* d_alpha = alpha;
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        // alpha is pageable host memory so the copy is staged before hipMemcpyAsync returns
+        RETURN_IF_HIP_ERROR(hipMemcpyAsync(
+            workspace, alpha, sizeof(T) * k, hipMemcpyHostToDevice, handle->get_stream()));
+        d_alpha = workspace;
+    }
+
+    int64_t shiftx = incx < 0 ? -int64_t(incx) * (n - 1) : 0;
+    int64_t shifty = incy < 0 ? -int64_t(incy) * (n - 1) : 0;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
+    hipLaunchKernelGGL((rocblas_multi_axpy_kernel<NB>),
+                       dim3(blocks),
+                       dim3(NB),
+                       0,
+                       handle->get_stream(),
+                       n,
+                       k,
+                       d_alpha,
+                       x + shiftx,
+                       incx,
+                       stridex,
+                       y + shifty,
+                       incy);
+
+    return rocblas_status_success;
+}
+
+template <rocblas_int NB, typename T>
+rocblas_status rocblas_internal_multi_dot_template(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   rocblas_int    k,
+                                                   const T*       x,
+                                                   rocblas_int    incx,
+                                                   rocblas_stride stridex,
+                                                   const T*       y,
+                                                   rocblas_int    incy,
+                                                   T*             results,
+                                                   T*             workspace)
+{
+    static constexpr int WIN = rocblas_dot_WIN<T>();
+    static constexpr int KB  = rocblas_multi_dot_KB;
+
+    int64_t shiftx = incx < 0 ? -int64_t(incx) * (n - 1) : 0;
+    int64_t shifty = incy < 0 ? -int64_t(incy) * (n - 1) : 0;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+    dim3        threads(NB);
+    T*          output = handle->pointer_mode == rocblas_pointer_mode_device
+                             ? results
+                             : workspace + size_t(blocks) * k;
+
+    // block y covers KB vectors, so each launch covers up to KB * c_YZ_grid_launch_limit of them
+    constexpr rocblas_int k_chunk = KB * c_YZ_grid_launch_limit;
+    for(int64_t j = 0; j < k; j += k_chunk)
+    {
+        rocblas_int kc = k - j < k_chunk ? rocblas_int(k - j) : k_chunk;
+        dim3        grid(blocks, (kc - 1) / KB + 1);
+        hipLaunchKernelGGL((rocblas_multi_dot_kernel<NB, WIN, KB>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           n,
+                           kc,
+                           x + shiftx + j * stridex,
+                           incx,
+                           stridex,
+                           y + shifty,
+                           incy,
+                           workspace + size_t(blocks) * j,
+                           output + j);
+    }
+
+    if(blocks > 1)
+    {
+        for(int64_t j = 0; j < k; j += c_YZ_grid_launch_limit)
+        {
+            rocblas_int kc
+                = k - j < c_YZ_grid_launch_limit ? rocblas_int(k - j) : c_YZ_grid_launch_limit;
+            hipLaunchKernelGGL((rocblas_fused_reduce_kernel<NB, rocblas_finalize_identity>),
+                               dim3(1, kc),
+                               threads,
+                               0,
+                               handle->get_stream(),
+                               blocks,
+                               workspace + size_t(blocks) * j,
+                               output + j);
+        }
+    }
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        RETURN_IF_HIP_ERROR(hipMemcpy(results, output, sizeof(T) * k, hipMemcpyDeviceToHost));
+    }
+
+    return rocblas_status_success;
+}
+
+template <rocblas_int NB, typename Ti, typename To>
+rocblas_status rocblas_internal_nrm2_scal_template(rocblas_handle handle,
+                                                   rocblas_int    n,
+                                                   Ti*            x,
+                                                   rocblas_int    incx,
+                                                   To*            result,
+                                                   To*            workspace)
+{
+    static constexpr int WIN = rocblas_dot_WIN<Ti>();
+
+    // one block path holds WIN_OB elements per thread in registers
+    static constexpr int NB_OB  = 1024;
+    static constexpr int WIN_OB = 8;
+
+    rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB * WIN);
+
+    // the scaling kernel reads the norm from device memory in both pointer modes
+    To* nrm = handle->pointer_mode == rocblas_pointer_mode_device ? result : workspace + blocks;
+
+    if(n <= NB_OB * WIN_OB)
+    {
+        hipLaunchKernelGGL((rocblas_nrm2_scal_kernel_one_block<NB_OB, WIN_OB>),
+                           dim3(1),
+                           dim3(NB_OB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           x,
+                           incx,
+                           nrm);
+    }
+    else
+    {
+        hipLaunchKernelGGL((rocblas_nrm2_scal_kernel_part1<NB, WIN, To>),
+                           dim3(blocks),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           x,
+                           incx,
+                           workspace);
+
+        hipLaunchKernelGGL((rocblas_fused_reduce_kernel<NB, rocblas_finalize_nrm2>),
+                           dim3(1, 1),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           blocks,
+                           workspace,
+                           nrm);
+
+        hipLaunchKernelGGL((rocblas_nrm2_scal_kernel<NB>),
+                           dim3(rocblas_reduction_kernel_block_count(n, NB)),
+                           dim3(NB),
+                           0,
+                           handle->get_stream(),
+                           n,
+                           x,
+                           incx,
+                           (const To*)nrm);
+    }
+
+    if(handle->pointer_mode != rocblas_pointer_mode_device)
+    {
+        // synchronous to match nrm2 in host pointer mode
+        RETURN_IF_HIP_ERROR(hipMemcpy(result, nrm, sizeof(To), hipMemcpyDeviceToHost));
+    }
+
+    return rocblas_status_success;
+}
+
+// If there are any changes in template parameters in the files *axpy_dot*.cpp, *multi_axpy*.cpp,
+// *multi_dot*.cpp or *nrm2_scal*.cpp instantiations below will need to be manually updated to
+// match the changes.
+
+// clang-format off
+#ifdef INSTANTIATE_FUSED_BLAS1_TEMPLATE
+#error INSTANTIATE_FUSED_BLAS1_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_FUSED_BLAS1_TEMPLATE(T_)                                                                       \
+template rocblas_status rocblas_internal_axpy_dot_template<ROCBLAS_AXPY_DOT_NB, T_>(rocblas_handle handle,         \
+                                                                                    rocblas_int    n,              \
+                                                                                    const T_*      alpha,          \
+                                                                                    const T_*      x,              \
+                                                                                    rocblas_int    incx,           \
+                                                                                    T_*            y,              \
+                                                                                    rocblas_int    incy,           \
+                                                                                    const T_*      z,              \
+                                                                                    rocblas_int    incz,           \
+                                                                                    T_*            result,         \
+                                                                                    T_*            workspace);     \
+template rocblas_status rocblas_internal_multi_axpy_template<ROCBLAS_MULTI_AXPY_NB, T_>(rocblas_handle handle,     \
+                                                                                        rocblas_int    n,          \
+                                                                                        rocblas_int    k,          \
+                                                                                        const T_*      alpha,      \
+                                                                                        const T_*      x,          \
+                                                                                        rocblas_int    incx,       \
+                                                                                        rocblas_stride stridex,    \
+                                                                                        T_*            y,          \
+                                                                                        rocblas_int    incy,       \
+                                                                                        T_*            workspace); \
+template rocblas_status rocblas_internal_multi_dot_template<ROCBLAS_MULTI_DOT_NB, T_>(rocblas_handle handle,       \
+                                                                                      rocblas_int    n,            \
+                                                                                      rocblas_int    k,            \
+                                                                                      const T_*      x,            \
+                                                                                      rocblas_int    incx,         \
+                                                                                      rocblas_stride stridex,      \
+                                                                                      const T_*      y,            \
+                                                                                      rocblas_int    incy,         \
+                                                                                      T_*            results,      \
+                                                                                      T_*            workspace);
+
+INSTANTIATE_FUSED_BLAS1_TEMPLATE(float)
+INSTANTIATE_FUSED_BLAS1_TEMPLATE(double)
+INSTANTIATE_FUSED_BLAS1_TEMPLATE(rocblas_float_complex)
+INSTANTIATE_FUSED_BLAS1_TEMPLATE(rocblas_double_complex)
+
+#undef INSTANTIATE_FUSED_BLAS1_TEMPLATE
+
+#ifdef INSTANTIATE_NRM2_SCAL_TEMPLATE
+#error INSTANTIATE_NRM2_SCAL_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_NRM2_SCAL_TEMPLATE(Ti_, To_)                                                                       \
+template rocblas_status rocblas_internal_nrm2_scal_template<ROCBLAS_NRM2_SCAL_NB, Ti_, To_>(rocblas_handle handle,     \
+                                                                                            rocblas_int    n,          \
+                                                                                            Ti_*           x,          \
+                                                                                            rocblas_int    incx,       \
+                                                                                            To_*           result,     \
+                                                                                            To_*           workspace);
+
+INSTANTIATE_NRM2_SCAL_TEMPLATE(float, float)
+INSTANTIATE_NRM2_SCAL_TEMPLATE(double, double)
+INSTANTIATE_NRM2_SCAL_TEMPLATE(rocblas_float_complex, float)
+INSTANTIATE_NRM2_SCAL_TEMPLATE(rocblas_double_complex, double)
+
+#undef INSTANTIATE_NRM2_SCAL_TEMPLATE
+// clang-format on
@@ -54,6 +54,9 @@ namespace
         static constexpr rocblas_stride shiftx_0  = 0;
         static constexpr int            NB        = ROCBLAS_IAMAX_NB;
 
+        ROCBLAS_API_RANGE(
+            handle, rocblas_iamin_strided_batched_name<T>, n, incx, stridex, batch_count);
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, rocblas_index_value_t<S>>(
@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "check_numerics_vector.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_block_sizes.h"
+#include "rocblas_fused_blas1.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    constexpr int NB = ROCBLAS_MULTI_DOT_NB;
+
+    template <typename>
+    constexpr char rocblas_multi_dot_name[] = "unknown";
+    template <>
+    constexpr char rocblas_multi_dot_name<float>[] = "rocblas_smulti_dot";
+    template <>
+    constexpr char rocblas_multi_dot_name<double>[] = "rocblas_dmulti_dot";
+    template <>
+    constexpr char rocblas_multi_dot_name<rocblas_float_complex>[] = "rocblas_cmulti_dot";
+    template <>
+    constexpr char rocblas_multi_dot_name<rocblas_double_complex>[] = "rocblas_zmulti_dot";
+
+    template <typename T>
+    rocblas_status rocblas_multi_dot_check_numerics(rocblas_handle handle,
+                                                    rocblas_int    n,
+                                                    rocblas_int    k,
+                                                    const T*       x,
+                                                    rocblas_int    incx,
+                                                    rocblas_stride stridex,
+                                                    const T*       y,
+                                                    rocblas_int    incy,
+                                                    const int      check_numerics,
+                                                    bool           is_input)
+    {
+        // the k vectors x_j are checked as a strided batch
+        rocblas_status check_numerics_status
+            = rocblas_internal_check_numerics_vector_template(rocblas_multi_dot_name<T>,
+                                                              handle,
+                                                              n,
+                                                              x,
+                                                              0,
+                                                              incx,
+                                                              stridex,
+                                                              k,
+                                                              check_numerics,
+                                                              is_input);
+        if(check_numerics_status != rocblas_status_success)
+            return check_numerics_status;
+
+        return rocblas_internal_check_numerics_vector_template(rocblas_multi_dot_name<T>,
+                                                               handle,
+                                                               n,
+                                                               y,
+                                                               0,
+                                                               incy,
+                                                               0,
+                                                               1,
+                                                               check_numerics,
+                                                               is_input);
+    }
+
+    // allocate workspace inside this API
+    template <typename T>
+    rocblas_status rocblas_multi_dot_impl(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          rocblas_int    k,
+                                          const T*       x,
+                                          rocblas_int    incx,
+                                          rocblas_stride stridex,
+                                          const T*       y,
+                                          rocblas_int    incy,
+                                          T*             results)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        size_t dev_bytes = rocblas_multi_dot_workspace_size<NB, T>(n, k);
+        if(handle->is_device_memory_size_query())
+        {
+            if(n <= 0 || k <= 0)
+                return rocblas_status_size_unchanged;
+            else
+                return handle->set_optimal_device_memory_size(dev_bytes);
+        }
+
+        ROCBLAS_API_RANGE(handle, rocblas_multi_dot_name<T>, n, k, incx, stridex, incy);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, rocblas_multi_dot_name<T>, n, k, x, incx, stridex, y, incy, results);
+
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f multi_dot -r",
+                      rocblas_precision_string<T>,
+                      "-n",
+                      n,
+                      "-k",
+                      k,
+                      "--incx",
+                      incx,
+                      "--stride_x",
+                      stridex,
+                      "--incy",
+                      incy);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_multi_dot_name<T>,
+                        "N",
+                        n,
+                        "K",
+                        k,
+                        "incx",
+                        incx,
+                        "stride_x",
+                        stridex,
+                        "incy",
+                        incy);
+
+        if(k < 0)
+            return rocblas_status_invalid_size;
+
+        if(k == 0)
+            return rocblas_status_success;
+
+        if(!results)
+            return rocblas_status_invalid_pointer;
+
+        // Quick return if possible.
+        if(n <= 0)
+        {
+            if(rocblas_pointer_mode_device == handle->pointer_mode)
+                RETURN_IF_HIP_ERROR(
+                    hipMemsetAsync(results, 0, sizeof(T) * k, handle->get_stream()));
+            else
+                for(rocblas_int j = 0; j < k; j++)
+                    results[j] = T(0);
+            return rocblas_status_success;
+        }
+
+        if(!x || !y)
+            return rocblas_status_invalid_pointer;
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        if(check_numerics)
+        {
+            bool           is_input              = true;
+            rocblas_status check_numerics_status = rocblas_multi_dot_check_numerics(
+                handle, n, k, x, incx, stridex, y, incy, check_numerics, is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_multi_dot_template<NB>(
+            handle, n, k, x, incx, stridex, y, incy, results, (T*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input              = false;
+            rocblas_status check_numerics_status = rocblas_multi_dot_check_numerics(
+                handle, n, k, x, incx, stridex, y, incy, check_numerics, is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, T_)                                                                  \
+    rocblas_status name_(rocblas_handle handle,                                          \
+                         rocblas_int    n,                                               \
+                         rocblas_int    k,                                               \
+                         const T_*      x,                                               \
+                         rocblas_int    incx,                                            \
+                         rocblas_stride stridex,                                         \
+                         const T_*      y,                                               \
+                         rocblas_int    incy,                                            \
+                         T_*            results)                                         \
+    try                                                                                  \
+    {                                                                                    \
+        return rocblas_multi_dot_impl(handle, n, k, x, incx, stridex, y, incy, results); \
+    }                                                                                    \
+    catch(...)                                                                           \
+    {                                                                                    \
+        return exception_to_rocblas_status();                                            \
+    }
+
+IMPL(rocblas_smulti_dot, float);
+IMPL(rocblas_dmulti_dot, double);
+IMPL(rocblas_cmulti_dot, rocblas_float_complex);
+IMPL(rocblas_zmulti_dot, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -51,6 +51,8 @@ namespace
         static constexpr rocblas_int    batch_count_1 = 1;
         static constexpr rocblas_stride shiftx_0      = 0;
 
+        ROCBLAS_API_RANGE(handle, rocblas_nrm2_name<Ti>, n, incx);
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, To>(handle,
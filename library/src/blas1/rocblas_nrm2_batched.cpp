@@ -52,6 +52,8 @@ namespace
         static constexpr rocblas_stride shiftx_0  = 0;
         static constexpr rocblas_stride stridex_0 = 0;
 
+        ROCBLAS_API_RANGE(handle, rocblas_nrm2_batched_name<Ti>, n, incx, batch_count);
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, To>(handle,
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "check_numerics_vector.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_fused_blas1.hpp"
+#include "rocblas_reduction_setup.hpp"
+
+namespace
+{
+    constexpr int NB = ROCBLAS_NRM2_SCAL_NB;
+
+    template <typename>
+    constexpr char rocblas_nrm2_scal_name[] = "unknown";
+    template <>
+    constexpr char rocblas_nrm2_scal_name<float>[] = "rocblas_snrm2_scal";
+    template <>
+    constexpr char rocblas_nrm2_scal_name<double>[] = "rocblas_dnrm2_scal";
+    template <>
+    constexpr char rocblas_nrm2_scal_name<rocblas_float_complex>[] = "rocblas_scnrm2_scal";
+    template <>
+    constexpr char rocblas_nrm2_scal_name<rocblas_double_complex>[] = "rocblas_dznrm2_scal";
+
+    // allocate workspace inside this API
+    template <typename Ti, typename To>
+    rocblas_status rocblas_nrm2_scal_impl(
+        rocblas_handle handle, rocblas_int n, Ti* x, rocblas_int incx, To* result)
+    {
+        static constexpr bool           isbatched     = false;
+        static constexpr rocblas_stride stridex_0     = 0;
+        static constexpr rocblas_int    batch_count_1 = 1;
+
+        ROCBLAS_API_RANGE(handle, rocblas_nrm2_scal_name<Ti>, n, incx);
+
+        // the setup sizes the workspace for the NB * WIN elements each reduction block covers
+        size_t         dev_bytes = 0;
+        rocblas_status checks_status
+            = rocblas_reduction_setup<NB * rocblas_dot_WIN<Ti>(), isbatched, To>(
+                handle,
+                n,
+                x,
+                incx,
+                stridex_0,
+                batch_count_1,
+                result,
+                rocblas_nrm2_scal_name<Ti>,
+                "nrm2_scal",
+                dev_bytes);
+        if(checks_status != rocblas_status_continue)
+            return checks_status;
+
+        auto check_numerics = handle->check_numerics;
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status check_numerics_status
+                = rocblas_internal_check_numerics_vector_template(rocblas_nrm2_scal_name<Ti>,
+                                                                  handle,
+                                                                  n,
+                                                                  x,
+                                                                  0,
+                                                                  incx,
+                                                                  stridex_0,
+                                                                  batch_count_1,
+                                                                  check_numerics,
+                                                                  is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+
+        auto w_mem = handle->device_malloc(dev_bytes);
+        if(!w_mem)
+            return rocblas_status_memory_error;
+
+        rocblas_status status
+            = rocblas_internal_nrm2_scal_template<NB>(handle, n, x, incx, result, (To*)w_mem);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status check_numerics_status
+                = rocblas_internal_check_numerics_vector_template(rocblas_nrm2_scal_name<Ti>,
+                                                                  handle,
+                                                                  n,
+                                                                  x,
+                                                                  0,
+                                                                  incx,
+                                                                  stridex_0,
+                                                                  batch_count_1,
+                                                                  check_numerics,
+                                                                  is_input);
+            if(check_numerics_status != rocblas_status_success)
+                return check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(name_, Ti_, To_)                                                        \
+    rocblas_status name_(                                                            \
+        rocblas_handle handle, rocblas_int n, Ti_* x, rocblas_int incx, To_* result) \
+    try                                                                              \
+    {                                                                                \
+        return rocblas_nrm2_scal_impl(handle, n, x, incx, result);                   \
+    }                                                                                \
+    catch(...)                                                                       \
+    {                                                                                \
+        return exception_to_rocblas_status();                                        \
+    }
+
+IMPL(rocblas_snrm2_scal, float, float);
+IMPL(rocblas_dnrm2_scal, double, double);
+IMPL(rocblas_scnrm2_scal, rocblas_float_complex, float);
+IMPL(rocblas_dznrm2_scal, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
@@ -56,6 +56,9 @@ namespace
         static constexpr bool           isbatched = true;
         static constexpr rocblas_stride shiftx_0  = 0;
 
+        ROCBLAS_API_RANGE(
+            handle, rocblas_nrm2_strided_batched_name<Ti>, n, incx, stridex, batch_count);
+
         size_t         dev_bytes = 0;
         rocblas_status checks_status
             = rocblas_reduction_setup<NB, isbatched, To>(handle,
@@ -144,6 +144,65 @@ __inline__ __device__ T rocblas_dot_block_reduce(T val)
     return val;
 }
 
+// Width of the lane groups of rocblas_dot_block_reduce_fixed. It is independent of warpSize so
+// the summation tree is the same on wave32 and wave64 devices.
+constexpr int rocblas_fixed_reduce_width()
+{
+    return 32;
+}
+
+// Block sum reduction in a fixed order for rocblas_reproducibility_mode. Lane 0 of each group of
+// 32 threads only reads lanes of its own group in rocblas_wavefront_reduce<32>, also on wave64.
+template <rocblas_int NB, typename T>
+__inline__ __device__ T rocblas_dot_block_reduce_fixed(T val)
+{
+    constexpr rocblas_int WF = rocblas_fixed_reduce_width();
+    static_assert(NB % WF == 0 && NB <= WF * WF, "NB must be a multiple of 32 and at most 1024");
+
+    static constexpr rocblas_int num_groups = NB / WF;
+    __shared__ T                 psums[num_groups];
+
+    rocblas_int group = threadIdx.x / WF;
+    rocblas_int lane  = threadIdx.x % WF;
+
+    val = rocblas_wavefront_reduce<WF>(val); // sum over group
+    if(lane == 0)
+        psums[group] = val; // store sum for group
+
+    __syncthreads(); // Wait for all group reductions
+
+    if constexpr(num_groups > 1)
+    {
+        val = (threadIdx.x < num_groups) ? psums[threadIdx.x] : T(0);
+        if(group == 0)
+            val = rocblas_wavefront_reduce<num_groups>(val); // sum group sums
+    }
+
+    return val;
+}
+
+template <rocblas_int NB, bool FIXED_ORDER, typename T>
+__inline__ __device__ T rocblas_block_reduce_sum(T val)
+{
+    if constexpr(FIXED_ORDER)
+        return rocblas_dot_block_reduce_fixed<NB>(val);
+    else
+        return rocblas_dot_block_reduce<NB>(val);
+}
+
+// Compensated accumulation of val into sum. The exact rounding error of each addition is
+// recovered with the branch free TwoSum and accumulated in err, so unlike Kahan summation it
+// stays accurate when val is larger than sum. Operations are componentwise for complex T.
+// The final value is sum + err.
+template <typename T>
+__forceinline__ __device__ void rocblas_two_sum_add(T& sum, T& err, T val)
+{
+    T t  = sum + val;
+    T bp = t - sum;
+    err += (sum - (t - bp)) + (val - bp);
+    sum = t;
+}
+
 inline size_t rocblas_reduction_kernel_block_count(rocblas_int n, rocblas_int NB)
 {
     if(n <= 0)
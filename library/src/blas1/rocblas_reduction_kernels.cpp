@@ -72,8 +72,9 @@
 // yet. rocBLAS still use the classic standard parallel reduction right now.
 
 // kernel 1 writes partial results per thread block in workspace; number of partial results is
-// blocks
-template <rocblas_int NB, typename FETCH, typename TPtrX, typename To>
+// blocks. FIXED_ORDER selects a block reduction independent of the wavefront size for
+// rocblas_reproducibility_mode
+template <rocblas_int NB, bool FIXED_ORDER, typename FETCH, typename TPtrX, typename To>
 ROCBLAS_KERNEL(NB)
 rocblas_reduction_kernel_part1(rocblas_int    n,
                                rocblas_int    nblocks,
@@ -94,7 +95,7 @@ rocblas_reduction_kernel_part1(rocblas_int    n,
     else
         sum = rocblas_default_value<To>{}(); // pad with default value
 
-    sum = rocblas_dot_block_reduce<NB, To>(sum); // sum reduction only
+    sum = rocblas_block_reduce_sum<NB, FIXED_ORDER, To>(sum); // sum reduction only
 
     if(threadIdx.x == 0)
         workspace[blockIdx.y * nblocks + blockIdx.x] = sum;
@@ -102,8 +103,13 @@ rocblas_reduction_kernel_part1(rocblas_int    n,
 
 // kernel 2 is used from non-strided reduction_batched see include file
 // kernel 2 gathers all the partial results in workspace and finishes the final reduction;
-// number of threads (NB) loop blocks
-template <rocblas_int NB, typename FINALIZE, typename To, typename Tr>
+// number of threads (NB) loop blocks. COMPENSATED uses compensated summation for the loop
+template <rocblas_int NB,
+          bool        FIXED_ORDER,
+          bool        COMPENSATED,
+          typename FINALIZE,
+          typename To,
+          typename Tr>
 ROCBLAS_KERNEL(NB)
 rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
 {
@@ -116,15 +122,25 @@ rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
         sum      = work[tx];
 
         // bound, loop
-        for(rocblas_int i = tx + NB; i < nblocks; i += NB)
-            sum += work[i];
+        if constexpr(COMPENSATED)
+        {
+            To err = rocblas_default_value<To>{}();
+            for(rocblas_int i = tx + NB; i < nblocks; i += NB)
+                rocblas_two_sum_add(sum, err, work[i]);
+            sum += err;
+        }
+        else
+        {
+            for(rocblas_int i = tx + NB; i < nblocks; i += NB)
+                sum += work[i];
+        }
     }
     else
     { // pad with default value
         sum = rocblas_default_value<To>{}();
     }
 
-    sum = rocblas_dot_block_reduce<NB, To>(sum);
+    sum = rocblas_block_reduce_sum<NB, FIXED_ORDER, To>(sum);
 
     // Store result on device or in workspace
     if(tx == 0)
@@ -170,12 +186,14 @@ rocblas_reduction_kernel_part2(rocblas_int nblocks, To* workspace, Tr* result)
               return is 0.0 if n, incx<=0.
     ********************************************************************/
 template <rocblas_int NB,
+          bool        FIXED_ORDER,
+          bool        COMPENSATED,
           typename FETCH,
           typename FINALIZE,
           typename TPtrX,
           typename To,
           typename Tr>
-rocblas_status rocblas_reduction_template(rocblas_handle handle,
+rocblas_status rocblas_reduction_launcher(rocblas_handle handle,
                                           rocblas_int    n,
                                           TPtrX          x,
                                           rocblas_stride shiftx,
@@ -189,7 +207,7 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
 
     rocblas_int blocks = rocblas_reduction_kernel_block_count(n, NB);
 
-    hipLaunchKernelGGL((rocblas_reduction_kernel_part1<NB, FETCH>),
+    hipLaunchKernelGGL((rocblas_reduction_kernel_part1<NB, FIXED_ORDER, FETCH>),
                        dim3(blocks, batch_count),
                        NB,
                        0,
@@ -204,14 +222,15 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
 
     if(handle->pointer_mode == rocblas_pointer_mode_device)
     {
-        hipLaunchKernelGGL((rocblas_reduction_kernel_part2<NB, FINALIZE>),
-                           dim3(1, batch_count),
-                           NB,
-                           0,
-                           handle->get_stream(),
-                           blocks,
-                           workspace,
-                           result);
+        hipLaunchKernelGGL(
+            (rocblas_reduction_kernel_part2<NB, FIXED_ORDER, COMPENSATED, FINALIZE>),
+            dim3(1, batch_count),
+            NB,
+            0,
+            handle->get_stream(),
+            blocks,
+            workspace,
+            result);
     }
     else
     {
@@ -220,17 +239,20 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
         // it must be a standard layout type and its first member must be of type Tr.
         static_assert(std::is_standard_layout<To>{}, "To must be a standard layout type");
 
-        bool reduceKernel = blocks > 1 || batch_count > 1;
+        // the fixed order path always finalizes on the device so the result does not depend
+        // on batch_count
+        bool reduceKernel = FIXED_ORDER || blocks > 1 || batch_count > 1;
         if(reduceKernel)
         {
-            hipLaunchKernelGGL((rocblas_reduction_kernel_part2<NB, FINALIZE>),
-                               dim3(1, batch_count),
-                               NB,
-                               0,
-                               handle->get_stream(),
-                               blocks,
-                               workspace,
-                               (Tr*)(workspace + size_t(batch_count) * blocks));
+            hipLaunchKernelGGL(
+                (rocblas_reduction_kernel_part2<NB, FIXED_ORDER, COMPENSATED, FINALIZE>),
+                dim3(1, batch_count),
+                NB,
+                0,
+                handle->get_stream(),
+                blocks,
+                workspace,
+                (Tr*)(workspace + size_t(batch_count) * blocks));
         }
 
         if(std::is_same_v<FINALIZE, rocblas_finalize_identity> || reduceKernel)
@@ -256,6 +278,38 @@ rocblas_status rocblas_reduction_template(rocblas_handle handle,
     return rocblas_status_success;
 }
 
+template <rocblas_int NB,
+          typename FETCH,
+          typename FINALIZE,
+          typename TPtrX,
+          typename To,
+          typename Tr>
+rocblas_status rocblas_reduction_template(rocblas_handle handle,
+                                          rocblas_int    n,
+                                          TPtrX          x,
+                                          rocblas_stride shiftx,
+                                          rocblas_int    incx,
+                                          rocblas_stride stridex,
+                                          rocblas_int    batch_count,
+                                          To*            workspace,
+                                          Tr*            result)
+{
+    // the block geometry only depends on n, the fixed order kernels also make the block
+    // reductions independent of the wavefront size
+    if(handle->reproducibility_mode == rocblas_reproducibility_bitwise)
+        return rocblas_reduction_launcher<NB, true, false, FETCH, FINALIZE>(
+            handle, n, x, shiftx, incx, stridex, batch_count, workspace, result);
+    else if(handle->reproducibility_mode == rocblas_reproducibility_bitwise_compensated)
+        return rocblas_reduction_launcher<NB, true, true, FETCH, FINALIZE>(
+            handle, n, x, shiftx, incx, stridex, batch_count, workspace, result);
+    else if(handle->math_mode == rocblas_compensated_sum_math)
+        return rocblas_reduction_launcher<NB, false, true, FETCH, FINALIZE>(
+            handle, n, x, shiftx, incx, stridex, batch_count, workspace, result);
+    else
+        return rocblas_reduction_launcher<NB, false, false, FETCH, FINALIZE>(
+            handle, n, x, shiftx, incx, stridex, batch_count, workspace, result);
+}
+
 // clang-format off
 #ifdef INSTANTIATE_ROCBLAS_REDUCTION_TEMPLATE
 #error INSTANTIATE_ROCBLAS_REDUCTION_TEMPLATE IS ALREADY DEFINED
@@ -187,6 +187,7 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
         }
     }
 
+    ROCBLAS_HOST_TIMER_BEGIN(logging);
     auto layer_mode = handle->layer_mode;
     if(layer_mode & rocblas_layer_mode_log_trace)
     {
@@ -203,7 +204,9 @@ inline rocblas_status rocblas_reduction_setup(rocblas_handle handle,
     {
         rocblas_reduction_log_profile<ISBATCHED>(handle, n, x, incx, stridex, batch_count, name);
     }
+    ROCBLAS_HOST_TIMER_END(logging);
 
+    ROCBLAS_HOST_TIMER(arg_check);
     if(!results)
     {
         return rocblas_status_invalid_pointer;
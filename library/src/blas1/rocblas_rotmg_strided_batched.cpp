@@ -53,6 +53,15 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_rotmg_name<T>,
+                          stride_d1,
+                          stride_d2,
+                          stride_x1,
+                          stride_y1,
+                          stride_param,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
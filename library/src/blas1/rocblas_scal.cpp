@@ -53,9 +53,12 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle, rocblas_scal_name<T, U>, n, incx);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
+        ROCBLAS_HOST_TIMER_BEGIN(logging);
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(
                 handle, rocblas_scal_name<T, U>, n, LOG_TRACE_SCALAR_VALUE(handle, alpha), x, incx);
@@ -80,11 +83,14 @@ namespace
 
         if(layer_mode & rocblas_layer_mode_log_profile)
             log_profile(handle, rocblas_scal_name<T, U>, "N", n, "incx", incx);
+        ROCBLAS_HOST_TIMER_END(logging);
 
+        ROCBLAS_HOST_TIMER_BEGIN(arg_check);
         if(n <= 0 || incx <= 0)
             return rocblas_status_success;
         if(!x || !alpha)
             return rocblas_status_invalid_pointer;
+        ROCBLAS_HOST_TIMER_END(arg_check);
 
         if(handle->pointer_mode == rocblas_pointer_mode_host)
         {
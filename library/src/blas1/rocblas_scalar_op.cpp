@@ -0,0 +1,105 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocblas_scalar_op.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_scalar_op_name[] = "unknown";
+    template <>
+    constexpr char rocblas_scalar_op_name<float>[] = "rocblas_sscalar_op";
+    template <>
+    constexpr char rocblas_scalar_op_name<double>[] = "rocblas_dscalar_op";
+    template <>
+    constexpr char rocblas_scalar_op_name<rocblas_float_complex>[] = "rocblas_cscalar_op";
+    template <>
+    constexpr char rocblas_scalar_op_name<rocblas_double_complex>[] = "rocblas_zscalar_op";
+
+    template <typename T>
+    rocblas_status rocblas_scalar_op_impl(
+        rocblas_handle handle, rocblas_scalar_operation op, const T* a, const T* b, T* result)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        ROCBLAS_API_RANGE(handle, rocblas_scalar_op_name<T>, op);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle, rocblas_scalar_op_name<T>, op, a, b, result);
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle, "./rocblas-bench -f scalar_op -r", rocblas_precision_string<T>);
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle, rocblas_scalar_op_name<T>, "op", op);
+
+        if(!rocblas_scalar_op_is_valid(op))
+            return rocblas_status_invalid_value;
+
+        if(!a || !result || (rocblas_scalar_op_is_binary(op) && !b))
+            return rocblas_status_invalid_pointer;
+
+        return rocblas_scalar_op_template(handle, op, a, b, result);
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                   \
+    rocblas_status routine_name_(rocblas_handle           handle, \
+                                 rocblas_scalar_operation op,     \
+                                 const T_*                a,      \
+                                 const T_*                b,      \
+                                 T_*                      result) \
+    try                                                           \
+    {                                                             \
+        return rocblas_scalar_op_impl(handle, op, a, b, result);  \
+    }                                                             \
+    catch(...)                                                    \
+    {                                                             \
+        return exception_to_rocblas_status();                     \
+    }
+
+IMPL(rocblas_sscalar_op, float);
+IMPL(rocblas_dscalar_op, double);
+IMPL(rocblas_cscalar_op, rocblas_float_complex);
+IMPL(rocblas_zscalar_op, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
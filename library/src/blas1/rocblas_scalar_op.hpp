@@ -0,0 +1,41 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+/*! \brief true if the rocblas_scalar_operation reads its second operand b */
+constexpr bool rocblas_scalar_op_is_binary(rocblas_scalar_operation op)
+{
+    return op == rocblas_scalar_operation_multiply || op == rocblas_scalar_operation_divide
+           || op == rocblas_scalar_operation_negate_divide;
+}
+
+constexpr bool rocblas_scalar_op_is_valid(rocblas_scalar_operation op)
+{
+    return op >= rocblas_scalar_operation_copy && op <= rocblas_scalar_operation_negate_divide;
+}
+
+template <typename T>
+rocblas_status rocblas_scalar_op_template(
+    rocblas_handle handle, rocblas_scalar_operation op, const T* a, const T* b, T* result);
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "rocblas_scalar_op.hpp"
+#include "utility.hpp"
+
+// principal square root, branch cut along the negative real axis
+template <typename T, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+__device__ __host__ inline T rocblas_scalar_op_sqrt(T a)
+{
+    return sqrt(a);
+}
+
+template <typename T, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+__device__ __host__ inline T rocblas_scalar_op_sqrt(T a)
+{
+    using U = decltype(std::real(a));
+    U x     = std::real(a);
+    U y     = std::imag(a);
+    if(x == 0 && y == 0)
+        return T(0);
+
+    U t = sqrt((rocblas_abs(a) + rocblas_abs(x)) / 2);
+    if(x >= 0)
+        return T(t, y / (2 * t));
+    else
+        return T(rocblas_abs(y) / (2 * t), copysign(t, y));
+}
+
+template <typename T>
+__device__ __host__ inline T rocblas_scalar_op_calc(rocblas_scalar_operation op, T a, T b)
+{
+    switch(op)
+    {
+    case rocblas_scalar_operation_copy:
+        return a;
+    case rocblas_scalar_operation_negate:
+        return -a;
+    case rocblas_scalar_operation_reciprocal:
+        return T(1) / a;
+    case rocblas_scalar_operation_sqrt:
+        return rocblas_scalar_op_sqrt(a);
+    case rocblas_scalar_operation_rsqrt:
+        return T(1) / rocblas_scalar_op_sqrt(a);
+    case rocblas_scalar_operation_multiply:
+        return a * b;
+    case rocblas_scalar_operation_divide:
+        return a / b;
+    case rocblas_scalar_operation_negate_divide:
+        return -a / b;
+    }
+    return a;
+}
+
+template <typename T>
+ROCBLAS_KERNEL(1)
+rocblas_scalar_op_kernel(rocblas_scalar_operation op, const T* a, const T* b, T* result)
+{
+    // b is only dereferenced by binary operations and may be nullptr otherwise
+    *result = rocblas_scalar_op_calc(op, *a, rocblas_scalar_op_is_binary(op) ? *b : T(0));
+}
+
+template <typename T>
+rocblas_status rocblas_scalar_op_template(
+    rocblas_handle handle, rocblas_scalar_operation op, const T* a, const T* b, T* result)
+{
+    if(rocblas_pointer_mode_device == handle->pointer_mode)
+    {
+        // no host synchronization, so the result can be chained into a following call on the
+        // same stream, including under stream capture
+        hipLaunchKernelGGL(
+            rocblas_scalar_op_kernel<T>, 1, 1, 0, handle->get_stream(), op, a, b, result);
+    }
+    else
+    {
+        *result = rocblas_scalar_op_calc(op, *a, rocblas_scalar_op_is_binary(op) ? *b : T(0));
+    }
+
+    return rocblas_status_success;
+}
+
+#ifdef INSTANTIATE_SCALAR_OP_TEMPLATE
+#error INSTANTIATE_SCALAR_OP_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_SCALAR_OP_TEMPLATE(T_)                                                   \
+    template rocblas_status rocblas_scalar_op_template<T_>(rocblas_handle           handle,  \
+                                                           rocblas_scalar_operation op,      \
+                                                           const T_*                a,       \
+                                                           const T_*                b,       \
+                                                           T_*                      result);
+
+INSTANTIATE_SCALAR_OP_TEMPLATE(float)
+INSTANTIATE_SCALAR_OP_TEMPLATE(double)
+INSTANTIATE_SCALAR_OP_TEMPLATE(rocblas_float_complex)
+INSTANTIATE_SCALAR_OP_TEMPLATE(rocblas_double_complex)
+
+#undef INSTANTIATE_SCALAR_OP_TEMPLATE
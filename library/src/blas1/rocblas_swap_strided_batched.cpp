@@ -56,6 +56,15 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_swap_strided_batched_name<T>,
+                          n,
+                          incx,
+                          stridex,
+                          incy,
+                          stridey,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
@@ -680,7 +680,13 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_warp_reduce_kernel_calc(rocblas_int m,
     }
 }
 
-template <bool CONJ, rocblas_int NB_X, rocblas_int WIN, typename T_index, typename Ti, typename Tex>
+template <bool        CONJ,
+          rocblas_int NB_X,
+          rocblas_int WIN,
+          typename T_index,
+          bool        FIXED_ORDER,
+          typename Ti,
+          typename Tex>
 ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_kernel_calc(rocblas_int m,
                                                      rocblas_int n,
                                                      Tex         alpha,
@@ -753,7 +759,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_kernel_calc(rocblas_int m,
         }
 
         for(int k = 0; k < NC; k++)
-            sum[k] = rocblas_dot_block_reduce<NB_X>(sum[k]);
+            sum[k] = rocblas_block_reduce_sum<NB_X, FIXED_ORDER>(sum[k]);
 
         if(tx == 0)
         {
@@ -791,13 +797,13 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_kernel_calc(rocblas_int m,
                        * xvec[j];
             }
         }
-        sum[0] = rocblas_dot_block_reduce<NB_X>(sum[0]);
+        sum[0] = rocblas_block_reduce_sum<NB_X, FIXED_ORDER>(sum[0]);
         if(tx == 0)
             workspace[blockIdx.x + size_t(i) * gridDim.x] = alpha * sum[0];
     }
 }
 
-template <rocblas_int NB, rocblas_int WIN, typename Tex, typename To>
+template <rocblas_int NB, rocblas_int WIN, bool FIXED_ORDER, typename Tex, typename To>
 ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_reduce_calc(
     rocblas_int n_sums, Tex beta, To* __restrict__ y, rocblas_int incy, Tex* __restrict__ workspace)
 {
@@ -820,7 +826,7 @@ ROCBLAS_KERNEL_ILF void rocblas_gemvt_sn_reduce_calc(
     {
         sum += workspace[n_sums - 1 - threadIdx.x];
     }
-    sum = rocblas_dot_block_reduce<NB>(sum);
+    sum = rocblas_block_reduce_sum<NB, FIXED_ORDER>(sum);
 
     if(threadIdx.x == 0)
     {
@@ -1082,6 +1088,7 @@ template <bool        CONJ,
           rocblas_int NB_X,
           rocblas_int WIN,
           typename T_index,
+          bool        FIXED_ORDER,
           typename Ti,
           typename U,
           typename Tex>
@@ -1105,10 +1112,11 @@ rocblas_gemvt_sn_kernel(rocblas_int    m,
     const auto* A = cond_load_ptr_batch(alpha, Aa, blockIdx.y, shifta, strideA);
     const auto* x = cond_load_ptr_batch(alpha, xa, blockIdx.y, shiftx, stridex);
 
-    rocblas_gemvt_sn_kernel_calc<CONJ, NB_X, WIN, T_index>(m, n, alpha, A, lda, x, incx, workspace);
+    rocblas_gemvt_sn_kernel_calc<CONJ, NB_X, WIN, T_index, FIXED_ORDER>(
+        m, n, alpha, A, lda, x, incx, workspace);
 }
 
-template <rocblas_int NB, rocblas_int WIN, typename Tex, typename U, typename To>
+template <rocblas_int NB, rocblas_int WIN, bool FIXED_ORDER, typename Tex, typename U, typename To>
 ROCBLAS_KERNEL(NB)
 rocblas_gemvt_sn_reduce(rocblas_int    n_sums,
                         U              beta_device_host,
@@ -1122,7 +1130,7 @@ rocblas_gemvt_sn_reduce(rocblas_int    n_sums,
     auto* y    = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
     auto  beta = load_scalar(beta_device_host, blockIdx.z, stride_beta);
 
-    rocblas_gemvt_sn_reduce_calc<NB, WIN>(n_sums, beta, y, incy, workspace);
+    rocblas_gemvt_sn_reduce_calc<NB, WIN, FIXED_ORDER>(n_sums, beta, y, incy, workspace);
 }
 
 template <bool CONJ, rocblas_int NB_X, typename Ti, typename Tex, typename To>
@@ -1265,3 +1273,106 @@ rocblas_gemvn_sm_mn_batched_kernel(rocblas_int    m,
 
 #endif
 }
+
+// Small matrices with a large batch_count. Each team of DIM threads computes one gemv, several
+// teams share a wavefront, and one thread computes one element of y with x held in registers.
+// There is no shared memory or synchronization so teams finish independently.
+template <rocblas_int DIM, bool TRANS, bool CONJ, typename Tex, typename Ti, typename To>
+ROCBLAS_KERNEL_ILF void rocblas_gemv_small_batched_kernel_calc(rocblas_int tx,
+                                                               rocblas_int m,
+                                                               rocblas_int n,
+                                                               Tex         alpha,
+                                                               const Ti*   A,
+                                                               rocblas_int lda,
+                                                               const Ti*   x,
+                                                               rocblas_int incx,
+                                                               Tex         beta,
+                                                               To*         y,
+                                                               rocblas_int incy)
+{
+    // y has n elements for the transpose, the reduction is over the other dimension
+    const rocblas_int y_len = TRANS ? n : m;
+    const rocblas_int k_len = TRANS ? m : n;
+
+    if(tx >= y_len)
+        return;
+
+    Tex res = 0;
+    if(alpha)
+    {
+        Tex rx[DIM];
+
+#pragma unroll
+        for(int k = 0; k < DIM; k++)
+            rx[k] = k < k_len ? Tex(x[k * int64_t(incx)]) : Tex(0);
+
+#pragma unroll
+        for(int k = 0; k < DIM; k++)
+        {
+            if(k < k_len)
+            {
+                Tex a = TRANS ? Tex(A[k + tx * size_t(lda)]) : Tex(A[tx + k * size_t(lda)]);
+                res += (CONJ ? conj(a) : a) * rx[k];
+            }
+        }
+        res *= alpha;
+    }
+
+    if(beta)
+        res += beta * Tex(y[tx * int64_t(incy)]);
+
+    y[tx * int64_t(incy)] = To(res);
+}
+
+// Persistent grid: the grid is sized from the CU count and each team loops over the batch with a
+// grid stride, so the launch shape does not grow with batch_count.
+template <rocblas_int DIM,
+          rocblas_int NB,
+          bool        TRANS,
+          bool        CONJ,
+          typename Ti,
+          typename Tex,
+          typename To>
+ROCBLAS_KERNEL(NB)
+rocblas_gemv_small_batched_kernel(rocblas_int    m,
+                                  rocblas_int    n,
+                                  Tex            alpha_device_host,
+                                  rocblas_stride stride_alpha,
+                                  const Ti*      Aa,
+                                  rocblas_stride shifta,
+                                  rocblas_int    lda,
+                                  rocblas_stride strideA,
+                                  const Ti*      xa,
+                                  rocblas_stride shiftx,
+                                  rocblas_int    incx,
+                                  rocblas_stride stridex,
+                                  Tex            beta_device_host,
+                                  rocblas_stride stride_beta,
+                                  To*            ya,
+                                  rocblas_stride shifty,
+                                  rocblas_int    incy,
+                                  rocblas_stride stridey,
+                                  rocblas_int    batch_count)
+{
+    static constexpr rocblas_int TEAMS = NB / DIM;
+
+    const rocblas_int tx   = threadIdx.x % DIM;
+    const rocblas_int team = threadIdx.x / DIM;
+
+    for(uint32_t b = blockIdx.x * TEAMS + team; b < uint32_t(batch_count); b += gridDim.x * TEAMS)
+    {
+        auto alpha = load_scalar(alpha_device_host, b, stride_alpha);
+        auto beta  = load_scalar(beta_device_host, b, stride_beta);
+
+        if(!alpha && beta == 1)
+            continue;
+
+        const auto* A = cond_load_ptr_batch(alpha, Aa, b, shifta, strideA);
+        const auto* x = cond_load_ptr_batch(alpha, xa, b, shiftx, stridex);
+
+        auto* y = load_ptr_batch(ya, b, shifty, stridey);
+
+        rocblas_gemv_small_batched_kernel_calc<DIM, TRANS, CONJ>(
+            tx, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    }
+}
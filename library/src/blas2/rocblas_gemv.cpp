@@ -56,8 +56,11 @@ namespace
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
+        ROCBLAS_API_RANGE(handle, rocblas_gemv_name<T>, transA, m, n, lda, incx, incy);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+        ROCBLAS_HOST_TIMER_BEGIN(logging);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
               | rocblas_layer_mode_log_profile))
@@ -114,9 +117,12 @@ namespace
                             "incy",
                             incy);
         }
+        ROCBLAS_HOST_TIMER_END(logging);
 
+        ROCBLAS_HOST_TIMER_BEGIN(arg_check);
         rocblas_status arg_status = rocblas_internal_gemv_arg_check(
             handle, transA, m, n, alpha, 0, A, 0, lda, 0, x, 0, incx, 0, beta, 0, y, 0, incy, 0, 1);
+        ROCBLAS_HOST_TIMER_END(arg_check);
         if(arg_status != rocblas_status_continue)
             return arg_status;
 
@@ -114,6 +114,210 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE size_t rocblas_internal_gemv_kernel_workspace_s
     return sizeof(To) * blocks * n * batch_count;
 }
 
+// Skinny n transpose kernels, the partial sums of a column are written to workspace and reduced
+// by a second kernel. FIXED_ORDER selects block reductions independent of the wavefront size.
+template <bool CONJ, bool FIXED_ORDER, typename Ti, typename Tex, typename To>
+rocblas_status rocblas_gemvt_sn_template(rocblas_handle handle,
+                                         rocblas_int    m,
+                                         rocblas_int    n,
+                                         const Tex*     alpha,
+                                         rocblas_stride stride_alpha,
+                                         const Ti*      A,
+                                         rocblas_stride offseta,
+                                         rocblas_int    lda,
+                                         rocblas_stride strideA,
+                                         const Ti*      x,
+                                         rocblas_stride shiftx,
+                                         rocblas_int    incx,
+                                         rocblas_stride stridex,
+                                         const Tex*     beta,
+                                         rocblas_stride stride_beta,
+                                         To*            y,
+                                         rocblas_stride shifty,
+                                         rocblas_int    incy,
+                                         rocblas_stride stridey,
+                                         rocblas_int    batch_count,
+                                         Tex*           workspace,
+                                         bool           i64_indices)
+{
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    static constexpr int NB     = rocblas_gemvt_sn_NB();
+    static constexpr int WIN    = rocblas_gemvt_sn_WIN();
+    int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
+    dim3                 gemvt_grid(blocks, batch_count);
+    dim3                 gemvt_threads(NB);
+
+#define gemvt_sn_KARGS(alpha_)                                                                 \
+    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
+        strideA, x, shiftx, incx, stridex, (Tex*)workspace
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        if(!i64_indices)
+            hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, rocblas_int, FIXED_ORDER>),
+                               gemvt_sn_KARGS(alpha));
+        else
+            hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, int64_t, FIXED_ORDER>),
+                               gemvt_sn_KARGS(alpha));
+
+        hipLaunchKernelGGL((rocblas_gemvt_sn_reduce<NB, 8, FIXED_ORDER>),
+                           dim3(1, n, batch_count),
+                           gemvt_threads,
+                           0,
+                           rocblas_stream,
+                           blocks,
+                           beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           (Tex*)workspace);
+    }
+    else
+    {
+        if(!*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        if(!i64_indices)
+            hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, rocblas_int, FIXED_ORDER>),
+                               gemvt_sn_KARGS(*alpha));
+        else
+            hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, int64_t, FIXED_ORDER>),
+                               gemvt_sn_KARGS(*alpha));
+
+        hipLaunchKernelGGL((rocblas_gemvt_sn_reduce<NB, 8, FIXED_ORDER>),
+                           dim3(1, n, batch_count),
+                           gemvt_threads,
+                           0,
+                           rocblas_stream,
+                           blocks,
+                           *beta,
+                           stride_beta,
+                           y,
+                           shifty,
+                           incy,
+                           stridey,
+                           workspace);
+    }
+
+#undef gemvt_sn_KARGS
+    return rocblas_status_success;
+}
+
+// Team width of the small batched kernel from gemv_small_batched_crossover_table, or 0 when the
+// matrices are too large or the batch too small for it to be faster
+template <typename Tex>
+inline rocblas_int
+    rocblas_gemv_small_batched_dim(rocblas_int m, rocblas_int n, rocblas_int batch_count)
+{
+    rocblas_int mn = std::max(m, n);
+    for(const auto& entry : gemv_small_batched_crossover_table)
+    {
+        if(entry.dim * sizeof(Tex) > gemv_small_batched_max_x_bytes)
+            break;
+        if(mn <= entry.dim)
+            return batch_count >= entry.min_batch_count ? entry.dim : 0;
+    }
+    return 0;
+}
+
+template <rocblas_int DIM, bool TRANS, bool CONJ, typename Ti, typename Tex, typename To>
+rocblas_status rocblas_gemv_small_batched_launcher(rocblas_handle handle,
+                                                   rocblas_int    m,
+                                                   rocblas_int    n,
+                                                   const Tex*     alpha,
+                                                   rocblas_stride stride_alpha,
+                                                   const Ti*      A,
+                                                   rocblas_stride offseta,
+                                                   rocblas_int    lda,
+                                                   rocblas_stride strideA,
+                                                   const Ti*      x,
+                                                   rocblas_stride shiftx,
+                                                   rocblas_int    incx,
+                                                   rocblas_stride stridex,
+                                                   const Tex*     beta,
+                                                   rocblas_stride stride_beta,
+                                                   To*            y,
+                                                   rocblas_stride shifty,
+                                                   rocblas_int    incy,
+                                                   rocblas_stride stridey,
+                                                   rocblas_int    batch_count)
+{
+    static constexpr int NB    = 256;
+    static constexpr int TEAMS = NB / DIM;
+
+    // enough blocks to fill the device, the teams then loop over the rest of the batch
+    int64_t max_blocks = std::max(handle->getCUCount(), 1) * int64_t(8);
+    int64_t blocks     = std::min((batch_count - 1) / TEAMS + int64_t(1), max_blocks);
+
+#define gemv_small_batched_KARGS(alpha_, beta_)                                                   \
+    dim3(blocks), dim3(NB), 0, handle->get_stream(), m, n, alpha_, stride_alpha, A, offseta, lda, \
+        strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey,          \
+        batch_count
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((rocblas_gemv_small_batched_kernel<DIM, NB, TRANS, CONJ>),
+                           gemv_small_batched_KARGS(alpha, beta));
+    }
+    else
+    {
+        if(!*alpha && *beta == 1)
+            return rocblas_status_success;
+
+        hipLaunchKernelGGL((rocblas_gemv_small_batched_kernel<DIM, NB, TRANS, CONJ>),
+                           gemv_small_batched_KARGS(*alpha, *beta));
+    }
+#undef gemv_small_batched_KARGS
+
+    return rocblas_status_success;
+}
+
+template <bool TRANS, bool CONJ, typename Ti, typename Tex, typename To>
+rocblas_status rocblas_gemv_small_batched_template(rocblas_handle handle,
+                                                   rocblas_int    dim,
+                                                   rocblas_int    m,
+                                                   rocblas_int    n,
+                                                   const Tex*     alpha,
+                                                   rocblas_stride stride_alpha,
+                                                   const Ti*      A,
+                                                   rocblas_stride offseta,
+                                                   rocblas_int    lda,
+                                                   rocblas_stride strideA,
+                                                   const Ti*      x,
+                                                   rocblas_stride shiftx,
+                                                   rocblas_int    incx,
+                                                   rocblas_stride stridex,
+                                                   const Tex*     beta,
+                                                   rocblas_stride stride_beta,
+                                                   To*            y,
+                                                   rocblas_stride shifty,
+                                                   rocblas_int    incy,
+                                                   rocblas_stride stridey,
+                                                   rocblas_int    batch_count)
+{
+#define gemv_small_batched_ARGS                                                                  \
+    handle, m, n, alpha, stride_alpha, A, offseta, lda, strideA, x, shiftx, incx, stridex, beta, \
+        stride_beta, y, shifty, incy, stridey, batch_count
+
+    switch(dim)
+    {
+    case 8:
+        return rocblas_gemv_small_batched_launcher<8, TRANS, CONJ>(gemv_small_batched_ARGS);
+    case 16:
+        return rocblas_gemv_small_batched_launcher<16, TRANS, CONJ>(gemv_small_batched_ARGS);
+    case 32:
+        return rocblas_gemv_small_batched_launcher<32, TRANS, CONJ>(gemv_small_batched_ARGS);
+    case 64:
+        return rocblas_gemv_small_batched_launcher<64, TRANS, CONJ>(gemv_small_batched_ARGS);
+    default:
+        return rocblas_status_internal_error;
+    }
+#undef gemv_small_batched_ARGS
+}
+
 template <typename Ti, typename Tex, typename To>
 rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
                                               rocblas_operation transA,
@@ -169,14 +373,38 @@ rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
         = std::is_same_v<
               Ti,
               rocblas_double_complex> || std::is_same_v<Ti, rocblas_double_complex const*>;
-    const bool is_atomics_allowed = handle->atomics_mode == rocblas_atomics_allowed ? true : false;
+
+    // rocblas_reproducibility_mode selects the kernel by problem shape only: no atomics, no
+    // architecture or batch_count specific kernels, and reductions in a fixed order
+    const bool is_reproducible = handle->reproducibility_mode != rocblas_reproducibility_default;
+    const bool is_atomics_allowed
+        = !is_reproducible && handle->atomics_mode == rocblas_atomics_allowed ? true : false;
 
     //Identifying the architecture to have an appropriate optimization
-    int  arch_major       = handle->getArchMajor();
+    int  arch             = is_reproducible ? 0 : handle->getArch();
+    int  arch_major       = is_reproducible ? 0 : handle->getArchMajor();
     bool is_arch_10_or_11 = arch_major == 10 || arch_major == 11 ? true : false;
-    bool is_gfx908        = handle->getArch() == 908 ? true : false;
-    bool is_gfx906        = handle->getArch() == 906 ? true : false;
-    bool is_gfx90a        = handle->getArch() == 910 ? true : false;
+    bool is_gfx908        = arch == 908 ? true : false;
+    bool is_gfx906        = arch == 906 ? true : false;
+    bool is_gfx90a        = arch == 910 ? true : false;
+
+    // many tiny matrices: several matrices per wavefront and a persistent loop over the batch
+    rocblas_int small_batched_dim
+        = is_reproducible ? 0 : rocblas_gemv_small_batched_dim<Tex>(m, n, batch_count);
+    if(small_batched_dim)
+    {
+#define gemv_small_batched_ARGS                                                                \
+    handle, small_batched_dim, m, n, alpha, stride_alpha, A, offseta, lda, strideA, x, shiftx, \
+        incx, stridex, beta, stride_beta, y, shifty, incy, stridey, batch_count
+
+        if(transA == rocblas_operation_none)
+            return rocblas_gemv_small_batched_template<false, false>(gemv_small_batched_ARGS);
+        else if(transA == rocblas_operation_transpose)
+            return rocblas_gemv_small_batched_template<true, false>(gemv_small_batched_ARGS);
+        else
+            return rocblas_gemv_small_batched_template<true, true>(gemv_small_batched_ARGS);
+#undef gemv_small_batched_ARGS
+    }
 
     if(transA == rocblas_operation_none)
     {
@@ -422,7 +650,7 @@ rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
         // transpose
         static constexpr bool CONJ = false;
 
-        if(m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
+        if(!is_reproducible && m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
         {
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
@@ -486,67 +714,52 @@ rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
         }
         else if(workspace && rocblas_gemvt_skinny_n<Ti>(transA, m, n))
         {
-            static constexpr int NB     = rocblas_gemvt_sn_NB();
-            static constexpr int WIN    = rocblas_gemvt_sn_WIN();
-            int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
-            dim3                 gemvt_grid(blocks, batch_count);
-            dim3                 gemvt_threads(NB);
-
-#define gemvt_sn_KARGS(alpha_)                                                                 \
-    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, (Tex*)workspace
-
-            if(handle->pointer_mode == rocblas_pointer_mode_device)
-            {
-                if(!i64_indices)
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, rocblas_int>),
-                                       gemvt_sn_KARGS(alpha));
-                else
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, int64_t>),
-                                       gemvt_sn_KARGS(alpha));
-
-                hipLaunchKernelGGL((rocblas_gemvt_sn_reduce<NB, 8>),
-                                   dim3(1, n, batch_count),
-                                   gemvt_threads,
-                                   0,
-                                   rocblas_stream,
-                                   blocks,
-                                   beta,
-                                   stride_beta,
-                                   y,
-                                   shifty,
-                                   incy,
-                                   stridey,
-                                   (Tex*)workspace);
-            }
+            if(is_reproducible)
+                return rocblas_gemvt_sn_template<CONJ, true>(handle,
+                                                             m,
+                                                             n,
+                                                             alpha,
+                                                             stride_alpha,
+                                                             A,
+                                                             offseta,
+                                                             lda,
+                                                             strideA,
+                                                             x,
+                                                             shiftx,
+                                                             incx,
+                                                             stridex,
+                                                             beta,
+                                                             stride_beta,
+                                                             y,
+                                                             shifty,
+                                                             incy,
+                                                             stridey,
+                                                             batch_count,
+                                                             workspace,
+                                                             i64_indices);
             else
-            {
-                if(!*alpha && *beta == 1)
-                    return rocblas_status_success;
-
-                if(!i64_indices)
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, rocblas_int>),
-                                       gemvt_sn_KARGS(*alpha));
-                else
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, int64_t>),
-                                       gemvt_sn_KARGS(*alpha));
-
-                hipLaunchKernelGGL((rocblas_gemvt_sn_reduce<NB, 8>),
-                                   dim3(1, n, batch_count),
-                                   gemvt_threads,
-                                   0,
-                                   rocblas_stream,
-                                   blocks,
-                                   *beta,
-                                   stride_beta,
-                                   y,
-                                   shifty,
-                                   incy,
-                                   stridey,
-                                   workspace);
-            }
-
-#undef gemvt_sn_KARGS
+                return rocblas_gemvt_sn_template<CONJ, false>(handle,
+                                                              m,
+                                                              n,
+                                                              alpha,
+                                                              stride_alpha,
+                                                              A,
+                                                              offseta,
+                                                              lda,
+                                                              strideA,
+                                                              x,
+                                                              shiftx,
+                                                              incx,
+                                                              stridex,
+                                                              beta,
+                                                              stride_beta,
+                                                              y,
+                                                              shifty,
+                                                              incy,
+                                                              stridey,
+                                                              batch_count,
+                                                              workspace,
+                                                              i64_indices);
         }
         //optimized gemvt kernel with double buffered loads for gfx908.
         else if(is_atomics_allowed && (m == n) && (m % rocblas_gemv_bx() == 0)
@@ -661,7 +874,7 @@ rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
         }
         //Using kernel code with shared memory reduction for single precision as well as for other precisions when m or n is less than 6000 and for complex double in gfx1030.
         else if((is_float || m < gemvt_threshold || n < gemvt_threshold)
-                || (is_arch_10_or_11 && is_complex_double))
+                || (is_arch_10_or_11 && is_complex_double) || is_reproducible)
         {
             //Number of threads per block
             static constexpr int NB = 256;
@@ -711,7 +924,7 @@ rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
         static constexpr bool CONJ = true;
         // conjugate transpose
 
-        if(m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
+        if(!is_reproducible && m <= 64 && batch_count > 8) // few rows, e.g. qmcpack
         {
             // number of columns on the y-dim of the grid
             static constexpr int NB = 256;
@@ -775,67 +988,52 @@ rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
         }
         else if(workspace && rocblas_gemvt_skinny_n<Ti>(transA, m, n))
         {
-            static constexpr int NB     = rocblas_gemvt_sn_NB();
-            static constexpr int WIN    = rocblas_gemvt_sn_WIN();
-            int                  blocks = rocblas_gemvt_sn_kernel_block_count(m);
-            dim3                 gemvt_grid(blocks, batch_count);
-            dim3                 gemvt_threads(NB);
-
-#define gemvt_sn_KARGS(alpha_)                                                                 \
-    gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
-        strideA, x, shiftx, incx, stridex, (Tex*)workspace
-
-            if(handle->pointer_mode == rocblas_pointer_mode_device)
-            {
-                if(!i64_indices)
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, rocblas_int>),
-                                       gemvt_sn_KARGS(alpha));
-                else
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, int64_t>),
-                                       gemvt_sn_KARGS(alpha));
-
-                hipLaunchKernelGGL((rocblas_gemvt_sn_reduce<NB, 8>),
-                                   dim3(1, n, batch_count),
-                                   gemvt_threads,
-                                   0,
-                                   rocblas_stream,
-                                   blocks,
-                                   beta,
-                                   stride_beta,
-                                   y,
-                                   shifty,
-                                   incy,
-                                   stridey,
-                                   (Tex*)workspace);
-            }
+            if(is_reproducible)
+                return rocblas_gemvt_sn_template<CONJ, true>(handle,
+                                                             m,
+                                                             n,
+                                                             alpha,
+                                                             stride_alpha,
+                                                             A,
+                                                             offseta,
+                                                             lda,
+                                                             strideA,
+                                                             x,
+                                                             shiftx,
+                                                             incx,
+                                                             stridex,
+                                                             beta,
+                                                             stride_beta,
+                                                             y,
+                                                             shifty,
+                                                             incy,
+                                                             stridey,
+                                                             batch_count,
+                                                             workspace,
+                                                             i64_indices);
             else
-            {
-                if(!*alpha && *beta == 1)
-                    return rocblas_status_success;
-
-                if(!i64_indices)
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, rocblas_int>),
-                                       gemvt_sn_KARGS(*alpha));
-                else
-                    hipLaunchKernelGGL((rocblas_gemvt_sn_kernel<CONJ, NB, WIN, int64_t>),
-                                       gemvt_sn_KARGS(*alpha));
-
-                hipLaunchKernelGGL((rocblas_gemvt_sn_reduce<NB, 8>),
-                                   dim3(1, n, batch_count),
-                                   gemvt_threads,
-                                   0,
-                                   rocblas_stream,
-                                   blocks,
-                                   *beta,
-                                   stride_beta,
-                                   y,
-                                   shifty,
-                                   incy,
-                                   stridey,
-                                   workspace);
-            }
-
-#undef gemvt_sn_KARGS
+                return rocblas_gemvt_sn_template<CONJ, false>(handle,
+                                                              m,
+                                                              n,
+                                                              alpha,
+                                                              stride_alpha,
+                                                              A,
+                                                              offseta,
+                                                              lda,
+                                                              strideA,
+                                                              x,
+                                                              shiftx,
+                                                              incx,
+                                                              stridex,
+                                                              beta,
+                                                              stride_beta,
+                                                              y,
+                                                              shifty,
+                                                              incy,
+                                                              stridey,
+                                                              batch_count,
+                                                              workspace,
+                                                              i64_indices);
         }
         //optimized gemvt kernel with double buffered loads for gfx908.
         else if(is_atomics_allowed && (m == n) && (m % rocblas_gemv_bx() == 0)
@@ -922,7 +1120,7 @@ rocblas_status rocblas_internal_gemv_template(rocblas_handle    handle,
     gemvt_grid, gemvt_threads, 0, rocblas_stream, m, n, alpha_, stride_alpha, A, offseta, lda, \
         strideA, x, shiftx, incx, stridex, beta_, stride_beta, y, shifty, incy, stridey
         //Using kernel code with shared memory reduction for single precision and all other precision when m or n is less than 6000.
-        else if(is_float || m < 6000 || n < 6000)
+        else if(is_float || m < 6000 || n < 6000 || is_reproducible)
         {
             //Number of threads per block
             static constexpr int NB = 256;
@@ -76,6 +76,19 @@ namespace
         if(handle->is_device_memory_size_query())
             return handle->set_optimal_device_memory_size(dev_bytes);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_gemv_name<Ti, To>,
+                          transA,
+                          m,
+                          n,
+                          lda,
+                          strideA,
+                          incx,
+                          stridex,
+                          incy,
+                          stridey,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
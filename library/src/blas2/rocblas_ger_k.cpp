@@ -0,0 +1,259 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_ger_k.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_ger_k_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_k_name<false, float>[] = "rocblas_sger_k";
+    template <>
+    constexpr char rocblas_ger_k_name<false, double>[] = "rocblas_dger_k";
+    template <>
+    constexpr char rocblas_ger_k_name<false, rocblas_float_complex>[] = "rocblas_cgeru_k";
+    template <>
+    constexpr char rocblas_ger_k_name<false, rocblas_double_complex>[] = "rocblas_zgeru_k";
+    template <>
+    constexpr char rocblas_ger_k_name<true, rocblas_float_complex>[] = "rocblas_cgerc_k";
+    template <>
+    constexpr char rocblas_ger_k_name<true, rocblas_double_complex>[] = "rocblas_zgerc_k";
+
+    template <bool, typename>
+    constexpr char rocblas_ger_k_fn_name[] = "unknown";
+    template <>
+    constexpr char rocblas_ger_k_fn_name<false, float>[] = "ger_k";
+    template <>
+    constexpr char rocblas_ger_k_fn_name<false, double>[] = "ger_k";
+    template <>
+    constexpr char rocblas_ger_k_fn_name<false, rocblas_float_complex>[] = "geru_k";
+    template <>
+    constexpr char rocblas_ger_k_fn_name<false, rocblas_double_complex>[] = "geru_k";
+    template <>
+    constexpr char rocblas_ger_k_fn_name<true, rocblas_float_complex>[] = "gerc_k";
+    template <>
+    constexpr char rocblas_ger_k_fn_name<true, rocblas_double_complex>[] = "gerc_k";
+
+    template <bool CONJ, typename T>
+    rocblas_status rocblas_ger_k_impl(rocblas_handle handle,
+                                      rocblas_int    m,
+                                      rocblas_int    n,
+                                      rocblas_int    k,
+                                      const T*       alpha,
+                                      const T*       x,
+                                      rocblas_int    ldx,
+                                      const T*       y,
+                                      rocblas_int    ldy,
+                                      T*             A,
+                                      rocblas_int    lda)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        ROCBLAS_API_RANGE(handle, rocblas_ger_k_name<CONJ, T>, m, n, k, ldx, ldy, lda);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(handle,
+                      rocblas_ger_k_name<CONJ, T>,
+                      m,
+                      n,
+                      k,
+                      LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                      x,
+                      ldx,
+                      y,
+                      ldy,
+                      A,
+                      lda);
+
+        // rocblas-bench takes the leading dimensions of x and y as ldb and ldc
+        if(layer_mode & rocblas_layer_mode_log_bench)
+            log_bench(handle,
+                      "./rocblas-bench -f",
+                      rocblas_ger_k_fn_name<CONJ, T>,
+                      "-r",
+                      rocblas_precision_string<T>,
+                      "-m",
+                      m,
+                      "-n",
+                      n,
+                      "-k",
+                      k,
+                      LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                      "--ldb",
+                      ldx,
+                      "--ldc",
+                      ldy,
+                      "--lda",
+                      lda);
+
+        if(layer_mode & rocblas_layer_mode_log_profile)
+            log_profile(handle,
+                        rocblas_ger_k_name<CONJ, T>,
+                        "M",
+                        m,
+                        "N",
+                        n,
+                        "K",
+                        k,
+                        "ldx",
+                        ldx,
+                        "ldy",
+                        ldy,
+                        "lda",
+                        lda);
+
+        rocblas_status arg_status = rocblas_ger_k_arg_check(
+            handle, rocblas_fill_full, m, n, k, alpha, x, ldx, y, ldy, A, lda, 1);
+        if(arg_status != rocblas_status_continue)
+            return arg_status;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status ger_k_check_numerics_status
+                = rocblas_ger_k_check_numerics(rocblas_ger_k_name<CONJ, T>,
+                                               handle,
+                                               rocblas_fill_full,
+                                               m,
+                                               n,
+                                               k,
+                                               A,
+                                               lda,
+                                               0,
+                                               x,
+                                               ldx,
+                                               0,
+                                               y,
+                                               ldy,
+                                               0,
+                                               1,
+                                               check_numerics,
+                                               is_input);
+            if(ger_k_check_numerics_status != rocblas_status_success)
+                return ger_k_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_ger_k_template<CONJ>(handle,
+                                                                      rocblas_fill_full,
+                                                                      m,
+                                                                      n,
+                                                                      k,
+                                                                      alpha,
+                                                                      0,
+                                                                      x,
+                                                                      0,
+                                                                      ldx,
+                                                                      0,
+                                                                      y,
+                                                                      0,
+                                                                      ldy,
+                                                                      0,
+                                                                      A,
+                                                                      0,
+                                                                      lda,
+                                                                      0,
+                                                                      1);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status ger_k_check_numerics_status
+                = rocblas_ger_k_check_numerics(rocblas_ger_k_name<CONJ, T>,
+                                               handle,
+                                               rocblas_fill_full,
+                                               m,
+                                               n,
+                                               k,
+                                               A,
+                                               lda,
+                                               0,
+                                               x,
+                                               ldx,
+                                               0,
+                                               y,
+                                               ldy,
+                                               0,
+                                               1,
+                                               check_numerics,
+                                               is_input);
+            if(ger_k_check_numerics_status != rocblas_status_success)
+                return ger_k_check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, CONJ_, T_)                                                        \
+    rocblas_status routine_name_(rocblas_handle handle,                                       \
+                                 rocblas_int    m,                                            \
+                                 rocblas_int    n,                                            \
+                                 rocblas_int    k,                                            \
+                                 const T_*      alpha,                                        \
+                                 const T_*      x,                                            \
+                                 rocblas_int    ldx,                                          \
+                                 const T_*      y,                                            \
+                                 rocblas_int    ldy,                                          \
+                                 T_*            A,                                            \
+                                 rocblas_int    lda)                                          \
+    try                                                                                       \
+    {                                                                                         \
+        return rocblas_ger_k_impl<CONJ_, T_>(handle, m, n, k, alpha, x, ldx, y, ldy, A, lda); \
+    }                                                                                         \
+    catch(...)                                                                                \
+    {                                                                                         \
+        return exception_to_rocblas_status();                                                 \
+    }
+
+IMPL(rocblas_sger_k, false, float);
+IMPL(rocblas_dger_k, false, double);
+IMPL(rocblas_cgeru_k, false, rocblas_float_complex);
+IMPL(rocblas_zgeru_k, false, rocblas_double_complex);
+IMPL(rocblas_cgerc_k, true, rocblas_float_complex);
+IMPL(rocblas_zgerc_k, true, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "check_numerics_matrix.hpp"
+#include "handle.hpp"
+
+/**
+ * Argument check shared by ger_k, geru_k, gerc_k, syr_k and her_k.
+ * uplo is rocblas_fill_full for the general forms, syr_k and her_k pass the triangle of A
+ * to update with m == n and y == x.
+ */
+template <typename TScal, typename TConstPtr, typename TPtr>
+inline rocblas_status rocblas_ger_k_arg_check(rocblas_handle handle,
+                                              rocblas_fill   uplo,
+                                              rocblas_int    m,
+                                              rocblas_int    n,
+                                              rocblas_int    k,
+                                              TScal          alpha,
+                                              TConstPtr      x,
+                                              rocblas_int    ldx,
+                                              TConstPtr      y,
+                                              rocblas_int    ldy,
+                                              TPtr           A,
+                                              rocblas_int    lda,
+                                              rocblas_int    batch_count)
+{
+    if(uplo != rocblas_fill_full && uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+        return rocblas_status_invalid_value;
+
+    if(m < 0 || n < 0 || k < 0 || ldx < m || ldx < 1 || ldy < n || ldy < 1 || lda < m
+       || lda < 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    if(!m || !n || !k || !batch_count)
+        return rocblas_status_success;
+
+    if(!alpha)
+        return rocblas_status_invalid_pointer;
+
+    if(handle->pointer_mode == rocblas_pointer_mode_host)
+    {
+        if(*alpha == 0)
+            return rocblas_status_success;
+
+        // pointers are validated if they need to be dereferenced
+        if(!A || !x || !y)
+            return rocblas_status_invalid_pointer;
+    }
+
+    return rocblas_status_continue;
+}
+
+/**
+ * A := A + alpha * sum_j x_j * op(y_j), for the k columns x_j of the m by k matrix x and y_j of
+ * the n by k matrix y. op conjugates when CONJ. With uplo upper or lower only that triangle of A
+ * is updated, and with CONJ the diagonal is kept real as in her.
+ *
+ * A tile of A is read and written once for all k updates.
+ *
+ * TScal     is always: const T* or const real_t<T>* (either host or device)
+ * TConstPtr is either: const T* OR const T* const*
+ * TPtr      is either:       T* OR       T* const*
+ */
+template <bool CONJ, typename TScal, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_ger_k_template(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    m,
+                                               rocblas_int    n,
+                                               rocblas_int    k,
+                                               TScal          alpha,
+                                               rocblas_stride stride_alpha,
+                                               TConstPtr      x,
+                                               rocblas_stride offsetx,
+                                               rocblas_int    ldx,
+                                               rocblas_stride stridex,
+                                               TConstPtr      y,
+                                               rocblas_stride offsety,
+                                               rocblas_int    ldy,
+                                               rocblas_stride stridey,
+                                               TPtr           A,
+                                               rocblas_stride offsetA,
+                                               rocblas_int    lda,
+                                               rocblas_stride strideA,
+                                               rocblas_int    batch_count);
+
+template <typename TConstPtr, typename TPtr>
+rocblas_status rocblas_ger_k_check_numerics(const char*    function_name,
+                                            rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            rocblas_int    k,
+                                            TPtr           A,
+                                            rocblas_int    lda,
+                                            rocblas_stride stride_a,
+                                            TConstPtr      x,
+                                            rocblas_int    ldx,
+                                            rocblas_stride stride_x,
+                                            TConstPtr      y,
+                                            rocblas_int    ldy,
+                                            rocblas_stride stride_y,
+                                            rocblas_int    batch_count,
+                                            const int      check_numerics,
+                                            bool           is_input);
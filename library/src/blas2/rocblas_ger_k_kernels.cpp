@@ -0,0 +1,370 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "check_numerics_matrix.hpp"
+#include "handle.hpp"
+#include "rocblas_ger_k.hpp"
+
+/**
+ * Each DIM_X by DIM_Y block owns a DIM_X by DIM_X tile of A and accumulates the k rank-1 updates
+ * of the tile in registers, DIM_X / DIM_Y columns per thread. Columns of x and y are staged
+ * through shared memory KB at a time, and the tile of A is read and written once at the end.
+ */
+template <rocblas_int DIM_X,
+          rocblas_int DIM_Y,
+          rocblas_int KB,
+          bool        CONJ,
+          typename T,
+          typename TScal,
+          typename TConstPtr,
+          typename TPtr>
+ROCBLAS_KERNEL(DIM_X* DIM_Y)
+rocblas_ger_k_kernel(rocblas_fill   uplo,
+                     rocblas_int    m,
+                     rocblas_int    n,
+                     rocblas_int    k,
+                     TScal          alpha_device_host,
+                     rocblas_stride stride_alpha,
+                     TConstPtr      xa,
+                     rocblas_stride shiftx,
+                     rocblas_int    ldx,
+                     rocblas_stride stridex,
+                     TConstPtr      ya,
+                     rocblas_stride shifty,
+                     rocblas_int    ldy,
+                     rocblas_stride stridey,
+                     TPtr           Aa,
+                     rocblas_stride shiftA,
+                     rocblas_int    lda,
+                     rocblas_stride strideA)
+{
+    static constexpr int WIN = DIM_X / DIM_Y;
+
+    __shared__ T xdata[KB][DIM_X];
+    __shared__ T ydata[KB][DIM_X];
+
+    // tiles entirely outside of the referenced triangle are skipped
+    if((uplo == rocblas_fill_upper && blockIdx.x > blockIdx.y)
+       || (uplo == rocblas_fill_lower && blockIdx.x < blockIdx.y))
+        return;
+
+    auto alpha = load_scalar(alpha_device_host, blockIdx.z, stride_alpha);
+    if(!alpha)
+        return;
+
+    const T* __restrict__ x = load_ptr_batch(xa, blockIdx.z, shiftx, stridex);
+    const T* __restrict__ y = load_ptr_batch(ya, blockIdx.z, shifty, stridey);
+
+    const int     tid  = threadIdx.y * DIM_X + threadIdx.x;
+    const int64_t row0 = blockIdx.x * int64_t(DIM_X);
+    const int64_t col0 = blockIdx.y * int64_t(DIM_X);
+
+    T acc[WIN];
+    for(int i = 0; i < WIN; i++)
+        acc[i] = T(0);
+
+    for(rocblas_int kk = 0; kk < k; kk += KB)
+    {
+        for(int e = tid; e < DIM_X * KB; e += DIM_X * DIM_Y)
+        {
+            int r = e % DIM_X;
+            int c = e / DIM_X;
+
+            bool in_k   = kk + c < k;
+            xdata[c][r] = in_k && row0 + r < m ? x[row0 + r + int64_t(kk + c) * ldx] : T(0);
+
+            T yv        = in_k && col0 + r < n ? y[col0 + r + int64_t(kk + c) * ldy] : T(0);
+            ydata[c][r] = CONJ ? conj(yv) : yv;
+        }
+
+        __syncthreads();
+
+        for(int c = 0; c < KB; c++)
+        {
+            T xv = xdata[c][threadIdx.x];
+            for(int i = 0; i < WIN; i++)
+                acc[i] += xv * ydata[c][threadIdx.y + i * DIM_Y];
+        }
+
+        __syncthreads();
+    }
+
+    T* __restrict__ A = load_ptr_batch(Aa, blockIdx.z, shiftA, strideA);
+
+    int64_t row = row0 + threadIdx.x;
+    if(row >= m)
+        return;
+
+    for(int i = 0; i < WIN; i++)
+    {
+        int64_t col = col0 + threadIdx.y + i * DIM_Y;
+        if(col >= n || (uplo == rocblas_fill_upper && row > col)
+           || (uplo == rocblas_fill_lower && row < col))
+            continue;
+
+        T& a = A[row + col * size_t(lda)];
+        if constexpr(CONJ)
+        {
+            //Diagonal elements of a Hermitian update must be real
+            if(uplo != rocblas_fill_full && row == col)
+            {
+                a = std::real(a) + std::real(alpha * acc[i]);
+                continue;
+            }
+        }
+        a += alpha * acc[i];
+    }
+}
+
+template <bool CONJ, typename TScal, typename TConstPtr, typename TPtr>
+rocblas_status rocblas_internal_ger_k_template(rocblas_handle handle,
+                                               rocblas_fill   uplo,
+                                               rocblas_int    m,
+                                               rocblas_int    n,
+                                               rocblas_int    k,
+                                               TScal          alpha,
+                                               rocblas_stride stride_alpha,
+                                               TConstPtr      x,
+                                               rocblas_stride offsetx,
+                                               rocblas_int    ldx,
+                                               rocblas_stride stridex,
+                                               TConstPtr      y,
+                                               rocblas_stride offsety,
+                                               rocblas_int    ldy,
+                                               rocblas_stride stridey,
+                                               TPtr           A,
+                                               rocblas_stride offsetA,
+                                               rocblas_int    lda,
+                                               rocblas_stride strideA,
+                                               rocblas_int    batch_count)
+{
+    // Quick return if possible. Not Argument error
+    if(!m || !n || !k || !batch_count)
+        return rocblas_status_success;
+
+    using T = std::remove_cv_t<std::remove_pointer_t<std::remove_pointer_t<TPtr>>>;
+
+    hipStream_t rocblas_stream = handle->get_stream();
+
+    static constexpr int DIM_X = 32;
+    static constexpr int DIM_Y = 8;
+    static constexpr int KB    = 16; // columns of x and y staged per pass
+
+    rocblas_int blocksX = (m - 1) / DIM_X + 1;
+    rocblas_int blocksY = (n - 1) / DIM_X + 1;
+
+    dim3 ger_k_grid(blocksX, blocksY, batch_count);
+    dim3 ger_k_threads(DIM_X, DIM_Y);
+
+#define ger_k_KARGS(alpha_)                                                                        \
+    ger_k_grid, ger_k_threads, 0, rocblas_stream, uplo, m, n, k, alpha_, stride_alpha, x, offsetx, \
+        ldx, stridex, y, offsety, ldy, stridey, A, offsetA, lda, strideA
+
+    if(handle->pointer_mode == rocblas_pointer_mode_device)
+    {
+        hipLaunchKernelGGL((rocblas_ger_k_kernel<DIM_X, DIM_Y, KB, CONJ, T>), ger_k_KARGS(alpha));
+    }
+    else
+    {
+        hipLaunchKernelGGL((rocblas_ger_k_kernel<DIM_X, DIM_Y, KB, CONJ, T>), ger_k_KARGS(*alpha));
+    }
+#undef ger_k_KARGS
+
+    return rocblas_status_success;
+}
+
+template <typename TConstPtr, typename TPtr>
+rocblas_status rocblas_ger_k_check_numerics(const char*    function_name,
+                                            rocblas_handle handle,
+                                            rocblas_fill   uplo,
+                                            rocblas_int    m,
+                                            rocblas_int    n,
+                                            rocblas_int    k,
+                                            TPtr           A,
+                                            rocblas_int    lda,
+                                            rocblas_stride stride_a,
+                                            TConstPtr      x,
+                                            rocblas_int    ldx,
+                                            rocblas_stride stride_x,
+                                            TConstPtr      y,
+                                            rocblas_int    ldy,
+                                            rocblas_stride stride_y,
+                                            rocblas_int    batch_count,
+                                            const int      check_numerics,
+                                            bool           is_input)
+{
+    rocblas_check_matrix_type matrix_type = uplo == rocblas_fill_full
+                                                ? rocblas_client_general_matrix
+                                                : rocblas_client_symmetric_matrix;
+
+    rocblas_status check_numerics_status
+        = rocblas_internal_check_numerics_matrix_template(function_name,
+                                                          handle,
+                                                          rocblas_operation_none,
+                                                          uplo,
+                                                          matrix_type,
+                                                          m,
+                                                          n,
+                                                          A,
+                                                          0,
+                                                          lda,
+                                                          stride_a,
+                                                          batch_count,
+                                                          check_numerics,
+                                                          is_input);
+    if(check_numerics_status != rocblas_status_success)
+        return check_numerics_status;
+
+    if(is_input)
+    {
+        check_numerics_status
+            = rocblas_internal_check_numerics_matrix_template(function_name,
+                                                              handle,
+                                                              rocblas_operation_none,
+                                                              rocblas_fill_full,
+                                                              rocblas_client_general_matrix,
+                                                              m,
+                                                              k,
+                                                              x,
+                                                              0,
+                                                              ldx,
+                                                              stride_x,
+                                                              batch_count,
+                                                              check_numerics,
+                                                              is_input);
+        if(check_numerics_status != rocblas_status_success)
+            return check_numerics_status;
+
+        // syr_k and her_k pass x as y
+        if(y != x)
+            check_numerics_status
+                = rocblas_internal_check_numerics_matrix_template(function_name,
+                                                                  handle,
+                                                                  rocblas_operation_none,
+                                                                  rocblas_fill_full,
+                                                                  rocblas_client_general_matrix,
+                                                                  n,
+                                                                  k,
+                                                                  y,
+                                                                  0,
+                                                                  ldy,
+                                                                  stride_y,
+                                                                  batch_count,
+                                                                  check_numerics,
+                                                                  is_input);
+    }
+    return check_numerics_status;
+}
+
+// Instantiations below will need to be manually updated to match any change in
+// template parameters in the files *ger_k*.cpp and *syr_k*.cpp
+
+// clang-format off
+
+#ifdef INSTANTIATE_GER_K_TEMPLATE
+#error INSTANTIATE_GER_K_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_GER_K_TEMPLATE(CONJ_, TScal_, TConstPtr_, TPtr_)                      \
+template rocblas_status rocblas_internal_ger_k_template<CONJ_, TScal_, TConstPtr_, TPtr_> \
+                                               (rocblas_handle handle,                    \
+                                               rocblas_fill   uplo,                       \
+                                               rocblas_int    m,                          \
+                                               rocblas_int    n,                          \
+                                               rocblas_int    k,                          \
+                                               TScal_         alpha,                      \
+                                               rocblas_stride stride_alpha,               \
+                                               TConstPtr_     x,                          \
+                                               rocblas_stride offsetx,                    \
+                                               rocblas_int    ldx,                        \
+                                               rocblas_stride stridex,                    \
+                                               TConstPtr_     y,                          \
+                                               rocblas_stride offsety,                    \
+                                               rocblas_int    ldy,                        \
+                                               rocblas_stride stridey,                    \
+                                               TPtr_          A,                          \
+                                               rocblas_stride offsetA,                    \
+                                               rocblas_int    lda,                        \
+                                               rocblas_stride strideA,                    \
+                                               rocblas_int    batch_count);
+
+// ger_k, geru_k and syr_k
+INSTANTIATE_GER_K_TEMPLATE(false, float const*, float const*, float*)
+INSTANTIATE_GER_K_TEMPLATE(false, double const*, double const*, double*)
+INSTANTIATE_GER_K_TEMPLATE(false, rocblas_float_complex const*, rocblas_float_complex const*, rocblas_float_complex*)
+INSTANTIATE_GER_K_TEMPLATE(false, rocblas_double_complex const*, rocblas_double_complex const*, rocblas_double_complex*)
+INSTANTIATE_GER_K_TEMPLATE(false, float const*, float const* const*, float* const*)
+INSTANTIATE_GER_K_TEMPLATE(false, double const*, double const* const*, double* const*)
+INSTANTIATE_GER_K_TEMPLATE(false, rocblas_float_complex const*, rocblas_float_complex const* const*, rocblas_float_complex* const*)
+INSTANTIATE_GER_K_TEMPLATE(false, rocblas_double_complex const*, rocblas_double_complex const* const*, rocblas_double_complex* const*)
+
+// gerc_k
+INSTANTIATE_GER_K_TEMPLATE(true, rocblas_float_complex const*, rocblas_float_complex const*, rocblas_float_complex*)
+INSTANTIATE_GER_K_TEMPLATE(true, rocblas_double_complex const*, rocblas_double_complex const*, rocblas_double_complex*)
+INSTANTIATE_GER_K_TEMPLATE(true, rocblas_float_complex const*, rocblas_float_complex const* const*, rocblas_float_complex* const*)
+INSTANTIATE_GER_K_TEMPLATE(true, rocblas_double_complex const*, rocblas_double_complex const* const*, rocblas_double_complex* const*)
+
+// her_k
+INSTANTIATE_GER_K_TEMPLATE(true, float const*, rocblas_float_complex const*, rocblas_float_complex*)
+INSTANTIATE_GER_K_TEMPLATE(true, double const*, rocblas_double_complex const*, rocblas_double_complex*)
+INSTANTIATE_GER_K_TEMPLATE(true, float const*, rocblas_float_complex const* const*, rocblas_float_complex* const*)
+INSTANTIATE_GER_K_TEMPLATE(true, double const*, rocblas_double_complex const* const*, rocblas_double_complex* const*)
+
+#undef INSTANTIATE_GER_K_TEMPLATE
+
+#ifdef INSTANTIATE_GER_K_NUMERICS
+#error INSTANTIATE_GER_K_NUMERICS already defined
+#endif
+
+#define INSTANTIATE_GER_K_NUMERICS(TConstPtr_, TPtr_)                      \
+template rocblas_status rocblas_ger_k_check_numerics<TConstPtr_, TPtr_>    \
+                                           (const char*    function_name,  \
+                                            rocblas_handle handle,         \
+                                            rocblas_fill   uplo,           \
+                                            rocblas_int    m,              \
+                                            rocblas_int    n,              \
+                                            rocblas_int    k,              \
+                                            TPtr_          A,              \
+                                            rocblas_int    lda,            \
+                                            rocblas_stride stride_a,       \
+                                            TConstPtr_     x,              \
+                                            rocblas_int    ldx,            \
+                                            rocblas_stride stride_x,       \
+                                            TConstPtr_     y,              \
+                                            rocblas_int    ldy,            \
+                                            rocblas_stride stride_y,       \
+                                            rocblas_int    batch_count,    \
+                                            const int      check_numerics, \
+                                            bool           is_input);
+
+INSTANTIATE_GER_K_NUMERICS(float const*, float*)
+INSTANTIATE_GER_K_NUMERICS(double const*, double*)
+INSTANTIATE_GER_K_NUMERICS(rocblas_float_complex const*, rocblas_float_complex*)
+INSTANTIATE_GER_K_NUMERICS(rocblas_double_complex const*, rocblas_double_complex*)
+INSTANTIATE_GER_K_NUMERICS(float const* const*, float* const*)
+INSTANTIATE_GER_K_NUMERICS(double const* const*, double* const*)
+INSTANTIATE_GER_K_NUMERICS(rocblas_float_complex const* const*, rocblas_float_complex* const*)
+INSTANTIATE_GER_K_NUMERICS(rocblas_double_complex const* const*, rocblas_double_complex* const*)
+
+#undef INSTANTIATE_GER_K_NUMERICS
+
+// clang-format on
@@ -87,6 +87,18 @@ namespace
             return rocblas_status_invalid_handle;
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_ger_strided_batched_name<CONJ, T>,
+                          m,
+                          n,
+                          incx,
+                          stridex,
+                          incy,
+                          stridey,
+                          lda,
+                          strideA,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
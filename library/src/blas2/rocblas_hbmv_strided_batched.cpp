@@ -53,6 +53,19 @@ namespace
             return rocblas_status_invalid_handle;
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_hbmv_name<T>,
+                          uplo,
+                          n,
+                          k,
+                          lda,
+                          stride_A,
+                          incx,
+                          stride_x,
+                          incy,
+                          stride_y,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode
@@ -49,6 +49,8 @@ namespace
 
         auto check_numerics = handle->check_numerics;
 
+        ROCBLAS_API_RANGE(handle, rocblas_hemv_name<T>, uplo, n, lda, incx, incy);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
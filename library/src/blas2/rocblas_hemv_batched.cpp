@@ -47,6 +47,9 @@ namespace
     {
         if(!handle)
             return rocblas_status_invalid_handle;
+
+        ROCBLAS_API_RANGE(handle, rocblas_hemv_name<T>, uplo, n, lda, incx, incy, batch_count);
+
         auto check_numerics = handle->check_numerics;
         if(!handle->is_device_memory_size_query())
         {
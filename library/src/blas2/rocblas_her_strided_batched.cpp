@@ -52,6 +52,16 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_her_strided_batched_name<T>,
+                          uplo,
+                          n,
+                          incx,
+                          stridex,
+                          lda,
+                          strideA,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode
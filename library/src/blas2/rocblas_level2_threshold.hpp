@@ -40,6 +40,20 @@ constexpr int sgemvt_gfx_arch_10_11_threshold = 4000;
 constexpr int sgemvt_gfx908_lower_threshold = 7000;
 constexpr int dgemvt_gfx908_lower_threshold = 3000;
 
+// Small batched gemv: the team width (threads per matrix) covering max(m, n), and the batch_count
+// from which the persistent small batched kernel is used instead of one block per matrix.
+struct rocblas_gemv_small_batched_crossover
+{
+    int dim;
+    int min_batch_count;
+};
+
+constexpr rocblas_gemv_small_batched_crossover gemv_small_batched_crossover_table[]
+    = {{8, 512}, {16, 1024}, {32, 2048}, {64, 8192}};
+
+// x is held in dim registers of the compute type per thread
+constexpr int gemv_small_batched_max_x_bytes = 512;
+
 /*********************************************************************symv**********************************************************************/
 
 // Double buffered load optimized for single and double precision for symv (upper)
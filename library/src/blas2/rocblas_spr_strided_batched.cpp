@@ -55,6 +55,15 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_spr_strided_batched_name<T>,
+                          uplo,
+                          n,
+                          incx,
+                          stridex,
+                          strideA,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode
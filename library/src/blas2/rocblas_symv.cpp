@@ -52,6 +52,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle, rocblas_symv_name<T>, uplo, n, lda, incx, incy);
+
         auto check_numerics = handle->check_numerics;
         if(!handle->is_device_memory_size_query())
         {
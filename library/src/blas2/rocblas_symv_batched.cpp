@@ -55,6 +55,9 @@ namespace
 
         auto check_numerics = handle->check_numerics;
 
+        ROCBLAS_API_RANGE(
+            handle, rocblas_symv_batched_name<T>, uplo, n, lda, incx, incy, batch_count);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
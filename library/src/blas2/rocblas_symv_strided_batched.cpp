@@ -60,6 +60,18 @@ namespace
 
         auto check_numerics = handle->check_numerics;
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_symv_strided_batched_name<T>,
+                          uplo,
+                          n,
+                          lda,
+                          strideA,
+                          incx,
+                          stridex,
+                          incy,
+                          stridey,
+                          batch_count);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
@@ -59,6 +59,18 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_syr2_strided_batched_name<T>,
+                          uplo,
+                          n,
+                          incx,
+                          stride_x,
+                          incy,
+                          stride_y,
+                          lda,
+                          strideA,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode
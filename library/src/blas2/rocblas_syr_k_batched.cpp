@@ -0,0 +1,275 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "rocblas_ger_k.hpp"
+#include "utility.hpp"
+
+namespace
+{
+    template <bool, typename>
+    constexpr char rocblas_syr_k_batched_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syr_k_batched_name<false, float>[] = "rocblas_ssyr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_name<false, double>[] = "rocblas_dsyr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_name<false, rocblas_float_complex>[]
+        = "rocblas_csyr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_name<false, rocblas_double_complex>[]
+        = "rocblas_zsyr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_name<true, rocblas_float_complex>[]
+        = "rocblas_cher_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_name<true, rocblas_double_complex>[]
+        = "rocblas_zher_k_batched";
+
+    template <bool, typename>
+    constexpr char rocblas_syr_k_batched_fn_name[] = "unknown";
+    template <>
+    constexpr char rocblas_syr_k_batched_fn_name<false, float>[] = "syr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_fn_name<false, double>[] = "syr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_fn_name<false, rocblas_float_complex>[] = "syr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_fn_name<false, rocblas_double_complex>[] = "syr_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_fn_name<true, rocblas_float_complex>[] = "her_k_batched";
+    template <>
+    constexpr char rocblas_syr_k_batched_fn_name<true, rocblas_double_complex>[] = "her_k_batched";
+
+    // syr_k and her_k share the ger_k kernel with y = x, her_k conjugates and has a real alpha
+    template <bool HERM, typename T, typename U>
+    rocblas_status rocblas_syr_k_batched_impl(rocblas_handle handle,
+                                              rocblas_fill   uplo,
+                                              rocblas_int    n,
+                                              rocblas_int    k,
+                                              const U*       alpha,
+                                              const T* const x[],
+                                              rocblas_int    ldx,
+                                              T* const       A[],
+                                              rocblas_int    lda,
+                                              rocblas_int    batch_count)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
+        ROCBLAS_API_RANGE(
+            handle, rocblas_syr_k_batched_name<HERM, T>, uplo, n, k, ldx, lda, batch_count);
+
+        auto layer_mode     = handle->layer_mode;
+        auto check_numerics = handle->check_numerics;
+        if(layer_mode
+           & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
+              | rocblas_layer_mode_log_profile))
+        {
+            auto uplo_letter = rocblas_fill_letter(uplo);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_syr_k_batched_name<HERM, T>,
+                          uplo,
+                          n,
+                          k,
+                          LOG_TRACE_SCALAR_VALUE(handle, alpha),
+                          x,
+                          ldx,
+                          A,
+                          lda,
+                          batch_count);
+
+            // rocblas-bench takes the leading dimension of x as ldb
+            if(layer_mode & rocblas_layer_mode_log_bench)
+                log_bench(handle,
+                          "./rocblas-bench -f",
+                          rocblas_syr_k_batched_fn_name<HERM, T>,
+                          "-r",
+                          rocblas_precision_string<T>,
+                          "--uplo",
+                          uplo_letter,
+                          "-n",
+                          n,
+                          "-k",
+                          k,
+                          LOG_BENCH_SCALAR_VALUE(handle, alpha),
+                          "--ldb",
+                          ldx,
+                          "--lda",
+                          lda,
+                          "--batch_count",
+                          batch_count);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_syr_k_batched_name<HERM, T>,
+                            "uplo",
+                            uplo_letter,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "ldx",
+                            ldx,
+                            "lda",
+                            lda,
+                            "batch_count",
+                            batch_count);
+        }
+
+        static constexpr rocblas_stride stridex = 0, strideA = 0;
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        rocblas_status arg_status = rocblas_ger_k_arg_check(
+            handle, uplo, n, n, k, alpha, x, ldx, x, ldx, A, lda, batch_count);
+        if(arg_status != rocblas_status_continue)
+            return arg_status;
+
+        if(check_numerics)
+        {
+            bool           is_input = true;
+            rocblas_status syr_k_check_numerics_status
+                = rocblas_ger_k_check_numerics(rocblas_syr_k_batched_name<HERM, T>,
+                                               handle,
+                                               uplo,
+                                               n,
+                                               n,
+                                               k,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               ldx,
+                                               stridex,
+                                               x,
+                                               ldx,
+                                               stridex,
+                                               batch_count,
+                                               check_numerics,
+                                               is_input);
+            if(syr_k_check_numerics_status != rocblas_status_success)
+                return syr_k_check_numerics_status;
+        }
+
+        rocblas_status status = rocblas_internal_ger_k_template<HERM>(handle,
+                                                                      uplo,
+                                                                      n,
+                                                                      n,
+                                                                      k,
+                                                                      alpha,
+                                                                      0,
+                                                                      x,
+                                                                      0,
+                                                                      ldx,
+                                                                      stridex,
+                                                                      x,
+                                                                      0,
+                                                                      ldx,
+                                                                      stridex,
+                                                                      A,
+                                                                      0,
+                                                                      lda,
+                                                                      strideA,
+                                                                      batch_count);
+        if(status != rocblas_status_success)
+            return status;
+
+        if(check_numerics)
+        {
+            bool           is_input = false;
+            rocblas_status syr_k_check_numerics_status
+                = rocblas_ger_k_check_numerics(rocblas_syr_k_batched_name<HERM, T>,
+                                               handle,
+                                               uplo,
+                                               n,
+                                               n,
+                                               k,
+                                               A,
+                                               lda,
+                                               strideA,
+                                               x,
+                                               ldx,
+                                               stridex,
+                                               x,
+                                               ldx,
+                                               stridex,
+                                               batch_count,
+                                               check_numerics,
+                                               is_input);
+            if(syr_k_check_numerics_status != rocblas_status_success)
+                return syr_k_check_numerics_status;
+        }
+        return status;
+    }
+
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, HERM_, T_, U_)                           \
+    rocblas_status routine_name_(rocblas_handle  handle,             \
+                                 rocblas_fill    uplo,               \
+                                 rocblas_int     n,                  \
+                                 rocblas_int     k,                  \
+                                 const U_*       alpha,              \
+                                 const T_* const x[],                \
+                                 rocblas_int     ldx,                \
+                                 T_* const       A[],                \
+                                 rocblas_int     lda,                \
+                                 rocblas_int     batch_count)        \
+    try                                                              \
+    {                                                                \
+        return rocblas_syr_k_batched_impl<HERM_, T_>(                \
+            handle, uplo, n, k, alpha, x, ldx, A, lda, batch_count); \
+    }                                                                \
+    catch(...)                                                       \
+    {                                                                \
+        return exception_to_rocblas_status();                        \
+    }
+
+IMPL(rocblas_ssyr_k_batched, false, float, float);
+IMPL(rocblas_dsyr_k_batched, false, double, double);
+IMPL(rocblas_csyr_k_batched, false, rocblas_float_complex, rocblas_float_complex);
+IMPL(rocblas_zsyr_k_batched, false, rocblas_double_complex, rocblas_double_complex);
+IMPL(rocblas_cher_k_batched, true, rocblas_float_complex, float);
+IMPL(rocblas_zher_k_batched, true, rocblas_double_complex, double);
+
+#undef IMPL
+
+} // extern "C"
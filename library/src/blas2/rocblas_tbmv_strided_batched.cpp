@@ -56,6 +56,19 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_tbmv_name<T>,
+                          uplo,
+                          transA,
+                          diag,
+                          m,
+                          k,
+                          lda,
+                          stride_A,
+                          incx,
+                          stride_x,
+                          batch_count);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
@@ -62,6 +62,19 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_tbsv_name<T>,
+                          uplo,
+                          transA,
+                          diag,
+                          n,
+                          k,
+                          lda,
+                          stride_A,
+                          incx,
+                          stride_x,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode & rocblas_layer_mode_log_trace)
@@ -52,6 +52,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle, rocblas_tpmv_name<T>, uplo, transA, diag, m, incx);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
@@ -60,6 +60,17 @@ namespace
 
         auto check_numerics = handle->check_numerics;
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_tpmv_strided_batched_name<T>,
+                          uplo,
+                          transa,
+                          diag,
+                          m,
+                          incx,
+                          stridea,
+                          stridex,
+                          batch_count);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
@@ -60,6 +60,17 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_tpsv_strided_batched_name<T>,
+                          uplo,
+                          transA,
+                          diag,
+                          n,
+                          stride_A,
+                          incx,
+                          stride_x,
+                          batch_count);
+
         auto layer_mode = handle->layer_mode;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle,
@@ -58,6 +58,18 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_trmv_strided_batched_name<T>,
+                          uplo,
+                          transa,
+                          diag,
+                          m,
+                          lda,
+                          incx,
+                          stridea,
+                          stridex,
+                          batch_count);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
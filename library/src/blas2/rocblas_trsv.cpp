@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 #include "rocblas_trsv.hpp"
+#include "../blas3/rocblas_trsm_refine.hpp"
 #include "handle.hpp"
 #include "logging.hpp"
 #include "rocblas.h"
@@ -54,6 +55,8 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle, rocblas_trsv_name<T>, uplo, transA, diag, m, lda, incx);
+
         auto layer_mode = handle->layer_mode;
         if(layer_mode & rocblas_layer_mode_log_trace)
             log_trace(handle, rocblas_trsv_name<T>, uplo, transA, diag, m, A, lda, B, incx);
@@ -108,13 +111,35 @@ namespace
         rocblas_status arg_status
             = rocblas_trsv_arg_check(handle, uplo, transA, diag, m, A, lda, B, incx, 1, dev_bytes);
         if(arg_status != rocblas_status_continue)
+        {
+            // A size query also sizes the refinement workspace, which is released before the
+            // fallback solve in T allocates
+            if constexpr(rocblas_is_refinement_type<T>)
+            {
+                if(m && handle->math_mode == rocblas_iterative_refinement_math
+                   && (arg_status == rocblas_status_size_increased
+                       || arg_status == rocblas_status_size_unchanged))
+                {
+                    rocblas_status refine_status
+                        = rocblas_internal_trsm_refine_template(handle,
+                                                                rocblas_side_left,
+                                                                uplo,
+                                                                transA,
+                                                                diag,
+                                                                m,
+                                                                1,
+                                                                (const T*)nullptr,
+                                                                A,
+                                                                lda,
+                                                                B,
+                                                                incx,
+                                                                m);
+                    if(refine_status != rocblas_status_size_unchanged)
+                        return refine_status;
+                }
+            }
             return arg_status;
-
-        auto w_mem = handle->device_malloc(dev_bytes);
-        if(!w_mem)
-            return rocblas_status_memory_error;
-
-        auto w_completed_sec = w_mem[0];
+        }
 
         auto check_numerics = handle->check_numerics;
 
@@ -141,21 +166,50 @@ namespace
                 return trsv_check_numerics_status;
         }
 
-        rocblas_status status = rocblas_internal_trsv_template(handle,
+        // rocblas_status_continue when the refinement did not converge, B is unchanged
+        rocblas_status status = rocblas_status_continue;
+        if constexpr(rocblas_is_refinement_type<T>)
+        {
+            if(handle->math_mode == rocblas_iterative_refinement_math)
+                status = rocblas_internal_trsm_refine_template(handle,
+                                                               rocblas_side_left,
                                                                uplo,
                                                                transA,
                                                                diag,
                                                                m,
+                                                               1,
+                                                               (const T*)nullptr,
                                                                A,
-                                                               0,
                                                                lda,
-                                                               0,
                                                                B,
-                                                               0,
                                                                incx,
-                                                               0,
-                                                               1,
-                                                               (rocblas_int*)w_completed_sec);
+                                                               m);
+        }
+
+        if(status == rocblas_status_continue)
+        {
+            auto w_mem = handle->device_malloc(dev_bytes);
+            if(!w_mem)
+                return rocblas_status_memory_error;
+
+            auto w_completed_sec = w_mem[0];
+
+            status = rocblas_internal_trsv_template(handle,
+                                                    uplo,
+                                                    transA,
+                                                    diag,
+                                                    m,
+                                                    A,
+                                                    0,
+                                                    lda,
+                                                    0,
+                                                    B,
+                                                    0,
+                                                    incx,
+                                                    0,
+                                                    1,
+                                                    (rocblas_int*)w_completed_sec);
+        }
 
         if(status != rocblas_status_success)
             return status;
@@ -55,6 +55,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(
+            handle, rocblas_trsv_batched_name<T>, uplo, transA, diag, m, lda, incx, batch_count);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
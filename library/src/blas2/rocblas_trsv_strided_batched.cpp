@@ -60,6 +60,18 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_trsv_strided_batched_name<T>,
+                          uplo,
+                          transA,
+                          diag,
+                          m,
+                          lda,
+                          stride_A,
+                          incx,
+                          stride_x,
+                          batch_count);
+
         if(!handle->is_device_memory_size_query())
         {
             auto layer_mode = handle->layer_mode;
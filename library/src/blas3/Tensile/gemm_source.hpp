@@ -23,6 +23,7 @@
 #pragma once
 
 #include "handle.hpp"
+#include <algorithm>
 
 namespace
 {
@@ -524,8 +525,705 @@ namespace
         return rocblas_status_success;
     }
 
+    /*
+     * ===========================================================================
+     *    split-K / stream-K source kernels
+     *
+     *    The classic kernels above assign one output tile to each workgroup, which
+     *    leaves most of the device idle when m * n * batch_count covers fewer tiles
+     *    than there are CUs. The kernels below additionally partition the k loop so
+     *    that every CU has work. Partial tiles are either accumulated with atomics
+     *    into a beta-scaled C, or written to workspace and reduced in a fixed order
+     *    so that results are bitwise reproducible.
+     * ===========================================================================
+     */
+
+    // Compute the BLK_M x BLK_N partial product of tile (blx, bly) over the k range
+    // [k_begin, k_end). k_begin must be a multiple of BLK_K.
+    template <typename T,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              int  DIM_M_A,
+              int  DIM_N_A,
+              int  DIM_M_B,
+              int  DIM_N_B,
+              char TRANS_A,
+              char TRANS_B>
+    ROCBLAS_KERNEL_ILF void rocblas_gemm_tile_partial_device(rocblas_int M,
+                                                             rocblas_int N,
+                                                             rocblas_int k_begin,
+                                                             rocblas_int k_end,
+                                                             const T*    dA,
+                                                             rocblas_int lda,
+                                                             const T*    dB,
+                                                             rocblas_int ldb,
+                                                             int         blx,
+                                                             int         bly,
+                                                             T (*sA)[BLK_M],
+                                                             T (*sB)[BLK_K],
+                                                             T (&rC)[BLK_N / DIM_N][BLK_M / DIM_M])
+    {
+        int thx  = threadIdx.x;
+        int thy  = threadIdx.y;
+        int idt  = DIM_M * thy + thx;
+        int thxA = idt % DIM_M_A;
+        int thyA = idt / DIM_M_A;
+        int thxB = idt % DIM_M_B;
+        int thyB = idt / DIM_M_B;
+
+        int a_i_offset = thxA + BLK_M * blx;
+        int b_j_offset = thyB + BLK_N * bly;
+
+        for(int n = 0; n < BLK_N / DIM_N; ++n)
+            for(int m = 0; m < BLK_M / DIM_M; ++m)
+                rC[n][m] = 0.0;
+
+        for(int kk = k_begin; kk < k_end; kk += BLK_K)
+        {
+            for(int n = 0; n < BLK_K; n += DIM_N_A)
+            {
+                for(int m = 0; m < BLK_M; m += DIM_M_A)
+                {
+                    int i = m + a_i_offset;
+                    int j = n + kk + thyA;
+                    if(i < M && j < k_end)
+                    {
+                        if(TRANS_A == 'N')
+                            sA[n + thyA][m + thxA] = dA[i + j * size_t(lda)];
+                        else if(TRANS_A == 'T')
+                            sA[n + thyA][m + thxA] = dA[i * size_t(lda) + j];
+                        else if(TRANS_A == 'C')
+                            sA[n + thyA][m + thxA] = conj(dA[i * size_t(lda) + j]);
+                    }
+                    else
+                    {
+                        sA[n + thyA][m + thxA] = 0.0;
+                    }
+                }
+            }
+
+            for(int n = 0; n < BLK_N; n += DIM_N_B)
+            {
+                for(int m = 0; m < BLK_K; m += DIM_M_B)
+                {
+                    int i = m + kk + thxB;
+                    int j = n + b_j_offset;
+                    if(i < k_end && j < N)
+                    {
+                        if(TRANS_B == 'N')
+                            sB[n + thyB][m + thxB] = dB[i + j * size_t(ldb)];
+                        else if(TRANS_B == 'T')
+                            sB[n + thyB][m + thxB] = dB[i * size_t(ldb) + j];
+                        else if(TRANS_B == 'C')
+                            sB[n + thyB][m + thxB] = conj(dB[i * size_t(ldb) + j]);
+                    }
+                    else
+                    {
+                        sB[n + thyB][m + thxB] = 0;
+                    }
+                }
+            }
+
+            __syncthreads();
+
+            for(int k = 0; k < BLK_K; ++k)
+                for(int n = 0; n < BLK_N / DIM_N; ++n)
+                    for(int m = 0; m < BLK_M / DIM_M; ++m)
+                        rC[n][m] += sA[k][m * DIM_M + thx] * sB[n * DIM_N + thy][k];
+
+            __syncthreads();
+        }
+    }
+
+    // Write a partial tile either atomically into C (which has already been scaled by beta)
+    // or into its slot in the workspace. Workspace slots are BLK_M x BLK_N, column major.
+    template <typename T, int DIM_M, int DIM_N, int BLK_M, int BLK_N, bool ATOMIC, typename U>
+    ROCBLAS_KERNEL_ILF void rocblas_gemm_tile_store_partial_device(
+        rocblas_int M,
+        rocblas_int N,
+        int         blx,
+        int         bly,
+        const T     alpha,
+        const T (&rC)[BLK_N / DIM_N][BLK_M / DIM_M],
+        U*          dC,
+        rocblas_int ldc,
+        T*          slot)
+    {
+        int thx = threadIdx.x;
+        int thy = threadIdx.y;
+        for(int n = 0; n < BLK_N / DIM_N; ++n)
+        {
+            for(int m = 0; m < BLK_M / DIM_M; ++m)
+            {
+                int tile_m = m * DIM_M + thx;
+                int tile_n = n * DIM_N + thy;
+                if constexpr(ATOMIC)
+                {
+                    int coord_dCm = blx * BLK_M + tile_m;
+                    int coord_dCn = bly * BLK_N + tile_n;
+                    if(coord_dCm < M && coord_dCn < N)
+                        atomicAdd(&dC[coord_dCn * size_t(ldc) + coord_dCm], alpha * rC[n][m]);
+                }
+                else
+                {
+                    slot[tile_n * BLK_M + tile_m] = rC[n][m];
+                }
+            }
+        }
+    }
+
+    // Split-K: gridDim.x = blocks_m * splits, each workgroup handles k_per_split of the k loop
+    // for one tile. k_per_split is a multiple of BLK_K.
+    template <typename T,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              char TRANS_A,
+              char TRANS_B,
+              bool ATOMIC,
+              typename TConstPtr,
+              typename TPtr>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_splitk_kernel(rocblas_int    M,
+                               rocblas_int    N,
+                               rocblas_int    K,
+                               rocblas_int    splits,
+                               rocblas_int    k_per_split,
+                               const T        alpha,
+                               TConstPtr*     dA_input,
+                               rocblas_int    lda,
+                               rocblas_stride a_st_or_of,
+                               TConstPtr*     dB_input,
+                               rocblas_int    ldb,
+                               rocblas_stride b_st_or_of,
+                               TPtr*          dC_input,
+                               rocblas_int    ldc,
+                               rocblas_stride c_st_or_of,
+                               T*             workspace)
+    {
+        int blocks_m = (M - 1) / BLK_M + 1;
+        int blocks_n = (N - 1) / BLK_N + 1;
+        int blx      = blockIdx.x % blocks_m; // block's m position
+        int split    = blockIdx.x / blocks_m; // block's k partition
+        int bly      = blockIdx.y; // block's n position
+        int blz      = blockIdx.z; // block's matrix in the batch
+
+        rocblas_int k_begin = split * k_per_split;
+        rocblas_int k_end   = k_begin + k_per_split < K ? k_begin + k_per_split : K;
+
+        auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
+        auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
+
+        __shared__ T sA[BLK_K][BLK_M];
+        __shared__ T sB[BLK_N][BLK_K];
+        T            rC[BLK_N / DIM_N][BLK_M / DIM_M];
+
+        rocblas_gemm_tile_partial_device<T,
+                                         DIM_M,
+                                         DIM_N,
+                                         BLK_M,
+                                         BLK_N,
+                                         BLK_K,
+                                         BLK_M,
+                                         BLK_K,
+                                         BLK_K,
+                                         BLK_N,
+                                         TRANS_A,
+                                         TRANS_B>(
+            M, N, k_begin, k_end, dA, lda, dB, ldb, blx, bly, sA, sB, rC);
+
+        size_t tile = (size_t(blz) * blocks_n + bly) * blocks_m + blx;
+        T*     slot = ATOMIC ? nullptr : workspace + (tile * splits + split) * BLK_M * BLK_N;
+
+        rocblas_gemm_tile_store_partial_device<T, DIM_M, DIM_N, BLK_M, BLK_N, ATOMIC>(
+            M, N, blx, bly, alpha, rC, ATOMIC ? load_ptr_batch(dC_input, blz, c_st_or_of) : nullptr,
+            ldc, slot);
+    }
+
+    // Stream-K: a persistent grid where workgroup b owns the contiguous range
+    // [b * block_iters, (b + 1) * block_iters) of the flattened (tile, k-iteration) space.
+    // Tiles may therefore be shared by two or more workgroups; a tile is never split into
+    // more than slots_per_tile pieces.
+    template <typename T,
+              int  DIM_M,
+              int  DIM_N,
+              int  BLK_M,
+              int  BLK_N,
+              int  BLK_K,
+              char TRANS_A,
+              char TRANS_B,
+              bool ATOMIC,
+              typename TConstPtr,
+              typename TPtr>
+    ROCBLAS_KERNEL(DIM_M* DIM_N)
+    rocblas_gemm_streamk_kernel(rocblas_int    M,
+                                rocblas_int    N,
+                                rocblas_int    K,
+                                int64_t        total_iters,
+                                int64_t        block_iters,
+                                rocblas_int    slots_per_tile,
+                                const T        alpha,
+                                TConstPtr*     dA_input,
+                                rocblas_int    lda,
+                                rocblas_stride a_st_or_of,
+                                TConstPtr*     dB_input,
+                                rocblas_int    ldb,
+                                rocblas_stride b_st_or_of,
+                                TPtr*          dC_input,
+                                rocblas_int    ldc,
+                                rocblas_stride c_st_or_of,
+                                T*             workspace)
+    {
+        int     blocks_m   = (M - 1) / BLK_M + 1;
+        int     blocks_n   = (N - 1) / BLK_N + 1;
+        int64_t tile_iters = (K - 1) / BLK_K + 1;
+
+        __shared__ T sA[BLK_K][BLK_M];
+        __shared__ T sB[BLK_N][BLK_K];
+        T            rC[BLK_N / DIM_N][BLK_M / DIM_M];
+
+        int64_t iter     = blockIdx.x * block_iters;
+        int64_t iter_end = iter + block_iters < total_iters ? iter + block_iters : total_iters;
+
+        while(iter < iter_end)
+        {
+            int64_t tile       = iter / tile_iters;
+            int64_t tile_begin = tile * tile_iters;
+            int64_t seg_end    = tile_begin + tile_iters < iter_end ? tile_begin + tile_iters
+                                                                    : iter_end;
+
+            int blx = tile % blocks_m;
+            int bly = (tile / blocks_m) % blocks_n;
+            int blz = tile / (int64_t(blocks_m) * blocks_n);
+
+            auto* dA = load_ptr_batch(dA_input, blz, a_st_or_of);
+            auto* dB = load_ptr_batch(dB_input, blz, b_st_or_of);
+
+            rocblas_int k_begin = (iter - tile_begin) * BLK_K;
+            int64_t     k_last  = (seg_end - tile_begin) * BLK_K;
+            rocblas_int k_end   = k_last < K ? k_last : K;
+
+            rocblas_gemm_tile_partial_device<T,
+                                             DIM_M,
+                                             DIM_N,
+                                             BLK_M,
+                                             BLK_N,
+                                             BLK_K,
+                                             BLK_M,
+                                             BLK_K,
+                                             BLK_K,
+                                             BLK_N,
+                                             TRANS_A,
+                                             TRANS_B>(
+                M, N, k_begin, k_end, dA, lda, dB, ldb, blx, bly, sA, sB, rC);
+
+            // the first workgroup touching this tile owns slot 0
+            int64_t first_block = tile_begin / block_iters;
+            T*      slot        = ATOMIC ? nullptr
+                                         : workspace
+                                    + (tile * slots_per_tile + (blockIdx.x - first_block))
+                                          * BLK_M * BLK_N;
+
+            rocblas_gemm_tile_store_partial_device<T, DIM_M, DIM_N, BLK_M, BLK_N, ATOMIC>(
+                M, N, blx, bly, alpha, rC,
+                ATOMIC ? load_ptr_batch(dC_input, blz, c_st_or_of) : nullptr, ldc, slot);
+
+            iter = seg_end;
+        }
+    }
+
+    // Deterministic fixup for split-K and stream-K. The partial tiles of each output tile are
+    // summed in increasing workgroup order, so results do not depend on scheduling.
+    // For split-K pass tile_iters = slots_per_tile = splits and block_iters = 1.
+    template <int  DIM_X,
+              int  DIM_Y,
+              int  BLK_M,
+              int  BLK_N,
+              bool BETA_EQ_ZERO,
+              typename T,
+              typename TPtr>
+    ROCBLAS_KERNEL(DIM_X* DIM_Y)
+    rocblas_gemm_partial_reduce_kernel(rocblas_int    M,
+                                       rocblas_int    N,
+                                       int64_t        tile_iters,
+                                       int64_t        block_iters,
+                                       rocblas_int    slots_per_tile,
+                                       const T        alpha,
+                                       const T*       workspace,
+                                       const T        beta,
+                                       TPtr*          dC_input,
+                                       rocblas_int    ldc,
+                                       rocblas_stride c_st_or_of)
+    {
+        int row = blockIdx.x * DIM_X + threadIdx.x;
+        int col = blockIdx.y * DIM_Y + threadIdx.y;
+        int blz = blockIdx.z;
+        if(row >= M || col >= N)
+            return;
+
+        int     blocks_m = (M - 1) / BLK_M + 1;
+        int     blocks_n = (N - 1) / BLK_N + 1;
+        int64_t tile     = (int64_t(blz) * blocks_n + col / BLK_N) * blocks_m + row / BLK_M;
+        int64_t first    = tile * tile_iters / block_iters;
+        int64_t last     = (tile * tile_iters + tile_iters - 1) / block_iters;
+        size_t  offset   = (col % BLK_N) * BLK_M + (row % BLK_M);
+
+        T sum = 0;
+        for(int64_t b = first; b <= last; ++b)
+            sum += workspace[(tile * slots_per_tile + (b - first)) * BLK_M * BLK_N + offset];
+
+        auto* dC = load_ptr_batch(dC_input, blz, c_st_or_of);
+        if(BETA_EQ_ZERO)
+            dC[col * size_t(ldc) + row] = alpha * sum;
+        else
+            dC[col * size_t(ldc) + row] = alpha * sum + beta * dC[col * size_t(ldc) + row];
+    }
+
+    // Partitioning strategy for the source gemm
+    enum class rocblas_gemm_source_algo
+    {
+        tiled, // one workgroup per output tile
+        split_k, // fixed number of k partitions per output tile
+        stream_k // persistent workgroups over a flattened (tile, k) iteration space
+    };
+
+    // Tile sizes used by the split-K and stream-K kernels
+    constexpr int ROCBLAS_GEMM_PARTITION_DIM = 16;
+    constexpr int ROCBLAS_GEMM_PARTITION_BLK = 32;
+    constexpr int ROCBLAS_GEMM_PARTITION_BLK_K = 8;
+
+    struct rocblas_gemm_source_partition
+    {
+        rocblas_gemm_source_algo algo        = rocblas_gemm_source_algo::tiled;
+        rocblas_int              splits      = 1; // split_k only
+        rocblas_int              k_per_split = 0; // split_k only
+        int64_t                  grid        = 0; // stream_k only, number of workgroups
+        int64_t                  tile_iters  = 0; // k iterations per output tile
+        int64_t                  block_iters = 0; // stream_k only, k iterations per workgroup
+        rocblas_int              slots       = 0; // partial tiles stored per output tile
+        size_t                   workspace   = 0; // bytes needed for deterministic reduction
+    };
+
+    /*! \brief Host-side heuristic choosing between the tiled, split-K and stream-K kernels.
+
+        Partitioning k only pays off when the output tiles alone cannot fill the device and
+        each partition still has enough k iterations to amortize the extra reduction traffic:
+        - fewer output tiles than half the CUs: split-K, with enough splits to cover the CUs
+        - a partial last wave of output tiles (up to 4 waves): stream-K, which balances the
+          iterations of all tiles evenly over exactly one wave of workgroups
+        - otherwise the classic one-tile-per-workgroup kernels
+    */
+    template <typename T>
+    inline rocblas_gemm_source_partition rocblas_gemm_source_select_partition(
+        rocblas_int m, rocblas_int n, rocblas_int k, rocblas_int batch_count, int cu_count)
+    {
+        // minimum number of BLK_K iterations handled by one workgroup in a partitioned tile
+        constexpr int64_t min_iters_per_partition = 16;
+        constexpr int     max_splits              = 64;
+        constexpr int64_t max_waves               = 4;
+
+        rocblas_gemm_source_partition p;
+
+        int64_t tiles = int64_t((m - 1) / ROCBLAS_GEMM_PARTITION_BLK + 1)
+                        * ((n - 1) / ROCBLAS_GEMM_PARTITION_BLK + 1) * batch_count;
+        int64_t tile_iters = (k - 1) / ROCBLAS_GEMM_PARTITION_BLK_K + 1;
+        size_t  slot_bytes = sizeof(T) * ROCBLAS_GEMM_PARTITION_BLK * ROCBLAS_GEMM_PARTITION_BLK;
+
+        if(cu_count <= 0 || tile_iters < 2 * min_iters_per_partition)
+            return p;
+
+        p.tile_iters = tile_iters;
+
+        if(2 * tiles <= cu_count)
+        {
+            int64_t splits = std::min<int64_t>({(cu_count + tiles - 1) / tiles,
+                                                tile_iters / min_iters_per_partition,
+                                                max_splits});
+            if(splits < 2)
+                return p;
+
+            // round k_per_split up to a multiple of BLK_K, then drop empty trailing splits
+            int64_t iters_per_split = (tile_iters + splits - 1) / splits;
+            splits                  = (tile_iters + iters_per_split - 1) / iters_per_split;
+
+            p.algo        = rocblas_gemm_source_algo::split_k;
+            p.splits      = rocblas_int(splits);
+            p.k_per_split = rocblas_int(iters_per_split * ROCBLAS_GEMM_PARTITION_BLK_K);
+            p.slots       = p.splits;
+            p.workspace   = size_t(tiles) * p.slots * slot_bytes;
+        }
+        else if(tiles < max_waves * cu_count && tiles % cu_count != 0)
+        {
+            int64_t total_iters = tiles * tile_iters;
+            int64_t block_iters = (total_iters + cu_count - 1) / cu_count;
+            if(block_iters < min_iters_per_partition)
+                return p;
+
+            p.algo        = rocblas_gemm_source_algo::stream_k;
+            p.grid        = (total_iters + block_iters - 1) / block_iters;
+            p.block_iters = block_iters;
+            p.slots       = rocblas_int((tile_iters - 1) / block_iters + 2);
+            p.workspace   = size_t(tiles) * p.slots * slot_bytes;
+        }
+
+        return p;
+    }
+
+    // Launch the split-K or stream-K kernels for one transpose combination
+    template <typename T,
+              char TRANS_A,
+              char TRANS_B,
+              bool ATOMIC,
+              typename TConstPtr,
+              typename TPtr>
+    void rocblas_gemm_source_partition_launch(const rocblas_gemm_source_partition& p,
+                                              rocblas_int                          m,
+                                              rocblas_int                          n,
+                                              rocblas_int                          k,
+                                              const T                              alpha,
+                                              TConstPtr*                           dA,
+                                              rocblas_int                          lda,
+                                              rocblas_stride                       a_st_or_of,
+                                              TConstPtr*                           dB,
+                                              rocblas_int                          ldb,
+                                              rocblas_stride                       b_st_or_of,
+                                              TPtr*                                dC,
+                                              rocblas_int                          ldc,
+                                              rocblas_stride                       c_st_or_of,
+                                              rocblas_int                          batch_count,
+                                              T*                                   workspace,
+                                              hipStream_t                          stream)
+    {
+        constexpr int dim   = ROCBLAS_GEMM_PARTITION_DIM;
+        constexpr int blk   = ROCBLAS_GEMM_PARTITION_BLK;
+        constexpr int blk_k = ROCBLAS_GEMM_PARTITION_BLK_K;
+
+        rocblas_int blocks_m = (m - 1) / blk + 1;
+        rocblas_int blocks_n = (n - 1) / blk + 1;
+        dim3        dimBlock(dim, dim, 1);
+
+        // clang-format off
+        if(p.algo == rocblas_gemm_source_algo::split_k)
+        {
+            dim3 dimGrid(blocks_m * p.splits, blocks_n, batch_count);
+            hipLaunchKernelGGL((rocblas_gemm_splitk_kernel
+                <T, dim, dim, blk, blk, blk_k, TRANS_A, TRANS_B, ATOMIC>),
+                dimGrid, dimBlock, 0, stream, m, n, k, p.splits, p.k_per_split, alpha, dA, lda,
+                a_st_or_of, dB, ldb, b_st_or_of, dC, ldc, c_st_or_of, workspace);
+        }
+        else
+        {
+            int64_t total_iters = p.tile_iters * blocks_m * blocks_n * batch_count;
+            dim3    dimGrid(p.grid, 1, 1);
+            hipLaunchKernelGGL((rocblas_gemm_streamk_kernel
+                <T, dim, dim, blk, blk, blk_k, TRANS_A, TRANS_B, ATOMIC>),
+                dimGrid, dimBlock, 0, stream, m, n, k, total_iters, p.block_iters, p.slots, alpha,
+                dA, lda, a_st_or_of, dB, ldb, b_st_or_of, dC, ldc, c_st_or_of, workspace);
+        }
+        // clang-format on
+    }
+
+    template <typename T, bool ATOMIC, typename TConstPtr, typename TPtr>
+    void rocblas_gemm_source_partition_dispatch(const rocblas_gemm_source_partition& p,
+                                                rocblas_operation                    trans_a,
+                                                rocblas_operation                    trans_b,
+                                                rocblas_int                          m,
+                                                rocblas_int                          n,
+                                                rocblas_int                          k,
+                                                const T                              alpha,
+                                                TConstPtr*                           dA,
+                                                rocblas_int                          lda,
+                                                rocblas_stride                       a_st_or_of,
+                                                TConstPtr*                           dB,
+                                                rocblas_int                          ldb,
+                                                rocblas_stride                       b_st_or_of,
+                                                TPtr*                                dC,
+                                                rocblas_int                          ldc,
+                                                rocblas_stride                       c_st_or_of,
+                                                rocblas_int                          batch_count,
+                                                T*                                   workspace,
+                                                hipStream_t                          stream)
+    {
+#define ROCBLAS_GEMM_PARTITION_LAUNCH(TA_, TB_)                                                \
+    rocblas_gemm_source_partition_launch<T, TA_, TB_, ATOMIC>(p,                               \
+                                                              m,                               \
+                                                              n,                               \
+                                                              k,                               \
+                                                              alpha,                           \
+                                                              dA,                              \
+                                                              lda,                             \
+                                                              a_st_or_of,                      \
+                                                              dB,                              \
+                                                              ldb,                             \
+                                                              b_st_or_of,                      \
+                                                              dC,                              \
+                                                              ldc,                             \
+                                                              c_st_or_of,                      \
+                                                              batch_count,                     \
+                                                              workspace,                       \
+                                                              stream)
+
+        // clang-format off
+        if(rocblas_operation_none == trans_a && rocblas_operation_none == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('N', 'N');
+        else if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('N', 'T');
+        else if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('N', 'C');
+        else if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('T', 'N');
+        else if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('T', 'T');
+        else if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('T', 'C');
+        else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('C', 'N');
+        else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('C', 'T');
+        else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
+            ROCBLAS_GEMM_PARTITION_LAUNCH('C', 'C');
+        // clang-format on
+
+#undef ROCBLAS_GEMM_PARTITION_LAUNCH
+    }
+
+    /*! \brief Try to run gemm with the split-K or stream-K kernels.
+
+        Returns false without launching anything if the heuristic prefers the tiled kernels,
+        in which case the caller falls back to them. With rocblas_atomics_allowed, float and
+        double partial tiles are accumulated with atomics into C after scaling it by beta;
+        otherwise partial tiles go to handle workspace and a fixed-order reduction kernel
+        produces bitwise reproducible results.
+    */
+    template <typename T, typename TConstPtr, typename TPtr>
+    bool rocblas_gemm_source_partitioned(rocblas_handle    handle,
+                                         rocblas_operation trans_a,
+                                         rocblas_operation trans_b,
+                                         rocblas_int       m,
+                                         rocblas_int       n,
+                                         rocblas_int       k,
+                                         const T           alpha,
+                                         TConstPtr*        dA_krn,
+                                         rocblas_int       lda,
+                                         rocblas_stride    a_st_or_of,
+                                         TConstPtr*        dB_krn,
+                                         rocblas_int       ldb,
+                                         rocblas_stride    b_st_or_of,
+                                         const T           beta,
+                                         TPtr*             dC,
+                                         TPtr*             dC_krn,
+                                         rocblas_int       ldc,
+                                         rocblas_stride    stride_c,
+                                         rocblas_stride    offset_c,
+                                         rocblas_stride    c_st_or_of,
+                                         rocblas_int       batch_count)
+    {
+        auto p = rocblas_gemm_source_select_partition<T>(
+            m, n, k, batch_count, handle->getCUCount());
+        if(p.algo == rocblas_gemm_source_algo::tiled)
+            return false;
+
+        hipStream_t stream = handle->get_stream();
+
+        // atomicAdd is only available for the real types
+        constexpr bool atomics_supported
+            = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+        if constexpr(atomics_supported)
+        {
+            if(handle->atomics_mode == rocblas_atomics_allowed)
+            {
+                if(rocblas_gemm_scale_template(
+                       m, n, beta, dC, offset_c, ldc, stride_c, batch_count, stream)
+                   != rocblas_status_success)
+                    return false;
+
+                rocblas_gemm_source_partition_dispatch<T, true>(p,
+                                                                trans_a,
+                                                                trans_b,
+                                                                m,
+                                                                n,
+                                                                k,
+                                                                alpha,
+                                                                dA_krn,
+                                                                lda,
+                                                                a_st_or_of,
+                                                                dB_krn,
+                                                                ldb,
+                                                                b_st_or_of,
+                                                                dC_krn,
+                                                                ldc,
+                                                                c_st_or_of,
+                                                                batch_count,
+                                                                (T*)nullptr,
+                                                                stream);
+                return true;
+            }
+        }
+
+        // The partial tiles must fit in the workspace which is currently available, as the
+        // handle cannot grow its workspace while a caller (e.g. trsm) holds part of it
+        if(p.workspace > handle->get_available_workspace())
+            return false;
+
+        auto w_mem = handle->device_malloc(p.workspace);
+        if(!w_mem)
+            return false;
+
+        T* workspace = (T*)w_mem;
+
+        rocblas_gemm_source_partition_dispatch<T, false>(p,
+                                                         trans_a,
+                                                         trans_b,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         dA_krn,
+                                                         lda,
+                                                         a_st_or_of,
+                                                         dB_krn,
+                                                         ldb,
+                                                         b_st_or_of,
+                                                         dC_krn,
+                                                         ldc,
+                                                         c_st_or_of,
+                                                         batch_count,
+                                                         workspace,
+                                                         stream);
+
+        constexpr int reduce_dim_x = 32;
+        constexpr int reduce_dim_y = 8;
+        constexpr int blk          = ROCBLAS_GEMM_PARTITION_BLK;
+
+        int64_t tile_iters  = p.algo == rocblas_gemm_source_algo::split_k ? p.splits : p.tile_iters;
+        int64_t block_iters = p.algo == rocblas_gemm_source_algo::split_k ? 1 : p.block_iters;
+
+        dim3 reduce_grid((m - 1) / reduce_dim_x + 1, (n - 1) / reduce_dim_y + 1, batch_count);
+        dim3 reduce_threads(reduce_dim_x, reduce_dim_y);
+
+        if(beta == 0)
+            hipLaunchKernelGGL(
+                (rocblas_gemm_partial_reduce_kernel<reduce_dim_x, reduce_dim_y, blk, blk, true>),
+                reduce_grid, reduce_threads, 0, stream, m, n, tile_iters, block_iters, p.slots,
+                alpha, (const T*)workspace, beta, dC_krn, ldc, c_st_or_of);
+        else
+            hipLaunchKernelGGL(
+                (rocblas_gemm_partial_reduce_kernel<reduce_dim_x, reduce_dim_y, blk, blk, false>),
+                reduce_grid, reduce_threads, 0, stream, m, n, tile_iters, block_iters, p.slots,
+                alpha, (const T*)workspace, beta, dC_krn, ldc, c_st_or_of);
+
+        return true;
+    }
+
     template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
-    void rocblas_gemm_source_solution(rocblas_operation trans_a,
+    void rocblas_gemm_source_solution(rocblas_handle    handle,
+                                      rocblas_operation trans_a,
                                       rocblas_operation trans_b,
                                       rocblas_int       m,
                                       rocblas_int       n,
@@ -579,6 +1277,30 @@ namespace
             c_st_or_of = stride_c;
         }
 
+        // small m * n with large k underutilizes the device with one workgroup per tile
+        if(rocblas_gemm_source_partitioned(handle,
+                                           trans_a,
+                                           trans_b,
+                                           m,
+                                           n,
+                                           k,
+                                           alpha,
+                                           dA_krn,
+                                           lda,
+                                           a_st_or_of,
+                                           dB_krn,
+                                           ldb,
+                                           b_st_or_of,
+                                           beta,
+                                           dC,
+                                           dC_krn,
+                                           ldc,
+                                           stride_c,
+                                           offset_c,
+                                           c_st_or_of,
+                                           batch_count))
+            return;
+
         if((m % 64 == 0) && (n % 64 == 0) && (k % 4 == 0))
         {
             //m is mult of 64, n is mult of 64, k is mult of 4
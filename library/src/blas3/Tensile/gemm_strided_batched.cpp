@@ -80,8 +80,24 @@ namespace
             rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_gemm_strided_batched_name<T>,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          lda,
+                          stride_a,
+                          ldb,
+                          stride_b,
+                          ldc,
+                          stride_c,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
+        ROCBLAS_HOST_TIMER_BEGIN(logging);
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
               | rocblas_layer_mode_log_profile))
@@ -177,9 +193,12 @@ namespace
                             batch_count);
             }
         }
+        ROCBLAS_HOST_TIMER_END(logging);
 
+        ROCBLAS_HOST_TIMER_BEGIN(arg_check);
         auto validArgs = rocblas_validateArgs(
             handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        ROCBLAS_HOST_TIMER_END(arg_check);
 
         if(validArgs != rocblas_status_continue)
             return validArgs;
@@ -126,7 +126,8 @@ rocblas_status rocblas_internal_gemm_template(rocblas_handle    handle,
             m, n, *beta, C, offset_c, ldc, stride_c, batch_count, rocblas_stream);
     }
 
-    rocblas_gemm_source_solution<BATCHED>(trans_a,
+    rocblas_gemm_source_solution<BATCHED>(handle,
+                                          trans_a,
                                           trans_b,
                                           m,
                                           n,
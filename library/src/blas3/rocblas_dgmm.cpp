@@ -55,6 +55,8 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle, rocblas_dgmm_name<T>, side, m, n, lda, incx, ldc);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
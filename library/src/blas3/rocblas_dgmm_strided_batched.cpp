@@ -61,6 +61,19 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_dgmm_strided_batched_name<T>,
+                          side,
+                          m,
+                          n,
+                          lda,
+                          stride_a,
+                          incx,
+                          stride_x,
+                          ldc,
+                          stride_c,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
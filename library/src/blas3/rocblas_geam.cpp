@@ -58,6 +58,8 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle, rocblas_geam_name<T>, transA, transB, m, n, lda, ldb, ldc);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
@@ -64,6 +64,20 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_geam_strided_batched_name<T>,
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          lda,
+                          stride_a,
+                          ldb,
+                          stride_b,
+                          ldc,
+                          stride_c,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
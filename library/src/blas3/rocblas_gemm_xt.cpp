@@ -0,0 +1,483 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "rocblas_gemm_xt.hpp"
+#include "Tensile/gemm.hpp"
+#include "handle.hpp"
+#include "logging.hpp"
+#include "rocblas.h"
+#include "utility.hpp"
+
+#include <deque>
+
+namespace
+{
+    template <typename>
+    constexpr char rocblas_gemm_xt_name[] = "unknown";
+    template <>
+    constexpr char rocblas_gemm_xt_name<float>[] = "rocblas_sgemm_xt";
+    template <>
+    constexpr char rocblas_gemm_xt_name<double>[] = "rocblas_dgemm_xt";
+    template <>
+    constexpr char rocblas_gemm_xt_name<rocblas_float_complex>[] = "rocblas_cgemm_xt";
+    template <>
+    constexpr char rocblas_gemm_xt_name<rocblas_double_complex>[] = "rocblas_zgemm_xt";
+
+    /***************************************************************************
+     * Device layer for rocblas_gemm_xt_schedule on one handle.
+     * gemms run on the handle's stream, while uploads and downloads use their
+     * own streams, ordered against the gemms with events per slot.
+     **************************************************************************/
+    template <typename T>
+    class rocblas_gemm_xt_hip_device
+    {
+        rocblas_handle handle;
+        decltype(std::declval<rocblas_handle>()->push_pointer_mode(rocblas_pointer_mode_host))
+            saved_pointer_mode;
+        decltype(std::declval<rocblas_handle>()->device_malloc(0)) w_mem;
+
+        hipStream_t upload_stream   = nullptr;
+        hipStream_t download_stream = nullptr;
+
+        T* dA[rocblas_gemm_xt_slots];
+        T* dB[rocblas_gemm_xt_slots];
+        T* dC[rocblas_gemm_xt_slots];
+
+        hipEvent_t ab_uploaded[rocblas_gemm_xt_slots] = {};
+        hipEvent_t ab_consumed[rocblas_gemm_xt_slots] = {};
+        hipEvent_t c_uploaded[rocblas_gemm_xt_slots]  = {};
+        hipEvent_t c_computed[rocblas_gemm_xt_slots]  = {};
+        hipEvent_t c_downloaded[rocblas_gemm_xt_slots] = {};
+
+        rocblas_status init_status = rocblas_status_success;
+
+        std::initializer_list<hipEvent_t*> all_events()
+        {
+            return {ab_uploaded, ab_consumed, c_uploaded, c_computed, c_downloaded};
+        }
+
+        rocblas_status create_streams_and_events()
+        {
+            auto saved_device_id = handle->push_device_id();
+
+            RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&upload_stream, hipStreamNonBlocking));
+            RETURN_IF_HIP_ERROR(hipStreamCreateWithFlags(&download_stream, hipStreamNonBlocking));
+
+            for(hipEvent_t* events : all_events())
+                for(int s = 0; s < rocblas_gemm_xt_slots; s++)
+                    RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&events[s], hipEventDisableTiming));
+
+            // Copies must not start before the buffers are allocated on the handle's stream
+            hipEvent_t start;
+            RETURN_IF_HIP_ERROR(hipEventCreateWithFlags(&start, hipEventDisableTiming));
+            hipError_t status = hipEventRecord(start, handle->get_stream());
+            if(status == hipSuccess)
+                status = hipStreamWaitEvent(upload_stream, start, 0);
+            if(status == hipSuccess)
+                status = hipStreamWaitEvent(download_stream, start, 0);
+            hipEventDestroy(start);
+
+            return get_rocblas_status_for_hip_status(status);
+        }
+
+    public:
+        static size_t workspace_size(int64_t block_dim)
+        {
+            return sizeof(T) * block_dim * block_dim;
+        }
+
+        rocblas_gemm_xt_hip_device(rocblas_handle handle, int64_t block_dim)
+            : handle(handle)
+            , saved_pointer_mode(handle->push_pointer_mode(rocblas_pointer_mode_host))
+            , w_mem(handle->device_malloc(workspace_size(block_dim),
+                                          workspace_size(block_dim),
+                                          workspace_size(block_dim),
+                                          workspace_size(block_dim),
+                                          workspace_size(block_dim),
+                                          workspace_size(block_dim)))
+        {
+            for(int s = 0; s < rocblas_gemm_xt_slots; s++)
+            {
+                dA[s] = static_cast<T*>(w_mem[3 * s]);
+                dB[s] = static_cast<T*>(w_mem[3 * s + 1]);
+                dC[s] = static_cast<T*>(w_mem[3 * s + 2]);
+            }
+
+            if(w_mem)
+                init_status = create_streams_and_events();
+        }
+
+        rocblas_gemm_xt_hip_device(const rocblas_gemm_xt_hip_device&) = delete;
+        rocblas_gemm_xt_hip_device& operator=(const rocblas_gemm_xt_hip_device&) = delete;
+
+        ~rocblas_gemm_xt_hip_device()
+        {
+            auto saved_device_id = handle->push_device_id();
+
+            for(hipEvent_t* events : all_events())
+                for(int s = 0; s < rocblas_gemm_xt_slots; s++)
+                    if(events[s])
+                        hipEventDestroy(events[s]);
+
+            if(upload_stream)
+                hipStreamDestroy(upload_stream);
+            if(download_stream)
+                hipStreamDestroy(download_stream);
+        }
+
+        rocblas_status status()
+        {
+            return w_mem ? init_status : rocblas_status_memory_error;
+        }
+
+        rocblas_status set_c(int c_slot, const T* C, int64_t ldc, int64_t m, int64_t n)
+        {
+            auto saved_device_id = handle->push_device_id();
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(upload_stream, c_downloaded[c_slot], 0));
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(dC[c_slot],
+                                                 sizeof(T) * m,
+                                                 C,
+                                                 sizeof(T) * ldc,
+                                                 sizeof(T) * m,
+                                                 n,
+                                                 hipMemcpyHostToDevice,
+                                                 upload_stream));
+            RETURN_IF_HIP_ERROR(hipEventRecord(c_uploaded[c_slot], upload_stream));
+            return rocblas_status_success;
+        }
+
+        rocblas_status set_ab(int      ab_slot,
+                              const T* A,
+                              int64_t  lda,
+                              int64_t  a_rows,
+                              int64_t  a_cols,
+                              const T* B,
+                              int64_t  ldb,
+                              int64_t  b_rows,
+                              int64_t  b_cols)
+        {
+            auto saved_device_id = handle->push_device_id();
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(upload_stream, ab_consumed[ab_slot], 0));
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(dA[ab_slot],
+                                                 sizeof(T) * a_rows,
+                                                 A,
+                                                 sizeof(T) * lda,
+                                                 sizeof(T) * a_rows,
+                                                 a_cols,
+                                                 hipMemcpyHostToDevice,
+                                                 upload_stream));
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(dB[ab_slot],
+                                                 sizeof(T) * b_rows,
+                                                 B,
+                                                 sizeof(T) * ldb,
+                                                 sizeof(T) * b_rows,
+                                                 b_cols,
+                                                 hipMemcpyHostToDevice,
+                                                 upload_stream));
+            RETURN_IF_HIP_ERROR(hipEventRecord(ab_uploaded[ab_slot], upload_stream));
+            return rocblas_status_success;
+        }
+
+        rocblas_status gemm(int               ab_slot,
+                            int               c_slot,
+                            rocblas_operation trans_a,
+                            rocblas_operation trans_b,
+                            int64_t           m,
+                            int64_t           n,
+                            int64_t           k,
+                            const T*          alpha,
+                            const T*          beta)
+        {
+            auto        saved_device_id = handle->push_device_id();
+            hipStream_t stream          = handle->get_stream();
+
+            // Never-recorded events are complete, so waiting on unused slots is harmless
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, ab_uploaded[ab_slot], 0));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, c_uploaded[c_slot], 0));
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(stream, c_downloaded[c_slot], 0));
+
+            rocblas_int lda = std::max(int64_t(1), trans_a == rocblas_operation_none ? m : k);
+            rocblas_int ldb = std::max(int64_t(1), trans_b == rocblas_operation_none ? k : n);
+
+            RETURN_IF_ROCBLAS_ERROR(rocblas_internal_gemm_template<T>(handle,
+                                                                      trans_a,
+                                                                      trans_b,
+                                                                      rocblas_int(m),
+                                                                      rocblas_int(n),
+                                                                      rocblas_int(k),
+                                                                      alpha,
+                                                                      dA[ab_slot],
+                                                                      0,
+                                                                      lda,
+                                                                      0,
+                                                                      dB[ab_slot],
+                                                                      0,
+                                                                      ldb,
+                                                                      0,
+                                                                      beta,
+                                                                      dC[c_slot],
+                                                                      0,
+                                                                      rocblas_int(m),
+                                                                      0,
+                                                                      1));
+
+            RETURN_IF_HIP_ERROR(hipEventRecord(ab_consumed[ab_slot], stream));
+            RETURN_IF_HIP_ERROR(hipEventRecord(c_computed[c_slot], stream));
+            return rocblas_status_success;
+        }
+
+        rocblas_status get_c(int c_slot, T* C, int64_t ldc, int64_t m, int64_t n)
+        {
+            auto saved_device_id = handle->push_device_id();
+            RETURN_IF_HIP_ERROR(hipStreamWaitEvent(download_stream, c_computed[c_slot], 0));
+            RETURN_IF_HIP_ERROR(hipMemcpy2DAsync(C,
+                                                 sizeof(T) * ldc,
+                                                 dC[c_slot],
+                                                 sizeof(T) * m,
+                                                 sizeof(T) * m,
+                                                 n,
+                                                 hipMemcpyDeviceToHost,
+                                                 download_stream));
+            RETURN_IF_HIP_ERROR(hipEventRecord(c_downloaded[c_slot], download_stream));
+            return rocblas_status_success;
+        }
+
+        rocblas_status synchronize()
+        {
+            auto saved_device_id = handle->push_device_id();
+
+            // Work on all streams must finish before the buffers are released
+            hipError_t upload_status   = hipStreamSynchronize(upload_stream);
+            hipError_t download_status = hipStreamSynchronize(download_stream);
+            hipError_t stream_status   = hipStreamSynchronize(handle->get_stream());
+
+            RETURN_IF_HIP_ERROR(upload_status);
+            RETURN_IF_HIP_ERROR(download_status);
+            RETURN_IF_HIP_ERROR(stream_status);
+            return rocblas_status_success;
+        }
+    };
+
+    template <typename T>
+    rocblas_status rocblas_gemm_xt_impl(const rocblas_handle* handles,
+                                        rocblas_int           num_handles,
+                                        rocblas_operation     trans_a,
+                                        rocblas_operation     trans_b,
+                                        rocblas_int           m,
+                                        rocblas_int           n,
+                                        rocblas_int           k,
+                                        const T*              alpha,
+                                        const T*              A,
+                                        rocblas_int           lda,
+                                        const T*              B,
+                                        rocblas_int           ldb,
+                                        const T*              beta,
+                                        T*                    C,
+                                        rocblas_int           ldc,
+                                        rocblas_int           block_dim)
+    {
+        if(!handles || num_handles <= 0)
+            return rocblas_status_invalid_handle;
+
+        for(rocblas_int i = 0; i < num_handles; i++)
+        {
+            if(!handles[i])
+                return rocblas_status_invalid_handle;
+
+            // Each handle's workspace is allocated once, so handles must be distinct
+            for(rocblas_int j = 0; j < i; j++)
+                if(handles[j] == handles[i])
+                    return rocblas_status_invalid_value;
+        }
+
+        rocblas_handle handle = handles[0];
+
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_gemm_xt_name<T>,
+                          num_handles,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          lda,
+                          ldb,
+                          ldc,
+                          block_dim);
+
+        auto layer_mode = handle->layer_mode;
+        if(layer_mode & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_profile))
+        {
+            auto trans_a_letter = rocblas_transpose_letter(trans_a);
+            auto trans_b_letter = rocblas_transpose_letter(trans_b);
+
+            if(layer_mode & rocblas_layer_mode_log_trace)
+                log_trace(handle,
+                          rocblas_gemm_xt_name<T>,
+                          num_handles,
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          alpha ? *alpha : T(0),
+                          A,
+                          lda,
+                          B,
+                          ldb,
+                          beta ? *beta : T(0),
+                          C,
+                          ldc,
+                          block_dim);
+
+            if(layer_mode & rocblas_layer_mode_log_profile)
+                log_profile(handle,
+                            rocblas_gemm_xt_name<T>,
+                            "num_handles",
+                            num_handles,
+                            "transA",
+                            trans_a_letter,
+                            "transB",
+                            trans_b_letter,
+                            "M",
+                            m,
+                            "N",
+                            n,
+                            "K",
+                            k,
+                            "lda",
+                            lda,
+                            "ldb",
+                            ldb,
+                            "ldc",
+                            ldc,
+                            "block_dim",
+                            block_dim);
+        }
+
+        if(block_dim < 0)
+            return rocblas_status_invalid_size;
+
+        // alpha and beta are always host pointers
+        auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+        auto validArgs = rocblas_validateArgs(
+            handle, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        if(validArgs != rocblas_status_continue)
+        {
+            // Size queries on quick return need no workspace
+            for(rocblas_int i = 0; i < num_handles; i++)
+                RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handles[i]);
+            return validArgs;
+        }
+
+        int64_t tile_dim = rocblas_gemm_xt_block_dim(m, n, k, block_dim);
+        size_t  size     = rocblas_gemm_xt_hip_device<T>::workspace_size(tile_dim);
+
+        bool           queried = false;
+        rocblas_status status  = rocblas_status_success;
+        for(rocblas_int i = 0; i < num_handles; i++)
+        {
+            if(handles[i]->is_device_memory_size_query())
+            {
+                queried = true;
+                status  = handles[i]->set_optimal_device_memory_size(
+                    size, size, size, size, size, size);
+            }
+        }
+        if(queried)
+            return status;
+
+        // The devices own streams and LIFO workspace, so they are constructed in place
+        std::deque<rocblas_gemm_xt_hip_device<T>> devices;
+        for(rocblas_int i = 0; i < num_handles; i++)
+        {
+            devices.emplace_back(handles[i], tile_dim);
+            RETURN_IF_ROCBLAS_ERROR(devices.back().status());
+        }
+
+        return rocblas_gemm_xt_schedule<T>(
+            devices, trans_a, trans_b, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, tile_dim);
+    }
+} // namespace
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+#ifdef IMPL
+#error IMPL ALREADY DEFINED
+#endif
+
+#define IMPL(routine_name_, T_)                                                   \
+    rocblas_status routine_name_(const rocblas_handle* handles,                  \
+                                 rocblas_int           num_handles,              \
+                                 rocblas_operation     transA,                   \
+                                 rocblas_operation     transB,                   \
+                                 rocblas_int           m,                        \
+                                 rocblas_int           n,                        \
+                                 rocblas_int           k,                        \
+                                 const T_*             alpha,                    \
+                                 const T_*             A,                        \
+                                 rocblas_int           lda,                      \
+                                 const T_*             B,                        \
+                                 rocblas_int           ldb,                      \
+                                 const T_*             beta,                     \
+                                 T_*                   C,                        \
+                                 rocblas_int           ldc,                      \
+                                 rocblas_int           block_dim)                \
+    try                                                                           \
+    {                                                                             \
+        return rocblas_gemm_xt_impl<T_>(handles,                                  \
+                                        num_handles,                              \
+                                        transA,                                   \
+                                        transB,                                   \
+                                        m,                                        \
+                                        n,                                        \
+                                        k,                                        \
+                                        alpha,                                    \
+                                        A,                                        \
+                                        lda,                                      \
+                                        B,                                        \
+                                        ldb,                                      \
+                                        beta,                                     \
+                                        C,                                        \
+                                        ldc,                                      \
+                                        block_dim);                               \
+    }                                                                             \
+    catch(...)                                                                    \
+    {                                                                             \
+        return exception_to_rocblas_status();                                     \
+    }
+
+IMPL(rocblas_sgemm_xt, float);
+IMPL(rocblas_dgemm_xt, double);
+IMPL(rocblas_cgemm_xt, rocblas_float_complex);
+IMPL(rocblas_zgemm_xt, rocblas_double_complex);
+
+#undef IMPL
+
+} // extern "C"
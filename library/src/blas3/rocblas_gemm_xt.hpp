@@ -0,0 +1,236 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/*******************************************************************************
+ * Multi-device gemm scheduling.
+ *
+ * C is split into block_dim x block_dim tiles which are distributed 2D
+ * block-cyclically over a process grid of devices. Each device streams the
+ * panels of op(A) and op(B) needed by its tiles through a small set of
+ * buffers, so that uploads of the next panel overlap the gemm on the current
+ * one. The scheduling only depends on the Device interface below, so it can be
+ * exercised on the host with a fake device layer.
+ ******************************************************************************/
+
+// Number of buffers per device for tiles of C and for panels of op(A) and op(B)
+constexpr int rocblas_gemm_xt_slots = 2;
+
+// Default tile size when block_dim == 0
+constexpr int64_t rocblas_gemm_xt_default_block_dim = 2048;
+
+// Process grid: tile (i, j) of C is owned by device (i % rows) * cols + j % cols
+struct rocblas_gemm_xt_grid
+{
+    int rows;
+    int cols;
+};
+
+struct rocblas_gemm_xt_tile
+{
+    int64_t row; // first row of the tile in C
+    int64_t col; // first column of the tile in C
+    int64_t m;
+    int64_t n;
+};
+
+// Most square process grid using all devices
+inline rocblas_gemm_xt_grid rocblas_gemm_xt_make_grid(int num_devices)
+{
+    int rows = 1;
+    for(int r = 2; r * r <= num_devices; r++)
+        if(num_devices % r == 0)
+            rows = r;
+    return {rows, num_devices / rows};
+}
+
+// Tile size actually used: no larger than the biggest dimension of the problem
+inline int64_t rocblas_gemm_xt_block_dim(int64_t m, int64_t n, int64_t k, int64_t block_dim)
+{
+    if(!block_dim)
+        block_dim = rocblas_gemm_xt_default_block_dim;
+    return std::max(int64_t(1), std::min(block_dim, std::max({m, n, k})));
+}
+
+// Tiles of C owned by each device, in column-major tile order
+inline std::vector<std::vector<rocblas_gemm_xt_tile>>
+    rocblas_gemm_xt_distribute(int64_t m, int64_t n, int64_t block_dim, int num_devices)
+{
+    rocblas_gemm_xt_grid                            grid = rocblas_gemm_xt_make_grid(num_devices);
+    std::vector<std::vector<rocblas_gemm_xt_tile>> tiles(num_devices);
+
+    for(int64_t col = 0; col < n; col += block_dim)
+        for(int64_t row = 0; row < m; row += block_dim)
+        {
+            int device = int((row / block_dim) % grid.rows) * grid.cols
+                         + int((col / block_dim) % grid.cols);
+            tiles[device].push_back(
+                {row, col, std::min(block_dim, m - row), std::min(block_dim, n - col)});
+        }
+
+    return tiles;
+}
+
+/*! \brief Computes C = alpha * op(A) * op(B) + beta * C with A, B and C in host memory.
+
+    devices is an indexable container whose elements provide the following
+    operations. Buffers hold at most block_dim x block_dim elements and are
+    packed with a leading dimension equal to their number of rows. Operations
+    may complete asynchronously, but must observe the ordering implied by the
+    slots: an upload into a slot waits for the previous gemm or download using
+    it, a gemm waits for the uploads into its slots, and a download waits for
+    the gemm writing its slot.
+
+        rocblas_status set_c(int c_slot, const T* C, int64_t ldc, int64_t m, int64_t n);
+        rocblas_status set_ab(int ab_slot,
+                              const T* A, int64_t lda, int64_t a_rows, int64_t a_cols,
+                              const T* B, int64_t ldb, int64_t b_rows, int64_t b_cols);
+        rocblas_status gemm(int ab_slot, int c_slot,
+                            rocblas_operation trans_a, rocblas_operation trans_b,
+                            int64_t m, int64_t n, int64_t k, const T* alpha, const T* beta);
+        rocblas_status get_c(int c_slot, T* C, int64_t ldc, int64_t m, int64_t n);
+        rocblas_status synchronize();
+
+    alpha and beta are host pointers. block_dim must already be resolved with
+    rocblas_gemm_xt_block_dim().
+*/
+template <typename T, typename Devices>
+rocblas_status rocblas_gemm_xt_schedule(Devices&             devices,
+                                        rocblas_operation    trans_a,
+                                        rocblas_operation    trans_b,
+                                        int64_t              m,
+                                        int64_t              n,
+                                        int64_t              k,
+                                        const T*             alpha,
+                                        const T*             A,
+                                        int64_t              lda,
+                                        const T*             B,
+                                        int64_t              ldb,
+                                        const T*             beta,
+                                        T*                   C,
+                                        int64_t              ldc,
+                                        int64_t              block_dim)
+{
+    const int  num_devices = int(devices.size());
+    const auto tiles       = rocblas_gemm_xt_distribute(m, n, block_dim, num_devices);
+
+    size_t rounds = 0;
+    for(const auto& device_tiles : tiles)
+        rounds = std::max(rounds, device_tiles.size());
+
+    // With k == 0 or alpha == 0 only C is scaled, so op(A) and op(B) are never read
+    const bool    read_c = *beta != T(0);
+    const int64_t k_eff  = k && *alpha != T(0) ? k : 0;
+    const T       zero   = T(0);
+    const T       one    = T(1);
+
+    std::vector<int> steps(num_devices);
+    rocblas_status   status = rocblas_status_success;
+
+    // Issue one tile per device per round so that all devices start working early
+    for(size_t t = 0; t < rounds && status == rocblas_status_success; t++)
+    {
+        for(int d = 0; d < num_devices && status == rocblas_status_success; d++)
+        {
+            if(t >= tiles[d].size())
+                continue;
+
+            auto&                       device = devices[d];
+            const rocblas_gemm_xt_tile& tile   = tiles[d][t];
+            const int                   c_slot = t % rocblas_gemm_xt_slots;
+            T*                          Ct     = C + tile.row + tile.col * ldc;
+
+            if(read_c)
+            {
+                status = device.set_c(c_slot, Ct, ldc, tile.m, tile.n);
+                if(status != rocblas_status_success)
+                    break;
+            }
+
+            if(!k_eff)
+                status = device.gemm(steps[d] % rocblas_gemm_xt_slots,
+                                     c_slot,
+                                     trans_a,
+                                     trans_b,
+                                     tile.m,
+                                     tile.n,
+                                     0,
+                                     &zero,
+                                     beta);
+
+            for(int64_t kk = 0; kk < k_eff && status == rocblas_status_success; kk += block_dim)
+            {
+                const int64_t kb      = std::min(block_dim, k_eff - kk);
+                const int     ab_slot = steps[d]++ % rocblas_gemm_xt_slots;
+
+                const bool a_none = trans_a == rocblas_operation_none;
+                const bool b_none = trans_b == rocblas_operation_none;
+
+                const T* At = a_none ? A + tile.row + kk * lda : A + kk + tile.row * lda;
+                const T* Bt = b_none ? B + kk + tile.col * ldb : B + tile.col + kk * ldb;
+
+                status = device.set_ab(ab_slot,
+                                       At,
+                                       lda,
+                                       a_none ? tile.m : kb,
+                                       a_none ? kb : tile.m,
+                                       Bt,
+                                       ldb,
+                                       b_none ? kb : tile.n,
+                                       b_none ? tile.n : kb);
+                if(status != rocblas_status_success)
+                    break;
+
+                // Later panels accumulate into the partial result
+                status = device.gemm(ab_slot,
+                                     c_slot,
+                                     trans_a,
+                                     trans_b,
+                                     tile.m,
+                                     tile.n,
+                                     kb,
+                                     alpha,
+                                     kk ? &one : beta);
+            }
+
+            if(status == rocblas_status_success)
+                status = device.get_c(c_slot, Ct, ldc, tile.m, tile.n);
+        }
+    }
+
+    // Downloads into C may still be in flight, so every device is drained even after an error
+    for(auto& device : devices)
+    {
+        rocblas_status sync_status = device.synchronize();
+        if(status == rocblas_status_success)
+            status = sync_status;
+    }
+
+    return status;
+}
@@ -66,6 +66,20 @@ namespace
             rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_her2k_name<T>,
+                          uplo,
+                          trans,
+                          n,
+                          k,
+                          lda,
+                          stride_a,
+                          ldb,
+                          stride_b,
+                          ldc,
+                          stride_c,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode
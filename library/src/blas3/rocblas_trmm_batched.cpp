@@ -67,6 +67,19 @@ namespace
             handle, alpha, beta, alpha_h, beta_h, m && n));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_trmm_batched_name<T>,
+                          side,
+                          uplo,
+                          transa,
+                          diag,
+                          m,
+                          n,
+                          lda,
+                          ldb,
+                          ldc,
+                          batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
         if(layer_mode
@@ -26,6 +26,7 @@
 #include "rocblas.h"
 #include "rocblas_block_sizes.h"
 #include "rocblas_trmm.hpp"
+#include "rocblas_trsm_refine.hpp"
 #include "trtri_trsm.hpp"
 #include "utility.hpp"
 
@@ -68,12 +69,15 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle, rocblas_trsm_name<T>, side, uplo, transA, diag, m, n, lda, ldb);
+
         auto check_numerics = handle->check_numerics;
         /////////////
         // LOGGING //
         /////////////
         if(!handle->is_device_memory_size_query())
         {
+            ROCBLAS_HOST_TIMER(logging);
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -143,8 +147,10 @@ namespace
             }
         }
 
+        ROCBLAS_HOST_TIMER_BEGIN(arg_check);
         rocblas_status arg_status = rocblas_trsm_arg_check(
             handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, 1);
+        ROCBLAS_HOST_TIMER_END(arg_check);
 
         if(arg_status != rocblas_status_continue)
             return arg_status;
@@ -179,11 +185,37 @@ namespace
                 return trsm_check_numerics_status;
         }
 
+        // Reuse the invA registered with rocblas_set_trsm_invA if A matches its fingerprint
+        rocblas_int k = side == rocblas_side_left ? m : n;
+        if(!supplied_invA
+           && handle->trsm_invA.matches(A, k, lda, uplo, diag, rocblas_datatype_from_type<T>))
+        {
+            supplied_invA      = static_cast<const T*>(handle->trsm_invA.invA);
+            supplied_invA_size = handle->trsm_invA.invA_size;
+        }
+
+        // A supplied invA is only for the solve in T. rocblas_status_continue from the
+        // refinement has the solve in T run as usual, and a size query reports the larger of
+        // the two workspaces since they are not in use at the same time.
+        rocblas_status status = rocblas_status_continue;
+        if constexpr(rocblas_is_refinement_type<T>)
+        {
+            if(!supplied_invA && handle->math_mode == rocblas_iterative_refinement_math)
+            {
+                status = rocblas_internal_trsm_refine_template(
+                    handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, 1, ldb);
+                if(status != rocblas_status_continue && status != rocblas_status_success
+                   && status != rocblas_status_size_increased
+                   && status != rocblas_status_size_unchanged)
+                    return status;
+            }
+        }
+
         //////////////////////
         // MEMORY MANAGEMENT//
         //////////////////////
-        rocblas_status status = rocblas_status_success;
         //kernel function is enclosed inside the brackets so that the handle device memory used by the kernel is released after the computation.
+        if(status == rocblas_status_continue || handle->is_device_memory_size_query())
         {
             // Proxy object holds the allocation. It must stay alive as long as mem_* pointers below are alive.
             auto           w_mem = handle->device_malloc(0);
@@ -208,7 +240,10 @@ namespace
 
             // If this was a device memory query or an error occurred, return status
             if(perf_status != rocblas_status_success && perf_status != rocblas_status_perf_degraded)
-                return perf_status;
+                return perf_status == rocblas_status_size_unchanged
+                               && status == rocblas_status_size_increased
+                           ? status
+                           : perf_status;
 
             bool optimal_mem = perf_status == rocblas_status_success;
 
@@ -267,6 +302,63 @@ namespace
         }
         return status;
     }
+
+    template <typename T>
+    rocblas_status rocblas_set_trsm_invA_impl(rocblas_handle   handle,
+                                              rocblas_side     side,
+                                              rocblas_fill     uplo,
+                                              rocblas_diagonal diag,
+                                              rocblas_int      m,
+                                              rocblas_int      n,
+                                              const T*         A,
+                                              rocblas_int      lda,
+                                              T*               invA,
+                                              rocblas_int      invA_size)
+    {
+        if(!handle)
+            return rocblas_status_invalid_handle;
+
+        if(!handle->is_device_memory_size_query()
+           && handle->layer_mode & rocblas_layer_mode_log_trace)
+            log_trace(
+                handle, "rocblas_set_trsm_invA", side, uplo, diag, m, n, A, lda, invA, invA_size);
+
+        if(side != rocblas_side_left && side != rocblas_side_right)
+            return rocblas_status_invalid_value;
+
+        if(uplo != rocblas_fill_lower && uplo != rocblas_fill_upper)
+            return rocblas_status_invalid_value;
+
+        if(diag != rocblas_diagonal_non_unit && diag != rocblas_diagonal_unit)
+            return rocblas_status_invalid_value;
+
+        rocblas_int k = side == rocblas_side_left ? m : n;
+        if(m < 0 || n < 0 || lda < k || invA_size / ROCBLAS_TRSM_NB < k)
+            return rocblas_status_invalid_size;
+
+        if(!k)
+            return handle->is_device_memory_size_query() ? rocblas_status_size_unchanged
+                                                         : rocblas_status_success;
+
+        if(!A || !invA)
+            return rocblas_status_invalid_pointer;
+
+        rocblas_status status
+            = rocblas_internal_trsm_invA_template<T>(handle, uplo, diag, k, A, lda, invA);
+        if(status != rocblas_status_success || handle->is_device_memory_size_query())
+            return status;
+
+        handle->trsm_invA.A         = A;
+        handle->trsm_invA.invA      = invA;
+        handle->trsm_invA.invA_size = invA_size;
+        handle->trsm_invA.k         = k;
+        handle->trsm_invA.lda       = lda;
+        handle->trsm_invA.uplo      = uplo;
+        handle->trsm_invA.diag      = diag;
+        handle->trsm_invA.type      = rocblas_datatype_from_type<T>;
+
+        return rocblas_status_success;
+    }
 }
 
 /*
@@ -453,4 +545,91 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+rocblas_status rocblas_set_trsm_invA(rocblas_handle   handle,
+                                     rocblas_side     side,
+                                     rocblas_fill     uplo,
+                                     rocblas_diagonal diag,
+                                     rocblas_int      m,
+                                     rocblas_int      n,
+                                     const void*      A,
+                                     rocblas_int      lda,
+                                     void*            invA,
+                                     rocblas_int      invA_size,
+                                     rocblas_datatype compute_type)
+try
+{
+    switch(compute_type)
+    {
+    case rocblas_datatype_f64_r:
+        return rocblas_set_trsm_invA_impl(handle,
+                                          side,
+                                          uplo,
+                                          diag,
+                                          m,
+                                          n,
+                                          static_cast<const double*>(A),
+                                          lda,
+                                          static_cast<double*>(invA),
+                                          invA_size);
+
+    case rocblas_datatype_f32_r:
+        return rocblas_set_trsm_invA_impl(handle,
+                                          side,
+                                          uplo,
+                                          diag,
+                                          m,
+                                          n,
+                                          static_cast<const float*>(A),
+                                          lda,
+                                          static_cast<float*>(invA),
+                                          invA_size);
+
+    case rocblas_datatype_f32_c:
+        return rocblas_set_trsm_invA_impl(handle,
+                                          side,
+                                          uplo,
+                                          diag,
+                                          m,
+                                          n,
+                                          static_cast<const rocblas_float_complex*>(A),
+                                          lda,
+                                          static_cast<rocblas_float_complex*>(invA),
+                                          invA_size);
+
+    case rocblas_datatype_f64_c:
+        return rocblas_set_trsm_invA_impl(handle,
+                                          side,
+                                          uplo,
+                                          diag,
+                                          m,
+                                          n,
+                                          static_cast<const rocblas_double_complex*>(A),
+                                          lda,
+                                          static_cast<rocblas_double_complex*>(invA),
+                                          invA_size);
+
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocblas_clear_trsm_invA(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_clear_trsm_invA");
+    handle->trsm_invA = {};
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 } // extern "C"
@@ -109,6 +109,15 @@ rocblas_status rocblas_internal_trsm_template_mem(rocblas_handle              ha
                                                   U                           supplied_invA,
                                                   rocblas_int                 supplied_invA_size);
 
+template <typename T>
+rocblas_status rocblas_internal_trsm_invA_template(rocblas_handle   handle,
+                                                   rocblas_fill     uplo,
+                                                   rocblas_diagonal diag,
+                                                   rocblas_int      k,
+                                                   const T*         A,
+                                                   rocblas_int      lda,
+                                                   T*               invA);
+
 template <typename T>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_trsm_workspace_size(rocblas_side      side,
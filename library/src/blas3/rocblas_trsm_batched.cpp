@@ -65,6 +65,9 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(
+            handle, rocblas_trsm_name<T>, side, uplo, transA, diag, m, n, lda, ldb, batch_count);
+
         auto check_numerics = handle->check_numerics;
         /////////////
         // LOGGING //
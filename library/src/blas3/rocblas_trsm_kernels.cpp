@@ -106,6 +106,16 @@
     {1,  1,  1,  1,  1,  1,  1,  1,  1,  1, 80, 80, 56, 56, 32, 32},        \
     {1, 64, 32, 32, 32, 64, 48, 32, 32, 32, 32, 32, 32, 32, 32, 32},        \
     {1,  1,  1,  1,  1,  1, 64, 64, 64, 64, 64, 64, 64, 48, 48, 48}
+
+// Tiny batched systems, max(m, n) <= 32: minimum batch_count for which the
+// multi-system-per-workgroup kernel is used, per max(m, n) interval. 0 disables it.
+#define TRSM_SMALL_BATCH_NUMINTERVALS 4
+#define TRSM_SMALL_BATCH_INTERVALS                                          \
+    4, 8, 16, 32
+#define TRSM_SMALL_BATCH_MIN_COUNT_REAL                                     \
+    16, 32, 128, 512
+#define TRSM_SMALL_BATCH_MIN_COUNT_COMPLEX                                  \
+    16, 32, 256, 0
 // clang-format on
 
 static constexpr rocblas_int trsm_intervals_row_real_batch[] = {TRSM_BATCH_INTERVALSROW_REAL};
@@ -126,6 +136,34 @@ static constexpr rocblas_int trsm_intervals_col_complex_nonbatch[] = {TRSM_INTER
 static constexpr rocblas_int trsm_blksizes_complex_nonbatch[][TRSM_NUMCOLS_COMPLEX]
     = {TRSM_BLKSIZES_COMPLEX};
 
+static constexpr rocblas_int trsm_small_batch_intervals[] = {TRSM_SMALL_BATCH_INTERVALS};
+static constexpr rocblas_int trsm_small_batch_min_count_real[] = {TRSM_SMALL_BATCH_MIN_COUNT_REAL};
+static constexpr rocblas_int trsm_small_batch_min_count_complex[]
+    = {TRSM_SMALL_BATCH_MIN_COUNT_COMPLEX};
+
+/*! \brief Returns the block size NB of the tiny batched trsm kernel for this problem, or 0 if
+ *         the regular small kernels should be used.
+ *
+ *  A single launch of the tiny batched kernel solves SYS systems per workgroup with the
+ *  right-hand sides held in registers, so it needs no workspace. It is selected when both m
+ *  and n fit in NB and batch_count reaches the tuned threshold for that size.
+ */
+template <typename T>
+static rocblas_int
+    rocblas_trsm_small_batch_nb(rocblas_int m, rocblas_int n, rocblas_int batch_count)
+{
+    const rocblas_int  k_max     = std::max(m, n);
+    const rocblas_int* min_count = rocblas_is_complex<T> ? trsm_small_batch_min_count_complex
+                                                         : trsm_small_batch_min_count_real;
+
+    for(int i = 0; i < TRSM_SMALL_BATCH_NUMINTERVALS; i++)
+    {
+        if(k_max <= trsm_small_batch_intervals[i])
+            return min_count[i] && batch_count >= min_count[i] ? trsm_small_batch_intervals[i] : 0;
+    }
+    return 0;
+}
+
 template <typename T>
 static const T alpha_negative_one = T(-1);
 template <typename T>
@@ -1636,6 +1674,27 @@ rocblas_int rocblas_trsm_blksize(rocblas_int m, rocblas_int n)
         If the user is unable to allocate w_x_tmp_arr_size bytes, w_x_tmp_size_backup
         bytes may be used in trsm with degraded performance.
     ********************************************************************/
+/*! \brief Temporary memory in bytes needed by rocblas_trtri_trsm_template to compute
+ *         the BLOCK x BLOCK diagonal block inverses of a k x k triangular matrix.
+ */
+template <rocblas_int BLOCK, typename T>
+static size_t rocblas_trsm_invA_c_temp_bytes(rocblas_int k)
+{
+    // When k < BLOCK, C is unnecessary for trtri
+    size_t c_temp_bytes = ((k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2))) * sizeof(T);
+
+    // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
+    if(k % BLOCK != 0)
+    {
+        // TODO: Make this more accurate -- right now it's much larger than necessary
+        size_t remainder_bytes = ROCBLAS_TRTRI_NB * BLOCK * 2 * sizeof(T);
+
+        // C is the maximum of the temporary space needed for TRTRI
+        c_temp_bytes = std::max(c_temp_bytes, remainder_bytes);
+    }
+    return c_temp_bytes;
+}
+
 template <rocblas_int BLOCK, bool BATCHED, typename T>
 rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
                                                     rocblas_operation transA,
@@ -1655,8 +1714,8 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
         return rocblas_status_invalid_pointer;
     }
 
-    // can use trsv kernel for n == 1 && left
-    if(n == 1 && side == rocblas_side_left)
+    // can use trsv kernel for n == 1 && left, unless the tiny batched kernel is used
+    if(n == 1 && side == rocblas_side_left && !rocblas_trsm_small_batch_nb<T>(m, n, batch_count))
     {
         *w_x_tmp_size        = batch_count * sizeof(rocblas_int);
         *w_x_tmp_arr_size    = 0;
@@ -1696,9 +1755,7 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
         return rocblas_status_continue;
     }
 
-    // Whether size is an exact multiple of blocksize
-    const bool exact_blocks = (k % BLOCK) == 0;
-    const bool use_special  = trsm_use_special_kernel<BLOCK, BATCHED, T>(
+    const bool use_special = trsm_use_special_kernel<BLOCK, BATCHED, T>(
         side, transA, m, n, batch_count, supplied_invA_size);
 
     size_t invA_temp_bytes     = 0;
@@ -1710,19 +1767,7 @@ rocblas_status rocblas_internal_trsm_workspace_size(rocblas_side      side,
     if(supplied_invA_size / BLOCK < k)
     {
         invA_temp_bytes = BLOCK * k * sizeof(T) * batch_count;
-
-        // When k < BLOCK, C is unnecessary for trtri
-        c_temp_bytes = ((k / BLOCK) * ((BLOCK / 2) * (BLOCK / 2))) * sizeof(T);
-
-        // For the TRTRI last diagonal block we need remainder space if k % BLOCK != 0
-        if(!exact_blocks)
-        {
-            // TODO: Make this more accurate -- right now it's much larger than necessary
-            size_t remainder_bytes = ROCBLAS_TRTRI_NB * BLOCK * 2 * sizeof(T);
-
-            // C is the maximum of the temporary space needed for TRTRI
-            c_temp_bytes = std::max(c_temp_bytes, remainder_bytes);
-        }
+        c_temp_bytes    = rocblas_trsm_invA_c_temp_bytes<BLOCK, T>(k);
     }
 
     // non-special kernel (regular left/right kernel) when not exact blocks. Also used
@@ -1821,6 +1866,44 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
 
 #undef TRSM_WORKSPACE_TEMPLATE_PARAMS
 
+/*! \brief Computes the packed ROCBLAS_TRSM_NB x ROCBLAS_TRSM_NB diagonal block inverses
+ *         of the k x k triangular matrix A into invA, in the layout accepted by trsm_ex.
+ *         Only the temporary memory of trtri is taken from the handle.
+ */
+template <typename T>
+rocblas_status rocblas_internal_trsm_invA_template(rocblas_handle   handle,
+                                                   rocblas_fill     uplo,
+                                                   rocblas_diagonal diag,
+                                                   rocblas_int      k,
+                                                   const T*         A,
+                                                   rocblas_int      lda,
+                                                   T*               invA)
+{
+    constexpr rocblas_int BLOCK = ROCBLAS_TRSM_NB;
+
+    size_t c_temp_bytes = rocblas_trsm_invA_c_temp_bytes<BLOCK, T>(k);
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(c_temp_bytes);
+
+    auto w_mem = handle->device_malloc(c_temp_bytes);
+    if(!w_mem)
+        return rocblas_status_memory_error;
+
+    return rocblas_trtri_trsm_template<BLOCK, false, T>(handle,
+                                                        (T*)w_mem[0],
+                                                        uplo,
+                                                        diag,
+                                                        k,
+                                                        A,
+                                                        0,
+                                                        lda,
+                                                        0,
+                                                        invA,
+                                                        0,
+                                                        BLOCK * k,
+                                                        1);
+}
+
 /**
  *  The purpose of this function is to allocate memory for trsm. It is added to remove
  *  memory allocation from the rocblas_internal_trsm_template function, but also allow code reuse
@@ -3005,6 +3088,279 @@ void rocblas_trsm_small(rocblas_handle    handle,
     }
 }
 
+/* T = float, double, etc.
+ * SCAL = T* or T
+ * ATYPE = const T* or const T* const *
+ * BTYPE = T* or T* const *
+ *
+ * Solves many tiny triangular systems in one launch, SYS systems per workgroup.
+ * Each system is rewritten as M * x = alpha * b for every right-hand side vector x, where
+ * M = op(A) for left side (x is a column of B) and M = op(A)^T for right side (x is a row of B).
+ * M is staged in shared memory, each thread keeps one x in registers.
+ *
+ * FORWARD: M is lower triangular
+ * READ_T:  M(i, j) is read from A(j, i)
+ */
+template <const int NB,
+          const int SYS,
+          bool      LEFT,
+          bool      FORWARD,
+          bool      READ_T,
+          bool      CONJ,
+          typename T,
+          typename SCAL,
+          typename ATYPE,
+          typename BTYPE>
+ROCBLAS_KERNEL(NB* SYS)
+rocblas_trsm_small_batched_device(rocblas_diagonal diag,
+                                  int              k,
+                                  int              nvec,
+                                  SCAL             alpha_dev_host,
+                                  ATYPE            Aa,
+                                  rocblas_stride   offset_A,
+                                  int              lda,
+                                  rocblas_stride   stride_A,
+                                  BTYPE            Ba,
+                                  rocblas_stride   offset_B,
+                                  int              ldb,
+                                  rocblas_stride   stride_B,
+                                  int              batch_count)
+{
+    const int tx      = threadIdx.x;
+    const int batchid = blockIdx.x * SYS + threadIdx.y;
+
+    // sM[i * NB + j] = M(i, j), one copy per system in the workgroup
+    __shared__ T sA[SYS][NB * NB];
+    T*           sM = sA[threadIdx.y];
+
+    if(batchid < batch_count && tx < k)
+    {
+        auto A = load_ptr_batch(Aa, batchid, offset_A, stride_A);
+
+        // thread tx loads column tx of the referenced triangle of M
+        for(int i = 0; i < k; i++)
+        {
+            if(FORWARD ? tx < i : tx > i)
+            {
+                T a = READ_T ? A[tx + i * size_t(lda)] : A[i + tx * size_t(lda)];
+                sM[i * NB + tx] = CONJ ? conj(a) : a;
+            }
+        }
+
+        // invert diagonal here so just have to multiply later
+        if(diag == rocblas_diagonal_unit)
+            sM[tx * NB + tx] = T(1.0);
+        else
+        {
+            T a              = A[tx + tx * size_t(lda)];
+            sM[tx * NB + tx] = T(1.0) / (CONJ ? conj(a) : a);
+        }
+    }
+    __syncthreads();
+
+    if(batchid >= batch_count || tx >= nvec)
+        return;
+
+    auto B     = load_ptr_batch(Ba, batchid, offset_B, stride_B);
+    auto alpha = load_scalar(alpha_dev_host);
+
+    // left: x is column tx of B, right: x is row tx of B
+    const size_t offset_x = LEFT ? tx * size_t(ldb) : tx;
+    const size_t inc_x    = LEFT ? 1 : ldb;
+
+    T x[NB];
+#pragma unroll
+    for(int i = 0; i < NB; i++)
+        if(i < k)
+            x[i] = alpha * B[offset_x + i * inc_x];
+
+    if constexpr(FORWARD)
+    {
+#pragma unroll
+        for(int i = 0; i < NB; i++)
+        {
+            if(i < k)
+            {
+                T res = x[i];
+#pragma unroll
+                for(int j = 0; j < i; j++)
+                    res -= sM[i * NB + j] * x[j];
+                x[i] = res * sM[i * NB + i];
+            }
+        }
+    }
+    else
+    {
+#pragma unroll
+        for(int i = NB - 1; i >= 0; i--)
+        {
+            if(i < k)
+            {
+                T res = x[i];
+#pragma unroll
+                for(int j = i + 1; j < NB; j++)
+                    if(j < k)
+                        res -= sM[i * NB + j] * x[j];
+                x[i] = res * sM[i * NB + i];
+            }
+        }
+    }
+
+#pragma unroll
+    for(int i = 0; i < NB; i++)
+        if(i < k)
+            B[offset_x + i * inc_x] = x[i];
+}
+
+template <const int NB,
+          bool      LEFT,
+          bool      TRANSA,
+          bool      CONJ,
+          typename T,
+          typename SCAL,
+          typename ATYPE,
+          typename BTYPE>
+void rocblas_trsm_small_batched_launcher(rocblas_handle   handle,
+                                         rocblas_fill     uplo,
+                                         rocblas_diagonal diag,
+                                         rocblas_int      k,
+                                         rocblas_int      nvec,
+                                         SCAL             alpha,
+                                         ATYPE            dA,
+                                         rocblas_stride   offset_A,
+                                         rocblas_int      lda,
+                                         rocblas_stride   stride_A,
+                                         BTYPE            dB,
+                                         rocblas_stride   offset_B,
+                                         rocblas_int      ldb,
+                                         rocblas_stride   stride_B,
+                                         rocblas_int      batch_count)
+{
+    // systems per workgroup: up to 256 threads, with at most 32 KiB of shared memory for A
+    constexpr int SYS = std::max(1, std::min(256 / NB, int(32 * 1024 / (NB * NB * sizeof(T)))));
+
+    // threadIdx.x = right-hand side vector, threadIdx.y = system within the workgroup
+    dim3 threads(NB, SYS);
+    dim3 grid((batch_count - 1) / SYS + 1);
+
+    // M = op(A) on the left and op(A)^T on the right
+    constexpr bool READ_T = LEFT == TRANSA;
+    const bool     lower  = uplo == rocblas_fill_lower;
+
+    if(LEFT ? lower != TRANSA : lower == TRANSA)
+        hipLaunchKernelGGL((rocblas_trsm_small_batched_device<NB,
+                                                              SYS,
+                                                              LEFT,
+                                                              true,
+                                                              READ_T,
+                                                              CONJ,
+                                                              T,
+                                                              SCAL,
+                                                              ATYPE,
+                                                              BTYPE>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           diag,
+                           k,
+                           nvec,
+                           alpha,
+                           dA,
+                           offset_A,
+                           lda,
+                           stride_A,
+                           dB,
+                           offset_B,
+                           ldb,
+                           stride_B,
+                           batch_count);
+    else
+        hipLaunchKernelGGL((rocblas_trsm_small_batched_device<NB,
+                                                              SYS,
+                                                              LEFT,
+                                                              false,
+                                                              READ_T,
+                                                              CONJ,
+                                                              T,
+                                                              SCAL,
+                                                              ATYPE,
+                                                              BTYPE>),
+                           grid,
+                           threads,
+                           0,
+                           handle->get_stream(),
+                           diag,
+                           k,
+                           nvec,
+                           alpha,
+                           dA,
+                           offset_A,
+                           lda,
+                           stride_A,
+                           dB,
+                           offset_B,
+                           ldb,
+                           stride_B,
+                           batch_count);
+}
+
+/* T = float, double, etc.
+ * SCAL = T* or T
+ * ATYPE = const T* or const T* const *
+ * BTYPE = T* or T* const *
+ *
+ * Launches the tiny batched trsm kernel, m <= NB and n <= NB.
+ */
+template <typename T, typename SCAL, typename ATYPE, typename BTYPE, const int NB>
+void rocblas_trsm_small_batched(rocblas_handle    handle,
+                                rocblas_side      side,
+                                rocblas_fill      uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal  diag,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                SCAL              alpha,
+                                ATYPE             dA,
+                                rocblas_stride    offset_A,
+                                rocblas_int       lda,
+                                rocblas_stride    stride_A,
+                                BTYPE             dB,
+                                rocblas_stride    offset_B,
+                                rocblas_int       ldb,
+                                rocblas_stride    stride_B,
+                                rocblas_int       batch_count)
+{
+#define TRSM_SMALL_BATCHED_PARAMS                                                            \
+    handle, uplo, diag, k, nvec, alpha, dA, offset_A, lda, stride_A, dB, offset_B, ldb, stride_B, \
+        batch_count
+
+    // clang-format off
+    if(side == rocblas_side_left)
+    {
+        const rocblas_int k = m, nvec = n;
+        if(transA == rocblas_operation_none)
+            rocblas_trsm_small_batched_launcher<NB, true, false, false, T>(TRSM_SMALL_BATCHED_PARAMS);
+        else if(transA == rocblas_operation_transpose)
+            rocblas_trsm_small_batched_launcher<NB, true, true, false, T>(TRSM_SMALL_BATCHED_PARAMS);
+        else
+            rocblas_trsm_small_batched_launcher<NB, true, true, true, T>(TRSM_SMALL_BATCHED_PARAMS);
+    }
+    else
+    {
+        const rocblas_int k = n, nvec = m;
+        if(transA == rocblas_operation_none)
+            rocblas_trsm_small_batched_launcher<NB, false, false, false, T>(TRSM_SMALL_BATCHED_PARAMS);
+        else if(transA == rocblas_operation_transpose)
+            rocblas_trsm_small_batched_launcher<NB, false, true, false, T>(TRSM_SMALL_BATCHED_PARAMS);
+        else
+            rocblas_trsm_small_batched_launcher<NB, false, true, true, T>(TRSM_SMALL_BATCHED_PARAMS);
+    }
+    // clang-format on
+
+#undef TRSM_SMALL_BATCHED_PARAMS
+}
+
 template <typename T,
           typename SCAL,
           typename ATYPE,
@@ -3395,7 +3751,10 @@ rocblas_status rocblas_internal_trsm_template(rocblas_handle    handle,
     rocblas_int k  = side == rocblas_side_left ? m : n;
     rocblas_int k1 = side == rocblas_side_left ? n : m;
 
-    if(n == 1 && side == rocblas_side_left)
+    // many tiny systems are solved in a single launch, several systems per workgroup
+    const rocblas_int small_batch_nb = rocblas_trsm_small_batch_nb<T>(m, n, batch_count);
+
+    if(n == 1 && side == rocblas_side_left && !small_batch_nb)
     {
         // left
         // B is essentially a vector (x, in trsv). Don't need ldb, can use 1 for incx.
@@ -3436,7 +3795,24 @@ rocblas_status rocblas_internal_trsm_template(rocblas_handle    handle,
 
         // These small substitution kernels still seem faster than full substitution method below
         bool is_small = (k <= 32) || (m <= 64 && n <= 64);
-        if(is_small)
+        if(small_batch_nb)
+        {
+#define TRSM_SMALL_BATCHED_PARAMS                                                             \
+    handle, side, uplo, transA, diag, m, n, alpha_h, A, offset_A, lda, stride_A, B, offset_B, ldb, \
+        stride_B, batch_count
+
+            if(small_batch_nb == 4)
+                rocblas_trsm_small_batched<T, T, U, V, 4>(TRSM_SMALL_BATCHED_PARAMS);
+            else if(small_batch_nb == 8)
+                rocblas_trsm_small_batched<T, T, U, V, 8>(TRSM_SMALL_BATCHED_PARAMS);
+            else if(small_batch_nb == 16)
+                rocblas_trsm_small_batched<T, T, U, V, 16>(TRSM_SMALL_BATCHED_PARAMS);
+            else
+                rocblas_trsm_small_batched<T, T, U, V, 32>(TRSM_SMALL_BATCHED_PARAMS);
+
+#undef TRSM_SMALL_BATCHED_PARAMS
+        }
+        else if(is_small)
         {
             if(k <= 2)
                 rocblas_trsm_small<T, T, U, V, 2>(handle,
@@ -4154,4 +4530,24 @@ INSTANTIATE_TRSM_MEM_TEMPLATE(true, rocblas_float_complex, const rocblas_float_c
 INSTANTIATE_TRSM_MEM_TEMPLATE(true, rocblas_double_complex, const rocblas_double_complex* const*)
 
 #undef INSTANTIATE_TRSM_MEM_TEMPLATE
+
+#ifdef INSTANTIATE_TRSM_INVA_TEMPLATE
+#error INSTANTIATE_TRSM_INVA_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_TRSM_INVA_TEMPLATE(T_)                                          \
+template rocblas_status rocblas_internal_trsm_invA_template<T_>(rocblas_handle   handle, \
+                                                                rocblas_fill     uplo,   \
+                                                                rocblas_diagonal diag,   \
+                                                                rocblas_int      k,      \
+                                                                const T_*        A,      \
+                                                                rocblas_int      lda,    \
+                                                                T_*              invA);
+
+INSTANTIATE_TRSM_INVA_TEMPLATE(float)
+INSTANTIATE_TRSM_INVA_TEMPLATE(double)
+INSTANTIATE_TRSM_INVA_TEMPLATE(rocblas_float_complex)
+INSTANTIATE_TRSM_INVA_TEMPLATE(rocblas_double_complex)
+
+#undef INSTANTIATE_TRSM_INVA_TEMPLATE
 // clang-format on
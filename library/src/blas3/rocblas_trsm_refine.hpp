@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+
+/*! \brief Types whose trsm and trsv solves go through rocblas_internal_trsm_refine_template
+    with rocblas_iterative_refinement_math, those with a single precision counterpart. */
+template <typename T>
+constexpr bool rocblas_is_refinement_type
+    = std::is_same_v<T, double> || std::is_same_v<T, rocblas_double_complex>;
+
+/**
+ * Solves op(A) * X = alpha * B or X * op(A) = alpha * B in single precision and refines X with
+ * residuals computed in T, as LAPACK dsgesv does for general systems:
+ *
+ *     X = op(A)^-1 * alpha * B                  single precision trsm
+ *     repeat
+ *         R = alpha * B - op(A) * X             trmm in T
+ *         stop if ||R|| <= tol * k * ||A|| * ||X||
+ *         X = X + op(A)^-1 * R                  single precision trsm reusing the diagonal
+ *                                               block inverses of the first solve
+ *
+ * The norms are the largest absolute elements, and tol is the handle's refinement tolerance or
+ * sqrt(k) * epsilon of T when it is not set. The norms are read back after each residual, so the
+ * stream is synchronized once per iteration.
+ *
+ * B is accessed with row increment incb so trsv can pass x with incx, and alpha may be nullptr
+ * for 1. Returns rocblas_status_continue, leaving B unchanged, when the residual has not
+ * converged within the handle's iteration cap or the workspace cannot be allocated, and the
+ * caller solves in T instead.
+ */
+template <typename T>
+rocblas_status rocblas_internal_trsm_refine_template(rocblas_handle    handle,
+                                                     rocblas_side      side,
+                                                     rocblas_fill      uplo,
+                                                     rocblas_operation transA,
+                                                     rocblas_diagonal  diag,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     const T*          alpha,
+                                                     const T*          A,
+                                                     rocblas_int       lda,
+                                                     T*                B,
+                                                     rocblas_int       incb,
+                                                     rocblas_int       ldb);
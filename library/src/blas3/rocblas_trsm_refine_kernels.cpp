@@ -0,0 +1,535 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "handle.hpp"
+#include "rocblas_block_sizes.h"
+#include "rocblas_trmm.hpp"
+#include "rocblas_trsm.hpp"
+#include "rocblas_trsm_refine.hpp"
+
+#include <cfloat>
+#include <cmath>
+
+namespace
+{
+    // Precision of the triangular solves for T
+    template <typename T>
+    using rocblas_refine_t
+        = std::conditional_t<rocblas_is_complex<T>, rocblas_float_complex, float>;
+
+    template <typename To, typename From>
+    __device__ __host__ inline To rocblas_refine_cast(From x)
+    {
+        if constexpr(rocblas_is_complex<To>)
+            return To(std::real(x), std::imag(x));
+        else
+            return To(x);
+    }
+
+    // |re| + |im| for complex, as the BLAS amax functions use
+    template <typename T>
+    __device__ __host__ inline double rocblas_refine_abs(T x)
+    {
+        if constexpr(rocblas_is_complex<T>)
+            return fabs(double(std::real(x))) + fabs(double(std::imag(x)));
+        else
+            return fabs(double(x));
+    }
+
+    // Device max is fmax, which drops a NaN operand, so the per thread maxima keep it instead
+    __device__ inline double rocblas_refine_max(double a, double b)
+    {
+        return b > a || b != b ? b : a;
+    }
+
+    // Non-negative doubles order like their bit patterns, so the maximum is reduced with
+    // integer atomics, first within the block and then once per block into norm. The NaN from
+    // fabs has the sign bit clear and orders above infinity, so it reaches norm.
+    template <int NB>
+    __device__ inline void rocblas_refine_block_max(double* norm, double val)
+    {
+        __shared__ unsigned long long block_max;
+        if(threadIdx.x == 0)
+            block_max = 0;
+        __syncthreads();
+        atomicMax(&block_max, (unsigned long long)__double_as_longlong(val));
+        __syncthreads();
+        if(threadIdx.x == 0)
+            atomicMax((unsigned long long*)norm, block_max);
+    }
+
+    // B0 = alpha * B and Xf = B0 rounded, with m by n B0 and Xf packed column major
+    template <int NB, typename T, typename Tf, typename TScal>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_load_kernel(rocblas_int m,
+                                    int64_t     mn,
+                                    TScal       alpha_device_host,
+                                    const T* __restrict__ B,
+                                    rocblas_int incb,
+                                    rocblas_int ldb,
+                                    T* __restrict__ B0,
+                                    Tf* __restrict__ Xf)
+    {
+        auto alpha = load_scalar(alpha_device_host);
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < mn;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            int64_t i = idx % m;
+            int64_t j = idx / m;
+
+            T b     = alpha * B[i * incb + j * ldb];
+            B0[idx] = b;
+            Xf[idx] = rocblas_refine_cast<Tf>(b);
+        }
+    }
+
+    // Af = A rounded with the other triangle zeroed, and norm = largest element of the triangle
+    template <int NB, typename T, typename Tf>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_copy_a_kernel(rocblas_fill     uplo,
+                                      rocblas_diagonal diag,
+                                      rocblas_int      k,
+                                      int64_t          kk,
+                                      const T* __restrict__ A,
+                                      rocblas_int lda,
+                                      Tf* __restrict__ Af,
+                                      double* __restrict__ norm)
+    {
+        double amax = 0;
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < kk;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            int64_t i = idx % k;
+            int64_t j = idx / k;
+
+            if(uplo == rocblas_fill_upper ? i <= j : i >= j)
+            {
+                T    a    = A[i + j * lda];
+                bool unit = i == j && diag == rocblas_diagonal_unit;
+
+                Af[idx] = rocblas_refine_cast<Tf>(a);
+                amax    = rocblas_refine_max(amax, unit ? 1.0 : rocblas_refine_abs(a));
+            }
+            else
+                Af[idx] = Tf(0);
+        }
+        rocblas_refine_block_max<NB>(norm, amax);
+    }
+
+    // Xf = B0 - R rounded, norms[0] = ||B0 - R|| and norms[1] = ||X||
+    template <int NB, typename T, typename Tf>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_residual_kernel(int64_t mn,
+                                        const T* __restrict__ B0,
+                                        const T* __restrict__ R,
+                                        const T* __restrict__ X,
+                                        Tf* __restrict__ Xf,
+                                        double* __restrict__ norms)
+    {
+        double rmax = 0;
+        double xmax = 0;
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < mn;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            T r     = B0[idx] - R[idx];
+            Xf[idx] = rocblas_refine_cast<Tf>(r);
+            rmax    = rocblas_refine_max(rmax, rocblas_refine_abs(r));
+            xmax    = rocblas_refine_max(xmax, rocblas_refine_abs(X[idx]));
+        }
+        rocblas_refine_block_max<NB>(norms, rmax);
+        rocblas_refine_block_max<NB>(norms + 1, xmax);
+    }
+
+    // X = Xf for the first solve, X += Xf for the corrections
+    template <int NB, bool FIRST, typename T, typename Tf>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_update_kernel(int64_t mn, const Tf* __restrict__ Xf, T* __restrict__ X)
+    {
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < mn;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            T d = rocblas_refine_cast<T>(Xf[idx]);
+            if(FIRST)
+                X[idx] = d;
+            else
+                X[idx] += d;
+        }
+    }
+
+    template <int NB, typename T>
+    ROCBLAS_KERNEL(NB)
+    rocblas_trsm_refine_store_kernel(rocblas_int m,
+                                     int64_t     mn,
+                                     const T* __restrict__ X,
+                                     T* __restrict__ B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb)
+    {
+        for(int64_t idx = blockIdx.x * int64_t(NB) + threadIdx.x; idx < mn;
+            idx += int64_t(gridDim.x) * NB)
+        {
+            int64_t i = idx % m;
+            int64_t j = idx / m;
+
+            B[i * incb + j * ldb] = X[idx];
+        }
+    }
+
+    // The element wise kernels are grid stride loops
+    constexpr int64_t c_refine_max_blocks = 65536;
+}
+
+template <typename T>
+rocblas_status rocblas_internal_trsm_refine_template(rocblas_handle    handle,
+                                                     rocblas_side      side,
+                                                     rocblas_fill      uplo,
+                                                     rocblas_operation transA,
+                                                     rocblas_diagonal  diag,
+                                                     rocblas_int       m,
+                                                     rocblas_int       n,
+                                                     const T*          alpha,
+                                                     const T*          A,
+                                                     rocblas_int       lda,
+                                                     T*                B,
+                                                     rocblas_int       incb,
+                                                     rocblas_int       ldb)
+{
+    using Tf                    = rocblas_refine_t<T>;
+    constexpr rocblas_int BLOCK = ROCBLAS_TRSM_NB;
+    constexpr int         NB    = 256;
+
+    // Each iteration waits on the host for its norms, which is illegal while the stream is
+    // captured into a graph, so a capturing stream takes the direct solve
+    if(handle->is_stream_in_capture_mode())
+        return rocblas_status_continue;
+
+    rocblas_int k  = side == rocblas_side_left ? m : n;
+    int64_t     mn = int64_t(m) * n;
+    int64_t     kk = int64_t(k) * k;
+
+    // workspace of the single precision trsm, the corrections pass the invA of the first solve
+    // back in which can select the other trsm kernel and its temporary size
+    size_t w_x_tmp_size, w_x_tmp_arr_size, w_invA_size, w_invA_arr_size, w_x_tmp_size_backup;
+
+    rocblas_status memory_status = rocblas_internal_trsm_workspace_size<Tf>(side,
+                                                                            transA,
+                                                                            m,
+                                                                            n,
+                                                                            1,
+                                                                            0,
+                                                                            &w_x_tmp_size,
+                                                                            &w_x_tmp_arr_size,
+                                                                            &w_invA_size,
+                                                                            &w_invA_arr_size,
+                                                                            &w_x_tmp_size_backup);
+    if(memory_status != rocblas_status_success && memory_status != rocblas_status_continue)
+        return memory_status;
+
+    if(w_invA_size)
+    {
+        size_t w_x_tmp_size_invA, unused_arr, unused_invA, unused_invA_arr, unused_backup;
+        memory_status = rocblas_internal_trsm_workspace_size<Tf>(side,
+                                                                 transA,
+                                                                 m,
+                                                                 n,
+                                                                 1,
+                                                                 BLOCK * k,
+                                                                 &w_x_tmp_size_invA,
+                                                                 &unused_arr,
+                                                                 &unused_invA,
+                                                                 &unused_invA_arr,
+                                                                 &unused_backup);
+        if(memory_status != rocblas_status_success && memory_status != rocblas_status_continue)
+            return memory_status;
+        w_x_tmp_size = std::max(w_x_tmp_size, w_x_tmp_size_invA);
+    }
+
+    size_t Af_size    = kk * sizeof(Tf);
+    size_t Xf_size    = mn * sizeof(Tf);
+    size_t X_size     = mn * sizeof(T);
+    size_t norms_size = 3 * sizeof(double);
+
+    if(handle->is_device_memory_size_query())
+        return handle->set_optimal_device_memory_size(
+            w_x_tmp_size, w_invA_size, Af_size, Xf_size, X_size, X_size, X_size, norms_size);
+
+    // B0, X and R are in T, norms holds ||R||, ||X|| and ||A||
+    auto w_mem = handle->device_malloc(
+        w_x_tmp_size, w_invA_size, Af_size, Xf_size, X_size, X_size, X_size, norms_size);
+    if(!w_mem)
+        return rocblas_status_continue;
+
+    void*   w_x_tmp = w_mem[0];
+    void*   w_invA  = w_mem[1];
+    Tf*     Af      = (Tf*)w_mem[2];
+    Tf*     Xf      = (Tf*)w_mem[3];
+    T*      B0      = (T*)w_mem[4];
+    T*      X       = (T*)w_mem[5];
+    T*      R       = (T*)w_mem[6];
+    double* norms   = (double*)w_mem[7];
+
+    hipStream_t rocblas_stream = handle->get_stream();
+    dim3        threads(NB);
+    dim3        mn_grid(std::min((mn - 1) / NB + 1, c_refine_max_blocks));
+    dim3        kk_grid(std::min((kk - 1) / NB + 1, c_refine_max_blocks));
+
+    int64_t shiftb = incb < 0 ? -int64_t(incb) * (m - 1) : 0;
+
+    // The solves and the residual product run with alpha = 1, alpha is applied to B0
+    rocblas_pointer_mode alpha_mode         = handle->pointer_mode;
+    auto                 saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
+
+    RETURN_IF_HIP_ERROR(hipMemsetAsync(norms, 0, norms_size, rocblas_stream));
+
+    if(!alpha)
+        hipLaunchKernelGGL((rocblas_trsm_refine_load_kernel<NB>),
+                           mn_grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           mn,
+                           T(1),
+                           B + shiftb,
+                           incb,
+                           ldb,
+                           B0,
+                           Xf);
+    else if(alpha_mode == rocblas_pointer_mode_device)
+        hipLaunchKernelGGL((rocblas_trsm_refine_load_kernel<NB>),
+                           mn_grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           mn,
+                           alpha,
+                           B + shiftb,
+                           incb,
+                           ldb,
+                           B0,
+                           Xf);
+    else
+        hipLaunchKernelGGL((rocblas_trsm_refine_load_kernel<NB>),
+                           mn_grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           m,
+                           mn,
+                           *alpha,
+                           B + shiftb,
+                           incb,
+                           ldb,
+                           B0,
+                           Xf);
+
+    hipLaunchKernelGGL((rocblas_trsm_refine_copy_a_kernel<NB>),
+                       kk_grid,
+                       threads,
+                       0,
+                       rocblas_stream,
+                       uplo,
+                       diag,
+                       k,
+                       kk,
+                       A,
+                       lda,
+                       Af,
+                       norms + 2);
+
+    const Tf one_f = Tf(1);
+    const T  one   = T(1);
+
+    // The first solve computes the diagonal block inverses into w_invA, if the trsm path uses
+    // them, and the corrections supply them back
+    const Tf*   supplied_invA      = nullptr;
+    rocblas_int supplied_invA_size = 0;
+
+    auto solve = [&]() {
+        rocblas_status status = rocblas_internal_trsm_template(handle,
+                                                               side,
+                                                               uplo,
+                                                               transA,
+                                                               diag,
+                                                               m,
+                                                               n,
+                                                               &one_f,
+                                                               (const Tf*)Af,
+                                                               0,
+                                                               k,
+                                                               0,
+                                                               Xf,
+                                                               0,
+                                                               m,
+                                                               0,
+                                                               1,
+                                                               true,
+                                                               w_x_tmp,
+                                                               nullptr,
+                                                               w_invA,
+                                                               nullptr,
+                                                               supplied_invA,
+                                                               supplied_invA_size);
+        if(w_invA)
+        {
+            supplied_invA      = (const Tf*)w_invA;
+            supplied_invA_size = BLOCK * k;
+        }
+        return status;
+    };
+
+    rocblas_status status = solve();
+    if(status != rocblas_status_success)
+        return status;
+
+    hipLaunchKernelGGL((rocblas_trsm_refine_update_kernel<NB, true>),
+                       mn_grid,
+                       threads,
+                       0,
+                       rocblas_stream,
+                       mn,
+                       (const Tf*)Xf,
+                       X);
+
+    double tolerance = handle->refinement_tolerance > 0 ? handle->refinement_tolerance
+                                                        : std::sqrt(double(k)) * DBL_EPSILON;
+    bool   converged = false;
+
+    for(rocblas_int iter = 0;; iter++)
+    {
+        status = rocblas_internal_trmm_template(handle,
+                                                side,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                m,
+                                                n,
+                                                &one,
+                                                0,
+                                                A,
+                                                0,
+                                                lda,
+                                                0,
+                                                (const T*)X,
+                                                0,
+                                                m,
+                                                0,
+                                                R,
+                                                0,
+                                                m,
+                                                0,
+                                                1);
+        if(status != rocblas_status_success)
+            return status;
+
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(norms, 0, 2 * sizeof(double), rocblas_stream));
+        hipLaunchKernelGGL((rocblas_trsm_refine_residual_kernel<NB>),
+                           mn_grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           mn,
+                           (const T*)B0,
+                           (const T*)R,
+                           (const T*)X,
+                           Xf,
+                           norms);
+
+        double h_norms[3];
+        RETURN_IF_HIP_ERROR(
+            hipMemcpyAsync(h_norms, norms, norms_size, hipMemcpyDeviceToHost, rocblas_stream));
+        RETURN_IF_HIP_ERROR(hipStreamSynchronize(rocblas_stream));
+
+        // An inf or NaN norm makes the test pass or fail regardless of the solution, so the
+        // double precision solve takes over
+        if(!std::isfinite(h_norms[0]) || !std::isfinite(h_norms[1]) || !std::isfinite(h_norms[2]))
+            break;
+
+        if(h_norms[0] <= tolerance * k * h_norms[2] * h_norms[1])
+        {
+            converged = true;
+            break;
+        }
+
+        if(iter >= handle->refinement_max_iterations)
+            break;
+
+        status = solve();
+        if(status != rocblas_status_success)
+            return status;
+
+        hipLaunchKernelGGL((rocblas_trsm_refine_update_kernel<NB, false>),
+                           mn_grid,
+                           threads,
+                           0,
+                           rocblas_stream,
+                           mn,
+                           (const Tf*)Xf,
+                           X);
+    }
+
+    if(!converged)
+        return rocblas_status_continue;
+
+    hipLaunchKernelGGL((rocblas_trsm_refine_store_kernel<NB>),
+                       mn_grid,
+                       threads,
+                       0,
+                       rocblas_stream,
+                       m,
+                       mn,
+                       (const T*)X,
+                       B + shiftb,
+                       incb,
+                       ldb);
+
+    return rocblas_status_success;
+}
+
+// clang-format off
+#ifdef INSTANTIATE_TRSM_REFINE_TEMPLATE
+#error INSTANTIATE_TRSM_REFINE_TEMPLATE already defined
+#endif
+
+#define INSTANTIATE_TRSM_REFINE_TEMPLATE(T_)                                           \
+template rocblas_status rocblas_internal_trsm_refine_template<T_>                      \
+                                           (rocblas_handle    handle,                  \
+                                            rocblas_side      side,                    \
+                                            rocblas_fill      uplo,                    \
+                                            rocblas_operation transA,                  \
+                                            rocblas_diagonal  diag,                    \
+                                            rocblas_int       m,                       \
+                                            rocblas_int       n,                       \
+                                            const T_*         alpha,                   \
+                                            const T_*         A,                       \
+                                            rocblas_int       lda,                     \
+                                            T_*               B,                       \
+                                            rocblas_int       incb,                    \
+                                            rocblas_int       ldb);
+
+INSTANTIATE_TRSM_REFINE_TEMPLATE(double)
+INSTANTIATE_TRSM_REFINE_TEMPLATE(rocblas_double_complex)
+
+#undef INSTANTIATE_TRSM_REFINE_TEMPLATE
+
+// clang-format on
@@ -72,6 +72,20 @@ namespace
         if(!handle)
             return rocblas_status_invalid_handle;
 
+        ROCBLAS_API_RANGE(handle,
+                          rocblas_trsm_name<T>,
+                          side,
+                          uplo,
+                          transA,
+                          diag,
+                          m,
+                          n,
+                          lda,
+                          stride_A,
+                          ldb,
+                          stride_B,
+                          batch_count);
+
         auto check_numerics = handle->check_numerics;
         /////////////
         // LOGGING //
@@ -59,6 +59,8 @@ namespace
             return handle->set_optimal_device_memory_size(size);
         }
 
+        ROCBLAS_API_RANGE(handle, rocblas_trtri_name<T>, uplo, diag, n, lda, ldinvA);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
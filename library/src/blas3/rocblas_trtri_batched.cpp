@@ -64,6 +64,8 @@ namespace
             return handle->set_optimal_device_memory_size(size, sizep);
         }
 
+        ROCBLAS_API_RANGE(handle, rocblas_trtri_name<T>, uplo, diag, n, lda, ldinvA, batch_count);
+
         auto layer_mode     = handle->layer_mode;
         auto check_numerics = handle->check_numerics;
 
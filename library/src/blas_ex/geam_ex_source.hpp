@@ -26,6 +26,211 @@
 
 namespace
 {
+    template <typename T>
+    __device__ T geam_ex_min(T a, T b)
+    {
+        return fminf(a, b);
+    }
+
+    template <>
+    __device__ double geam_ex_min(double a, double b)
+    {
+        return fmin(a, b);
+    }
+
+    template <typename T>
+    __device__ T geam_ex_max(T a, T b)
+    {
+        return fmaxf(a, b);
+    }
+
+    template <>
+    __device__ double geam_ex_max(double a, double b)
+    {
+        return fmax(a, b);
+    }
+
+    /*
+     * Semirings computed by geam_ex as
+     *
+     *     Dij = add(beta * Cij, add_k(mul(alpha * Aik, alpha * Bkj)))
+     *
+     * set_identity gives the identity of add, used to initialize the accumulators.
+     * set_padding gives the value loaded for out-of-bounds elements of A and B; it is
+     * chosen such that mul(padding, padding) leaves the reduction unchanged.
+     */
+    template <rocblas_geam_ex_operation OP>
+    struct geam_ex_semiring;
+
+    template <>
+    struct geam_ex_semiring<rocblas_geam_ex_operation_min_plus>
+    {
+        template <typename T>
+        __device__ static T add(T a, T b)
+        {
+            return geam_ex_min(a, b);
+        }
+
+        template <typename T>
+        __device__ static T mul(T a, T b)
+        {
+            return a + b;
+        }
+
+        template <typename T>
+        __device__ static void set_identity(T& val)
+        {
+            rocblas_set_max_value(val);
+        }
+
+        template <typename T>
+        __device__ static void set_padding(T& val)
+        {
+            rocblas_set_max_value(val);
+        }
+    };
+
+    template <>
+    struct geam_ex_semiring<rocblas_geam_ex_operation_plus_min>
+    {
+        template <typename T>
+        __device__ static T add(T a, T b)
+        {
+            return a + b;
+        }
+
+        template <typename T>
+        __device__ static T mul(T a, T b)
+        {
+            return geam_ex_min(a, b);
+        }
+
+        template <typename T>
+        __device__ static void set_identity(T& val)
+        {
+            val = 0;
+        }
+
+        template <typename T>
+        __device__ static void set_padding(T& val)
+        {
+            val = 0;
+        }
+    };
+
+    template <>
+    struct geam_ex_semiring<rocblas_geam_ex_operation_max_plus>
+    {
+        template <typename T>
+        __device__ static T add(T a, T b)
+        {
+            return geam_ex_max(a, b);
+        }
+
+        template <typename T>
+        __device__ static T mul(T a, T b)
+        {
+            return a + b;
+        }
+
+        template <typename T>
+        __device__ static void set_identity(T& val)
+        {
+            rocblas_set_lowest_value(val);
+        }
+
+        template <typename T>
+        __device__ static void set_padding(T& val)
+        {
+            rocblas_set_lowest_value(val);
+        }
+    };
+
+    template <>
+    struct geam_ex_semiring<rocblas_geam_ex_operation_min_max>
+    {
+        template <typename T>
+        __device__ static T add(T a, T b)
+        {
+            return geam_ex_min(a, b);
+        }
+
+        template <typename T>
+        __device__ static T mul(T a, T b)
+        {
+            return geam_ex_max(a, b);
+        }
+
+        template <typename T>
+        __device__ static void set_identity(T& val)
+        {
+            rocblas_set_max_value(val);
+        }
+
+        template <typename T>
+        __device__ static void set_padding(T& val)
+        {
+            rocblas_set_max_value(val);
+        }
+    };
+
+    template <>
+    struct geam_ex_semiring<rocblas_geam_ex_operation_max_min>
+    {
+        template <typename T>
+        __device__ static T add(T a, T b)
+        {
+            return geam_ex_max(a, b);
+        }
+
+        template <typename T>
+        __device__ static T mul(T a, T b)
+        {
+            return geam_ex_min(a, b);
+        }
+
+        template <typename T>
+        __device__ static void set_identity(T& val)
+        {
+            rocblas_set_lowest_value(val);
+        }
+
+        template <typename T>
+        __device__ static void set_padding(T& val)
+        {
+            rocblas_set_lowest_value(val);
+        }
+    };
+
+    // Boolean semiring, any non-zero value is true and results are 0 or 1
+    template <>
+    struct geam_ex_semiring<rocblas_geam_ex_operation_or_and>
+    {
+        template <typename T>
+        __device__ static T add(T a, T b)
+        {
+            return (a != T(0) || b != T(0)) ? T(1) : T(0);
+        }
+
+        template <typename T>
+        __device__ static T mul(T a, T b)
+        {
+            return (a != T(0) && b != T(0)) ? T(1) : T(0);
+        }
+
+        template <typename T>
+        __device__ static void set_identity(T& val)
+        {
+            val = 0;
+        }
+
+        template <typename T>
+        __device__ static void set_padding(T& val)
+        {
+            val = 0;
+        }
+    };
+
     /*
      * Copies data from d_a into a, and d_b into b. Intended to copy
      * global memory into local memory for the kernel.
@@ -40,9 +245,9 @@ namespace
               rocblas_int DIM_M_A,
               rocblas_int DIM_N_B,
               rocblas_int DIM_M_B,
-              bool        ALPHA_ONE,
-              bool        MINPLUS,
-              bool        BOUNDS,
+              bool                      ALPHA_ONE,
+              rocblas_geam_ex_operation OP,
+              bool                      BOUNDS,
               typename T,
               typename U>
     __device__ void global_to_local(T        a[BUFA_M][BUFA_N],
@@ -90,12 +295,7 @@ namespace
                 }
 
                 if(BOUNDS && out_of_bounds)
-                {
-                    if constexpr(MINPLUS)
-                        rocblas_set_max_value(a[i][j]);
-                    else
-                        a[i][j] = 0;
-                }
+                    geam_ex_semiring<OP>::set_padding(a[i][j]);
                 else if(ALPHA_ONE)
                     a[i][j] = d_a[aj * lda + ai];
                 else
@@ -128,12 +328,7 @@ namespace
                 }
 
                 if(BOUNDS && out_of_bounds)
-                {
-                    if constexpr(MINPLUS)
-                        rocblas_set_max_value(b[i][j]);
-                    else
-                        b[i][j] = 0;
-                }
+                    geam_ex_semiring<OP>::set_padding(b[i][j]);
                 else if(ALPHA_ONE)
                     b[i][j] = d_b[bj * ldb + bi];
                 else
@@ -142,28 +337,22 @@ namespace
         }
     }
 
-    template <typename T, typename U, std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_min(const T& c_in, U& c_out)
-    {
-        c_out = c_in;
-    }
-
-    template <typename T, typename U, std::enable_if_t<rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_min(const T& c_in, U& c_out)
-    {
-        c_out = fminf(c_in.x, c_in.y);
-    }
-
-    template <typename T, typename U, std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_add(const T& c_in, U& c_out)
+    template <typename S,
+              typename T,
+              typename U,
+              std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
+    __device__ void vector2_reduce(const T& c_in, U& c_out)
     {
         c_out = c_in;
     }
 
-    template <typename T, typename U, std::enable_if_t<rocblas_is_array2<T>, int> = 0>
-    __device__ void vector2_add(const T& c_in, U& c_out)
+    template <typename S,
+              typename T,
+              typename U,
+              std::enable_if_t<rocblas_is_array2<T>, int> = 0>
+    __device__ void vector2_reduce(const T& c_in, U& c_out)
     {
-        c_out = c_in.x + c_in.y;
+        c_out = S::template add<U>(c_in.x, c_in.y);
     }
 
     /*
@@ -172,9 +361,9 @@ namespace
     template <rocblas_int THR_N,
               rocblas_int THR_M,
               rocblas_int DIM_N,
-              rocblas_int DIM_M,
-              bool        MINPLUS,
-              bool        BOUNDS,
+              rocblas_int               DIM_M,
+              rocblas_geam_ex_operation OP,
+              bool                      BOUNDS,
               typename T,
               typename U>
     __device__ void local_to_global(const T* d_c,
@@ -190,6 +379,8 @@ namespace
                                     int      m,
                                     int      n)
     {
+        using S = geam_ex_semiring<OP>;
+
         for(int j = 0; j < THR_N; ++j)
         {
             for(int i = 0; i < THR_M; ++i)
@@ -197,30 +388,21 @@ namespace
                 int ci = c_i + i * DIM_M + idx;
                 int cj = c_j + j * DIM_N + idy;
 
-                T c_min;
-                if constexpr(MINPLUS)
-                    vector2_min(c[j][i], c_min);
-                else
-                    vector2_add(c[j][i], c_min);
+                T c_red;
+                vector2_reduce<S>(c[j][i], c_red);
 
                 if(BOUNDS)
                 {
                     if(ci < m && cj < n)
                     {
-                        auto dc_scaled = beta ? beta * d_c[cj * ldc + ci] : 0;
-                        if constexpr(MINPLUS)
-                            d_d[cj * ldd + ci] = fminf(dc_scaled, c_min);
-                        else
-                            d_d[cj * ldd + ci] = dc_scaled + c_min;
+                        T dc_scaled = beta ? T(beta * d_c[cj * ldc + ci]) : T(0);
+                        d_d[cj * ldd + ci] = S::template add<T>(dc_scaled, c_red);
                     }
                 }
                 else
                 {
-                    auto dc_scaled = beta ? beta * d_c[cj * ldc + ci] : 0;
-                    if constexpr(MINPLUS)
-                        d_d[cj * ldd + ci] = fminf(dc_scaled, c_min);
-                    else
-                        d_d[cj * ldd + ci] = dc_scaled + c_min;
+                    T dc_scaled = beta ? T(beta * d_c[cj * ldc + ci]) : T(0);
+                    d_d[cj * ldd + ci] = S::template add<T>(dc_scaled, c_red);
                 }
             }
         }
@@ -331,26 +513,21 @@ namespace
         }
     }
 
-    template <rocblas_int THR_N,
-              rocblas_int THR_M,
-              bool        MINPLUS,
+    template <rocblas_int               THR_N,
+              rocblas_int               THR_M,
+              rocblas_geam_ex_operation OP,
               typename T,
               std::enable_if_t<!rocblas_is_array2<T>, int> = 0>
     __device__ void initialize_local_output(T c[THR_N][THR_M])
     {
         for(int j = 0; j < THR_N; j++)
             for(int i = 0; i < THR_M; i++)
-            {
-                if constexpr(MINPLUS)
-                    rocblas_set_max_value(c[j][i]);
-                else
-                    c[j][i] = 0;
-            }
+                geam_ex_semiring<OP>::set_identity(c[j][i]);
     }
 
-    template <rocblas_int THR_N,
-              rocblas_int THR_M,
-              bool        MINPLUS,
+    template <rocblas_int               THR_N,
+              rocblas_int               THR_M,
+              rocblas_geam_ex_operation OP,
               typename T,
               std::enable_if_t<rocblas_is_array2<T>, int> = 0>
     __device__ void initialize_local_output(T c[THR_N][THR_M])
@@ -358,18 +535,10 @@ namespace
         for(int j = 0; j < THR_N; j++)
             for(int i = 0; i < THR_M; i++)
             {
-                if constexpr(MINPLUS)
-                {
-                    auto tmp = c[j][i].x;
-                    rocblas_set_max_value(tmp);
-                    c[j][i].x = tmp;
-                    c[j][i].y = tmp;
-                }
-                else
-                {
-                    c[j][i].x = 0;
-                    c[j][i].y = 0;
-                }
+                auto tmp = c[j][i].x;
+                geam_ex_semiring<OP>::set_identity(tmp);
+                c[j][i].x = tmp;
+                c[j][i].y = tmp;
             }
     }
 
@@ -438,46 +607,97 @@ namespace
                 rocblas_geam_ex_minadd3(a[i], b[j], c[j][i]);
     }
 
+    template <typename S,
+              typename T,
+              typename T2,
+              std::enable_if_t<!rocblas_is_array2<T2>, int> = 0>
+    __device__ void rocblas_geam_ex_semiring3(const T2& a, const T2& b, T& c)
+    {
+        c = S::template add<T>(c, S::template mul<T>(a, b));
+    }
+
+    template <typename S,
+              typename T,
+              typename T2,
+              std::enable_if_t<rocblas_is_array2<T2> && !rocblas_is_array2<T>, int> = 0>
+    __device__ void rocblas_geam_ex_semiring3(const T2& a, const T2& b, T& c)
+    {
+        T ab = S::template add<T>(S::template mul<T>(a.x, b.x), S::template mul<T>(a.y, b.y));
+        c    = S::template add<T>(c, ab);
+    }
+
+    template <typename S,
+              typename T,
+              typename T2,
+              std::enable_if_t<std::is_same_v<T, rocblas_half2>, int> = 0>
+    __device__ void rocblas_geam_ex_semiring3(const T2& a, const T2& b, T& c)
+    {
+        c.x = S::template add<rocblas_half>(c.x, S::template mul<rocblas_half>(a.x, b.x));
+        c.y = S::template add<rocblas_half>(c.y, S::template mul<rocblas_half>(a.y, b.y));
+    }
+
+    /*
+     * Computes Cij = add(Cij, mul(Aik, Bkj)) for the semiring OP. The min_plus and
+     * plus_min semirings keep their specialized packed instructions.
+     */
+    template <rocblas_geam_ex_operation OP,
+              rocblas_int               THR_N,
+              rocblas_int               THR_M,
+              typename T,
+              typename T2>
+    __device__ void compute_geam_ex(T2 a[THR_M], T2 b[THR_N], T c[THR_N][THR_M])
+    {
+        if constexpr(OP == rocblas_geam_ex_operation_min_plus)
+            compute_minplus<THR_N, THR_M>(a, b, c);
+        else if constexpr(OP == rocblas_geam_ex_operation_plus_min)
+            compute_plusmin<THR_N, THR_M>(a, b, c);
+        else
+        {
+            for(int j = 0; j < THR_N; j++)
+                for(int i = 0; i < THR_M; i++)
+                    rocblas_geam_ex_semiring3<geam_ex_semiring<OP>>(a[i], b[j], c[j][i]);
+        }
+    }
+
     template <typename T,
               typename Tab,
               typename Tc,
-              int  DIM_M,
-              int  DIM_N,
-              int  BLK_M,
-              int  BLK_N,
-              int  BLK_K,
-              int  DIM_M_A,
-              int  DIM_N_A,
-              int  DIM_M_B,
-              int  DIM_N_B,
-              char TRANSA_C,
-              char TRANSB_C,
-              bool ALPHA_ONE,
-              bool BOUNDS,
-              bool MINPLUS,
+              int                       DIM_M,
+              int                       DIM_N,
+              int                       BLK_M,
+              int                       BLK_N,
+              int                       BLK_K,
+              int                       DIM_M_A,
+              int                       DIM_N_A,
+              int                       DIM_M_B,
+              int                       DIM_N_B,
+              char                      TRANSA_C,
+              char                      TRANSB_C,
+              bool                      ALPHA_ONE,
+              bool                      BOUNDS,
+              rocblas_geam_ex_operation OP,
               typename TScal,
               typename TConstPtr,
               typename TPtr>
     ROCBLAS_KERNEL(DIM_M* DIM_N)
-    geam_min_plus_kernel(rocblas_int               M,
-                         rocblas_int               N,
-                         rocblas_int               K,
-                         TScal                     alpha_in,
-                         TConstPtr*                dA_input,
-                         rocblas_int               lda,
-                         rocblas_stride            a_st_or_of,
-                         TConstPtr*                dB_input,
-                         rocblas_int               ldb,
-                         rocblas_stride            b_st_or_of,
-                         TScal                     beta_in,
-                         TConstPtr*                dC_input,
-                         rocblas_int               ldc,
-                         rocblas_stride            c_st_or_of,
-                         TPtr*                     dD_input,
-                         rocblas_int               ldd,
-                         rocblas_stride            d_st_or_of,
-                         rocblas_int               batch_count,
-                         rocblas_geam_ex_operation geam_ex_op)
+    geam_min_plus_kernel(rocblas_int    M,
+                         rocblas_int    N,
+                         rocblas_int    K,
+                         TScal          alpha_in,
+                         TConstPtr*     dA_input,
+                         rocblas_int    lda,
+                         rocblas_stride a_st_or_of,
+                         TConstPtr*     dB_input,
+                         rocblas_int    ldb,
+                         rocblas_stride b_st_or_of,
+                         TScal          beta_in,
+                         TConstPtr*     dC_input,
+                         rocblas_int    ldc,
+                         rocblas_stride c_st_or_of,
+                         TPtr*          dD_input,
+                         rocblas_int    ldd,
+                         rocblas_stride d_st_or_of,
+                         rocblas_int    batch_count)
     {
         int   blz   = blockIdx.z; // block's matrix in the batch
         auto  alpha = load_scalar(alpha_in, blockIdx.z, 1);
@@ -541,7 +761,7 @@ namespace
 
         constexpr int k_add = rocblas_is_array2<Tab> ? 2 : 1;
 
-        initialize_local_output<THR_N, THR_M, MINPLUS>(c);
+        initialize_local_output<THR_N, THR_M, OP>(c);
 
         global_to_local<TRANSA,
                         TRANSB,
@@ -554,7 +774,7 @@ namespace
                         DIM_N_B,
                         DIM_M_B,
                         ALPHA_ONE,
-                        MINPLUS,
+                        OP,
                         BOUNDS>(
             a0, b0, alpha, d_a, lda, ai, aj, idx_a, idy_a, d_b, ldb, bi, bj, idx_b, idy_b, M, N, K);
 
@@ -578,7 +798,7 @@ namespace
                         DIM_N_B,
                         DIM_M_B,
                         ALPHA_ONE,
-                        MINPLUS,
+                        OP,
                         BOUNDS>(
             a1, b1, alpha, d_a, lda, ai, aj, idx_a, idy_a, d_b, ldb, bi, bj, idx_b, idy_b, M, N, K);
 
@@ -610,10 +830,7 @@ namespace
         {
             shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                 a, b, s_a0, s_b0, k1, idx, idy);
-            if constexpr(MINPLUS)
-                compute_minplus<THR_N, THR_M>(a, b, c);
-            else
-                compute_plusmin<THR_N, THR_M>(a, b, c);
+            compute_geam_ex<OP, THR_N, THR_M>(a, b, c);
         }
 
         local_to_shared<TRANSA,
@@ -644,7 +861,7 @@ namespace
                             DIM_N_B,
                             DIM_M_B,
                             ALPHA_ONE,
-                            MINPLUS,
+                            OP,
                             BOUNDS>(a0,
                                     b0,
                                     alpha,
@@ -677,10 +894,7 @@ namespace
             {
                 shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                     a, b, s_a1, s_b1, k1, idx, idy);
-                if constexpr(MINPLUS)
-                    compute_minplus<THR_N, THR_M>(a, b, c);
-                else
-                    compute_plusmin<THR_N, THR_M>(a, b, c);
+                compute_geam_ex<OP, THR_N, THR_M>(a, b, c);
             }
 
             local_to_shared<TRANSA,
@@ -709,7 +923,7 @@ namespace
                             DIM_N_B,
                             DIM_M_B,
                             ALPHA_ONE,
-                            MINPLUS,
+                            OP,
                             BOUNDS>(a1,
                                     b1,
                                     alpha,
@@ -741,10 +955,7 @@ namespace
             {
                 shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                     a, b, s_a0, s_b0, k1, idx, idy);
-                if constexpr(MINPLUS)
-                    compute_minplus<THR_N, THR_M>(a, b, c);
-                else
-                    compute_plusmin<THR_N, THR_M>(a, b, c);
+                compute_geam_ex<OP, THR_N, THR_M>(a, b, c);
             }
 
             local_to_shared<TRANSA,
@@ -767,13 +978,10 @@ namespace
         {
             shared_to_local<THR_N, THR_M, BLK_N, BLK_M, BLK_K, DIM_N, DIM_M>(
                 a, b, s_a1, s_b1, k1, idx, idy);
-            if constexpr(MINPLUS)
-                compute_minplus<THR_N, THR_M>(a, b, c);
-            else
-                compute_plusmin<THR_N, THR_M>(a, b, c);
+            compute_geam_ex<OP, THR_N, THR_M>(a, b, c);
         }
 
-        local_to_global<THR_N, THR_M, DIM_N, DIM_M, MINPLUS, BOUNDS>(
+        local_to_global<THR_N, THR_M, DIM_N, DIM_M, OP, BOUNDS>(
             d_c, d_d, ldc, ldd, beta, ci, cj, idx, idy, c, M, N);
     }
 
@@ -804,10 +1012,21 @@ namespace
         }
     }
 
-    template <int DIM_X, int DIM_Y, typename T, typename TScal, typename TConstPtr, typename TPtr>
+    /*
+     * Computes D = add(beta * C, x) where x is the result of the k reduction when it does
+     * not depend on A and B: the identity of add when k == 0, or mul(0, 0) when alpha == 0.
+     */
+    template <int                       DIM_X,
+              int                       DIM_Y,
+              rocblas_geam_ex_operation OP,
+              typename T,
+              typename TScal,
+              typename TConstPtr,
+              typename TPtr>
     ROCBLAS_KERNEL(DIM_X* DIM_Y)
     geam_ex_round_kernel(rocblas_int    m,
                          rocblas_int    n,
+                         rocblas_int    k,
                          TScal          beta_host_device,
                          TConstPtr      dC,
                          rocblas_stride offset_c,
@@ -825,43 +1044,51 @@ namespace
         auto tx = blockIdx.x * blockDim.x + threadIdx.x;
         auto ty = blockIdx.y * blockDim.y + threadIdx.y;
 
+        using S = geam_ex_semiring<OP>;
+
         if(tx < m && ty < n)
         {
-            auto orig_val = beta ? beta * C[ty * size_t(ldc) + tx] : 0;
-            if(orig_val > 0)
-                D[ty * size_t(ldd) + tx] = 0;
+            T ab;
+            if(k)
+                ab = S::template mul<T>(T(0), T(0));
             else
-                D[ty * size_t(ldd) + tx] = orig_val;
+                S::set_identity(ab);
+
+            T orig_val               = beta ? T(beta * C[ty * size_t(ldc) + tx]) : T(0);
+            D[ty * size_t(ldd) + tx] = S::template add<T>(orig_val, ab);
         }
     }
 
-    template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
-    void geam_ex_source_solution(rocblas_handle            handle,
-                                 rocblas_operation         trans_a,
-                                 rocblas_operation         trans_b,
-                                 rocblas_int               m,
-                                 rocblas_int               n,
-                                 rocblas_int               k,
-                                 const T*                  alpha,
-                                 TConstPtr*                dA,
-                                 rocblas_stride            offset_a,
-                                 rocblas_int               lda,
-                                 rocblas_stride            stride_a,
-                                 TConstPtr*                dB,
-                                 rocblas_stride            offset_b,
-                                 rocblas_int               ldb,
-                                 rocblas_stride            stride_b,
-                                 const T*                  beta,
-                                 TConstPtr*                dC,
-                                 rocblas_stride            offset_c,
-                                 rocblas_int               ldc,
-                                 rocblas_stride            stride_c,
-                                 TPtr*                     dD,
-                                 rocblas_stride            offset_d,
-                                 rocblas_int               ldd,
-                                 rocblas_stride            stride_d,
-                                 rocblas_int               batch_count,
-                                 rocblas_geam_ex_operation geam_ex_op)
+    template <rocblas_geam_ex_operation OP,
+              bool                      BATCHED,
+              typename T,
+              typename TConstPtr,
+              typename TPtr>
+    void geam_ex_semiring_solution(rocblas_handle    handle,
+                                   rocblas_operation trans_a,
+                                   rocblas_operation trans_b,
+                                   rocblas_int       m,
+                                   rocblas_int       n,
+                                   rocblas_int       k,
+                                   const T*          alpha,
+                                   TConstPtr*        dA,
+                                   rocblas_stride    offset_a,
+                                   rocblas_int       lda,
+                                   rocblas_stride    stride_a,
+                                   TConstPtr*        dB,
+                                   rocblas_stride    offset_b,
+                                   rocblas_int       ldb,
+                                   rocblas_stride    stride_b,
+                                   const T*          beta,
+                                   TConstPtr*        dC,
+                                   rocblas_stride    offset_c,
+                                   rocblas_int       ldc,
+                                   rocblas_stride    stride_c,
+                                   TPtr*             dD,
+                                   rocblas_stride    offset_d,
+                                   rocblas_int       ldd,
+                                   rocblas_stride    stride_d,
+                                   rocblas_int       batch_count)
     {
         auto           stream   = handle->get_stream();
         auto           ptr_mode = handle->pointer_mode;
@@ -897,9 +1124,10 @@ namespace
             d_st_or_of = stride_d;
         }
 
-        if(k == 0
+        // the boolean semiring maps beta * C to 0 or 1 so it cannot use the scale kernel
+        if((k == 0 && OP != rocblas_geam_ex_operation_or_and)
            || (ptr_mode == rocblas_pointer_mode_host && *alpha == 0
-               && geam_ex_op == rocblas_geam_ex_operation_plus_min))
+               && OP == rocblas_geam_ex_operation_plus_min))
         {
             static constexpr int GEAM_SCALE_DIM_X = 32;
             static constexpr int GEAM_SCALE_DIM_Y = 32;
@@ -948,7 +1176,7 @@ namespace
             return;
         }
 
-        if(ptr_mode == rocblas_pointer_mode_host && *alpha == 0)
+        if(k == 0 || (ptr_mode == rocblas_pointer_mode_host && *alpha == 0))
         {
             static constexpr int GEAM_ROUND_DIM_X = 32;
             static constexpr int GEAM_ROUND_DIM_Y = 32;
@@ -959,27 +1187,49 @@ namespace
             dim3 geam_round_grid(blocksX, blocksY, batch_count);
             dim3 geam_round_threads(GEAM_ROUND_DIM_X, GEAM_ROUND_DIM_Y);
 
-            hipLaunchKernelGGL((geam_ex_round_kernel<GEAM_ROUND_DIM_X, GEAM_ROUND_DIM_Y, T>),
-                               geam_round_grid,
-                               geam_round_threads,
-                               0,
-                               stream,
-                               m,
-                               n,
-                               *beta,
-                               dC,
-                               offset_c,
-                               ldc,
-                               stride_c,
-                               dD,
-                               offset_d,
-                               ldd,
-                               stride_d);
+            if(ptr_mode == rocblas_pointer_mode_host)
+                hipLaunchKernelGGL(
+                    (geam_ex_round_kernel<GEAM_ROUND_DIM_X, GEAM_ROUND_DIM_Y, OP, T>),
+                    geam_round_grid,
+                    geam_round_threads,
+                    0,
+                    stream,
+                    m,
+                    n,
+                    k,
+                    *beta,
+                    dC,
+                    offset_c,
+                    ldc,
+                    stride_c,
+                    dD,
+                    offset_d,
+                    ldd,
+                    stride_d);
+            else
+                hipLaunchKernelGGL(
+                    (geam_ex_round_kernel<GEAM_ROUND_DIM_X, GEAM_ROUND_DIM_Y, OP, T>),
+                    geam_round_grid,
+                    geam_round_threads,
+                    0,
+                    stream,
+                    m,
+                    n,
+                    k,
+                    beta,
+                    dC,
+                    offset_c,
+                    ldc,
+                    stride_c,
+                    dD,
+                    offset_d,
+                    ldd,
+                    stride_d);
             return;
         }
 
 #define LAUNCH_GEAM_SOURCE_KERNEL(                                               \
-    TRANSA_, TRANSB_, DIM_M_A_, DIM_N_A_, DIM_M_B_, DIM_N_B_, MINPLUS_)          \
+    TRANSA_, TRANSB_, DIM_M_A_, DIM_N_A_, DIM_M_B_, DIM_N_B_, OP_)               \
     if(m % BLK_M == 0 && n % BLK_N == 0 && k % BLK_K == 0)                       \
     {                                                                            \
         dim3 dimBlock(DIM_M, DIM_N, 1);                                          \
@@ -1002,7 +1252,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      false,                      \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1024,8 +1274,7 @@ namespace
                                dD_krn,                                           \
                                ldd,                                              \
                                d_st_or_of,                                       \
-                               batch_count,                                      \
-                               geam_ex_op);                                      \
+                               batch_count);                                     \
         }                                                                        \
         else if(*alpha == 1)                                                     \
         {                                                                        \
@@ -1045,7 +1294,7 @@ namespace
                                                      TRANSB_,                    \
                                                      true,                       \
                                                      false,                      \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1067,8 +1316,7 @@ namespace
                                dD_krn,                                           \
                                ldd,                                              \
                                d_st_or_of,                                       \
-                               batch_count,                                      \
-                               geam_ex_op);                                      \
+                               batch_count);                                     \
         }                                                                        \
         else                                                                     \
         {                                                                        \
@@ -1088,7 +1336,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      false,                      \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1110,8 +1358,7 @@ namespace
                                dD_krn,                                           \
                                ldd,                                              \
                                d_st_or_of,                                       \
-                               batch_count,                                      \
-                               geam_ex_op);                                      \
+                               batch_count);                                     \
         }                                                                        \
     }                                                                            \
     else                                                                         \
@@ -1136,7 +1383,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      true,                       \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1158,8 +1405,7 @@ namespace
                                dD_krn,                                           \
                                ldd,                                              \
                                d_st_or_of,                                       \
-                               batch_count,                                      \
-                               geam_ex_op);                                      \
+                               batch_count);                                     \
         }                                                                        \
         else if(*alpha == 1)                                                     \
         {                                                                        \
@@ -1179,7 +1425,7 @@ namespace
                                                      TRANSB_,                    \
                                                      true,                       \
                                                      true,                       \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1201,8 +1447,7 @@ namespace
                                dD_krn,                                           \
                                ldd,                                              \
                                d_st_or_of,                                       \
-                               batch_count,                                      \
-                               geam_ex_op);                                      \
+                               batch_count);                                     \
         }                                                                        \
         else                                                                     \
         {                                                                        \
@@ -1222,7 +1467,7 @@ namespace
                                                      TRANSB_,                    \
                                                      false,                      \
                                                      true,                       \
-                                                     MINPLUS_>),                 \
+                                                     OP_>),                      \
                                dimGrid,                                          \
                                dimBlock,                                         \
                                0,                                                \
@@ -1244,8 +1489,7 @@ namespace
                                dD_krn,                                           \
                                ldd,                                              \
                                d_st_or_of,                                       \
-                               batch_count,                                      \
-                               geam_ex_op);                                      \
+                               batch_count);                                     \
         }                                                                        \
     }
 
@@ -1253,7 +1497,8 @@ namespace
         constexpr rocblas_int DIM_N_A = 4;
         constexpr rocblas_int DIM_M_B = 4;
         constexpr rocblas_int DIM_N_B = 64;
-        if(geam_ex_op == rocblas_geam_ex_operation_min_plus)
+        // max_plus, min_max, max_min and or_and share the min_plus tiling
+        if constexpr(OP != rocblas_geam_ex_operation_plus_min)
         {
             if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
             {
@@ -1267,19 +1512,19 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if constexpr(std::is_same_v<float, T>)
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
             }
             else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
@@ -1294,19 +1539,19 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if constexpr(std::is_same_v<float, T>)
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
             }
             else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
@@ -1321,19 +1566,19 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else if constexpr(std::is_same_v<float, T>)
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
             else
@@ -1348,23 +1593,23 @@ namespace
                 {
                     using Tc  = array2_t<T>;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else if constexpr(std::is_same_v<float, T>)
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     using Tc  = T;
                     using Tab = array2_t<T>;
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, true);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
         }
-        else if(geam_ex_op == rocblas_geam_ex_operation_plus_min)
+        else
         {
             if constexpr(std::is_same_v<rocblas_half, T>)
             {
@@ -1378,22 +1623,22 @@ namespace
                 if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // NN
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // TN
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
                 {
                     // NT
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     // TT
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
             else if constexpr(std::is_same_v<float, T>)
@@ -1408,22 +1653,22 @@ namespace
                 if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // NN
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // TN
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
                 {
                     // NT
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     // TT
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
             else if(std::is_same_v<double, T>)
@@ -1438,25 +1683,88 @@ namespace
                 if(trans_a == rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // NN
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'N', DIM_M_A, DIM_N_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a != rocblas_operation_none && trans_b == rocblas_operation_none)
                 {
                     // TN
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'N', DIM_N_A, DIM_M_A, DIM_M_B, DIM_N_B, OP);
                 }
                 else if(trans_a == rocblas_operation_none && trans_b != rocblas_operation_none)
                 {
                     // NT
-                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('N', 'T', DIM_M_A, DIM_N_A, DIM_N_B, DIM_M_B, OP);
                 }
                 else
                 {
                     // TT
-                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, false);
+                    LAUNCH_GEAM_SOURCE_KERNEL('T', 'T', DIM_N_A, DIM_M_A, DIM_N_B, DIM_M_B, OP);
                 }
             }
         }
 #undef LAUNCH_GEAM_SOURCE_KERNEL
     }
+
+    template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
+    void geam_ex_source_solution(rocblas_handle            handle,
+                                 rocblas_operation         trans_a,
+                                 rocblas_operation         trans_b,
+                                 rocblas_int               m,
+                                 rocblas_int               n,
+                                 rocblas_int               k,
+                                 const T*                  alpha,
+                                 TConstPtr*                dA,
+                                 rocblas_stride            offset_a,
+                                 rocblas_int               lda,
+                                 rocblas_stride            stride_a,
+                                 TConstPtr*                dB,
+                                 rocblas_stride            offset_b,
+                                 rocblas_int               ldb,
+                                 rocblas_stride            stride_b,
+                                 const T*                  beta,
+                                 TConstPtr*                dC,
+                                 rocblas_stride            offset_c,
+                                 rocblas_int               ldc,
+                                 rocblas_stride            stride_c,
+                                 TPtr*                     dD,
+                                 rocblas_stride            offset_d,
+                                 rocblas_int               ldd,
+                                 rocblas_stride            stride_d,
+                                 rocblas_int               batch_count,
+                                 rocblas_geam_ex_operation geam_ex_op)
+    {
+#define GEAM_EX_SEMIRING_PARAM                                                                 \
+    handle, trans_a, trans_b, m, n, k, alpha, dA, offset_a, lda, stride_a, dB, offset_b, ldb, \
+        stride_b, beta, dC, offset_c, ldc, stride_c, dD, offset_d, ldd, stride_d, batch_count
+
+        switch(geam_ex_op)
+        {
+        case rocblas_geam_ex_operation_min_plus:
+            geam_ex_semiring_solution<rocblas_geam_ex_operation_min_plus, BATCHED>(
+                GEAM_EX_SEMIRING_PARAM);
+            break;
+        case rocblas_geam_ex_operation_plus_min:
+            geam_ex_semiring_solution<rocblas_geam_ex_operation_plus_min, BATCHED>(
+                GEAM_EX_SEMIRING_PARAM);
+            break;
+        case rocblas_geam_ex_operation_max_plus:
+            geam_ex_semiring_solution<rocblas_geam_ex_operation_max_plus, BATCHED>(
+                GEAM_EX_SEMIRING_PARAM);
+            break;
+        case rocblas_geam_ex_operation_min_max:
+            geam_ex_semiring_solution<rocblas_geam_ex_operation_min_max, BATCHED>(
+                GEAM_EX_SEMIRING_PARAM);
+            break;
+        case rocblas_geam_ex_operation_max_min:
+            geam_ex_semiring_solution<rocblas_geam_ex_operation_max_min, BATCHED>(
+                GEAM_EX_SEMIRING_PARAM);
+            break;
+        case rocblas_geam_ex_operation_or_and:
+            geam_ex_semiring_solution<rocblas_geam_ex_operation_or_and, BATCHED>(
+                GEAM_EX_SEMIRING_PARAM);
+            break;
+        }
+
+#undef GEAM_EX_SEMIRING_PARAM
+    }
 }
@@ -62,6 +62,19 @@ namespace
                 return handle->set_optimal_device_memory_size(dev_bytes);
         }
 
+        ROCBLAS_API_RANGE(handle,
+                          name,
+                          n,
+                          x_type,
+                          incx,
+                          stride_x,
+                          y_type,
+                          incy,
+                          stride_y,
+                          batch_count,
+                          result_type,
+                          execution_type);
+
         auto layer_mode = handle->layer_mode;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
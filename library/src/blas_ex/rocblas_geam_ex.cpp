@@ -56,6 +56,24 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          "rocblas_geam_ex",
+                          transA,
+                          transB,
+                          m,
+                          n,
+                          k,
+                          a_type,
+                          lda,
+                          b_type,
+                          ldb,
+                          c_type,
+                          ldc,
+                          d_type,
+                          ldd,
+                          compute_type,
+                          geam_ex_op);
+
         // Perform logging
         auto layer_mode = handle->layer_mode;
         if(layer_mode
@@ -256,6 +274,9 @@ namespace
             }
         }
 
+        if(!rocblas_geam_ex_op_is_valid(geam_ex_op))
+            return rocblas_status_invalid_value;
+
         auto validArgs = rocblas_status_not_implemented;
         if(compute_type == rocblas_datatype_f16_r)
             validArgs = rocblas_validateArgs<rocblas_half>(
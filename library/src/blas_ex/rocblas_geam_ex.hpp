@@ -58,6 +58,12 @@ rocblas_status rocblas_geam_ex_template(rocblas_handle            handle,
                                         rocblas_datatype          compute_type,
                                         rocblas_geam_ex_operation geam_ex_op);
 
+inline bool rocblas_geam_ex_op_is_valid(rocblas_geam_ex_operation geam_ex_op)
+{
+    return geam_ex_op >= rocblas_geam_ex_operation_min_plus
+           && geam_ex_op <= rocblas_geam_ex_operation_or_and;
+}
+
 template <typename T>
 rocblas_status rocblas_validateArgs(rocblas_handle    handle,
                                     rocblas_operation trans_a,
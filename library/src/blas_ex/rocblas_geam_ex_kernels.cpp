@@ -26,7 +26,7 @@
 #include "logging.hpp"
 #include "rocblas_geam_ex.hpp"
 
-template <typename T, typename TConstPtr, typename TPtr>
+template <bool BATCHED, typename T, typename TConstPtr, typename TPtr>
 ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
     rocblas_internal_geam_ex_template(rocblas_handle            handle,
                                       rocblas_operation         trans_A,
@@ -55,32 +55,32 @@ ROCBLAS_INTERNAL_EXPORT_NOINLINE rocblas_status
                                       rocblas_int               batch_count,
                                       rocblas_geam_ex_operation geam_ex_op)
 {
-    geam_ex_source_solution<false, T>(handle,
-                                      trans_A,
-                                      trans_B,
-                                      m,
-                                      n,
-                                      k,
-                                      alpha,
-                                      A,
-                                      offset_A,
-                                      lda,
-                                      stride_A,
-                                      B,
-                                      offset_B,
-                                      ldb,
-                                      stride_B,
-                                      beta,
-                                      C,
-                                      offset_C,
-                                      ldc,
-                                      stride_C,
-                                      D,
-                                      offset_D,
-                                      ldd,
-                                      stride_D,
-                                      batch_count,
-                                      geam_ex_op);
+    geam_ex_source_solution<BATCHED, T>(handle,
+                                        trans_A,
+                                        trans_B,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        offset_A,
+                                        lda,
+                                        stride_A,
+                                        B,
+                                        offset_B,
+                                        ldb,
+                                        stride_B,
+                                        beta,
+                                        C,
+                                        offset_C,
+                                        ldc,
+                                        stride_C,
+                                        D,
+                                        offset_D,
+                                        ldd,
+                                        stride_D,
+                                        batch_count,
+                                        geam_ex_op);
 
     return rocblas_status_success;
 }
@@ -148,32 +148,32 @@ rocblas_status rocblas_geam_ex_typecasting(rocblas_handle            handle,
                 return gemm_min_plus_status;
         }
 
-        status = rocblas_internal_geam_ex_template<T>(handle,
-                                                      trans_A,
-                                                      trans_B,
-                                                      m,
-                                                      n,
-                                                      k,
-                                                      (const T*)alpha,
-                                                      (const T* const*)A,
-                                                      offset_A,
-                                                      lda,
-                                                      stride_A,
-                                                      (const T* const*)B,
-                                                      offset_B,
-                                                      ldb,
-                                                      stride_B,
-                                                      (const T*)beta,
-                                                      (const T* const*)C,
-                                                      offset_C,
-                                                      ldc,
-                                                      stride_C,
-                                                      (T* const*)D,
-                                                      offset_D,
-                                                      ldd,
-                                                      stride_D,
-                                                      batch_count,
-                                                      geam_ex_op);
+        status = rocblas_internal_geam_ex_template<BATCHED, T>(handle,
+                                                               trans_A,
+                                                               trans_B,
+                                                               m,
+                                                               n,
+                                                               k,
+                                                               (const T*)alpha,
+                                                               (const T* const*)A,
+                                                               offset_A,
+                                                               lda,
+                                                               stride_A,
+                                                               (const T* const*)B,
+                                                               offset_B,
+                                                               ldb,
+                                                               stride_B,
+                                                               (const T*)beta,
+                                                               (const T* const*)C,
+                                                               offset_C,
+                                                               ldc,
+                                                               stride_C,
+                                                               (T* const*)D,
+                                                               offset_D,
+                                                               ldd,
+                                                               stride_D,
+                                                               batch_count,
+                                                               geam_ex_op);
 
         if(status != rocblas_status_success)
             return status;
@@ -243,32 +243,32 @@ rocblas_status rocblas_geam_ex_typecasting(rocblas_handle            handle,
                 return gemm_min_plus_status;
         }
 
-        status = rocblas_internal_geam_ex_template<T>(handle,
-                                                      trans_A,
-                                                      trans_B,
-                                                      m,
-                                                      n,
-                                                      k,
-                                                      (const T*)alpha,
-                                                      (const T*)A,
-                                                      offset_A,
-                                                      lda,
-                                                      stride_A,
-                                                      (const T*)B,
-                                                      offset_B,
-                                                      ldb,
-                                                      stride_B,
-                                                      (const T*)beta,
-                                                      (const T*)C,
-                                                      offset_C,
-                                                      ldc,
-                                                      stride_C,
-                                                      (T*)D,
-                                                      offset_D,
-                                                      ldd,
-                                                      stride_D,
-                                                      batch_count,
-                                                      geam_ex_op);
+        status = rocblas_internal_geam_ex_template<BATCHED, T>(handle,
+                                                               trans_A,
+                                                               trans_B,
+                                                               m,
+                                                               n,
+                                                               k,
+                                                               (const T*)alpha,
+                                                               (const T*)A,
+                                                               offset_A,
+                                                               lda,
+                                                               stride_A,
+                                                               (const T*)B,
+                                                               offset_B,
+                                                               ldb,
+                                                               stride_B,
+                                                               (const T*)beta,
+                                                               (const T*)C,
+                                                               offset_C,
+                                                               ldc,
+                                                               stride_C,
+                                                               (T*)D,
+                                                               offset_D,
+                                                               ldd,
+                                                               stride_D,
+                                                               batch_count,
+                                                               geam_ex_op);
 
         if(status != rocblas_status_success)
             return status;
@@ -508,7 +508,7 @@ template rocblas_status rocblas_geam_ex_template<BATCHED>      \
                                         rocblas_geam_ex_operation geam_ex_op);
 
 INSTANTIATE_GEAM_EX_TEMPLATE(false)
-// INSTANTIATE_GEAM_EX_TEMPLATE(true)
+INSTANTIATE_GEAM_EX_TEMPLATE(true)
 
 #undef INSTANTIATE_GEAM_EX_TEMPLATE
 
@@ -75,6 +75,26 @@ try
         handle, alpha, beta, alpha_h, beta_h, k, compute_type));
     auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+    ROCBLAS_API_RANGE(handle,
+                      "rocblas_gemm_batched_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      a_type,
+                      lda,
+                      b_type,
+                      ldb,
+                      c_type,
+                      ldc,
+                      d_type,
+                      ldd,
+                      batch_count,
+                      compute_type,
+                      algo,
+                      solution_index);
+
     if(!handle->is_device_memory_size_query())
     {
         // Perform logging
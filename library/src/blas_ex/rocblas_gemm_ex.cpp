@@ -73,6 +73,26 @@ namespace
             handle, alpha, beta, alpha_h, beta_h, k, compute_type));
         auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+        ROCBLAS_API_RANGE(handle,
+                          "rocblas_gemm_ex",
+                          trans_a,
+                          trans_b,
+                          m,
+                          n,
+                          k,
+                          a_type,
+                          lda,
+                          b_type,
+                          ldb,
+                          c_type,
+                          ldc,
+                          d_type,
+                          ldd,
+                          compute_type,
+                          algo,
+                          solution_index,
+                          rocblas_gemm_flags(flags));
+
         // If this is a solution fitness query (internal testing), bypass logging and error checks
         if(handle->get_solution_fitness_query())
             goto solution_fitness_query;
@@ -80,6 +100,7 @@ namespace
         if(!handle->is_device_memory_size_query())
         {
             // Perform logging
+            ROCBLAS_HOST_TIMER(logging);
             auto layer_mode = handle->layer_mode;
             if(layer_mode
                & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
@@ -226,6 +247,7 @@ namespace
         }
 
         {
+            ROCBLAS_HOST_TIMER_BEGIN(arg_check);
             auto validArgs = rocblas_validateArgs(handle,
                                                   trans_a,
                                                   trans_b,
@@ -245,6 +267,7 @@ namespace
                                                   d_type,
                                                   ldd,
                                                   compute_type);
+            ROCBLAS_HOST_TIMER_END(arg_check);
 
             if(validArgs != rocblas_status_continue)
             {
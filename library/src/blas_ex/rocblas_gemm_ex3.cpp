@@ -28,30 +28,31 @@
 
 namespace
 {
-    rocblas_status rocblas_gemm_ex3_impl(rocblas_handle      handle,
-                                         rocblas_operation   trans_a,
-                                         rocblas_operation   trans_b,
-                                         rocblas_int         m,
-                                         rocblas_int         n,
-                                         rocblas_int         k,
-                                         const void*         alpha,
-                                         const void*         a,
-                                         rocblas_datatype    a_type,
-                                         rocblas_int         lda,
-                                         const void*         b,
-                                         rocblas_datatype    b_type,
-                                         rocblas_int         ldb,
-                                         const void*         beta,
-                                         const void*         c,
-                                         rocblas_datatype    c_type,
-                                         rocblas_int         ldc,
-                                         void*               d,
-                                         rocblas_datatype    d_type,
-                                         rocblas_int         ldd,
-                                         rocblas_computetype compute_type,
-                                         rocblas_gemm_algo   algo,
-                                         int32_t             solution_index,
-                                         uint32_t            flags)
+    rocblas_status rocblas_gemm_ex3_impl(rocblas_handle                  handle,
+                                         rocblas_operation               trans_a,
+                                         rocblas_operation               trans_b,
+                                         rocblas_int                     m,
+                                         rocblas_int                     n,
+                                         rocblas_int                     k,
+                                         const void*                     alpha,
+                                         const void*                     a,
+                                         rocblas_datatype                a_type,
+                                         rocblas_int                     lda,
+                                         const void*                     b,
+                                         rocblas_datatype                b_type,
+                                         rocblas_int                     ldb,
+                                         const void*                     beta,
+                                         const void*                     c,
+                                         rocblas_datatype                c_type,
+                                         rocblas_int                     ldc,
+                                         void*                           d,
+                                         rocblas_datatype                d_type,
+                                         rocblas_int                     ldd,
+                                         rocblas_computetype             compute_type,
+                                         rocblas_gemm_algo               algo,
+                                         int32_t                         solution_index,
+                                         uint32_t                        flags,
+                                         const rocblas_gemm_ex3_scaling& scaling)
     {
         if(!handle)
             return rocblas_status_invalid_handle;
@@ -71,6 +72,26 @@ namespace
 
             auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+            ROCBLAS_API_RANGE(handle,
+                              scaling.enabled() ? "rocblas_gemm_ex3_scaled" : "rocblas_gemm_ex3",
+                              trans_a,
+                              trans_b,
+                              m,
+                              n,
+                              k,
+                              a_type,
+                              lda,
+                              b_type,
+                              ldb,
+                              c_type,
+                              ldc,
+                              d_type,
+                              ldd,
+                              compute_type,
+                              algo,
+                              solution_index,
+                              rocblas_gemm_flags(flags));
+
             // If this is a solution fitness query (internal testing), bypass logging and error checks
             if(handle->get_solution_fitness_query())
                 goto solution_fitness_query;
@@ -94,6 +115,7 @@ namespace
                     auto c_type_string       = rocblas_datatype_string(c_type);
                     auto d_type_string       = rocblas_datatype_string(d_type);
                     auto compute_type_string = rocblas_datatype_string(compute_type);
+                    bool scaled              = scaling.enabled();
 
                     if(layer_mode & rocblas_layer_mode_log_trace)
                     {
@@ -102,7 +124,7 @@ namespace
                            == rocblas_status_success)
                         {
                             log_trace(handle,
-                                      "rocblas_gemm_ex3",
+                                      scaled ? "rocblas_gemm_ex3_scaled" : "rocblas_gemm_ex3",
                                       trans_a,
                                       trans_b,
                                       m,
@@ -135,52 +157,65 @@ namespace
                         if(log_bench_alpha_beta_ex(compute_type, alpha, beta, alphas, betas)
                            == rocblas_status_success)
                         {
+                            // gemm_ex3_scaled appends its scaling modes
+                            auto log_bench_gemm_ex3 = [&](const char* function,
+                                                          auto&&... scale_args) {
+                                log_bench(handle,
+                                          function,
+                                          "--transposeA",
+                                          trans_a_letter,
+                                          "--transposeB",
+                                          trans_b_letter,
+                                          "-m",
+                                          m,
+                                          "-n",
+                                          n,
+                                          "-k",
+                                          k,
+                                          alphas,
+                                          "--a_type",
+                                          a_type_string,
+                                          "--lda",
+                                          lda,
+                                          "--b_type",
+                                          b_type_string,
+                                          "--ldb",
+                                          ldb,
+                                          betas,
+                                          "--c_type",
+                                          c_type_string,
+                                          "--ldc",
+                                          ldc,
+                                          "--d_type",
+                                          d_type_string,
+                                          "--ldd",
+                                          ldd,
+                                          "--composite_compute_type",
+                                          compute_type_string,
+                                          "--algo",
+                                          algo,
+                                          "--solution_index",
+                                          solution_index,
+                                          "--flags",
+                                          flags,
+                                          scale_args...);
+                            };
 
-                            log_bench(handle,
-                                      "./rocblas-bench -f gemm_ex3",
-                                      "--transposeA",
-                                      trans_a_letter,
-                                      "--transposeB",
-                                      trans_b_letter,
-                                      "-m",
-                                      m,
-                                      "-n",
-                                      n,
-                                      "-k",
-                                      k,
-                                      alphas,
-                                      "--a_type",
-                                      a_type_string,
-                                      "--lda",
-                                      lda,
-                                      "--b_type",
-                                      b_type_string,
-                                      "--ldb",
-                                      ldb,
-                                      betas,
-                                      "--c_type",
-                                      c_type_string,
-                                      "--ldc",
-                                      ldc,
-                                      "--d_type",
-                                      d_type_string,
-                                      "--ldd",
-                                      ldd,
-                                      "--composite_compute_type",
-                                      compute_type_string,
-                                      "--algo",
-                                      algo,
-                                      "--solution_index",
-                                      solution_index,
-                                      "--flags",
-                                      flags);
+                            if(scaled)
+                                log_bench_gemm_ex3("./rocblas-bench -f gemm_ex3_scaled",
+                                                   "--scale_a_mode",
+                                                   scaling.scale_a_mode,
+                                                   "--scale_b_mode",
+                                                   scaling.scale_b_mode);
+                            else
+                                log_bench_gemm_ex3("./rocblas-bench -f gemm_ex3");
                         }
                     }
 
                     if(layer_mode & rocblas_layer_mode_log_profile)
                     {
                         log_profile(handle,
-                                    "rocblas_gemm_ex3",
+                                    scaled ? "rocblas_gemm_ex3_scaled" : "rocblas_gemm_ex3",
                                     "a_type",
                                     a_type_string,
                                     "b_type",
@@ -250,6 +285,16 @@ namespace
                         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
                     return validArgs;
                 }
+
+                for(auto mode : {scaling.scale_a_mode, scaling.scale_b_mode})
+                    if(mode != rocblas_gemm_scale_mode_none
+                       && mode != rocblas_gemm_scale_mode_tensor
+                       && mode != rocblas_gemm_scale_mode_vector)
+                        return rocblas_status_invalid_value;
+
+                if((scaling.scale_a_mode != rocblas_gemm_scale_mode_none && !scaling.scale_a)
+                   || (scaling.scale_b_mode != rocblas_gemm_scale_mode_none && !scaling.scale_b))
+                    return rocblas_status_invalid_pointer;
             }
 
         solution_fitness_query:
@@ -288,7 +333,8 @@ namespace
                                                     stride_d,
                                                     batch_count,
                                                     compute_type,
-                                                    flags);
+                                                    flags,
+                                                    scaling);
         }
         else
             return rocblas_status_arch_mismatch;
@@ -344,7 +390,79 @@ try
                                  compute_type,
                                  algo,
                                  solution_index,
-                                 flags);
+                                 flags,
+                                 rocblas_gemm_ex3_scaling{});
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+extern "C" rocblas_status rocblas_gemm_ex3_scaled(rocblas_handle          handle,
+                                                  rocblas_operation       trans_a,
+                                                  rocblas_operation       trans_b,
+                                                  rocblas_int             m,
+                                                  rocblas_int             n,
+                                                  rocblas_int             k,
+                                                  const void*             alpha,
+                                                  const void*             a,
+                                                  rocblas_datatype        a_type,
+                                                  rocblas_int             lda,
+                                                  const void*             b,
+                                                  rocblas_datatype        b_type,
+                                                  rocblas_int             ldb,
+                                                  const void*             beta,
+                                                  const void*             c,
+                                                  rocblas_datatype        c_type,
+                                                  rocblas_int             ldc,
+                                                  void*                   d,
+                                                  rocblas_datatype        d_type,
+                                                  rocblas_int             ldd,
+                                                  rocblas_computetype     compute_type,
+                                                  rocblas_gemm_algo       algo,
+                                                  int32_t                 solution_index,
+                                                  uint32_t                flags,
+                                                  const float*            scale_a,
+                                                  rocblas_gemm_scale_mode scale_a_mode,
+                                                  const float*            scale_b,
+                                                  rocblas_gemm_scale_mode scale_b_mode,
+                                                  const float*            scale_d,
+                                                  float*                  amax_d)
+try
+{
+    rocblas_gemm_ex3_scaling scaling;
+    scaling.scale_a      = scale_a;
+    scaling.scale_a_mode = scale_a_mode;
+    scaling.scale_b      = scale_b;
+    scaling.scale_b_mode = scale_b_mode;
+    scaling.scale_d      = scale_d;
+    scaling.amax_d       = amax_d;
+
+    return rocblas_gemm_ex3_impl(handle,
+                                 trans_a,
+                                 trans_b,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 a,
+                                 a_type,
+                                 lda,
+                                 b,
+                                 b_type,
+                                 ldb,
+                                 beta,
+                                 c,
+                                 c_type,
+                                 ldc,
+                                 d,
+                                 d_type,
+                                 ldd,
+                                 compute_type,
+                                 algo,
+                                 solution_index,
+                                 flags,
+                                 scaling);
 }
 catch(...)
 {
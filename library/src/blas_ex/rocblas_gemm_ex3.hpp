@@ -33,40 +33,77 @@
 #define EX_TYPECASTING_PARM                                                                    \
     handle, trans_a, trans_b, m, n, k, alpha, a, offsetAin, lda, stride_a, b, offsetBin, ldb,  \
         stride_b, beta, c, offsetCin, ldc, stride_c, d, offsetDin, ldd, stride_d, batch_count, \
-        rocblas_gemm_flags(flags)
+        rocblas_gemm_flags(flags), scaling
+
+/*
+ *  Scaling factors of gemm_ex3_scaled, all in device memory.
+ *  scale_a and scale_b dequantize A and B: either one value for the whole matrix or one value
+ *  per row of op(A) and per column of op(B). scale_d quantizes D and amax_d receives max(|D|)
+ *  before scale_d is applied, NaN when D contains NaN. Without scaling every factor is 1.
+ */
+struct rocblas_gemm_ex3_scaling
+{
+    const float*            scale_a      = nullptr;
+    rocblas_gemm_scale_mode scale_a_mode = rocblas_gemm_scale_mode_none;
+    const float*            scale_b      = nullptr;
+    rocblas_gemm_scale_mode scale_b_mode = rocblas_gemm_scale_mode_none;
+    const float*            scale_d      = nullptr;
+    float*                  amax_d       = nullptr;
+
+    bool enabled() const
+    {
+        return scale_a_mode != rocblas_gemm_scale_mode_none
+               || scale_b_mode != rocblas_gemm_scale_mode_none || scale_d || amax_d;
+    }
+
+    ROCBLAS_KERNEL_ILF float a(int64_t row) const
+    {
+        return scale_a_mode == rocblas_gemm_scale_mode_none     ? 1.0f
+               : scale_a_mode == rocblas_gemm_scale_mode_tensor ? scale_a[0]
+                                                                : scale_a[row];
+    }
+
+    ROCBLAS_KERNEL_ILF float b(int64_t col) const
+    {
+        return scale_b_mode == rocblas_gemm_scale_mode_none     ? 1.0f
+               : scale_b_mode == rocblas_gemm_scale_mode_tensor ? scale_b[0]
+                                                                : scale_b[col];
+    }
+};
 
 template <bool BATCHED>
-rocblas_status rocblas_gemm_ex3_template(rocblas_handle      handle,
-                                         rocblas_operation   trans_a,
-                                         rocblas_operation   trans_b,
-                                         rocblas_int         m,
-                                         rocblas_int         n,
-                                         rocblas_int         k,
-                                         const void*         alpha,
-                                         const void*         a,
-                                         rocblas_datatype    a_type,
-                                         rocblas_int         offsetAin,
-                                         rocblas_int         lda,
-                                         rocblas_stride      stride_a,
-                                         const void*         b,
-                                         rocblas_datatype    b_type,
-                                         rocblas_int         offsetBin,
-                                         rocblas_int         ldb,
-                                         rocblas_stride      stride_b,
-                                         const void*         beta,
-                                         const void*         c,
-                                         rocblas_datatype    c_type,
-                                         rocblas_int         offsetCin,
-                                         rocblas_int         ldc,
-                                         rocblas_stride      stride_c,
-                                         void*               d,
-                                         rocblas_datatype    d_type,
-                                         rocblas_int         offsetDin,
-                                         rocblas_int         ldd,
-                                         rocblas_stride      stride_d,
-                                         rocblas_int         batch_count,
-                                         rocblas_computetype compute_type,
-                                         uint32_t            flags);
+rocblas_status rocblas_gemm_ex3_template(rocblas_handle                  handle,
+                                         rocblas_operation               trans_a,
+                                         rocblas_operation               trans_b,
+                                         rocblas_int                     m,
+                                         rocblas_int                     n,
+                                         rocblas_int                     k,
+                                         const void*                     alpha,
+                                         const void*                     a,
+                                         rocblas_datatype                a_type,
+                                         rocblas_int                     offsetAin,
+                                         rocblas_int                     lda,
+                                         rocblas_stride                  stride_a,
+                                         const void*                     b,
+                                         rocblas_datatype                b_type,
+                                         rocblas_int                     offsetBin,
+                                         rocblas_int                     ldb,
+                                         rocblas_stride                  stride_b,
+                                         const void*                     beta,
+                                         const void*                     c,
+                                         rocblas_datatype                c_type,
+                                         rocblas_int                     offsetCin,
+                                         rocblas_int                     ldc,
+                                         rocblas_stride                  stride_c,
+                                         void*                           d,
+                                         rocblas_datatype                d_type,
+                                         rocblas_int                     offsetDin,
+                                         rocblas_int                     ldd,
+                                         rocblas_stride                  stride_d,
+                                         rocblas_int                     batch_count,
+                                         rocblas_computetype             compute_type,
+                                         uint32_t                        flags,
+                                         const rocblas_gemm_ex3_scaling& scaling);
 
 /*
  *  Pseudo random number generator
@@ -183,12 +220,47 @@ ROCBLAS_KERNEL(DIM_M* DIM_N) general_conversion_kernel(rocblas_int    M,
     }
 }
 
+/*
+ *  Converts an element of A or B to the compute type while loading a tile. Inputs which are
+ *  quantized by this conversion are divided by their scale first, inputs already in the compute
+ *  type carry their scale and are only rescaled in the epilogue.
+ */
+template <typename Tc, typename Ti, bool stochastic_rounding>
+ROCBLAS_KERNEL_ILF Tc gemm_ex3_load_element(Ti x, int64_t gid, uint32_t seed, float scale)
+{
+    if constexpr(!std::is_same<Ti, Tc>{})
+    {
+        if(scale != 1.0f)
+        {
+            float    xs  = float(x) / scale;
+            uint32_t rng = 0;
+            if(stochastic_rounding)
+                rng = prand_generator<float>(gid, seed, xs);
+            return explicit_downcast<Tc, float, stochastic_rounding>(xs, rng);
+        }
+    }
+
+    uint32_t rng = 0;
+    if(stochastic_rounding)
+        rng = prand_generator<Ti>(gid, seed, x);
+    return explicit_downcast<Tc, Ti, stochastic_rounding>(x, rng);
+}
+
+// Device max is fmax, which drops a NaN operand, so the maximum of |D| keeps NaN instead
+template <typename T>
+ROCBLAS_KERNEL_ILF T gemm_ex3_amax(T amax, T x)
+{
+    return x > amax || x != x ? x : amax;
+}
+
 /*
  *  Generalized F8 GEMM_EX kernel : HIP_GEMM
  *  NOTE: it is very slow when compare with Tensile's GEMM
  *        We don't expect to call it any time except for the fall-back cases, e.g., M,N,K too large to allocate
- *        workspace for quantization.
+ *        workspace for quantization, or when gemm_ex3_scaled requests scaling factors.
  *
+ *  Scaling is fused: inputs are scaled as tiles are converted, the epilogue applies
+ *  scale_a[row] * scale_b[col] and scale_d, and max(|D|) is reduced per block into amax_d.
  */
 template <
     typename TiA,
@@ -216,27 +288,29 @@ template <
                      int> = 0>
 __attribute__((amdgpu_flat_work_group_size(DIM_M * DIM_N, DIM_M* DIM_N)))
 ROCBLAS_KERNEL(DIM_M* DIM_N)
-    gemm_batched_general_kernel(rocblas_int    M,
-                                rocblas_int    N,
-                                rocblas_int    K,
-                                const Tacc     alpha,
-                                const TiA*     dA_array, // NOTE: may work only for non-batch
-                                rocblas_int    lda,
-                                rocblas_stride stride_a,
-                                const TiB*     dB_array,
-                                rocblas_int    ldb,
-                                rocblas_stride stride_b,
-                                const Tacc     beta,
-                                const To*      dC_array,
-                                rocblas_int    ldc,
-                                rocblas_stride stride_c,
-                                To*            dD_array,
-                                rocblas_int    ldd,
-                                rocblas_stride stride_d,
-                                rocblas_int    batch_count,
-                                uint32_t       seedA,
-                                uint32_t       seedB,
-                                uint32_t       seedC)
+    gemm_batched_general_kernel(rocblas_int              M,
+                                rocblas_int              N,
+                                rocblas_int              K,
+                                const Tacc               alpha,
+                                const TiA*               dA_array, // NOTE: may work only for
+                                                                   // non-batch
+                                rocblas_int              lda,
+                                rocblas_stride           stride_a,
+                                const TiB*               dB_array,
+                                rocblas_int              ldb,
+                                rocblas_stride           stride_b,
+                                const Tacc               beta,
+                                const To*                dC_array,
+                                rocblas_int              ldc,
+                                rocblas_stride           stride_c,
+                                To*                      dD_array,
+                                rocblas_int              ldd,
+                                rocblas_stride           stride_d,
+                                rocblas_int              batch_count,
+                                uint32_t                 seedA,
+                                uint32_t                 seedB,
+                                uint32_t                 seedC,
+                                rocblas_gemm_ex3_scaling scaling)
 {
     int thx  = threadIdx.x; // thread's m position in C
     int thy  = threadIdx.y; // thread's n position in C
@@ -279,36 +353,27 @@ ROCBLAS_KERNEL(DIM_M* DIM_N)
                 int j = n + kk + a_j_offset;
                 if(i < M && j < K)
                 {
-                    // operator overloading from Ti to TcA
+                    // operator overloading from Ti to TcA, i is the row of op(A)
                     if(TRANS_A == 'N')
                     {
-                        int      gid = i + j * lda;
-                        uint32_t rng = 0;
-                        if(stochastic_rounding)
-                            rng = prand_generator<TiA>(gid, seedA, dA[i + j * size_t(lda)]);
-
-                        sA[n + thyA][m + thxA] = explicit_downcast<TcA, TiA, stochastic_rounding>(
-                            dA[i + j * size_t(lda)], rng);
+                        int gid = i + j * lda;
+                        sA[n + thyA][m + thxA]
+                            = gemm_ex3_load_element<TcA, TiA, stochastic_rounding>(
+                                dA[i + j * size_t(lda)], gid, seedA, scaling.a(i));
                     }
                     else if(TRANS_A == 'T')
                     {
-                        int      gid = i * lda + j;
-                        uint32_t rng = 0;
-                        if(stochastic_rounding)
-                            rng = prand_generator<TiA>(gid, seedA, dA[i * size_t(lda) + j]);
-
-                        sA[n + thyA][m + thxA] = explicit_downcast<TcA, TiA, stochastic_rounding>(
-                            dA[i * size_t(lda) + j], rng);
+                        int gid = i * lda + j;
+                        sA[n + thyA][m + thxA]
+                            = gemm_ex3_load_element<TcA, TiA, stochastic_rounding>(
+                                dA[i * size_t(lda) + j], gid, seedA, scaling.a(i));
                     }
                     else if(TRANS_A == 'C')
                     {
-                        int      gid = i * lda + j;
-                        uint32_t rng = 0;
-                        if(stochastic_rounding)
-                            rng = prand_generator<TiA>(gid, seedA, conj(dA[i * size_t(lda) + j]));
-
-                        sA[n + thyA][m + thxA] = explicit_downcast<TcA, TiA, stochastic_rounding>(
-                            conj(dA[i * size_t(lda) + j]), rng);
+                        int gid = i * lda + j;
+                        sA[n + thyA][m + thxA]
+                            = gemm_ex3_load_element<TcA, TiA, stochastic_rounding>(
+                                conj(dA[i * size_t(lda) + j]), gid, seedA, scaling.a(i));
                     }
                 }
                 else
@@ -325,37 +390,29 @@ ROCBLAS_KERNEL(DIM_M* DIM_N)
                 int i = m + kk + b_i_offset;
                 int j = n + b_j_offset;
 
+                // j is the column of op(B)
                 if(i < K && j < N)
                 {
                     if(TRANS_B == 'N')
                     {
-                        int      gid = i + j * ldb;
-                        uint32_t rng = 0;
-                        if(stochastic_rounding)
-                            rng = prand_generator<TiB>(gid, seedB, dB[i + j * size_t(ldb)]);
-
-                        sB[n + thyB][m + thxB] = explicit_downcast<TcB, TiB, stochastic_rounding>(
-                            dB[i + j * size_t(ldb)], rng);
+                        int gid = i + j * ldb;
+                        sB[n + thyB][m + thxB]
+                            = gemm_ex3_load_element<TcB, TiB, stochastic_rounding>(
+                                dB[i + j * size_t(ldb)], gid, seedB, scaling.b(j));
                     }
                     else if(TRANS_B == 'T')
                     {
-                        int      gid = i * ldb + j;
-                        uint32_t rng = 0;
-                        if(stochastic_rounding)
-                            rng = prand_generator<TiB>(gid, seedB, dB[i * size_t(ldb) + j]);
-
-                        sB[n + thyB][m + thxB] = explicit_downcast<TcB, TiB, stochastic_rounding>(
-                            dB[i * size_t(ldb) + j], rng);
+                        int gid = i * ldb + j;
+                        sB[n + thyB][m + thxB]
+                            = gemm_ex3_load_element<TcB, TiB, stochastic_rounding>(
+                                dB[i * size_t(ldb) + j], gid, seedB, scaling.b(j));
                     }
                     else if(TRANS_B == 'C')
                     {
-                        int      gid = i * ldb + j;
-                        uint32_t rng = 0;
-                        if(stochastic_rounding)
-                            rng = prand_generator<TiB>(gid, seedB, conj(dB[i * size_t(ldb) + j]));
-
-                        sB[n + thyB][m + thxB] = explicit_downcast<TcB, TiB, stochastic_rounding>(
-                            conj(dB[i * size_t(ldb) + j]), rng);
+                        int gid = i * ldb + j;
+                        sB[n + thyB][m + thxB]
+                            = gemm_ex3_load_element<TcB, TiB, stochastic_rounding>(
+                                conj(dB[i * size_t(ldb) + j]), gid, seedB, scaling.b(j));
                     }
                 }
                 else
@@ -375,6 +432,9 @@ ROCBLAS_KERNEL(DIM_M* DIM_N)
         __syncthreads();
     }
 
+    const Tacc scale_d = scaling.scale_d ? *scaling.scale_d : Tacc(1);
+    Tacc       amax    = 0;
+
     for(int n = 0; n < BLK_N / DIM_N; ++n)
     {
         for(int m = 0; m < BLK_M / DIM_M; ++m)
@@ -383,34 +443,41 @@ ROCBLAS_KERNEL(DIM_M* DIM_N)
             int coord_dCn = bly * BLK_N + n * DIM_N + thy;
             if(coord_dCn < N && coord_dCm < M)
             {
-                if(BETA_EQ_ZERO)
-                {
-                    int      gid = coord_dCn * ldc + coord_dCm;
-                    uint32_t rng = 0;
-                    if(stochastic_rounding)
-                        rng = prand_generator<Tacc>(gid, seedC, alpha * rC[n][m]);
-
-                    dD[coord_dCn * ldc + coord_dCm]
-                        = explicit_downcast<To, Tacc, stochastic_rounding>(alpha * rC[n][m], rng);
-                }
-                else
-                {
-                    int      gid = coord_dCn * ldc + coord_dCm;
-                    uint32_t rng = 0;
-                    if(stochastic_rounding)
-                        rng = prand_generator<Tacc>(
-                            gid,
-                            seedC,
-                            alpha * rC[n][m] + beta * dC[coord_dCn * size_t(ldc) + coord_dCm]);
-
-                    dD[coord_dCn * ldc + coord_dCm]
-                        = explicit_downcast<To, Tacc, stochastic_rounding>(
-                            (alpha * rC[n][m] + beta * dC[coord_dCn * size_t(ldc) + coord_dCm]),
-                            rng);
-                }
+                Tacc result = alpha * rC[n][m];
+                if(scaling.scale_a_mode != rocblas_gemm_scale_mode_none
+                   || scaling.scale_b_mode != rocblas_gemm_scale_mode_none)
+                    result *= scaling.a(coord_dCm) * scaling.b(coord_dCn);
+                if(!BETA_EQ_ZERO)
+                    result += beta * dC[coord_dCn * size_t(ldc) + coord_dCm];
+
+                amax = gemm_ex3_amax(amax, Tacc(fabs(result)));
+                if(scaling.scale_d)
+                    result *= scale_d;
+
+                int      gid = coord_dCn * ldc + coord_dCm;
+                uint32_t rng = 0;
+                if(stochastic_rounding)
+                    rng = prand_generator<Tacc>(gid, seedC, result);
+
+                dD[coord_dCn * size_t(ldd) + coord_dCm]
+                    = explicit_downcast<To, Tacc, stochastic_rounding>(result, rng);
             }
         }
     }
+
+    // Non-negative floats order like their bit patterns, with NaN above inf, so the maximum is
+    // reduced with integer atomics, first within the block and then once per block into amax_d
+    if(scaling.amax_d)
+    {
+        __shared__ uint32_t block_amax;
+        if(idt == 0)
+            block_amax = 0;
+        __syncthreads();
+        atomicMax(&block_amax, __float_as_uint(amax));
+        __syncthreads();
+        if(idt == 0)
+            atomicMax((uint32_t*)scaling.amax_d, block_amax);
+    }
 }
 
 /***************************************************************************************/
@@ -503,33 +570,37 @@ template <bool BATCHED,
           typename TcA,
           typename TcB,
           typename Tacc>
-rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
-                                 rocblas_operation  trans_a,
-                                 rocblas_operation  trans_b,
-                                 rocblas_int        m,
-                                 rocblas_int        n,
-                                 rocblas_int        k,
-                                 const void*        alpha,
-                                 const void*        a,
-                                 rocblas_int        offsetAin,
-                                 rocblas_int        lda,
-                                 rocblas_stride     stride_a,
-                                 const void*        b,
-                                 rocblas_int        offsetBin,
-                                 rocblas_int        ldb,
-                                 rocblas_stride     stride_b,
-                                 const void*        beta,
-                                 const void*        c,
-                                 rocblas_int        offsetCin,
-                                 rocblas_int        ldc,
-                                 rocblas_stride     stride_c,
-                                 void*              d,
-                                 rocblas_int        offsetDin,
-                                 rocblas_int        ldd,
-                                 rocblas_stride     stride_d,
-                                 rocblas_int        batch_count,
-                                 rocblas_gemm_flags flags)
+rocblas_status gemm_ex3_fallback(rocblas_handle                  handle,
+                                 rocblas_operation               trans_a,
+                                 rocblas_operation               trans_b,
+                                 rocblas_int                     m,
+                                 rocblas_int                     n,
+                                 rocblas_int                     k,
+                                 const void*                     alpha,
+                                 const void*                     a,
+                                 rocblas_int                     offsetAin,
+                                 rocblas_int                     lda,
+                                 rocblas_stride                  stride_a,
+                                 const void*                     b,
+                                 rocblas_int                     offsetBin,
+                                 rocblas_int                     ldb,
+                                 rocblas_stride                  stride_b,
+                                 const void*                     beta,
+                                 const void*                     c,
+                                 rocblas_int                     offsetCin,
+                                 rocblas_int                     ldc,
+                                 rocblas_stride                  stride_c,
+                                 void*                           d,
+                                 rocblas_int                     offsetDin,
+                                 rocblas_int                     ldd,
+                                 rocblas_stride                  stride_d,
+                                 rocblas_int                     batch_count,
+                                 rocblas_gemm_flags              flags,
+                                 const rocblas_gemm_ex3_scaling& scaling)
 {
+    // the fallback kernel needs no workspace
+    RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
+
     float alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
         rocblas_copy_alpha_beta_to_host_if_on_device(handle, alpha, beta, alpha_h, beta_h, k));
@@ -575,6 +646,10 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
     dim3        dimBlock(dim_m, dim_n, 1);
     dim3        dimGrid(((m - 1) / blk_m) + 1, ((n - 1) / blk_n) + 1, batch_count);
 
+    // every block folds its max(|D|) into amax_d with an atomic
+    if(scaling.amax_d)
+        RETURN_IF_HIP_ERROR(hipMemsetAsync(scaling.amax_d, 0, sizeof(float), stream));
+
     if((*((Tacc*)beta)) == 0) // check the deref value of beta, not the ptr
     {
         // clang-format off
@@ -623,7 +698,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             ldd,
             stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
 
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
@@ -668,7 +743,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             ldd,
             stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
@@ -694,7 +769,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
 
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
@@ -717,7 +792,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
 
 
     }
@@ -744,7 +819,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -766,7 +841,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
@@ -792,7 +867,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -814,7 +889,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
 
     }
 
@@ -841,7 +916,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -863,7 +938,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
@@ -889,7 +964,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -911,7 +986,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
@@ -937,7 +1012,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // no SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -959,7 +1034,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -985,7 +1060,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1007,7 +1082,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -1033,7 +1108,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1055,7 +1130,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
         // clang-format on
     }
@@ -1094,7 +1169,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
                     ldd,
                     stride_d,
                     batch_count,
-                    seedA, seedB, seedC);
+                    seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1125,7 +1200,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
                     ldd,
                     stride_d,
                     batch_count,
-                    seedA, seedB, seedC);
+                    seedA, seedB, seedC, scaling);
     }
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_none == trans_b)
     {
@@ -1150,7 +1225,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1172,7 +1247,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_none == trans_a && rocblas_operation_transpose == trans_b)
@@ -1198,7 +1273,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1220,7 +1295,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
 
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_transpose == trans_b)
@@ -1246,7 +1321,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1268,7 +1343,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
 
     }
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -1294,7 +1369,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1316,7 +1391,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_none == trans_b)
     {
@@ -1341,7 +1416,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1363,7 +1438,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
     else if(rocblas_operation_conjugate_transpose == trans_a && rocblas_operation_transpose == trans_b)
     {
@@ -1388,7 +1463,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1410,7 +1485,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
     }
     else if(rocblas_operation_none == trans_a && rocblas_operation_conjugate_transpose == trans_b)
     {
@@ -1435,7 +1510,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1457,7 +1532,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
 
     }
     else if(rocblas_operation_transpose == trans_a && rocblas_operation_conjugate_transpose == trans_b)
@@ -1483,7 +1558,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
         else // non SR
             hipLaunchKernelGGL((gemm_batched_general_kernel
                                     <TiA,
@@ -1505,7 +1580,7 @@ rocblas_status gemm_ex3_fallback(rocblas_handle     handle,
             (To *) d,
             ldd, stride_d,
             batch_count,
-            seedA, seedB, seedC);
+            seedA, seedB, seedC, scaling);
 
     }
         // clang-format on
@@ -1522,32 +1597,33 @@ template <bool BATCHED,
           typename TcB,
           typename Tacc,
           typename To_expected = Tacc> // To_expected is type expected to return from Tensile kernel
-rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
-                                 rocblas_operation  trans_a,
-                                 rocblas_operation  trans_b,
-                                 rocblas_int        m,
-                                 rocblas_int        n,
-                                 rocblas_int        k,
-                                 const void*        alpha,
-                                 const void*        a,
-                                 rocblas_int        offsetAin,
-                                 rocblas_int        lda,
-                                 rocblas_stride     stride_a,
-                                 const void*        b,
-                                 rocblas_int        offsetBin,
-                                 rocblas_int        ldb,
-                                 rocblas_stride     stride_b,
-                                 const void*        beta,
-                                 const void*        c,
-                                 rocblas_int        offsetCin,
-                                 rocblas_int        ldc,
-                                 rocblas_stride     stride_c,
-                                 void*              d,
-                                 rocblas_int        offsetDin,
-                                 rocblas_int        ldd,
-                                 rocblas_stride     stride_d,
-                                 rocblas_int        batch_count,
-                                 rocblas_gemm_flags flags)
+rocblas_status gemm_ex3_quantize(rocblas_handle                  handle,
+                                 rocblas_operation               trans_a,
+                                 rocblas_operation               trans_b,
+                                 rocblas_int                     m,
+                                 rocblas_int                     n,
+                                 rocblas_int                     k,
+                                 const void*                     alpha,
+                                 const void*                     a,
+                                 rocblas_int                     offsetAin,
+                                 rocblas_int                     lda,
+                                 rocblas_stride                  stride_a,
+                                 const void*                     b,
+                                 rocblas_int                     offsetBin,
+                                 rocblas_int                     ldb,
+                                 rocblas_stride                  stride_b,
+                                 const void*                     beta,
+                                 const void*                     c,
+                                 rocblas_int                     offsetCin,
+                                 rocblas_int                     ldc,
+                                 rocblas_stride                  stride_c,
+                                 void*                           d,
+                                 rocblas_int                     offsetDin,
+                                 rocblas_int                     ldd,
+                                 rocblas_stride                  stride_d,
+                                 rocblas_int                     batch_count,
+                                 rocblas_gemm_flags              flags,
+                                 const rocblas_gemm_ex3_scaling& scaling)
 {
     float alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
@@ -1562,7 +1638,8 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
                     || (trans_a == rocblas_operation_none
                         && (m < 4 || (trans_b == rocblas_operation_transpose && n < 4)));
 
-    if(fallback)
+    // Tensile kernels have no scaling factors, the fallback kernel applies them while converting
+    if(fallback || scaling.enabled())
         return gemm_ex3_fallback<BATCHED, TiA, TiB, To, TcA, TcB, Tacc>(EX_TYPECASTING_PARM);
 
     bool stochastic_rounding = flags & rocblas_gemm_flags_stochastic_rounding;
@@ -1622,7 +1699,8 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
                                          stride_d,
                                          batch_count,
                                          rocblas_compute_type_f32,
-                                         flags);
+                                         flags,
+                                         rocblas_gemm_ex3_scaling{});
 
         rocblas_stop_device_memory_size_query(handle, &memsize);
         if(memsize)
@@ -2139,7 +2217,8 @@ rocblas_status gemm_ex3_quantize(rocblas_handle     handle,
                                            stride_d,
                                            batch_count,
                                            rocblas_compute_type_f32,
-                                           flags);
+                                           flags,
+                                           rocblas_gemm_ex3_scaling{});
 
 #if defined(SR_DEBUG)
     if(!To_is_final)
@@ -2238,32 +2317,33 @@ template <bool BATCHED,
           typename TcA,
           typename TcB,
           typename Tacc>
-rocblas_status gemm_ex3_typecasting_tensile(rocblas_handle    handle,
-                                           rocblas_operation trans_a,
-                                           rocblas_operation trans_b,
-                                           rocblas_int       m,
-                                           rocblas_int       n,
-                                           rocblas_int       k,
-                                           const void*       alpha,
-                                           const void*       a,
-                                           rocblas_int       offsetAin,
-                                           rocblas_int       lda,
-                                           rocblas_stride    stride_a,
-                                           const void*       b,
-                                           rocblas_int       offsetBin,
-                                           rocblas_int       ldb,
-                                           rocblas_stride    stride_b,
-                                           const void*       beta,
-                                           const void*       c,
-                                           rocblas_int       offsetCin,
-                                           rocblas_int       ldc,
-                                           rocblas_stride    stride_c,
-                                           void*             d,
-                                           rocblas_int       offsetDin,
-                                           rocblas_int       ldd,
-                                           rocblas_stride    stride_d,
-                                           rocblas_int       batch_count,
-                                           rocblas_gemm_flags flags)
+rocblas_status gemm_ex3_typecasting_tensile(rocblas_handle                  handle,
+                                            rocblas_operation               trans_a,
+                                            rocblas_operation               trans_b,
+                                            rocblas_int                     m,
+                                            rocblas_int                     n,
+                                            rocblas_int                     k,
+                                            const void*                     alpha,
+                                            const void*                     a,
+                                            rocblas_int                     offsetAin,
+                                            rocblas_int                     lda,
+                                            rocblas_stride                  stride_a,
+                                            const void*                     b,
+                                            rocblas_int                     offsetBin,
+                                            rocblas_int                     ldb,
+                                            rocblas_stride                  stride_b,
+                                            const void*                     beta,
+                                            const void*                     c,
+                                            rocblas_int                     offsetCin,
+                                            rocblas_int                     ldc,
+                                            rocblas_stride                  stride_c,
+                                            void*                           d,
+                                            rocblas_int                     offsetDin,
+                                            rocblas_int                     ldd,
+                                            rocblas_stride                  stride_d,
+                                            rocblas_int                     batch_count,
+                                            rocblas_gemm_flags              flags,
+                                            const rocblas_gemm_ex3_scaling& scaling)
 {
     Tacc alpha_h, beta_h;
     RETURN_IF_ROCBLAS_ERROR(
@@ -2276,7 +2356,7 @@ rocblas_status gemm_ex3_typecasting_tensile(rocblas_handle    handle,
     bool fallback = (trans_a == rocblas_operation_transpose && trans_b == rocblas_operation_transpose && n<4) ||
             (trans_a == rocblas_operation_none && (m<4 || (trans_b == rocblas_operation_transpose && n<4)));
 
-    if(fallback)
+    if(fallback || scaling.enabled())
         return gemm_ex3_fallback<BATCHED,
                                     TiA,
                                     TiB,
@@ -2390,37 +2470,38 @@ inline rocblas_status validateArgs(rocblas_handle      handle,
 }
 
 template <bool BATCHED>
-rocblas_status rocblas_gemm_ex3_template(rocblas_handle      handle,
-                                         rocblas_operation   trans_a,
-                                         rocblas_operation   trans_b,
-                                         rocblas_int         m,
-                                         rocblas_int         n,
-                                         rocblas_int         k,
-                                         const void*         alpha,
-                                         const void*         a,
-                                         rocblas_datatype    a_type,
-                                         rocblas_int         offsetAin,
-                                         rocblas_int         lda,
-                                         rocblas_stride      stride_a,
-                                         const void*         b,
-                                         rocblas_datatype    b_type,
-                                         rocblas_int         offsetBin,
-                                         rocblas_int         ldb,
-                                         rocblas_stride      stride_b,
-                                         const void*         beta,
-                                         const void*         c,
-                                         rocblas_datatype    c_type,
-                                         rocblas_int         offsetCin,
-                                         rocblas_int         ldc,
-                                         rocblas_stride      stride_c,
-                                         void*               d,
-                                         rocblas_datatype    d_type,
-                                         rocblas_int         offsetDin,
-                                         rocblas_int         ldd,
-                                         rocblas_stride      stride_d,
-                                         rocblas_int         batch_count,
-                                         rocblas_computetype compute_type,
-                                         uint32_t            flags)
+rocblas_status rocblas_gemm_ex3_template(rocblas_handle                  handle,
+                                         rocblas_operation               trans_a,
+                                         rocblas_operation               trans_b,
+                                         rocblas_int                     m,
+                                         rocblas_int                     n,
+                                         rocblas_int                     k,
+                                         const void*                     alpha,
+                                         const void*                     a,
+                                         rocblas_datatype                a_type,
+                                         rocblas_int                     offsetAin,
+                                         rocblas_int                     lda,
+                                         rocblas_stride                  stride_a,
+                                         const void*                     b,
+                                         rocblas_datatype                b_type,
+                                         rocblas_int                     offsetBin,
+                                         rocblas_int                     ldb,
+                                         rocblas_stride                  stride_b,
+                                         const void*                     beta,
+                                         const void*                     c,
+                                         rocblas_datatype                c_type,
+                                         rocblas_int                     offsetCin,
+                                         rocblas_int                     ldc,
+                                         rocblas_stride                  stride_c,
+                                         void*                           d,
+                                         rocblas_datatype                d_type,
+                                         rocblas_int                     offsetDin,
+                                         rocblas_int                     ldd,
+                                         rocblas_stride                  stride_d,
+                                         rocblas_int                     batch_count,
+                                         rocblas_computetype             compute_type,
+                                         uint32_t                        flags,
+                                         const rocblas_gemm_ex3_scaling& scaling)
 {
     // Note: k==0 is not an early exit, since C still needs to be multiplied by beta
     if(!m || !n || !batch_count)
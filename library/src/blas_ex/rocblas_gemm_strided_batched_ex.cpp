@@ -78,6 +78,30 @@ try
         handle, alpha, beta, alpha_h, beta_h, k, compute_type));
     auto saved_pointer_mode = handle->push_pointer_mode(rocblas_pointer_mode_host);
 
+    ROCBLAS_API_RANGE(handle,
+                      "rocblas_gemm_strided_batched_ex",
+                      trans_a,
+                      trans_b,
+                      m,
+                      n,
+                      k,
+                      a_type,
+                      lda,
+                      stride_a,
+                      b_type,
+                      ldb,
+                      stride_b,
+                      c_type,
+                      ldc,
+                      stride_c,
+                      d_type,
+                      ldd,
+                      stride_d,
+                      batch_count,
+                      compute_type,
+                      algo,
+                      solution_index);
+
     if(!handle->is_device_memory_size_query())
     {
         // Perform logging
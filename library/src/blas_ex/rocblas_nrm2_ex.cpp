@@ -56,6 +56,8 @@ namespace
             }
         }
 
+        ROCBLAS_API_RANGE(handle, "nrm2_ex", n, x_type, incx, result_type, execution_type);
+
         auto x_type_str      = rocblas_datatype_string(x_type);
         auto result_type_str = rocblas_datatype_string(result_type);
         auto ex_type_str     = rocblas_datatype_string(execution_type);
@@ -59,6 +59,16 @@ namespace
             }
         }
 
+        ROCBLAS_API_RANGE(handle,
+                          "nrm2_strided_batched_ex",
+                          n,
+                          x_type,
+                          incx,
+                          stride_x,
+                          result_type,
+                          batch_count,
+                          execution_type);
+
         auto x_type_str      = rocblas_datatype_string(x_type);
         auto result_type_str = rocblas_datatype_string(result_type);
         auto ex_type_str     = rocblas_datatype_string(execution_type);
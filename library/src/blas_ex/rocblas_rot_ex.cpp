@@ -48,6 +48,9 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(
+            handle, "rocblas_rot_ex", n, x_type, incx, y_type, incy, cs_type, execution_type);
+
         auto layer_mode  = handle->layer_mode;
         auto x_type_str  = rocblas_datatype_string(x_type);
         auto y_type_str  = rocblas_datatype_string(y_type);
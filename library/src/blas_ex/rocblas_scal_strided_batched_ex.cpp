@@ -45,6 +45,16 @@ namespace
 
         RETURN_ZERO_DEVICE_MEMORY_SIZE_IF_QUERIED(handle);
 
+        ROCBLAS_API_RANGE(handle,
+                          "rocblas_scal_strided_batched_ex",
+                          n,
+                          alpha_type,
+                          x_type,
+                          incx,
+                          stridex,
+                          batch_count,
+                          execution_type);
+
         auto layer_mode = handle->layer_mode;
         if(layer_mode
            & (rocblas_layer_mode_log_trace | rocblas_layer_mode_log_bench
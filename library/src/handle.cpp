@@ -22,6 +22,7 @@
 #include "handle.hpp"
 #include <cstdarg>
 #include <limits>
+#include <utility>
 #ifdef WIN32
 #include <windows.h>
 #endif
@@ -154,6 +155,10 @@ _rocblas_handle::_rocblas_handle()
     archMajor      = arch / 100; // this may need to switch to string handling in the future
     archMajorMinor = arch / 10;
 
+    if(hipDeviceGetAttribute(&cu_count, hipDeviceAttributeMultiprocessorCount, device)
+       != hipSuccess)
+        cu_count = 0;
+
     //ROCBLAS_STREAM_ORDER_ALLOC
     const char* stream_order_alloc_env = read_env("ROCBLAS_STREAM_ORDER_ALLOC");
 
@@ -200,14 +205,26 @@ _rocblas_handle::_rocblas_handle()
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
-        // The following allocation & free of device memory using hipMallocAsync/hipFreeAsync will allocate memory from
-        // the OS and release it to default memory pool. Further allocation of memory using hipMallocAsync
-        // will be from the memory pool and it will be faster.
-        THROW_IF_HIP_ERROR((hipMallocAsync)(&device_memory, device_memory_size, stream));
-
-        THROW_IF_HIP_ERROR((hipFreeAsync)(device_memory, stream));
-
-        device_memory = nullptr;
+        // Every device_malloc is served from a pool owned by this handle. Nothing is reserved up
+        // front; freed memory stays in the pool for reuse up to the release threshold, which
+        // defaults to the device memory size.
+        hipMemPoolProps props = {};
+        props.allocType       = hipMemAllocationTypePinned;
+        props.handleTypes     = hipMemHandleTypeNone;
+        props.location.type   = hipMemLocationTypeDevice;
+        props.location.id     = device;
+        THROW_IF_HIP_ERROR(hipMemPoolCreate(&mem_pool, &props));
+
+        uint64_t    release_threshold = device_memory_size;
+        const char* threshold_env     = read_env("ROCBLAS_STREAM_ORDER_ALLOC_RELEASE_THRESHOLD");
+        if(threshold_env)
+            release_threshold = strtoull(threshold_env, nullptr, 0);
+        THROW_IF_HIP_ERROR(
+            hipMemPoolSetAttribute(mem_pool, hipMemPoolAttrReleaseThreshold, &release_threshold));
+
+        // A user-managed size still gets a single slab, taken from the pool
+        if(device_memory_owner == rocblas_device_memory_ownership::user_managed)
+            THROW_IF_HIP_ERROR(stream_order_malloc(&device_memory, device_memory_size, stream));
 #else
         rocblas_cerr
             << "rocBLAS internal error: Stream order allocation is supported on ROCm 5.3 and above."
@@ -266,17 +283,19 @@ _rocblas_handle::~_rocblas_handle()
                              << std::endl;
                 rocblas_abort();
             };
-
-            hipMemPool_t mem_pool;
-            int          device;
-            hipGetDevice(&device);
-            hipDeviceGetDefaultMemPool(&mem_pool, device);
-
-            //Releases device memory back to OS
-            hipMemPoolTrimTo(mem_pool, 0);
 #endif
         }
     }
+
+#if HIP_VERSION >= 50300000
+    // Releases the pool memory back to OS, also when rocblas_set_workspace has made the device
+    // memory user-owned
+    if(mem_pool)
+    {
+        hipMemPoolTrimTo(mem_pool, 0);
+        hipMemPoolDestroy(mem_pool);
+    }
+#endif
 }
 
 /*******************************************************************************
@@ -437,7 +456,7 @@ try
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
     else
-        hipStatus = (hipMallocAsync)(&handle->device_memory, size, handle->stream);
+        hipStatus = handle->stream_order_malloc(&handle->device_memory, size, handle->stream);
 #endif
 
     if(hipStatus != hipSuccess)
@@ -460,6 +479,67 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * Set the release threshold of the handle's stream order allocation pool
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_device_memory_pool_release_threshold(rocblas_handle handle,
+                                                                           size_t         threshold)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!handle->mem_pool)
+        return rocblas_status_not_implemented;
+
+#if HIP_VERSION >= 50300000
+    uint64_t release_threshold = threshold;
+    RETURN_IF_HIP_ERROR(hipMemPoolSetAttribute(
+        handle->mem_pool, hipMemPoolAttrReleaseThreshold, &release_threshold));
+#endif
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * Get the statistics of the handle's stream order allocation pool
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_device_memory_pool_stats(rocblas_handle handle,
+                                                               size_t*        used_current,
+                                                               size_t*        used_high,
+                                                               size_t*        reserved_current,
+                                                               size_t*        reserved_high)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!used_current || !used_high || !reserved_current || !reserved_high)
+        return rocblas_status_invalid_pointer;
+    if(!handle->mem_pool)
+        return rocblas_status_not_implemented;
+
+#if HIP_VERSION >= 50300000
+    std::pair<hipMemPoolAttr, size_t*> stats[]
+        = {{hipMemPoolAttrUsedMemCurrent, used_current},
+           {hipMemPoolAttrUsedMemHigh, used_high},
+           {hipMemPoolAttrReservedMemCurrent, reserved_current},
+           {hipMemPoolAttrReservedMemHigh, reserved_high}};
+    for(auto& stat : stats)
+    {
+        uint64_t value;
+        RETURN_IF_HIP_ERROR(hipMemPoolGetAttribute(handle->mem_pool, stat.first, &value));
+        *stat.second = value;
+    }
+#endif
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * Set the device memory workspace
  ******************************************************************************/
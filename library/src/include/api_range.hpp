@@ -0,0 +1,135 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "rocblas_ostream.hpp"
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*******************************************************************************
+ * API ranges. When the library is built with BUILD_WITH_API_RANGES, each
+ * rocBLAS function opens a range with ROCBLAS_API_RANGE next to its log_trace,
+ * named after the function and carrying its sizes, modes and types. Ranges go
+ * to the sinks selected by the ROCBLAS_API_RANGES environment variable and to
+ * the callback registered with rocblas_set_api_range_callback. Otherwise
+ * ROCBLAS_API_RANGE compiles to nothing.
+ ******************************************************************************/
+
+// Range recorded in the per thread buffer
+struct rocblas_api_range_record
+{
+    std::string name;
+    std::string args;
+    double      begin_us; // steady clock
+    double      end_us;
+    int         depth; // number of enclosing ranges
+};
+
+// for internal use during testing and benchmarking, returns and clears the ranges recorded by the
+// calling thread. Empty if the library was built without API ranges.
+ROCBLAS_INTERNAL_EXPORT std::vector<rocblas_api_range_record> rocblas_internal_take_api_ranges();
+
+#ifdef ROCBLAS_API_RANGES
+
+// Bits of the ROCBLAS_API_RANGES environment variable
+enum rocblas_api_range_sink : uint32_t
+{
+    rocblas_api_range_sink_roctx    = 0x1, // roctx ranges, when built with roctx
+    rocblas_api_range_sink_buffer   = 0x2, // per thread buffer
+    rocblas_api_range_sink_callback = 0x4, // callback of the handle
+};
+
+// RAII range ending at the end of its scope
+class rocblas_api_range
+{
+    uint32_t                   m_sinks = 0;
+    const char*                m_name;
+    rocblas_api_range_callback m_callback  = nullptr;
+    void*                      m_user_data = nullptr;
+
+    // Sinks selected by the ROCBLAS_API_RANGES environment variable, read once
+    static uint32_t env_sinks();
+
+    void begin(const std::string& args);
+    void end();
+
+    // Pointers are not formatted, except for strings
+    template <typename T>
+    static void append(rocblas_internal_ostream& os, bool& first, const T& x)
+    {
+        if constexpr(!std::is_pointer<T>{} || std::is_same<std::decay_t<T>, const char*>{}
+                     || std::is_same<std::decay_t<T>, char*>{})
+        {
+            if(!first)
+                os << ", ";
+            os << x;
+            first = false;
+        }
+    }
+
+public:
+    template <typename... Ts>
+    rocblas_api_range(rocblas_handle handle, const char* name, const Ts&... xs)
+        : m_name(name)
+    {
+        if(!handle || handle->is_device_memory_size_query())
+            return;
+
+        m_sinks = env_sinks();
+        if(handle->api_range_callback)
+        {
+            m_sinks |= rocblas_api_range_sink_callback;
+            m_callback  = handle->api_range_callback;
+            m_user_data = handle->api_range_user_data;
+        }
+        if(!m_sinks)
+            return;
+
+        rocblas_internal_ostream os;
+        bool                     first = true;
+        (append(os, first, xs), ...);
+        begin(os.str());
+    }
+
+    ~rocblas_api_range()
+    {
+        if(m_sinks)
+            end();
+    }
+
+    rocblas_api_range(const rocblas_api_range&) = delete;
+    rocblas_api_range& operator=(const rocblas_api_range&) = delete;
+};
+
+// Opens a range, named by the first argument after handle_ and carrying the others, until the
+// end of the enclosing scope
+#define ROCBLAS_API_RANGE(handle_, ...) rocblas_api_range rocblas_api_range_(handle_, __VA_ARGS__)
+
+#else
+
+#define ROCBLAS_API_RANGE(...) ((void)0)
+
+#endif
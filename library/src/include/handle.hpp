@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "host_timers.hpp"
 #include "macros.hpp"
 #include "rocblas.h"
 #include "rocblas_ostream.hpp"
@@ -130,6 +131,7 @@ private:
             : device_id(device_id)
             , old_device_id(-1)
         {
+            ROCBLAS_HOST_TIMER(device_id);
             hipGetDevice(&old_device_id);
             if(device_id != old_device_id)
                 hipSetDevice(device_id);
@@ -233,6 +235,11 @@ public:
         return archMajorMinor;
     }
 
+    int getCUCount()
+    {
+        return cu_count;
+    }
+
     // hipEvent_t pointers (for internal use only)
     hipEvent_t startEvent = nullptr;
     hipEvent_t stopEvent  = nullptr;
@@ -246,6 +253,9 @@ public:
     // default atomics mode allows atomic operations
     rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
 
+    // default reproducibility mode lets reductions pick their summation order
+    rocblas_reproducibility_mode reproducibility_mode = rocblas_reproducibility_default;
+
     // Selects the benchmark library to be used for solution selection
     rocblas_performance_metric performance_metric = rocblas_default_performance_metric;
 
@@ -255,6 +265,40 @@ public:
     // default math_mode is default_math
     rocblas_math_mode math_mode = rocblas_default_math;
 
+    // rocblas_iterative_refinement_math parameters, a tolerance of 0 selects sqrt(k) * epsilon
+    double      refinement_tolerance      = 0;
+    rocblas_int refinement_max_iterations = 30;
+
+    // Diagonal block inverses of a triangular matrix registered with rocblas_set_trsm_invA.
+    // trsm calls on this handle whose A matches the recorded pointer and shape reuse invA
+    // instead of recomputing it.
+    struct trsm_invA_cache
+    {
+        const void*      A         = nullptr;
+        const void*      invA      = nullptr;
+        rocblas_int      invA_size = 0;
+        rocblas_int      k         = 0;
+        rocblas_int      lda       = 0;
+        rocblas_fill     uplo      = rocblas_fill_full;
+        rocblas_diagonal diag      = rocblas_diagonal_non_unit;
+        rocblas_datatype type      = rocblas_datatype_invalid;
+
+        bool matches(const void*      A_,
+                     rocblas_int      k_,
+                     rocblas_int      lda_,
+                     rocblas_fill     uplo_,
+                     rocblas_diagonal diag_,
+                     rocblas_datatype type_) const
+        {
+            return A && A == A_ && k == k_ && lda == lda_ && uplo == uplo_ && diag == diag_
+                   && type == type_;
+        }
+    } trsm_invA;
+
+    // callback receiving the API ranges of the handle, see rocblas_set_api_range_callback
+    rocblas_api_range_callback api_range_callback  = nullptr;
+    void*                      api_range_user_data = nullptr;
+
     // logging streams
     std::unique_ptr<rocblas_internal_ostream> log_trace_os;
     std::unique_ptr<rocblas_internal_ostream> log_bench_os;
@@ -272,6 +316,10 @@ public:
     friend bool(::rocblas_is_managing_device_memory)(_rocblas_handle*);
     friend bool(::rocblas_is_user_managing_device_memory)(_rocblas_handle*);
     friend rocblas_status(::rocblas_set_stream)(_rocblas_handle*, hipStream_t);
+    friend rocblas_status(::rocblas_set_device_memory_pool_release_threshold)(_rocblas_handle*,
+                                                                              size_t);
+    friend rocblas_status(::rocblas_get_device_memory_pool_stats)(
+        _rocblas_handle*, size_t*, size_t*, size_t*, size_t*);
 
     // C interfaces that interact with the solution selection process
     friend rocblas_status(::rocblas_set_solution_fitness_query)(_rocblas_handle*, double*);
@@ -369,6 +417,22 @@ private:
 
     bool stream_order_alloc = false;
 
+    // Per-handle pool serving every device_malloc request in stream order allocation mode
+    hipMemPool_t mem_pool = nullptr;
+
+    // Allocate from the handle's pool in stream order on the given stream
+    hipError_t stream_order_malloc(void** ptr, size_t size, hipStream_t stream_in_use)
+    {
+// hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
+// Support for default stream added in hip version 5.3.0
+#if HIP_VERSION >= 50300000
+        return mem_pool ? hipMallocFromPoolAsync(ptr, size, mem_pool, stream_in_use)
+                        : hipMallocAsync(ptr, size, stream_in_use);
+#else
+        return hipErrorNotSupported;
+#endif
+    }
+
     // Solution fitness query (used for internal testing)
     double* solution_fitness_query = nullptr;
 
@@ -388,6 +452,9 @@ private:
     int       archMajor;
     int       archMajorMinor;
 
+    // Number of compute units of the handle's device, queried at handle creation time.
+    int cu_count = 0;
+
     // Opaque smart allocator class to perform device memory allocations
     // clang-format off
     class [[nodiscard]] _device_malloc : public rocblas_device_malloc_base
@@ -408,6 +475,8 @@ private:
         template <typename... Ss>
         decltype(pointers) allocate_pointers(Ss... sizes)
         {
+            ROCBLAS_HOST_TIMER(device_malloc);
+
             // This creates a list of partial sums which are the offsets of each of the allocated
             // arrays. The sizes are rounded up to the next multiple of MIN_CHUNK_SIZE.
             // size contains the total of all sizes at the end of the calculation of offsets.
@@ -425,11 +494,11 @@ private:
                 if(!size)
                     return decltype(pointers)(sizeof...(sizes));
 
-                hipError_t hipStatus = hipMallocAsync(&dev_mem, size, stream_in_use);
+                hipError_t hipStatus = handle->stream_order_malloc(&dev_mem, size, stream_in_use);
                 if(hipStatus != hipSuccess)
                 {
                     success = false;
-                    rocblas_cerr << " rocBLAS internal error: hipMallocAsync() failed to allocate memory of size : " << size << std::endl;
+                    rocblas_cerr << " rocBLAS internal error: hipMallocFromPoolAsync() failed to allocate memory of size : " << size << std::endl;
                     return decltype(pointers)(sizeof...(sizes));
                 }
                 addr = static_cast<char*>(dev_mem);
@@ -480,16 +549,18 @@ private:
             , stream_in_use(handle->stream)
             , success(true)
         {
+            ROCBLAS_HOST_TIMER(device_malloc);
+
             if(handle->stream_order_alloc &&
                 handle->device_memory_owner == rocblas_device_memory_ownership::rocblas_managed)
             {
 // hipMallocAsync and hipFreeAsync are defined in hip version 5.2.0
 // Support for default stream added in hip version 5.3.0
 #if HIP_VERSION >= 50300000
-                bool status = hipMallocAsync(&dev_mem, size, stream_in_use) == hipSuccess ;
+                success = handle->stream_order_malloc(&dev_mem, size, stream_in_use) == hipSuccess ;
 
                 for(auto i= 0 ; i < count ; i++)
-                    pointers.push_back(status ? dev_mem : nullptr);
+                    pointers.push_back(success ? dev_mem : nullptr);
 #endif
             }
             else
@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstdint>
+
+#ifdef ROCBLAS_HOST_TIMERS
+#include <atomic>
+#include <chrono>
+#endif
+
+/*******************************************************************************
+ * Host-side phases of a rocBLAS call. The time spent in each is accumulated
+ * when the library is built with BUILD_WITH_HOST_TIMERS, and read back by
+ * rocblas-overhead-bench with rocblas_internal_get_host_timers().
+ ******************************************************************************/
+typedef enum rocblas_host_phase_
+{
+    rocblas_host_phase_arg_check,          // argument checks
+    rocblas_host_phase_logging,            // logging checks and logging
+    rocblas_host_phase_device_id,          // push_device_id
+    rocblas_host_phase_library_adapter,    // get_library_and_adapter
+    rocblas_host_phase_tensile_problem,    // ConstructTensileProblem
+    rocblas_host_phase_solution_selection, // findBestSolution
+    rocblas_host_phase_device_malloc,      // device_malloc
+    rocblas_host_phase_launch,             // kernel launches
+    rocblas_host_phase_count
+} rocblas_host_phase;
+
+inline const char* rocblas_host_phase_name(rocblas_host_phase phase)
+{
+    switch(phase)
+    {
+    case rocblas_host_phase_arg_check:
+        return "arg_check";
+    case rocblas_host_phase_logging:
+        return "logging";
+    case rocblas_host_phase_device_id:
+        return "device_id";
+    case rocblas_host_phase_library_adapter:
+        return "library_adapter";
+    case rocblas_host_phase_tensile_problem:
+        return "tensile_problem";
+    case rocblas_host_phase_solution_selection:
+        return "solution_selection";
+    case rocblas_host_phase_device_malloc:
+        return "device_malloc";
+    case rocblas_host_phase_launch:
+        return "launch";
+    case rocblas_host_phase_count:
+        break;
+    }
+    return "invalid";
+}
+
+// Time and number of entries of each phase since the last reset
+struct rocblas_host_timers
+{
+    double   us[rocblas_host_phase_count];
+    uint64_t count[rocblas_host_phase_count];
+};
+
+// for internal use during benchmarking, gets the host phase times. Returns false, with the times
+// zeroed, if the library was built without host timers.
+ROCBLAS_INTERNAL_EXPORT bool rocblas_internal_get_host_timers(rocblas_host_timers* timers);
+
+// for internal use during benchmarking, resets the host phase times
+ROCBLAS_INTERNAL_EXPORT void rocblas_internal_reset_host_timers();
+
+#ifdef ROCBLAS_HOST_TIMERS
+
+// Accumulated nanoseconds and entries of each phase, defined in rocblas_auxiliary.cpp
+extern std::atomic<uint64_t> rocblas_host_timer_ns[rocblas_host_phase_count];
+extern std::atomic<uint64_t> rocblas_host_timer_count[rocblas_host_phase_count];
+
+// RAII timer adding the time until stop() or the end of its scope to a phase
+// clang-format off
+class [[nodiscard]] rocblas_host_phase_timer
+{
+    rocblas_host_phase                    phase;
+    std::chrono::steady_clock::time_point start;
+    bool                                  running = true;
+
+public:
+    explicit rocblas_host_phase_timer(rocblas_host_phase phase)
+        : phase(phase)
+        , start(std::chrono::steady_clock::now())
+    {
+    }
+
+    void stop()
+    {
+        if(!running)
+            return;
+        running = false;
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start).count();
+        rocblas_host_timer_ns[phase].fetch_add(ns, std::memory_order_relaxed);
+        rocblas_host_timer_count[phase].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ~rocblas_host_phase_timer()
+    {
+        stop();
+    }
+
+    rocblas_host_phase_timer(const rocblas_host_phase_timer&) = delete;
+    rocblas_host_phase_timer& operator=(const rocblas_host_phase_timer&) = delete;
+};
+// clang-format on
+
+#define ROCBLAS_HOST_TIMER_CONCAT2(a_, b_) a_##b_
+#define ROCBLAS_HOST_TIMER_CONCAT(a_, b_) ROCBLAS_HOST_TIMER_CONCAT2(a_, b_)
+
+// Times the rest of the enclosing scope as phase rocblas_host_phase_<phase_>
+#define ROCBLAS_HOST_TIMER(phase_)                                                     \
+    rocblas_host_phase_timer ROCBLAS_HOST_TIMER_CONCAT(rocblas_host_timer_, __LINE__)( \
+        rocblas_host_phase_##phase_)
+
+// Times phase rocblas_host_phase_<phase_> from here to ROCBLAS_HOST_TIMER_END(phase_), so that
+// a phase can be timed without opening a scope for it
+#define ROCBLAS_HOST_TIMER_BEGIN(phase_)                                              \
+    rocblas_host_phase_timer rocblas_host_timer_##phase_(rocblas_host_phase_##phase_)
+#define ROCBLAS_HOST_TIMER_END(phase_) rocblas_host_timer_##phase_.stop()
+
+#else
+
+#define ROCBLAS_HOST_TIMER(phase_) ((void)0)
+#define ROCBLAS_HOST_TIMER_BEGIN(phase_) ((void)0)
+#define ROCBLAS_HOST_TIMER_END(phase_) ((void)0)
+
+#endif
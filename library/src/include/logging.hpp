@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "api_range.hpp"
 #include "handle.hpp"
 #include "rocblas_ostream.hpp"
 #include "tuple_helper.hpp"
@@ -179,7 +180,7 @@ void log_trace(rocblas_handle handle, Ts&&... xs)
 // log_bench will call log_arguments to log a string that
 // can be input to the executable rocblas-bench.
 template <typename... Ts>
-void log_bench(rocblas_handle handle, Ts&&... xs)
+void log_bench_atomics_mode(rocblas_handle handle, Ts&&... xs)
 {
     if(handle->atomics_mode == rocblas_atomics_not_allowed)
         log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)..., "--atomics_not_allowed");
@@ -187,6 +188,18 @@ void log_bench(rocblas_handle handle, Ts&&... xs)
         log_arguments(*handle->log_bench_os, " ", std::forward<Ts>(xs)...);
 }
 
+template <typename... Ts>
+void log_bench(rocblas_handle handle, Ts&&... xs)
+{
+    if(handle->reproducibility_mode != rocblas_reproducibility_default)
+        log_bench_atomics_mode(handle,
+                               std::forward<Ts>(xs)...,
+                               "--reproducibility_mode",
+                               int(handle->reproducibility_mode));
+    else
+        log_bench_atomics_mode(handle, std::forward<Ts>(xs)...);
+}
+
 /*************************************************
  * Trace log scalar values pointed to by pointer *
  *************************************************/
@@ -0,0 +1,60 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "rocblas.h"
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Random bits used to stochastically round element i of rocblas_convert_host. This is the
+// generator of the gemm_ex3 quantization kernels applied to the bits of the source element.
+template <typename T>
+inline uint32_t rocblas_convert_host_prand(size_t i, uint32_t seed, T val)
+{
+    typedef typename std::conditional<sizeof(T) == 2, uint16_t, uint32_t>::type IT;
+    static_assert(sizeof(T) == sizeof(IT), "prand is only defined for 16 and 32 bit sources");
+
+    IT x;
+    memcpy(&x, &val, sizeof(x));
+    uint32_t drop_bits = uint32_t(x) & 0xFFFFu;
+    if(sizeof(T) == 4)
+        drop_bits ^= uint32_t(x) >> 16;
+    drop_bits = ((drop_bits & 31) << 11) | (drop_bits >> 5);
+    drop_bits *= 0x7000149;
+    return drop_bits ^ 0x13371337 ^ (uint32_t(i) * 229791u) ^ seed;
+}
+
+// Scalar conversion of element i of rocblas_convert_host. The bulk conversion is bit exact with
+// this for every element.
+template <typename To, typename Ti, bool stochastic_rounding>
+inline To rocblas_convert_host_element(Ti x, size_t i, uint32_t seed)
+{
+    constexpr bool f8_out = std::is_same<To, rocblas_f8>{} || std::is_same<To, rocblas_bf8>{};
+    constexpr bool f8_in  = std::is_same<Ti, rocblas_f8>{} || std::is_same<Ti, rocblas_bf8>{};
+
+    uint32_t rng = 0;
+    if constexpr(stochastic_rounding && f8_out && !f8_in)
+        rng = rocblas_convert_host_prand(i, seed, x);
+    return explicit_downcast<To, Ti, stochastic_rounding>(x, rng);
+}
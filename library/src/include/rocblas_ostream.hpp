@@ -510,6 +510,14 @@ public:
         return os;
     }
 
+    // reproducibility mode output
+    friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream&    os,
+                                                rocblas_reproducibility_mode mode)
+    {
+        os.m_os << rocblas_reproducibility_mode_to_string(mode);
+        return os;
+    }
+
     // gemm flags output
     friend rocblas_internal_ostream& operator<<(rocblas_internal_ostream& os,
                                                 rocblas_gemm_flags        flags)
@@ -368,6 +368,18 @@ constexpr const char* rocblas_atomics_mode_to_string(rocblas_atomics_mode mode)
     return mode != rocblas_atomics_not_allowed ? "atomics_allowed" : "atomics_not_allowed";
 }
 
+// Convert reproducibility mode to string
+constexpr const char* rocblas_reproducibility_mode_to_string(rocblas_reproducibility_mode mode)
+{
+    switch(mode)
+    {
+    case rocblas_reproducibility_default:             return "reproducibility_default";
+    case rocblas_reproducibility_bitwise:             return "reproducibility_bitwise";
+    case rocblas_reproducibility_bitwise_compensated: return "reproducibility_bitwise_compensated";
+    }
+    return "invalid";
+}
+
 // Convert gemm flags to string
 constexpr const char* rocblas_gemm_flags_to_string(rocblas_gemm_flags type)
 {
@@ -589,6 +601,21 @@ __host__ __device__ inline void rocblas_set_max_value(rocblas_half& val)
     *((short*)(&val)) = 0x7c00;
 }
 
+/*******************************************************************************
+* \brief  returns lowest value for type
+********************************************************************************/
+
+template <typename T>
+__host__ __device__ inline void rocblas_set_lowest_value(T& val)
+{
+    val = std::numeric_limits<T>::lowest();
+}
+
+__host__ __device__ inline void rocblas_set_lowest_value(rocblas_half& val)
+{
+    *((short*)(&val)) = short(0xfc00);
+}
+
 /*******************************************************************************
 * \brief  returns true if arg is zero
 ********************************************************************************/
@@ -120,6 +120,51 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief get reproducibility mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_reproducibility_mode(rocblas_handle                handle,
+                                                           rocblas_reproducibility_mode* mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+    *mode = handle->reproducibility_mode;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_reproducibility_mode", *mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set reproducibility mode
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_reproducibility_mode(rocblas_handle               handle,
+                                                           rocblas_reproducibility_mode mode)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(mode != rocblas_reproducibility_default && mode != rocblas_reproducibility_bitwise
+       && mode != rocblas_reproducibility_bitwise_compensated)
+        return rocblas_status_invalid_value;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_reproducibility_mode", mode);
+    handle->reproducibility_mode = mode;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief get math mode
  ******************************************************************************/
@@ -158,6 +203,10 @@ try
     case rocblas_xf32_xdl_math_op:
         supported = rocblas_internal_tensile_supports_xdl_math_op(mode);
         break;
+    case rocblas_compensated_sum_math:
+    case rocblas_iterative_refinement_math:
+        supported = true;
+        break;
     default:
         supported = false;
         break;
@@ -182,6 +231,54 @@ catch(...)
     return exception_to_rocblas_status();
 }
 
+/*******************************************************************************
+ * ! \brief get iterative refinement parameters
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_get_iterative_refinement(rocblas_handle handle,
+                                                           double*        tolerance,
+                                                           rocblas_int*   max_iterations)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!tolerance || !max_iterations)
+        return rocblas_status_invalid_pointer;
+    *tolerance      = handle->refinement_tolerance;
+    *max_iterations = handle->refinement_max_iterations;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_get_iterative_refinement", *tolerance, *max_iterations);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+/*******************************************************************************
+ * ! \brief set iterative refinement parameters
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_set_iterative_refinement(rocblas_handle handle,
+                                                           double         tolerance,
+                                                           rocblas_int    max_iterations)
+try
+{
+    // if handle not valid
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->layer_mode & rocblas_layer_mode_log_trace)
+        log_trace(handle, "rocblas_set_iterative_refinement", tolerance, max_iterations);
+    if(!(tolerance >= 0) || max_iterations < 0)
+        return rocblas_status_invalid_value;
+    handle->refinement_tolerance      = tolerance;
+    handle->refinement_max_iterations = max_iterations;
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
 /*******************************************************************************
  * ! \brief create rocblas handle called before any rocblas library routines
  ******************************************************************************/
@@ -1263,3 +1360,41 @@ bool rocblas_internal_tensile_debug_skip_launch()
     }();
     return skip_launch;
 }
+
+/*******************************************************************************
+ * exported. Host phase times, accumulated when built with BUILD_WITH_HOST_TIMERS *
+ *******************************************************************************/
+#ifdef ROCBLAS_HOST_TIMERS
+std::atomic<uint64_t> rocblas_host_timer_ns[rocblas_host_phase_count];
+std::atomic<uint64_t> rocblas_host_timer_count[rocblas_host_phase_count];
+#endif
+
+bool rocblas_internal_get_host_timers(rocblas_host_timers* timers)
+{
+    for(int i = 0; i < rocblas_host_phase_count; ++i)
+    {
+#ifdef ROCBLAS_HOST_TIMERS
+        timers->us[i]    = rocblas_host_timer_ns[i].load(std::memory_order_relaxed) * 1e-3;
+        timers->count[i] = rocblas_host_timer_count[i].load(std::memory_order_relaxed);
+#else
+        timers->us[i]    = 0;
+        timers->count[i] = 0;
+#endif
+    }
+#ifdef ROCBLAS_HOST_TIMERS
+    return true;
+#else
+    return false;
+#endif
+}
+
+void rocblas_internal_reset_host_timers()
+{
+#ifdef ROCBLAS_HOST_TIMERS
+    for(int i = 0; i < rocblas_host_phase_count; ++i)
+    {
+        rocblas_host_timer_ns[i].store(0, std::memory_order_relaxed);
+        rocblas_host_timer_count[i].store(0, std::memory_order_relaxed);
+    }
+#endif
+}
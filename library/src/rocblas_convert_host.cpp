@@ -0,0 +1,516 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+#include "rocblas_convert_host.hpp"
+#include "rocblas-auxiliary.h"
+#include "utility.hpp"
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    // The conversion kernels work on the bits of several elements at a time, widened to 32 bit
+    // lanes. They are written with the GCC/Clang vector extension, which lowers to SSE/AVX on
+    // x86-64 and NEON on aarch64, and are branch free so every lane takes the same path. Vectors
+    // wider than the target registers get their compares split lane by lane, so the lane count
+    // follows the register width.
+#ifdef __AVX2__
+    constexpr size_t convert_lanes = 8;
+#else
+    constexpr size_t convert_lanes = 4;
+#endif
+
+    typedef uint32_t u32v __attribute__((vector_size(4 * convert_lanes)));
+    typedef int32_t  i32v __attribute__((vector_size(4 * convert_lanes)));
+    typedef float    f32v __attribute__((vector_size(4 * convert_lanes)));
+    typedef uint16_t u16v __attribute__((vector_size(2 * convert_lanes)));
+    typedef uint8_t  u8v __attribute__((vector_size(convert_lanes)));
+
+    // Arrays at least this long are split over several host threads
+    constexpr size_t convert_min_elements_per_thread = size_t(1) << 18;
+
+    template <typename T>
+    using convert_bits_t = std::conditional_t<
+        sizeof(T) == 4,
+        uint32_t,
+        std::conditional_t<sizeof(T) == 2, uint16_t, uint8_t>>;
+
+    template <typename T>
+    constexpr bool convert_is_f8 = std::is_same<T, rocblas_f8>{} || std::is_same<T, rocblas_bf8>{};
+
+    inline u32v convert_splat(uint32_t a)
+    {
+        return u32v{} + a;
+    }
+
+    inline u32v convert_select(i32v mask, u32v a, u32v b)
+    {
+        return (a & (u32v)mask) | (b & ~(u32v)mask);
+    }
+
+    inline i32v convert_select(i32v mask, i32v a, i32v b)
+    {
+        return (a & mask) | (b & ~mask);
+    }
+
+    inline i32v convert_max(i32v a, int32_t b)
+    {
+        return convert_select(a > b, a, i32v{} + b);
+    }
+
+    inline i32v convert_min(i32v a, int32_t b)
+    {
+        return convert_select(a < b, a, i32v{} + b);
+    }
+
+    // x << k and x >> k with a shift count per lane, for x below 2^24. x86-64 has no per lane
+    // shifts before AVX2, so they are done as exact float multiplies by powers of two.
+    inline f32v convert_exp2(i32v k)
+    {
+        return (f32v)((k + 127) << 23);
+    }
+
+    inline u32v convert_shl(u32v x, i32v k)
+    {
+        return (u32v)__builtin_convertvector(
+            __builtin_convertvector((i32v)x, f32v) * convert_exp2(k), i32v);
+    }
+
+    inline u32v convert_shr(u32v x, i32v k)
+    {
+        return convert_shl(x, -k);
+    }
+
+    template <typename B>
+    inline u32v convert_load(const B* x)
+    {
+        if constexpr(sizeof(B) == 4)
+        {
+            u32v v;
+            memcpy(&v, x, sizeof(v));
+            return v;
+        }
+        else if constexpr(sizeof(B) == 2)
+        {
+            u16v v;
+            memcpy(&v, x, sizeof(v));
+            return __builtin_convertvector(v, u32v);
+        }
+        else
+        {
+            u8v v;
+            memcpy(&v, x, sizeof(v));
+            return __builtin_convertvector(v, u32v);
+        }
+    }
+
+    template <typename B>
+    inline void convert_store(B* y, u32v v)
+    {
+        if constexpr(sizeof(B) == 4)
+        {
+            memcpy(y, &v, sizeof(v));
+        }
+        else if constexpr(sizeof(B) == 2)
+        {
+            u16v w = __builtin_convertvector(v, u16v);
+            memcpy(y, &w, sizeof(w));
+        }
+        else
+        {
+            u8v w = __builtin_convertvector(v, u8v);
+            memcpy(y, &w, sizeof(w));
+        }
+    }
+
+    // rocblas_convert_host_prand for the elements index, index + 1, ... with bits x
+    template <typename Ti>
+    inline u32v convert_prand(u32v x, size_t index, uint32_t seed)
+    {
+        u32v lane;
+        for(uint32_t i = 0; i < convert_lanes; i++)
+            lane[i] = i;
+
+        u32v drop_bits = x & 0xFFFFu;
+        if constexpr(sizeof(Ti) == 4)
+            drop_bits ^= x >> 16;
+        drop_bits = ((drop_bits & 31) << 11) | (drop_bits >> 5);
+        drop_bits *= 0x7000149u;
+        return drop_bits ^ 0x13371337u ^ ((lane + uint32_t(index)) * 229791u) ^ seed;
+    }
+
+    // Widen the bits of a 16 or 32 bit float to the bits of a float
+    template <typename Ti>
+    inline u32v convert_to_f32(u32v x)
+    {
+        if constexpr(std::is_same<Ti, float>{})
+        {
+            return x;
+        }
+        else if constexpr(std::is_same<Ti, rocblas_bfloat16>{})
+        {
+            return x << 16;
+        }
+        else
+        {
+            static_assert(std::is_same<Ti, rocblas_half>{}, "unsupported source type");
+
+            const u32v sign = (x & 0x8000u) << 16;
+            const u32v em   = x & 0x7FFFu;
+
+            const u32v normal = (em << 13) + ((127u - 15u) << 23);
+            // NaNs are quieted, as by the host conversion of _Float16 to float
+            const u32v inf_nan = (em << 13) | 0x7F800000u | ((u32v)(em > 0x7C00u) & 0x400000u);
+            // subnormal halves are exactly em * 2^-24 as floats
+            const f32v subnormal = __builtin_convertvector((i32v)em, f32v) * 0x1p-24f;
+
+            return sign
+                   | convert_select(em < 0x400u,
+                                    (u32v)subnormal,
+                                    convert_select(em >= 0x7C00u, inf_nan, normal));
+        }
+    }
+
+    // Round the bits of a float to half, round to nearest even
+    inline u32v convert_f32_to_f16(u32v x)
+    {
+        const u32v sign = x & 0x80000000u;
+        const u32v f    = x ^ sign;
+
+        // NaNs keep the upper bits of their payload and are quieted
+        const u32v inf_nan = convert_select(
+            f > 0x7F800000u, 0x7E00u | ((f >> 13) & 0x3FFu), convert_splat(0x7C00u));
+
+        // Results that are subnormal in half are rounded by adding 0.5f in float arithmetic
+        const u32v magic     = convert_splat(126u << 23);
+        const f32v rounded   = (f32v)f + (f32v)magic;
+        const u32v subnormal = (u32v)rounded - magic;
+
+        const u32v odd    = (f >> 13) & 1u;
+        const u32v normal = (f + ((uint32_t)(15 - 127) << 23) + 0xFFFu + odd) >> 13;
+
+        return (sign >> 16)
+               | convert_select(f >= (143u << 23),
+                                inf_nan,
+                                convert_select(f < (113u << 23), subnormal, normal));
+    }
+
+    // Round the bits of a float to bfloat16, as rocblas_bfloat16(float)
+    inline u32v convert_f32_to_bf16(u32v x)
+    {
+        const u32v rounded = x + 0x7FFFu + ((x >> 16) & 1u);
+        const u32v nan     = convert_select((x & 0xFFFFu) != 0u, x | 0x10000u, x);
+        return convert_select((~x & 0x7F800000u) != 0u, rounded, nan) >> 16;
+    }
+
+    // Round the bits of a float to an 8 bit float with wm mantissa and we exponent bits. This
+    // follows rocblas_hip_f8_impl::cast_to_f8 with negative_zero_nan lane by lane.
+    template <int wm, int we, bool clip, bool stochastic_rounding>
+    inline u32v convert_f32_to_f8(u32v x, u32v rng)
+    {
+        constexpr int32_t  f8_bias                  = 1 << (we - 1);
+        constexpr int32_t  f8_denormal_act_exponent = 1 - f8_bias;
+        constexpr int32_t  max_exp                  = (1 << we) - 1;
+        constexpr uint32_t drop_mask                = (1u << (23 - wm)) - 1;
+        constexpr uint32_t mantissa_mask            = (1u << wm) - 1;
+
+        const u32v sign     = x >> 31;
+        const i32v exponent = (i32v)((x >> 23) & 0xFFu);
+        const i32v denormal = exponent == 0;
+
+        u32v mantissa = (x & 0x7FFFFFu) | (~(u32v)denormal & (1u << 23));
+
+        // actual exponent of the float, and the right shift that aligns it with f8 denormals
+        const i32v act_exponent  = exponent - 127 - denormal;
+        const i32v exponent_diff = convert_max(f8_denormal_act_exponent - act_exponent, 0);
+
+        // shifts of 25 or more clear the 24 bit mantissa, so clamp them to the lane width
+        const i32v shift     = convert_min(exponent_diff, 31);
+        const i32v round_bit = shift + (23 - wm);
+
+        // the tie is judged before the shift drops the residual bits, there is none past bit 24
+        const i32v tie_bit  = convert_min(round_bit, 25);
+        const u32v low_mask = convert_shl(convert_splat(1u), tie_bit) - 1u;
+        const u32v half     = convert_shl(convert_splat(1u), tie_bit - 1);
+        const i32v midpoint = (round_bit <= 24) & ((mantissa & low_mask) == half);
+
+        mantissa = convert_shr(mantissa, shift);
+
+        const u32v implicit_one = (mantissa >> 23) & 1u;
+        i32v       f8_exponent  = convert_select(exponent_diff > 0,
+                                          (i32v)convert_splat(f8_denormal_act_exponent),
+                                          act_exponent)
+                           + (f8_bias - 1) + (i32v)implicit_one;
+
+        if constexpr(stochastic_rounding)
+        {
+            mantissa += rng & drop_mask;
+        }
+        else
+        {
+            const u32v odd = (mantissa >> (23 - wm)) & 1u;
+            mantissa += (mantissa - ((u32v)midpoint & (odd ^ 1u))) & drop_mask;
+        }
+
+        // a carry out of the mantissa promotes a denormal to normal, or bumps the exponent
+        const i32v f8_denormal = f8_exponent == 0;
+        const u32v carry       = (mantissa >> 24) & 1u;
+        f8_exponent            = convert_select(
+            f8_denormal, (i32v)((mantissa >> 23) & 1u), f8_exponent + (i32v)carry);
+        mantissa
+            = convert_select(f8_denormal | (carry == 0u), mantissa, mantissa >> 1) >> (23 - wm);
+
+        const i32v overflow = f8_exponent > max_exp;
+        const i32v zero     = (f8_exponent == 0) & (mantissa == 0u);
+
+        u32v result = (sign << 7) | ((u32v)f8_exponent << wm) | (mantissa & mantissa_mask);
+        if constexpr(clip)
+            result = convert_select(
+                overflow, (sign << 7) | (((uint32_t)max_exp << wm) | mantissa_mask), result);
+        else
+            result = convert_select(overflow, (sign << 7) + ((uint32_t)max_exp << wm), result);
+
+        // zeros, including results that round to zero, are unsigned, and Inf/NaN become NaN
+        result = convert_select(zero | (x == 0u), convert_splat(0), result);
+        return convert_select((x & 0x7F800000u) == 0x7F800000u, convert_splat(0x80), result);
+    }
+
+    // Round the bits of a float to To
+    template <typename To, bool stochastic_rounding>
+    inline u32v convert_from_f32(u32v x, u32v rng)
+    {
+        if constexpr(std::is_same<To, float>{})
+            return x;
+        else if constexpr(std::is_same<To, rocblas_half>{})
+            return convert_f32_to_f16(x);
+        else if constexpr(std::is_same<To, rocblas_bfloat16>{})
+            return convert_f32_to_bf16(x);
+#ifdef rocblas_F8_downcast_clipping
+        else if constexpr(std::is_same<To, rocblas_f8>{})
+            return convert_f32_to_f8<3, 4, true, stochastic_rounding>(x, rng);
+        else
+            return convert_f32_to_f8<2, 5, true, stochastic_rounding>(x, rng);
+#else
+        else if constexpr(std::is_same<To, rocblas_f8>{})
+            return convert_f32_to_f8<3, 4, false, stochastic_rounding>(x, rng);
+        else
+            return convert_f32_to_f8<2, 5, false, stochastic_rounding>(x, rng);
+#endif
+    }
+
+    // Converts lanes elements of x, which are elements index, index + 1, ... of the whole array
+    template <typename Ti, typename To, bool stochastic_rounding>
+    inline void convert_host_lanes(const convert_bits_t<Ti>* x,
+                                   convert_bits_t<To>*       y,
+                                   size_t                    index,
+                                   uint32_t                  seed)
+    {
+        const u32v xi = convert_load(x);
+        u32v       rng{};
+        if constexpr(stochastic_rounding && convert_is_f8<To>)
+            rng = convert_prand<Ti>(xi, index, seed);
+        convert_store(y, convert_from_f32<To, stochastic_rounding>(convert_to_f32<Ti>(xi), rng));
+    }
+
+    // 8 bit sources are decoded with a table built from the scalar conversion
+    template <typename Ti, typename To>
+    const convert_bits_t<To>* convert_host_table()
+    {
+        static const auto table = [] {
+            std::array<convert_bits_t<To>, 256> t;
+            for(uint32_t i = 0; i < 256; i++)
+            {
+                Ti x;
+                x.data = uint8_t(i);
+                To y   = rocblas_convert_host_element<To, Ti, false>(x, i, 0);
+                memcpy(&t[i], &y, sizeof(y));
+            }
+            return t;
+        }();
+        return table.data();
+    }
+
+    // Converts n elements starting at element index of the whole array
+    template <typename Ti, typename To, bool stochastic_rounding>
+    void convert_host_block(const Ti* x, To* y, size_t n, size_t index, uint32_t seed)
+    {
+        auto xb = reinterpret_cast<const convert_bits_t<Ti>*>(x);
+        auto yb = reinterpret_cast<convert_bits_t<To>*>(y);
+
+        if constexpr(convert_is_f8<Ti>)
+        {
+            const convert_bits_t<To>* table = convert_host_table<Ti, To>();
+            for(size_t i = 0; i < n; i++)
+                yb[i] = table[xb[i]];
+        }
+        else
+        {
+            size_t i = 0;
+            for(; i + convert_lanes <= n; i += convert_lanes)
+                convert_host_lanes<Ti, To, stochastic_rounding>(xb + i, yb + i, index + i, seed);
+
+            // the tail goes through the same lanes so it rounds identically
+            if(i < n)
+            {
+                convert_bits_t<Ti> xt[convert_lanes] = {};
+                convert_bits_t<To> yt[convert_lanes];
+                memcpy(xt, xb + i, (n - i) * sizeof(*xt));
+                convert_host_lanes<Ti, To, stochastic_rounding>(xt, yt, index + i, seed);
+                memcpy(yb + i, yt, (n - i) * sizeof(*yt));
+            }
+        }
+    }
+
+    // Splits large arrays over host threads. Chunks are a multiple of the lane count and each
+    // element rounds with its index in the whole array, so results do not depend on the split.
+    template <typename Ti, typename To, bool stochastic_rounding>
+    void convert_host_parallel(const Ti* x, To* y, size_t n, uint32_t seed)
+    {
+        size_t workers = std::min(size_t(std::max(1u, std::thread::hardware_concurrency())),
+                                  n / convert_min_elements_per_thread);
+        if(workers <= 1)
+            return convert_host_block<Ti, To, stochastic_rounding>(x, y, n, 0, seed);
+
+        size_t chunk = (n + workers - 1) / workers;
+        chunk        = (chunk + convert_lanes - 1) / convert_lanes * convert_lanes;
+
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        try
+        {
+            for(size_t begin = chunk; begin < n; begin += chunk)
+            {
+                size_t count = std::min(chunk, n - begin);
+                threads.emplace_back(convert_host_block<Ti, To, stochastic_rounding>,
+                                     x + begin,
+                                     y + begin,
+                                     count,
+                                     begin,
+                                     seed);
+            }
+        }
+        catch(...)
+        {
+            for(auto& t : threads)
+                t.join();
+            throw;
+        }
+
+        convert_host_block<Ti, To, stochastic_rounding>(x, y, chunk, 0, seed);
+        for(auto& t : threads)
+            t.join();
+    }
+
+    template <typename Ti, typename To>
+    rocblas_status convert_host_template(
+        size_t n, const void* x, void* y, bool stochastic_rounding, uint32_t seed)
+    {
+        // there is no defined rounding between the two 8 bit types
+        if constexpr(convert_is_f8<Ti> && convert_is_f8<To> && !std::is_same<Ti, To>{})
+        {
+            return rocblas_status_not_implemented;
+        }
+        else
+        {
+            auto xt = static_cast<const Ti*>(x);
+            auto yt = static_cast<To*>(y);
+
+            if constexpr(std::is_same<Ti, To>{})
+                memcpy(yt, xt, n * sizeof(Ti));
+            else if(stochastic_rounding && convert_is_f8<To>)
+                convert_host_parallel<Ti, To, true>(xt, yt, n, seed);
+            else
+                convert_host_parallel<Ti, To, false>(xt, yt, n, seed);
+
+            return rocblas_status_success;
+        }
+    }
+
+    template <typename Ti>
+    rocblas_status convert_host_to(size_t           n,
+                                   const void*      x,
+                                   void*            y,
+                                   rocblas_datatype y_type,
+                                   bool             stochastic_rounding,
+                                   uint32_t         seed)
+    {
+        switch(y_type)
+        {
+        case rocblas_datatype_f32_r:
+            return convert_host_template<Ti, float>(n, x, y, stochastic_rounding, seed);
+        case rocblas_datatype_f16_r:
+            return convert_host_template<Ti, rocblas_half>(n, x, y, stochastic_rounding, seed);
+        case rocblas_datatype_bf16_r:
+            return convert_host_template<Ti, rocblas_bfloat16>(n, x, y, stochastic_rounding, seed);
+        case rocblas_datatype_f8_r:
+            return convert_host_template<Ti, rocblas_f8>(n, x, y, stochastic_rounding, seed);
+        case rocblas_datatype_bf8_r:
+            return convert_host_template<Ti, rocblas_bf8>(n, x, y, stochastic_rounding, seed);
+        default:
+            return rocblas_status_not_implemented;
+        }
+    }
+} // namespace
+
+/*******************************************************************************
+ * ! \brief  converts n elements of x on the host to the datatype of y on the host
+ ******************************************************************************/
+extern "C" rocblas_status rocblas_convert_host(size_t                n,
+                                               const void*           x,
+                                               rocblas_datatype      x_type,
+                                               void*                 y,
+                                               rocblas_datatype      y_type,
+                                               rocblas_rounding_mode rounding,
+                                               uint32_t              seed)
+try
+{
+    if(rounding != rocblas_rounding_mode_nearest_even
+       && rounding != rocblas_rounding_mode_stochastic)
+        return rocblas_status_invalid_value;
+    if(!n)
+        return rocblas_status_success;
+    if(!x || !y)
+        return rocblas_status_invalid_pointer;
+
+    bool stochastic_rounding = rounding == rocblas_rounding_mode_stochastic;
+
+    switch(x_type)
+    {
+    case rocblas_datatype_f32_r:
+        return convert_host_to<float>(n, x, y, y_type, stochastic_rounding, seed);
+    case rocblas_datatype_f16_r:
+        return convert_host_to<rocblas_half>(n, x, y, y_type, stochastic_rounding, seed);
+    case rocblas_datatype_bf16_r:
+        return convert_host_to<rocblas_bfloat16>(n, x, y, y_type, stochastic_rounding, seed);
+    case rocblas_datatype_f8_r:
+        return convert_host_to<rocblas_f8>(n, x, y, y_type, stochastic_rounding, seed);
+    case rocblas_datatype_bf8_r:
+        return convert_host_to<rocblas_bf8>(n, x, y, y_type, stochastic_rounding, seed);
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
@@ -230,6 +230,8 @@ namespace
               typename TcB = TiA>
     auto ConstructTensileProblem(const RocblasContractionProblem<TiA, To, Tc, TiB, TcA, TcB>& prob)
     {
+        ROCBLAS_HOST_TIMER(tensile_problem);
+
         // Tensile DataTypes corresponding to rocBLAS data types
         static constexpr Tensile::DataType Tensile_TiA = tensile_datatype<TiA>;
         static constexpr Tensile::DataType Tensile_TiB = tensile_datatype<TiB>;
@@ -853,6 +855,8 @@ namespace
         int                               device     = -1)
     try
     {
+        ROCBLAS_HOST_TIMER(library_adapter);
+
         // TensileHost is initialized on the first call
         static TensileHost host;
 
@@ -980,6 +984,7 @@ rocblas_status
         }
         else
         {
+            ROCBLAS_HOST_TIMER(solution_selection);
             solution = library->findBestSolution(tensile_prob, *hardware, fitness_query);
         }
 
@@ -1023,6 +1028,7 @@ rocblas_status
                 {
                     if(!(prob.flags & rocblas_gemm_flags_check_solution_index))
                     {
+                        ROCBLAS_HOST_TIMER(launch);
                         adapter.launchKernels(
                             solution->solve(tensile_prob, GetTensileInputs(prob), *hardware),
                             handle->get_stream(),
@@ -50,6 +50,9 @@ def parse_args():
     parser.add_argument(       '--address-sanitizer', dest='address_sanitizer', required=False, default=False, action='store_true',
                         help='Build with address sanitizer enabled. (optional, default: False')
 
+    parser.add_argument(       '--api-ranges', dest='api_ranges', required=False, default=False, action='store_true',
+                        help='Build with API range instrumentation enabled, see ROCBLAS_API_RANGES. (optional, default: False)')
+
     parser.add_argument('-b', '--branch', dest='tensile_tag', type=str, required=False, default="",
                         help='Specify the Tensile repository branch or tag to use. (eg. develop, mybranch or <commit hash> )')
 
@@ -340,6 +343,9 @@ def config_cmd():
     if args.address_sanitizer:
         cmake_options.append(f"-DBUILD_ADDRESS_SANITIZER=ON")
 
+    if args.api_ranges:
+        cmake_options.append(f"-DBUILD_WITH_API_RANGES=ON")
+
     # clean
     delete_dir(build_path)
 
@@ -0,0 +1,308 @@
+#!/usr/bin/env python3
+
+"""Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+   ies of the Software, and to permit persons to whom the Software is furnished
+   to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+   PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+   CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+"""
+
+"""Compares two sets of rocblas-bench --output results, a baseline and a new run, case by case.
+
+A case is a function with its data types, arguments and batch count, and its samples are the
+records of the case, as written by rocblas-bench --samples. For each case the ratio of the new
+to the baseline median is reported, a ratio above one being slower for times and faster for
+rates. A case regresses when its slowdown exceeds the threshold, which is widened by the noise
+of the baseline samples, and, with enough samples, when it is also significant: the Mann-Whitney
+U test rejects equal distributions at --alpha and the bootstrap confidence interval of the ratio
+excludes one. Improvements are decided in the same way.
+
+Exit code: 0 no regression, 1 regressions (or missing cases with --fail-on-missing), 2 errors.
+"""
+
+import argparse
+import csv
+import json
+import math
+import random
+import sys
+from collections import defaultdict
+
+# fields identifying a case, in the order they are printed
+keyFields = ['function', 'a_type', 'compute_type', 'arguments', 'batch_count']
+
+# metrics, and whether higher values are better
+metrics = {'us': False, 'gflops': True, 'GBps': True}
+
+
+def readResults(filename):
+    """Records of a rocblas-bench --output file, JSON Lines or CSV"""
+    records = []
+    with open(filename) as f:
+        first = f.readline()
+        f.seek(0)
+        if first.lstrip().startswith('{'):
+            for lineNum, line in enumerate(f, 1):
+                if line.strip():
+                    try:
+                        records.append(json.loads(line))
+                    except json.JSONDecodeError as e:
+                        raise ValueError(f'{filename}:{lineNum}: {e}')
+        else:
+            records = list(csv.DictReader(f))
+    return records
+
+
+def caseKey(record):
+    args = record.get('arguments', '')
+    if isinstance(args, dict):
+        # same form as the CSV arguments column
+        args = ' '.join(f'{name}={value}' for name, value in args.items())
+    return tuple(str(args) if field == 'arguments' else str(record.get(field, ''))
+                 for field in keyFields)
+
+
+def groupSamples(records, metric):
+    """Samples of metric by case, skipping records where it is not measured"""
+    cases = defaultdict(list)
+    for record in records:
+        value = record.get(metric)
+        if value is None or value == '':
+            continue
+        cases[caseKey(record)].append(float(value))
+    return cases
+
+
+def median(values):
+    s = sorted(values)
+    n = len(s)
+    return s[n // 2] if n % 2 else 0.5 * (s[n // 2 - 1] + s[n // 2])
+
+
+def relativeNoise(values):
+    """Robust relative spread: scaled median absolute deviation over the median"""
+    if len(values) < 2:
+        return 0.0
+    m = median(values)
+    if m == 0:
+        return 0.0
+    mad = median([abs(v - m) for v in values])
+    return 1.4826 * mad / abs(m)
+
+
+def mannWhitneyP(x, y):
+    """Two sided p-value of the Mann-Whitney U test of samples x and y.
+
+    The exact distribution of U is used for small samples without ties, the normal
+    approximation with tie correction otherwise."""
+    n1, n2 = len(x), len(y)
+    combined = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+
+    # midranks of tied values
+    ranks = [0.0] * len(combined)
+    tieTerm = 0.0
+    i = 0
+    while i < len(combined):
+        j = i
+        while j + 1 < len(combined) and combined[j + 1][0] == combined[i][0]:
+            j += 1
+        for k in range(i, j + 1):
+            ranks[k] = 0.5 * (i + j) + 1
+        t = j - i + 1
+        tieTerm += t ** 3 - t
+        i = j + 1
+
+    r1 = sum(r for r, (_, group) in zip(ranks, combined) if group == 0)
+    u1 = r1 - n1 * (n1 + 1) / 2
+    u = min(u1, n1 * n2 - u1)
+
+    if tieTerm == 0 and n1 + n2 <= 40:
+        # counts[n][s]: number of subsets of n of the ranks 1..m summing, less the minimum, to s,
+        # built one rank at a time, giving the null distribution of U
+        counts = [[0] * (n1 * n2 + 1) for _ in range(n1 + 1)]
+        counts[0][0] = 1
+        for m in range(1, n1 + n2 + 1):
+            for n in range(min(m, n1), 0, -1):
+                # rank m as the n-th smallest chosen adds m - n to U
+                shift = m - n
+                if shift > n1 * n2:
+                    continue
+                row, prev = counts[n], counts[n - 1]
+                for s in range(n1 * n2, shift - 1, -1):
+                    row[s] += prev[s - shift]
+        total = math.comb(n1 + n2, n1)
+        tail = sum(counts[n1][:int(u) + 1])
+        return min(1.0, 2 * tail / total)
+
+    mean = n1 * n2 / 2
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - tieTerm / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+    z = (abs(u - mean) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0) / math.sqrt(2)))
+
+
+def bootstrapRatioCI(base, new, resamples, confidence, rng):
+    """Percentile bootstrap confidence interval of median(new) / median(base)"""
+    ratios = []
+    for _ in range(resamples):
+        b = median(rng.choices(base, k=len(base)))
+        n = median(rng.choices(new, k=len(new)))
+        if b > 0:
+            ratios.append(n / b)
+    if not ratios:
+        return (math.nan, math.nan)
+    ratios.sort()
+    lo = ratios[int((1 - confidence) / 2 * (len(ratios) - 1))]
+    hi = ratios[int((1 + confidence) / 2 * (len(ratios) - 1))]
+    return (lo, hi)
+
+
+def compareCase(base, new, higherIsBetter, args, rng):
+    baseMedian = median(base)
+    newMedian = median(new)
+    ratio = newMedian / baseMedian if baseMedian > 0 else math.nan
+
+    # slowdown > 1 is worse whatever the metric
+    slowdown = 1 / ratio if higherIsBetter else ratio
+
+    # noise widens the threshold so that cases varying more than it do not flag
+    noise = max(relativeNoise(base), relativeNoise(new))
+    threshold = max(args.threshold, args.noise_factor * noise)
+
+    statistics = len(base) >= args.min_samples and len(new) >= args.min_samples
+    p = mannWhitneyP(base, new) if statistics else math.nan
+    ci = (bootstrapRatioCI(base, new, args.resamples, 1 - args.alpha, rng)
+          if statistics else (math.nan, math.nan))
+    if higherIsBetter and statistics:
+        ci = (1 / ci[1], 1 / ci[0])
+
+    status = 'unchanged'
+    if math.isnan(slowdown):
+        status = 'invalid'
+    elif slowdown > 1 + threshold:
+        if not statistics or (p < args.alpha and ci[0] > 1):
+            status = 'regression'
+    elif slowdown < 1 / (1 + threshold):
+        if not statistics or (p < args.alpha and ci[1] < 1):
+            status = 'improvement'
+
+    return {'base_median': baseMedian, 'new_median': newMedian, 'base_samples': len(base),
+            'new_samples': len(new), 'slowdown': slowdown, 'threshold': threshold,
+            'p_value': p, 'ci_low': ci[0], 'ci_high': ci[1], 'status': status}
+
+
+def formatNumber(value, fmt):
+    return '-' if value is None or (isinstance(value, float) and math.isnan(value)) else fmt.format(value)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare rocblas-bench --output results of a new run against a baseline')
+    parser.add_argument('baseline', help='baseline results, JSON Lines or CSV')
+    parser.add_argument('new', help='new results, JSON Lines or CSV')
+    parser.add_argument('--metric', choices=sorted(metrics), default='us',
+                        help='metric compared (default us)')
+    parser.add_argument('--threshold', type=float, default=0.05,
+                        help='relative slowdown or speedup below which cases are unchanged (default 0.05)')
+    parser.add_argument('--noise-factor', type=float, default=3.0,
+                        help='multiple of the relative noise of the samples widening the threshold (default 3)')
+    parser.add_argument('--alpha', type=float, default=0.05,
+                        help='significance level of the test and confidence interval (default 0.05)')
+    parser.add_argument('--min-samples', type=int, default=3,
+                        help='samples per run needed for the statistical test; with fewer only the '
+                             'threshold applies (default 3)')
+    parser.add_argument('--resamples', type=int, default=2000,
+                        help='bootstrap resamples (default 2000)')
+    parser.add_argument('--seed', type=int, default=1, help='bootstrap random seed (default 1)')
+    parser.add_argument('--fail-on-missing', action='store_true',
+                        help='exit with 1 when baseline cases are missing from the new results')
+    parser.add_argument('--report', help='write the per case comparison to this CSV file')
+    parser.add_argument('--all', action='store_true', help='print unchanged cases too')
+    args = parser.parse_args()
+
+    try:
+        base = groupSamples(readResults(args.baseline), args.metric)
+        new = groupSamples(readResults(args.new), args.metric)
+    except (OSError, ValueError) as e:
+        print(f'error: {e}', file=sys.stderr)
+        return 2
+
+    if not base:
+        print(f'error: no {args.metric} results in {args.baseline}', file=sys.stderr)
+        return 2
+
+    rng = random.Random(args.seed)
+    higherIsBetter = metrics[args.metric]
+
+    results = []
+    for key in sorted(set(base) | set(new)):
+        if key not in new:
+            result = {'status': 'missing'}
+        elif key not in base:
+            result = {'status': 'new'}
+        else:
+            result = compareCase(base[key], new[key], higherIsBetter, args, rng)
+        result.update(zip(keyFields, key))
+        results.append(result)
+
+    # per case report
+    print(f'{"status":<12}{"slowdown":>10}{"threshold":>11}{"p":>9}{"CI":>18}  case')
+    for r in results:
+        if r['status'] == 'unchanged' and not args.all:
+            continue
+        ci = (f'[{formatNumber(r.get("ci_low"), "{:.3f}")}, {formatNumber(r.get("ci_high"), "{:.3f}")}]'
+              if 'ci_low' in r else '-')
+        print(f'{r["status"]:<12}{formatNumber(r.get("slowdown"), "{:.3f}"):>10}'
+              f'{formatNumber(r.get("threshold"), "{:.3f}"):>11}{formatNumber(r.get("p_value"), "{:.4f}"):>9}'
+              f'{ci:>18}  {" ".join(str(r[f]) for f in keyFields if r[f])}')
+
+    # per function summary, with the geometric mean slowdown of the compared cases
+    print()
+    print(f'{"function":<32}{"cases":>7}{"regress":>9}{"improve":>9}{"missing":>9}{"geomean":>9}{"worst":>8}')
+    summary = defaultdict(list)
+    for r in results:
+        summary[r['function']].append(r)
+    for function in sorted(summary):
+        rs = summary[function]
+        slowdowns = [r['slowdown'] for r in rs if 'slowdown' in r and r['slowdown'] > 0]
+        count = lambda status: sum(r['status'] == status for r in rs)
+        geomean = math.exp(sum(map(math.log, slowdowns)) / len(slowdowns)) if slowdowns else math.nan
+        worst = max(slowdowns) if slowdowns else math.nan
+        print(f'{function:<32}{len(rs):>7}{count("regression"):>9}{count("improvement"):>9}'
+              f'{count("missing"):>9}{formatNumber(geomean, "{:.3f}"):>9}{formatNumber(worst, "{:.3f}"):>8}')
+
+    if args.report:
+        columns = keyFields + ['status', 'base_median', 'new_median', 'base_samples', 'new_samples',
+                               'slowdown', 'threshold', 'p_value', 'ci_low', 'ci_high']
+        with open(args.report, 'w', newline='') as f:
+            writer = csv.DictWriter(f, fieldnames=columns, restval='')
+            writer.writeheader()
+            writer.writerows(results)
+
+    regressions = sum(r['status'] == 'regression' for r in results)
+    missing = sum(r['status'] == 'missing' for r in results)
+    print()
+    print(f'{regressions} regressions, {missing} missing cases of {len(base)} baseline cases')
+
+    if regressions or (missing and args.fail_on_missing):
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,328 @@
+#!/usr/bin/env python3
+
+"""Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+
+   Permission is hereby granted, free of charge, to any person obtaining a copy
+   of this software and associated documentation files (the "Software"), to deal
+   in the Software without restriction, including without limitation the rights
+   to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+   ies of the Software, and to permit persons to whom the Software is furnished
+   to do so, subject to the following conditions:
+
+   The above copyright notice and this permission notice shall be included in all
+   copies or substantial portions of the Software.
+
+   THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+   PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+   FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+   COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+   IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+   CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+"""
+
+"""Extracts a small representative workload from rocBLAS profile or bench logs.
+
+Profile logs (ROCBLAS_LOG_PROFILE_PATH) give each distinct call with its call_count, and bench
+logs (ROCBLAS_LOG_BENCH_PATH) give a rocblas-bench command line per call, identical lines being
+counted. Each call is weighted by its count and an estimated time: a launch overhead plus the
+larger of its flop count over --peak-gflops and its data size over --peak-gbps, with the flop
+counts of clients/include/flops.hpp.
+
+Calls with the same function, data types and non size arguments are clustered by their sizes M,
+N, K, KL, KU and batch_count: the heaviest call starts a cluster, and calls whose sizes are all
+within a factor of 2^--radius of its sizes join it. The heaviest clusters, until --coverage of
+the estimated time or --max-cases, are written as a YAML list runnable with
+rocblas-bench --yaml, each case being the call which started its cluster.
+"""
+
+import argparse
+import math
+import re
+import shlex
+import sys
+from collections import defaultdict
+from os import path
+
+import yaml
+
+# sizes compared when clustering
+sizeFields = ['M', 'N', 'K', 'KL', 'KU', 'batch_count']
+
+# arguments which follow the sizes of the representative call, and do not separate clusters
+followFields = ['lda', 'ldb', 'ldc', 'ldd', 'stride_a', 'stride_b', 'stride_c', 'stride_d',
+                'stride_x', 'stride_y']
+
+# rocblas-bench options of bench logs and their YAML argument names
+benchOptions = {'-f': 'function', '--function': 'function', '-r': 'precision',
+                '--precision': 'precision', '--transposeA': 'transA', '--transposeB': 'transB',
+                '-m': 'M', '--sizem': 'M', '-n': 'N', '--sizen': 'N', '-k': 'K', '--sizek': 'K'}
+
+# short precisions of rocblas-bench
+precisions = {'h': 'f16_r', 's': 'f32_r', 'd': 'f64_r', 'c': 'f32_c', 'z': 'f64_c'}
+
+typeSizes = {'f16_r': 2, 'bf16_r': 2, 'f32_r': 4, 'f64_r': 8, 'f32_c': 8, 'f64_c': 16,
+             'i8_r': 1, 'i32_r': 4, 'f8_r': 1, 'bf8_r': 1, 'f16_c': 4, 'bf16_c': 4}
+
+
+def readProfileLog(name, lines, calls):
+    """Calls of a profile log, - { rocblas_function: ..., call_count: ... } lines"""
+    for lineNum, line in enumerate(lines, 1):
+        line = line.strip()
+        if not line.startswith('- {'):
+            continue
+        try:
+            call = yaml.safe_load(line[2:])
+        except yaml.YAMLError as e:
+            raise ValueError(f'{name}:{lineNum}: {e}')
+        count = int(call.pop('call_count', 1))
+        addCall(calls, call, count)
+
+
+def readBenchLog(lines, calls):
+    """Calls of a bench log, rocblas-bench command lines"""
+    for line in lines:
+        words = shlex.split(line)
+        if not words or not words[0].endswith('rocblas-bench'):
+            continue
+        call = {}
+        i = 1
+        while i < len(words):
+            option = words[i]
+            value = None
+            if i + 1 < len(words) and not re.match(r'--?[a-zA-Z]', words[i + 1]):
+                value = words[i + 1]
+            if option.startswith('-'):
+                # switches without a value, like --outofplace, are true
+                name = benchOptions.get(option, option.lstrip('-'))
+                call[name] = value if value is not None else 'true'
+            i += 2 if value is not None else 1
+        if 'precision' in call:
+            precision = call.pop('precision')
+            precision = precisions.get(precision, precision)
+            for field in ('a_type', 'b_type', 'c_type', 'd_type', 'compute_type'):
+                call.setdefault(field, precision)
+        addCall(calls, call, 1)
+
+
+def addCall(calls, call, count):
+    """Counts a call, keeping the argument order of its first occurrence"""
+    call = {k: str(v) for k, v in call.items()}
+    key = tuple(sorted(call.items()))
+    if key in calls:
+        calls[key][1] += count
+    else:
+        calls[key] = [call, count]
+
+
+def number(call, field, default=0):
+    try:
+        return int(float(call.get(field, default)))
+    except ValueError:
+        return default
+
+
+def readFunctions(template):
+    """Functions of rocblas_template.yaml, mapping profile log names to functions and types"""
+    with open(template) as f:
+        text = re.sub(r'^include\s*:.*$', '', f.read(), flags=re.M)
+    with open(path.join(path.dirname(template), 'rocblas_common.yaml')) as f:
+        common = f.read()
+    return yaml.safe_load(common + '\n' + text.replace('---', '', 1)).get('Functions') or {}
+
+
+def functionAndType(call, functions):
+    """Generic function name and data type of a call"""
+    if 'rocblas_function' in call:
+        name = call['rocblas_function']
+        generic = functions.get(name, {})
+        return (generic.get('function', name.rpartition('rocblas_')[2]),
+                call.get('a_type', generic.get('a_type', 'f32_r')))
+    return call.get('function', ''), call.get('a_type', 'f32_r')
+
+
+def estimate(function, dtype, call):
+    """Estimated flops and bytes of one call, following clients/include/flops.hpp"""
+    base = re.sub(r'(_strided)?(_batched)?(_ex)?$', '', function)
+    base = re.sub(r'(_strided)?(_batched)?$', '', base)
+    m, n, k = number(call, 'M'), number(call, 'N'), number(call, 'K')
+    kl, ku = number(call, 'KL'), number(call, 'KU')
+    left = str(call.get('side', 'L')).upper().startswith('L')
+    complexScale = 4 if dtype.endswith('_c') else 1
+
+    if base in ('gemm', 'gemmt'):
+        flops, elements = 2 * m * n * k, m * k + k * n + 2 * m * n
+    elif base in ('symm', 'hemm'):
+        a = m if left else n
+        flops, elements = 2 * a * m * n, a * a / 2 + 3 * m * n
+    elif base in ('trsm', 'trmm'):
+        a = m if left else n
+        flops, elements = a * m * n, a * a / 2 + 2 * m * n
+    elif base in ('syrk', 'herk'):
+        flops, elements = n * (n + 1) * k, n * k + n * n
+    elif base in ('syr2k', 'her2k', 'syrkx', 'herkx'):
+        flops, elements = 2 * n * (n + 1) * k, 2 * n * k + n * n
+    elif base == 'trtri':
+        flops, elements = n * n * n / 3, n * n
+    elif base in ('geam', 'dgmm'):
+        flops, elements = 2 * m * n, 3 * m * n
+    elif base == 'gemv':
+        flops, elements = 2 * m * n, m * n + m + n
+    elif base == 'gbmv':
+        flops, elements = 2 * n * (kl + ku + 1), n * (kl + ku + 1) + m + n
+    elif base in ('ger', 'geru', 'gerc'):
+        flops, elements = 2 * m * n, 2 * m * n + m + n
+    elif base in ('symv', 'hemv', 'spmv', 'hpmv'):
+        flops, elements = 2 * n * n, n * n / 2 + 2 * n
+    elif base in ('sbmv', 'hbmv', 'tbmv', 'tbsv'):
+        flops, elements = 2 * n * (2 * k + 1), n * (k + 1) + 2 * n
+    elif base in ('trmv', 'trsv', 'tpmv', 'tpsv'):
+        flops, elements = n * n, n * n / 2 + 2 * n
+    elif base in ('syr', 'her', 'spr', 'hpr'):
+        flops, elements = n * n, n * n + n
+    elif base in ('syr2', 'her2', 'spr2', 'hpr2'):
+        flops, elements = 2 * n * n, n * n + 2 * n
+    elif base in ('axpy', 'dot', 'dotc', 'nrm2'):
+        flops, elements = 2 * n, 3 * n
+    elif base in ('scal', 'asum', 'amax', 'amin'):
+        flops, elements = n, 2 * n
+    elif base in ('rot', 'rotm'):
+        flops, elements = 6 * n, 4 * n
+    elif base in ('copy', 'swap'):
+        flops, elements = 0, 2 * n if base == 'copy' else 4 * n
+    else:
+        flops, elements = 0, max(m, n, k, 1) * max(min(m, n), 1)
+
+    batch = max(number(call, 'batch_count', 1), 1)
+    return flops * complexScale * batch, elements * typeSizes.get(dtype, 4) * batch
+
+
+def shapeDistance(a, b):
+    """Largest log2 ratio of the sizes of two calls"""
+    return max(abs(math.log2(a[i] + 1) - math.log2(b[i] + 1)) for i in range(len(a)))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Extract a representative rocblas-bench --yaml workload from profile or bench logs')
+    parser.add_argument('logs', nargs='+', help='profile or bench log files')
+    parser.add_argument('-o', '--output', required=True, help='output YAML file')
+    parser.add_argument('--coverage', type=float, default=0.95,
+                        help='fraction of the estimated time to cover (default 0.95)')
+    parser.add_argument('--max-cases', type=int, default=0,
+                        help='largest number of cases written, 0 for no limit (default 0)')
+    parser.add_argument('--radius', type=float, default=0.5,
+                        help='log2 size ratio within which calls join a cluster (default 0.5)')
+    parser.add_argument('--peak-gflops', type=float, default=20000,
+                        help='Gflops of the time estimate (default 20000)')
+    parser.add_argument('--peak-gbps', type=float, default=1500,
+                        help='GB/s of the time estimate (default 1500)')
+    parser.add_argument('--template',
+                        default=path.join(path.dirname(path.abspath(__file__)), '..', '..', 'clients',
+                                          'include', 'rocblas_template.yaml'),
+                        help='rocblas_template.yaml mapping the functions of profile logs')
+    parser.add_argument('--overhead-us', type=float, default=5,
+                        help='launch overhead of the time estimate in microseconds (default 5)')
+    args = parser.parse_args()
+
+    calls = {}
+    try:
+        functions = readFunctions(args.template)
+        for log in args.logs:
+            with open(log) as f:
+                text = f.read()
+            lines = text.splitlines()
+            if any(l.lstrip().startswith('- {') for l in lines):
+                readProfileLog(log, lines, calls)
+            else:
+                readBenchLog(lines, calls)
+    except (OSError, ValueError, yaml.YAMLError) as e:
+        print(f'error: {e}', file=sys.stderr)
+        return 2
+
+    if not calls:
+        print('error: no calls found in the logs', file=sys.stderr)
+        return 2
+
+    # group calls by function, types and non size arguments
+    groups = defaultdict(list)
+    totalTime = totalCalls = 0
+    for frozen, (call, count) in calls.items():
+        function, dtype = functionAndType(call, functions)
+        flops, size = estimate(function, dtype, call)
+        time = count * (args.overhead_us + max(flops / (args.peak_gflops * 1e3),
+                                               size / (args.peak_gbps * 1e3)))
+        key = tuple((k, v) for k, v in frozen if k not in sizeFields and k not in followFields)
+        shape = [number(call, f) for f in sizeFields]
+        groups[key].append({'call': call, 'count': count, 'time': time, 'shape': shape,
+                            'function': function})
+        totalTime += time
+        totalCalls += count
+
+    # greedy clustering from the heaviest call of each group
+    clusters = []
+    for members in groups.values():
+        members.sort(key=lambda c: c['time'], reverse=True)
+        groupClusters = []
+        for c in members:
+            nearest = min(groupClusters, key=lambda g: shapeDistance(g['shape'], c['shape']),
+                          default=None)
+            if nearest and shapeDistance(nearest['shape'], c['shape']) <= args.radius:
+                nearest['time'] += c['time']
+                nearest['count'] += c['count']
+                nearest['members'] += 1
+            else:
+                groupClusters.append({'call': c['call'], 'shape': c['shape'], 'time': c['time'],
+                                      'count': c['count'], 'members': 1,
+                                      'function': c['function']})
+        clusters += groupClusters
+
+    clusters.sort(key=lambda g: g['time'], reverse=True)
+    chosen = []
+    coveredTime = 0
+    for g in clusters:
+        if coveredTime >= args.coverage * totalTime or (args.max_cases and len(chosen) >= args.max_cases):
+            break
+        chosen.append(g)
+        coveredTime += g['time']
+
+    with open(args.output, 'w') as f:
+        f.write(f'# Representative workload of {", ".join(args.logs)}\n')
+        f.write(f'# {len(chosen)} cases of {len(clusters)} clusters of {len(calls)} distinct calls, '
+                f'covering {100 * coveredTime / totalTime:.1f}% of the estimated time\n')
+        f.write('# Run with: rocblas-bench --yaml ' + args.output + '\n')
+        for g in chosen:
+            entry = ', '.join(f'{k}: {formatValue(v)}' for k, v in g['call'].items())
+            f.write(f'- {{ {entry} }}  # {g["members"]} distinct calls, {g["count"]} calls, '
+                    f'{100 * g["time"] / totalTime:.2f}% of time\n')
+
+    # coverage statistics
+    print(f'{len(calls)} distinct calls, {totalCalls} calls, {len(clusters)} clusters')
+    print(f'{len(chosen)} cases written to {args.output}, covering '
+          f'{100 * coveredTime / totalTime:.1f}% of the estimated time and '
+          f'{100 * sum(g["count"] for g in chosen) / totalCalls:.1f}% of the calls')
+    print()
+    print(f'{"function":<32}{"clusters":>9}{"cases":>7}{"time %":>8}{"covered %":>11}')
+    byFunction = defaultdict(lambda: [0, 0, 0.0, 0.0])
+    for g in clusters:
+        stats = byFunction[g['function']]
+        stats[0] += 1
+        stats[2] += g['time']
+    for g in chosen:
+        stats = byFunction[g['function']]
+        stats[1] += 1
+        stats[3] += g['time']
+    for function, (n, cases, time, covered) in sorted(byFunction.items(), key=lambda x: -x[1][2]):
+        print(f'{function:<32}{n:>9}{cases:>7}{100 * time / totalTime:>8.2f}'
+              f'{100 * covered / time if time else 0:>11.1f}')
+    return 0
+
+
+def formatValue(value):
+    """YAML flow value of a logged value"""
+    if re.fullmatch(r'-?\d+(\.\d*)?([eE][-+]?\d+)?', value) or re.fullmatch(r'\w+', value):
+        return value
+    return "'" + value.replace("'", "''") + "'"
+
+
+if __name__ == '__main__':
+    sys.exit(main())